@@ -1,24 +1,52 @@
-/*!
- * @file: params-parser.h
- * @date: 2023-12-24
- * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
- * @brief: Declaration of parameters parser functions.
- */
-
-#ifndef PARAM_PARSER_H__
-#define PARAM_PARSER_H__
-
-#include "params-desc.h"
-
-/*!
- * @brief Parse the parameter passed to main function.
- * @param[in]   argc    Number of parameters including application name.
- * @param[in]   argv    Parameter of application (including application name).
- * @param[out]  params  Pointer on struct param to store application parameters.
- * @return 0 on success otherwise -1
- */
-int parse_application_parameters( int argc, \
-                                  char ** argv, \
-                                  struct params_t *params);
-
-#endif /* PARAM_PARSER_H__ */
+/*!
+ * @file: params-parser.h
+ * @date: 2023-12-24
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of parameters parser functions.
+ */
+
+#ifndef PARAM_PARSER_H__
+#define PARAM_PARSER_H__
+
+#include "params-desc.h"
+
+/*!
+ * @brief Parse the parameter passed to main function.
+ *
+ * Parameters are set in this order (last value wins): defaults, config file
+ * (-c/--config, accepted only on command line), then command line where each
+ * @file operand is replaced by content of response file at its position. Files stay mapped until
+ * release_application_parameters.
+ *
+ * @param[in]   argc    Number of parameters including application name.
+ * @param[in]   argv    Parameter of application (including application name).
+ * @param[out]  params  Pointer on struct param to store application parameters.
+ * @return 0 on success otherwise -1
+ */
+int parse_application_parameters( int argc, \
+                                  char ** argv, \
+                                  struct params_t *params);
+
+/*!
+ * @brief Parse parameters from an array of tokens (re-entrant: no global
+ *        state, tokens are not modified, no allocation).
+ * @param[in]   index       Index of g_parameters_description (built once with
+ *                          params_index_init).
+ * @param[in]   nb_tokens   Number of tokens.
+ * @param[in]   tokens      Tokens (without application name).
+ * @param[out]  params      Pointer on struct param to store parameters.
+ * @return 0 on success otherwise -1
+ */
+int parse_parameters_tokens( const params_index_t * index, \
+                             size_t nb_tokens, \
+                             const char * const * tokens, \
+                             struct params_t *params);
+
+/*!
+ * @brief Release files read by parse_application_parameters (string
+ *        parameters read from them are no longer valid).
+ * @return None.
+ */
+void release_application_parameters( void );
+
+#endif /* PARAM_PARSER_H__ */
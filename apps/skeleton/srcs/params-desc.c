@@ -1,88 +1,194 @@
-/*!
- * @file: params-desc.c
- * @date: 2024-01-01
- * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
- * @brief: Implementation of parameters descriptions.
- */
-#include <stdio.h>
-
-#include <lib-utils-tab.h>
-
-#include "params-desc.h"
-
-/*!
- * @brief Parameters description.
- */
-const struct parameter_description_t g_parameters_description[] =
-{
-    {
-        .type = BOOL_TYPE,
-        .offset = offsetof(struct params_t, display_help),
-        .size = sizeof(bool),
-        .arg_shortname = 'h',
-        .arg_longname = "help",
-        .help = "Display help."
-    },
-    {
-        .type = BOOL_TYPE,
-        .offset = offsetof(struct params_t, display_version),
-        .size = sizeof(bool),
-        .arg_shortname = 'v',
-        .arg_longname = "version",
-        .help = "Display version."
-    },
-    {
-        .type = SENTINEL_TYPE,
-        .offset = -1,
-        .size = -1,
-        .arg_shortname = -1,
-        .help = NULL,
-    },
-};
-
-const char * g_application_description = "Skeleton test application.";
-
-/*!
- * @brief Default parameters values.
- */
-struct params_t g_default_parameters =
-{
-    .display_help = false,
-    .display_version = false,
-} ;
-
-uint32_t get_number_parameters( void )
-{
-    return ( sizeof( g_parameters_description ) > 0 ) ? \
-            GET_NB_ELEMENTS( g_parameters_description ) : 0;
-}
-
-void display_parameters_help( const char * application_name )
-{
-    uint32_t nb_parameters;
-    uint32_t i;
-
-    nb_parameters = get_number_parameters() - 1;
-    
-    printf("%s - %s\r\n", application_name, g_application_description );
-
-    printf("Usage : %s [", application_name );
-    for(i=0; i<nb_parameters; i++)
-    {
-        printf( "%c", g_parameters_description[i].arg_shortname );
-
-        if( BOOL_TYPE != g_parameters_description[i].type )
-        {
-            printf(":");
-        }
-    }
-    printf("]\r\n");
-
-    for(i=0; i<nb_parameters; i++)
-    {
-        printf(" - %c/%s\t%s\r\n", \
-                g_parameters_description[i].arg_shortname, \
-                g_parameters_description[i].arg_longname, \
-                g_parameters_description[i].help );
-    }
-}
+/*!
+ * @file: params-desc.c
+ * @date: 2024-01-01
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of parameters descriptions.
+ */
+#include <stddef.h>
+#include <stdio.h>
+
+#include <lib-utils-tab.h>
+
+#include "params-desc.h"
+
+/*!
+ * @brief Build description of a boolean parameter.
+ */
+#define PARAM_FLAG_DESCRIPTION( field, shortname, longname, help_str ) \
+    PARAM_VALUE_DESCRIPTION( BOOL_TYPE, field, shortname, longname, help_str )
+
+/*!
+ * @brief Build description of a parameter with value.
+ */
+#define PARAM_VALUE_DESCRIPTION( param_type, field, shortname, longname, help_str ) \
+    { \
+        .type = param_type, \
+        .offset = offsetof( struct params_t, field ), \
+        .size = sizeof( g_default_parameters.field ), \
+        .arg_shortname = shortname, \
+        .arg_longname = longname, \
+        .help = help_str \
+    },
+
+/*!
+ * @brief Build index constant of a boolean parameter.
+ */
+#define PARAM_FLAG_INDEX( field, shortname, longname, help_str ) \
+    PARAM_INDEX_##field,
+
+/*!
+ * @brief Build index constant of a parameter with value.
+ */
+#define PARAM_VALUE_INDEX( param_type, field, shortname, longname, help_str ) \
+    PARAM_INDEX_##field,
+
+/*!
+ * @brief Build short name table entry of a boolean parameter.
+ */
+#define PARAM_FLAG_SHORTNAME( field, shortname, longname, help_str ) \
+    [(uint8_t)( shortname )] = PARAM_INDEX_##field + 1,
+
+/*!
+ * @brief Build short name table entry of a parameter with value.
+ */
+#define PARAM_VALUE_SHORTNAME( param_type, field, shortname, longname, help_str ) \
+    [(uint8_t)( shortname )] = PARAM_INDEX_##field + 1,
+
+/*!
+ * @brief Check at compile time that a boolean parameter has a short name.
+ */
+#define PARAM_FLAG_CHECK( field, shortname, longname, help_str ) \
+    _Static_assert( 0 != ( shortname ), \
+                    "Parameter " #field " requires a short name" );
+
+/*!
+ * @brief Check at compile time that a parameter with value has a short name.
+ */
+#define PARAM_VALUE_CHECK( param_type, field, shortname, longname, help_str ) \
+    PARAM_FLAG_CHECK( field, shortname, longname, help_str )
+
+/*!
+ * @brief Build switch case of a boolean parameter short name.
+ */
+#define PARAM_FLAG_CASE( field, shortname, longname, help_str ) \
+    case shortname: \
+        break;
+
+/*!
+ * @brief Build switch case of a parameter with value short name.
+ */
+#define PARAM_VALUE_CASE( param_type, field, shortname, longname, help_str ) \
+    PARAM_FLAG_CASE( field, shortname, longname, help_str )
+
+/*
+ * Short names are required: a 0 short name would end getopt optstring, be
+ * returned by getopt_long for every long only option and collide in
+ * g_parameters_by_shortname.
+ */
+PARAMETERS_LIST( PARAM_FLAG_CHECK, PARAM_VALUE_CHECK )
+
+/*!
+ * @brief Check at compile time that short names are unique: duplicated case
+ *        values are an error (duplicated designated initializers of
+ *        g_parameters_by_shortname are silently accepted). Never called.
+ * @param shortname Short name.
+ * @return None.
+ */
+static inline void check_unique_shortnames( char shortname )
+{
+    switch ( shortname )
+    {
+        PARAMETERS_LIST( PARAM_FLAG_CASE, PARAM_VALUE_CASE )
+        default:
+            break;
+    }
+}
+
+/*!
+ * @brief Index of parameters in g_parameters_description.
+ */
+enum
+{
+    PARAMETERS_LIST( PARAM_FLAG_INDEX, PARAM_VALUE_INDEX )
+    NB_PARAMETERS
+};
+
+/*!
+ * @brief Parameters description.
+ */
+const struct parameter_description_t g_parameters_description[] =
+{
+    PARAMETERS_LIST( PARAM_FLAG_DESCRIPTION, PARAM_VALUE_DESCRIPTION )
+    {
+        .type = SENTINEL_TYPE,
+        .offset = -1,
+        .size = -1,
+        .arg_shortname = -1,
+        .help = NULL,
+    },
+};
+
+/*!
+ * @brief Index plus one of parameters in g_parameters_description by short
+ *        name (0 if none).
+ */
+static const uint16_t g_parameters_by_shortname[256] =
+{
+    PARAMETERS_LIST( PARAM_FLAG_SHORTNAME, PARAM_VALUE_SHORTNAME )
+};
+
+const char * g_application_description = "Skeleton test application.";
+
+/*!
+ * @brief Default parameters values.
+ */
+struct params_t g_default_parameters =
+{
+    .display_help = false,
+    .display_version = false,
+    .config_file = NULL,
+} ;
+
+uint32_t get_number_parameters( void )
+{
+    return ( sizeof( g_parameters_description ) > 0 ) ? \
+            GET_NB_ELEMENTS( g_parameters_description ) : 0;
+}
+
+void display_parameters_help( const char * application_name )
+{
+    uint32_t nb_parameters;
+    uint32_t i;
+
+    nb_parameters = get_number_parameters() - 1;
+    
+    printf("%s - %s\r\n", application_name, g_application_description );
+
+    printf("Usage : %s [", application_name );
+    for(i=0; i<nb_parameters; i++)
+    {
+        printf( "%c", g_parameters_description[i].arg_shortname );
+
+        if( BOOL_TYPE != g_parameters_description[i].type )
+        {
+            printf(":");
+        }
+    }
+    printf("]\r\n");
+
+    for(i=0; SENTINEL_TYPE != g_parameters_description[i].type; i++)
+    {
+        printf(" - %c/%s\t%s\r\n", \
+                g_parameters_description[i].arg_shortname, \
+                g_parameters_description[i].arg_longname, \
+                g_parameters_description[i].help );
+    }
+}
+
+const struct parameter_description_t * get_parameter_by_shortname(
+                                        char shortname )
+{
+    uint16_t i = g_parameters_by_shortname[(uint8_t)shortname];
+
+    return ( i > 0 ) ? &g_parameters_description[i - 1] : NULL;
+}
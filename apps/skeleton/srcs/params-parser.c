@@ -1,254 +1,241 @@
-/*!
- * @file: params-parser.h
- * @date: 2023-12-24
- * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
- * @brief: Implementation of parameters parser functions.
- */
-#include <getopt.h>
-#include <stdlib.h>
-#include <string.h>
-
-#include <lib-utils-assert.h>
-#include <lib-utils-tab.h>
-#include <lib-utils-parse-number.h>
-#include <lib-utils-string.h>
-
-#include "params-desc.h"
-
-/*!
- * @brief Set parameter value to params struct.
- * @param shortname Short name of parameter option in command line.
- * @param value     String contains parameters value (NULL if option has not
- *                  parameters value).
- * @param params    Pointer on struct with parameters to init.
- * @return 0 on success otherwise -1.
- */
-static int set_param_value( char shortname,
-                            const char * value,
-                            struct params_t * params);
-
-/*!
- * @brief Get option string parameter optstring for function getopt_long and 
- *        getopt. (User must free return string when no used anymore).
- * @return Allocate optstring to pass to getopt or getopt_long on success 
- *         otherwise NULL.
- */
-static char * get_opt_string( void );
-
-/*!
- * @brief Get option list for getopt_long function. (User must free return 
- *        string when no used anymore).
- * @return Allocate optstring to pass to getopt or getopt_long on success 
- *         otherwise NULL.
- */
-static struct option * get_opt_list( void );
-
-int parse_application_parameters(int argc, char ** argv, struct params_t *params)
-{
-    int ret = -1;
-    int c;
-    struct option * p_lopts;
-    char *opt_str;
-    int opt_idx = 0;
-
-    ASSERT_I32( argc, 1, INT32_MAX, -1 );
-    ASSERT_PTR( argv, -1 );
-    ASSERT_PTR( params, -1 );
-
-    memcpy(params, &g_default_parameters, sizeof(*params) );
-
-    p_lopts = get_opt_list();
-    opt_str = get_opt_string();
-
-    if(p_lopts && opt_str)
-    {
-        ret = 0;
-
-        while ( 0 == ret )
-        {
-            c = getopt_long( argc, argv, opt_str, p_lopts, &opt_idx );
-
-            if ( -1 == c )
-            {
-                break;
-            }
-            else
-            {
-                if(required_argument == p_lopts[opt_idx].has_arg)
-                {
-                    ret = set_param_value( ( char )c, \
-                                            optarg, \
-                                            params );
-                }
-                else
-                {
-                    ret = set_param_value( ( char )c, \
-                                            NULL, \
-                                            params );
-                }
-            }
-        }
-    }
-
-    if(p_lopts)
-    {
-        free(p_lopts);
-    }
-
-    if(opt_str)
-    {
-        free(opt_str);
-    }
-
-    return ret;
-}
-
-int set_param_value( char shortname,
-                     const char * value,
-                     struct params_t * params)
-{
-    int ret = 0;
-    int i = 0;
-    bool found = false;
-    uint8_t *ptr8;
-
-    ASSERT_PTR(params, -1);
-
-    while((0 == ret) && !found && (SENTINEL_TYPE != g_parameters_description[i].type))
-    {
-        if(g_parameters_description[i].arg_shortname == shortname)
-        {
-            found = true;
-            ptr8 = &((uint8_t*)params)[g_parameters_description[i].offset];
-            switch(g_parameters_description[i].type)
-            {
-                case U8_TYPE:
-                    ret = parse_uint8( value , ptr8 );
-                break;
-                case I8_TYPE:
-                    ret = parse_int8( value , (int8_t*) ptr8 );
-                break;
-                case HEX8_TYPE:
-                    ret = parse_uint8( value , ptr8 );
-                break;
-                case U16_TYPE:
-                    ret = parse_uint16( value , (uint16_t*) ptr8 );
-                break;
-                case I16_TYPE:
-                    ret = parse_int16( value , (int16_t*) ptr8 );
-                break;
-                case HEX16_TYPE:
-                    ret = parse_hex16( value , (uint16_t*) ptr8 );
-                break;
-                case U32_TYPE:
-                    ret = parse_uint32( value , (uint32_t*) ptr8 );
-                break;
-                case I32_TYPE:
-                    ret = parse_int32( value , (int32_t*) ptr8 );
-                break;
-                case HEX32_TYPE:
-                    ret = parse_hex32( value , (uint32_t*) ptr8 );
-                break;
-                case U64_TYPE:
-                    ret = parse_uint64( value , (uint64_t*) ptr8 );
-                break;
-                case I64_TYPE:
-                    ret = parse_int64( value , (int64_t*) ptr8 );
-                break;
-                case HEX64_TYPE:
-                    ret = parse_hex64( value , (uint64_t*) ptr8 );
-                break;
-                case DFLOAT_TYPE:
-                    ret = parse_double( value, (double *) ptr8 );
-                break;
-                case STR_TYPE:
-                    ptr8 = (uint8_t*) allocate_and_copy_string( value );
-                break;
-                case BOOL_TYPE:
-                    *((bool*)ptr8) = true;
-                break;
-                case CHAR_TYPE:
-                    *ptr8 = value[0];
-                break;
-                default:
-                    ret = -1;
-                break;
-            }
-        }
-        i++;
-    }
-
-    if( ! found )
-    {
-        ret = -1;
-    }
-
-    return ret;
-}
-
-char * get_opt_string( void )
-{
-    uint32_t nb_elements;
-    uint32_t i;
-    uint32_t j;
-    char * str = NULL;
-
-    nb_elements = get_number_parameters();
-
-    /* Double elements and alloc to store param list */
-    str = malloc( nb_elements * 2 );
-    if( str )
-    {
-        i = 0;
-        j = 0;
-
-        while( SENTINEL_TYPE != g_parameters_description[i].type )
-        {
-            str[j] = g_parameters_description[i].arg_shortname;
-
-            if( BOOL_TYPE != g_parameters_description[i].type )
-            {
-                str[j+1] = ':';
-                j++;
-            }
-            j++;
-            i++;
-        }
-
-        str[j] = '\0';
-    }
-
-    return str;
-}
-
-struct option * get_opt_list( void )
-{
-    struct option * lopts = NULL;
-    uint32_t nb_elements;
-    uint32_t i;
-
-    nb_elements = get_number_parameters();
-
-    lopts = malloc( nb_elements * sizeof( struct option ) );
-    if( lopts )
-    {
-        i = 0;
-
-        while( SENTINEL_TYPE != g_parameters_description[i].type )
-        {
-            lopts[i].name = g_parameters_description[i].arg_longname;
-            lopts[i].has_arg = ( BOOL_TYPE != g_parameters_description[i].type ) ?
-                    required_argument : no_argument;
-            lopts[i].flag = 0;
-            lopts[i].val = g_parameters_description[i].arg_shortname;
-            i++;
-        }
-
-        lopts[i].name = NULL;
-        lopts[i].has_arg = 0;
-        lopts[i].flag = 0;
-        lopts[i].val = 0;
-    }
-
-    return lopts;
-}
\ No newline at end of file
+/*!
+ * @file: params-parser.h
+ * @date: 2023-12-24
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of parameters parser functions.
+ */
+#include <getopt.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <lib-utils-assert.h>
+
+#include "params-desc.h"
+#include "params-parser.h"
+
+/*!
+ * @brief Build getopt optstring characters of a boolean parameter.
+ */
+#define OPT_FLAG_STRING( field, shortname, longname, help ) \
+    shortname,
+
+/*!
+ * @brief Build getopt optstring characters of a parameter with value.
+ */
+#define OPT_VALUE_STRING( type, field, shortname, longname, help ) \
+    shortname, ':',
+
+/*!
+ * @brief Build getopt_long option of a boolean parameter.
+ */
+#define OPT_FLAG_OPTION( field, shortname, longname, help ) \
+    { longname, no_argument, NULL, shortname },
+
+/*!
+ * @brief Build getopt_long option of a parameter with value.
+ */
+#define OPT_VALUE_OPTION( type, field, shortname, longname, help ) \
+    { longname, required_argument, NULL, shortname },
+
+/*!
+ * @brief Maximum number of parameters files (config and response files).
+ */
+#define MAX_PARAMS_FILES    8
+
+/*!
+ * @brief Option string parameter optstring for getopt_long (built at
+ *        compile time from PARAMETERS_LIST). Leading '-' returns operands
+ *        in order (as option 1) to expand response files at their position.
+ */
+static const char g_opt_string[] =
+{
+    '-',
+    PARAMETERS_LIST( OPT_FLAG_STRING, OPT_VALUE_STRING )
+    '\0'
+};
+
+/*!
+ * @brief Option list for getopt_long (built at compile time from
+ *        PARAMETERS_LIST).
+ */
+static const struct option g_opt_list[] =
+{
+    PARAMETERS_LIST( OPT_FLAG_OPTION, OPT_VALUE_OPTION )
+    { NULL, 0, NULL, 0 }
+};
+
+/*!
+ * @brief Files read by parse_application_parameters (string parameters
+ *        point into them).
+ */
+static params_file_t g_params_files[MAX_PARAMS_FILES];
+
+/*!
+ * @brief Number of files in g_params_files.
+ */
+static size_t g_nb_params_files = 0;
+
+/*!
+ * @brief Load a parameters file (kept until release_application_parameters).
+ * @param[in]   path    Path of file.
+ * @return The loaded file otherwise NULL.
+ */
+static params_file_t * open_parameters_file( const char * path );
+
+/*!
+ * @brief Parse command line with getopt_long.
+ * @param[in]   argc        Number of parameters including application name.
+ * @param[in]   argv        Parameter of application.
+ * @param[in]   index       Index of g_parameters_description to parse
+ *                          response files (NULL to skip them).
+ * @param[out]  has_files   Set to true if command line has response files
+ *                          (can be NULL).
+ * @param[out]  params      Pointer on struct param to store parameters.
+ * @return 0 on success otherwise -1
+ */
+static int parse_command_line( int argc,
+                               char ** argv,
+                               const params_index_t * index,
+                               bool * has_files,
+                               struct params_t *params );
+
+int parse_application_parameters(int argc, char ** argv, struct params_t *params)
+{
+    int ret;
+    bool has_files = false;
+    const char * config_file;
+    params_file_t * file;
+    params_index_t index;
+
+    ASSERT_I32( argc, 1, INT32_MAX, -1 );
+    ASSERT_PTR( argv, -1 );
+    ASSERT_PTR( params, -1 );
+
+    memcpy(params, &g_default_parameters, sizeof(*params) );
+
+    /* Tables are static: no allocation and no table walk when there is
+       neither config file nor response file */
+    ret = parse_command_line( argc, argv, NULL, &has_files, params );
+    if( ( 0 != ret ) || ( ( NULL == params->config_file ) && ! has_files ) )
+    {
+        return ret;
+    }
+
+    /* Config file is read before command line: it cannot be named by a
+       config or response file */
+    if( ( 0 != params_index_init( &index, g_parameters_description ) ) ||
+        ( 0 != params_index_set_command_line_only( &index,
+                        params_index_find_longname( &index, "config", 6 ) ) ) )
+    {
+        params_index_release( &index );
+        return -1;
+    }
+
+    /* Config file is read first: command line is parsed again over it */
+    config_file = params->config_file;
+    memcpy(params, &g_default_parameters, sizeof(*params) );
+    if( config_file )
+    {
+        file = open_parameters_file( config_file );
+        ret = file ? parse_params_config_file( &index, file, params ) : -1;
+    }
+
+    if( 0 == ret )
+    {
+        ret = parse_command_line( argc, argv, &index, NULL, params );
+    }
+
+    params_index_release( &index );
+
+    return ret;
+}
+
+void release_application_parameters( void )
+{
+    while( g_nb_params_files > 0 )
+    {
+        params_file_close( &g_params_files[--g_nb_params_files] );
+    }
+}
+
+params_file_t * open_parameters_file( const char * path )
+{
+    params_file_t * file;
+
+    if( g_nb_params_files >= MAX_PARAMS_FILES )
+    {
+        return NULL;
+    }
+
+    file = &g_params_files[g_nb_params_files];
+    if( 0 != params_file_open( file, path ) )
+    {
+        return NULL;
+    }
+    g_nb_params_files++;
+
+    return file;
+}
+
+int parse_command_line( int argc,
+                        char ** argv,
+                        const params_index_t * index,
+                        bool * has_files,
+                        struct params_t *params )
+{
+    int ret = 0;
+    int c;
+    const struct parameter_description_t * desc;
+    params_file_t * file;
+
+    /* getopt_long matches long names by a scan of g_opt_list: cheaper than
+       building an index for a few options parsed once */
+    optind = 0;
+    while ( 0 == ret )
+    {
+        c = getopt_long( argc, argv, g_opt_string, g_opt_list, NULL );
+
+        if ( -1 == c )
+        {
+            break;
+        }
+
+        if ( 1 == c )
+        {
+            /* Operand: only response files are parsed */
+            if( '@' != optarg[0] )
+            {
+                continue;
+            }
+            if( has_files )
+            {
+                *has_files = true;
+            }
+            if( index )
+            {
+                file = open_parameters_file( optarg + 1 );
+                ret = file ? parse_params_response_file( index, file, params ) : -1;
+            }
+            continue;
+        }
+
+        /* Direct lookup: no scan of g_parameters_description. optarg is
+           NULL for options without value */
+        desc = get_parameter_by_shortname( ( char )c );
+        ret = desc ? set_param_value( desc, optarg, params ) : -1;
+    }
+
+    return ret;
+}
+
+int parse_parameters_tokens( const params_index_t * index,
+                             size_t nb_tokens,
+                             const char * const * tokens,
+                             struct params_t *params)
+{
+    ASSERT_PTR( params, -1 );
+
+    memcpy(params, &g_default_parameters, sizeof(*params) );
+
+    return parse_params_tokens( index, nb_tokens, tokens, params );
+}
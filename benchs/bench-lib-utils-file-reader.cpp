@@ -0,0 +1,207 @@
+/*!
+ * @file: bench-lib-utils-file-reader.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of benchmark for file reader functions.
+ */
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "bench-utils.h"
+
+extern "C"
+{
+    #include "lib-utils-file-reader.h"
+    #include "lib-utils-format-number.h"
+    #include "lib-utils-parse-number.h"
+}
+
+namespace
+{
+    const unsigned int NB_RUNS = 1;
+
+    // Sum of parsed values (checked to be the same for each reader)
+    struct sums_t
+    {
+        uint64_t    u32;
+        int64_t     i64;
+        double      d;
+        size_t      nb_records;
+    };
+
+    // Generate file of records "uint32,int64,double" of size bytes
+    size_t generate_file( const char * path, size_t size )
+    {
+        std::mt19937_64 gen( 42 );
+        std::uniform_real_distribution<double> dist( -1e6, 1e6 );
+        FILE * file = fopen( path, "wb" );
+        std::string chunk;
+        size_t written = 0;
+        char buf[FORMAT_NUMBER_BUFFER_SIZE];
+
+        if( ! file )
+        {
+            return 0;
+        }
+
+        while( written < size )
+        {
+            chunk.clear();
+            while( chunk.size() < 1024 * 1024 )
+            {
+                chunk.append( buf, format_uint32( (uint32_t)gen(), buf, sizeof( buf ) ) );
+                chunk += ',';
+                chunk.append( buf, format_int64( (int64_t)gen() >> ( gen() % 64 ), buf, sizeof( buf ) ) );
+                chunk += ',';
+                chunk.append( buf, format_double( dist( gen ), buf, sizeof( buf ) ) );
+                chunk += '\n';
+            }
+            written += fwrite( chunk.data(), 1, chunk.size(), file );
+        }
+        fclose( file );
+
+        return written;
+    }
+
+    // Baseline: fgets + strtok + strtoul/strtoll/strtod
+    sums_t read_stdio( const char * path )
+    {
+        sums_t sums = {};
+        FILE * file = fopen( path, "rb" );
+        char line[256];
+
+        while( file && fgets( line, sizeof( line ), file ) )
+        {
+            char * field = strtok( line, ",\n" );
+            sums.u32 += strtoul( field, NULL, 10 );
+            field = strtok( NULL, ",\n" );
+            sums.i64 += strtoll( field, NULL, 10 );
+            field = strtok( NULL, ",\n" );
+            sums.d += strtod( field, NULL );
+            sums.nb_records++;
+        }
+        if( file )
+        {
+            fclose( file );
+        }
+
+        return sums;
+    }
+
+    // File reader + parse_<type>_n on each field
+    sums_t read_file_reader( const char * path, file_reader_mode_t mode )
+    {
+        sums_t sums = {};
+        file_reader_t reader;
+        const char * field;
+        size_t len;
+        uint32_t u32;
+        int64_t i64;
+        double d;
+
+        if( 0 != file_reader_open( &reader, path, ',', mode, 0 ) )
+        {
+            return sums;
+        }
+
+        while( 1 == file_reader_next_record( &reader, NULL, NULL ) )
+        {
+            file_reader_next_field( &reader, &field, &len );
+            parse_uint32_n( field, len, &u32 );
+            file_reader_next_field( &reader, &field, &len );
+            parse_int64_n( field, len, &i64 );
+            file_reader_next_field( &reader, &field, &len );
+            parse_double_n( field, len, &d );
+            sums.u32 += u32;
+            sums.i64 += i64;
+            sums.d += d;
+            sums.nb_records++;
+        }
+        file_reader_close( &reader );
+
+        return sums;
+    }
+
+    // File reader split only (no number parsing)
+    sums_t split_file_reader( const char * path )
+    {
+        sums_t sums = {};
+        file_reader_t reader;
+        const char * field;
+        size_t len;
+
+        if( 0 != file_reader_open( &reader, path, ',', FILE_READER_MODE_AUTO, 0 ) )
+        {
+            return sums;
+        }
+
+        while( 1 == file_reader_next_record( &reader, NULL, NULL ) )
+        {
+            while( 1 == file_reader_next_field( &reader, &field, &len ) )
+            {
+                sums.u32 += len;
+            }
+            sums.nb_records++;
+        }
+        file_reader_close( &reader );
+
+        return sums;
+    }
+
+    // Run and report one reader
+    void bench_reader( const char * name, size_t size, sums_t ( *func )( void ),
+                       const sums_t * expected )
+    {
+        sums_t sums = {};
+        double t = bench_run( NB_RUNS, [&]() {
+            sums = func();
+            bench_keep( sums );
+        } );
+
+        bench_report( name, t, sums.nb_records, size );
+        if( expected && ( ( sums.nb_records != expected->nb_records ) ||
+                          ( sums.u32 != expected->u32 ) ||
+                          ( sums.i64 != expected->i64 ) ) )
+        {
+            printf( "  -> different result than baseline\r\n" );
+        }
+    }
+
+    const char * s_path;
+}
+
+int main( int argc, char** argv )
+{
+    size_t size_mb = ( argc > 1 ) ? strtoull( argv[1], NULL, 10 ) : 2048;
+    size_t size;
+    sums_t expected;
+
+    s_path = ( argc > 2 ) ? argv[2] : "/tmp/bench-lib-utils-file-reader.csv";
+
+    printf( "Generate %zu MB in %s\r\n", size_mb, s_path );
+    size = generate_file( s_path, size_mb * 1024 * 1024 );
+    if( 0 == size )
+    {
+        printf( "Can not generate file\r\n" );
+        return 1;
+    }
+
+    // Load file in page cache before measures
+    expected = read_file_reader( s_path, FILE_READER_MODE_READ );
+
+    bench_reader( "fgets + strtok + strto*", size,
+                  []() { return read_stdio( s_path ); }, &expected );
+    bench_reader( "file_reader split (mmap)", size,
+                  []() { return split_file_reader( s_path ); }, NULL );
+    bench_reader( "file_reader + parse (mmap)", size,
+                  []() { return read_file_reader( s_path, FILE_READER_MODE_MMAP ); },
+                  &expected );
+    bench_reader( "file_reader + parse (read)", size,
+                  []() { return read_file_reader( s_path, FILE_READER_MODE_READ ); },
+                  &expected );
+
+    remove( s_path );
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*!
+ * @file: bench-lib-utils-format-number.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of benchmark for number formatting functions.
+ */
+#include <cinttypes>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "bench-utils.h"
+
+extern "C"
+{
+    #include "lib-utils-format-number.h"
+}
+
+namespace
+{
+    const unsigned int NB_RUNS = 5;
+
+    // Bench formatter against snprintf on the same values
+    template <typename T, typename F, typename S>
+    void bench_format( const char * name,
+                       const std::vector<T> & values,
+                       F format,
+                       S reference )
+    {
+        char buf[FORMAT_NUMBER_BUFFER_SIZE];
+        char bench_name[64];
+        size_t nb_bytes = 0;
+        double t_snprintf;
+        double t;
+
+        t_snprintf = bench_run( NB_RUNS, [&]() {
+            nb_bytes = 0;
+            for( const T & value : values )
+            {
+                nb_bytes += reference( value, buf );
+                bench_keep( buf );
+            }
+        } );
+        snprintf( bench_name, sizeof( bench_name ), "snprintf (%s)", name );
+        bench_report( bench_name, t_snprintf, values.size(), nb_bytes );
+
+        t = bench_run( NB_RUNS, [&]() {
+            nb_bytes = 0;
+            for( const T & value : values )
+            {
+                nb_bytes += format( value, buf, sizeof( buf ) );
+                bench_keep( buf );
+            }
+        } );
+        snprintf( bench_name, sizeof( bench_name ), "format_%s x%.1f", name,
+                  t_snprintf / t );
+        bench_report( bench_name, t, values.size(), nb_bytes );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    size_t nb_values = ( argc > 1 ) ? strtoull( argv[1], NULL, 10 ) : 1000000;
+    std::mt19937_64 gen( 42 );
+    std::uniform_real_distribution<double> dist( -1e6, 1e6 );
+    std::vector<uint32_t> u32( nb_values );
+    std::vector<int64_t> i64( nb_values );
+    std::vector<uint64_t> h64( nb_values );
+    std::vector<double> d( nb_values );
+
+    for( size_t i = 0; i < nb_values; i++ )
+    {
+        u32[i] = (uint32_t)gen();
+        i64[i] = (int64_t)gen() >> ( gen() % 64 );
+        h64[i] = gen();
+        d[i] = dist( gen );
+    }
+
+    printf( "Format %zu values\r\n", nb_values );
+
+    bench_format( "uint32", u32, format_uint32, []( uint32_t v, char * buf ) {
+        return snprintf( buf, FORMAT_NUMBER_BUFFER_SIZE, "%" PRIu32, v );
+    } );
+    bench_format( "int64", i64, format_int64, []( int64_t v, char * buf ) {
+        return snprintf( buf, FORMAT_NUMBER_BUFFER_SIZE, "%" PRId64, v );
+    } );
+    bench_format( "hex64", h64, format_hex64, []( uint64_t v, char * buf ) {
+        return snprintf( buf, FORMAT_NUMBER_BUFFER_SIZE, "%" PRIx64, v );
+    } );
+    // %.17g always round trips but is not the shortest string
+    bench_format( "double", d, format_double, []( double v, char * buf ) {
+        return snprintf( buf, FORMAT_NUMBER_BUFFER_SIZE, "%.17g", v );
+    } );
+
+    return 0;
+}
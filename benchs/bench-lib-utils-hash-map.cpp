@@ -0,0 +1,297 @@
+/*!
+ * @file: bench-lib-utils-hash-map.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of benchmark for open addressing hash map.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "bench-utils.h"
+
+extern "C"
+{
+    #include "lib-utils-hash.h"
+    #include "lib-utils-hash-map.h"
+}
+
+namespace
+{
+    const unsigned int NB_RUNS = 3;
+
+    // Reference: naive chained map (one allocation per entry, buckets
+    // doubled when there are as many entries as buckets)
+    class chained_map
+    {
+    public:
+        chained_map() : m_buckets( 16, nullptr ), m_count( 0 ) {}
+
+        ~chained_map()
+        {
+            for( node * n : m_buckets )
+            {
+                while( n )
+                {
+                    node * next = n->next;
+                    delete n;
+                    n = next;
+                }
+            }
+        }
+
+        void set( const std::string & key, void * value )
+        {
+            uint64_t hash = hash_buffer( key.data(), key.size() );
+            node ** bucket = &m_buckets[hash & ( m_buckets.size() - 1 )];
+
+            for( node * n = *bucket; n; n = n->next )
+            {
+                if( n->key == key )
+                {
+                    n->value = value;
+                    return;
+                }
+            }
+            *bucket = new node{ *bucket, hash, key, value };
+            if( ++m_count > m_buckets.size() )
+            {
+                grow();
+            }
+        }
+
+        bool get( const char * key, size_t len, void ** value ) const
+        {
+            uint64_t hash = hash_buffer( key, len );
+
+            for( node * n = m_buckets[hash & ( m_buckets.size() - 1 )]; n; n = n->next )
+            {
+                if( ( n->key.size() == len ) && ( 0 == memcmp( n->key.data(), key, len ) ) )
+                {
+                    *value = n->value;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+    private:
+        struct node
+        {
+            node *      next;
+            uint64_t    hash;
+            std::string key;
+            void *      value;
+        };
+
+        void grow()
+        {
+            std::vector<node *> buckets( m_buckets.size() * 2, nullptr );
+
+            for( node * n : m_buckets )
+            {
+                while( n )
+                {
+                    node * next = n->next;
+                    node ** bucket = &buckets[n->hash & ( buckets.size() - 1 )];
+
+                    n->next = *bucket;
+                    *bucket = n;
+                    n = next;
+                }
+            }
+            m_buckets.swap( buckets );
+        }
+
+        std::vector<node *> m_buckets;
+        size_t m_count;
+    };
+
+    // Integer keys: insertion, successful and failed lookups
+    void bench_uint64( size_t nb )
+    {
+        std::mt19937_64 gen( 42 );
+        std::vector<uint64_t> keys( nb );
+        std::vector<uint64_t> shuffled;
+        std::vector<uint64_t> missing( nb );
+        char title[64];
+        double t;
+
+        for( size_t i = 0; i < nb; i++ )
+        {
+            keys[i] = gen();
+            missing[i] = gen();
+        }
+
+        // Lookups in insertion order would favor node based maps
+        shuffled = keys;
+        std::shuffle( shuffled.begin(), shuffled.end(), gen );
+
+        t = bench_run( NB_RUNS, [&]() {
+            hash_map_t * map = hash_map_create( HASH_MAP_KEY_UINT64, 0 );
+            for( uint64_t key : keys )
+            {
+                hash_map_set_uint64( map, key, (void *)key );
+            }
+            hash_map_destroy( map );
+        } );
+        snprintf( title, sizeof( title ), "hash_map insert uint64 %zu", nb );
+        bench_report( title, t, nb, 0 );
+
+        t = bench_run( NB_RUNS, [&]() {
+            std::unordered_map<uint64_t, void *> map;
+            for( uint64_t key : keys )
+            {
+                map[key] = (void *)key;
+            }
+            bench_keep( map.size() );
+        } );
+        snprintf( title, sizeof( title ), "unordered_map insert uint64 %zu", nb );
+        bench_report( title, t, nb, 0 );
+
+        hash_map_t * map = hash_map_create( HASH_MAP_KEY_UINT64, 0 );
+        std::unordered_map<uint64_t, void *> std_map;
+        for( uint64_t key : keys )
+        {
+            hash_map_set_uint64( map, key, (void *)key );
+            std_map[key] = (void *)key;
+        }
+
+        for( const std::vector<uint64_t> * lookup : { &shuffled, &missing } )
+        {
+            const char * kind = ( lookup == &shuffled ) ? "hit" : "miss";
+
+            t = bench_run( NB_RUNS, [&]() {
+                void * value = NULL;
+                size_t found = 0;
+                for( uint64_t key : *lookup )
+                {
+                    found += ( 0 == hash_map_get_uint64( map, key, &value ) );
+                }
+                bench_keep( found );
+            } );
+            snprintf( title, sizeof( title ), "hash_map get uint64 %s", kind );
+            bench_report( title, t, nb, 0 );
+
+            t = bench_run( NB_RUNS, [&]() {
+                size_t found = 0;
+                for( uint64_t key : *lookup )
+                {
+                    found += ( std_map.find( key ) != std_map.end() );
+                }
+                bench_keep( found );
+            } );
+            snprintf( title, sizeof( title ), "unordered_map get uint64 %s", kind );
+            bench_report( title, t, nb, 0 );
+        }
+
+        hash_map_destroy( map );
+    }
+
+    // String keys: insertion and successful lookups
+    void bench_string( size_t nb )
+    {
+        std::mt19937_64 gen( 42 );
+        std::vector<std::string> keys;
+        std::vector<std::string> shuffled;
+        char title[64];
+        double t;
+
+        for( size_t i = 0; i < nb; i++ )
+        {
+            keys.push_back( "--parameter-name-" + std::to_string( i * 2654435761u ) );
+        }
+        shuffled = keys;
+        std::shuffle( shuffled.begin(), shuffled.end(), gen );
+
+        t = bench_run( NB_RUNS, [&]() {
+            hash_map_t * map = hash_map_create( HASH_MAP_KEY_STRING, 0 );
+            for( const std::string & key : keys )
+            {
+                hash_map_set_string( map, key.c_str(), NULL );
+            }
+            hash_map_destroy( map );
+        } );
+        snprintf( title, sizeof( title ), "hash_map insert string %zu", nb );
+        bench_report( title, t, nb, 0 );
+
+        t = bench_run( NB_RUNS, [&]() {
+            chained_map map;
+            for( const std::string & key : keys )
+            {
+                map.set( key, NULL );
+            }
+        } );
+        snprintf( title, sizeof( title ), "chained_map insert string %zu", nb );
+        bench_report( title, t, nb, 0 );
+
+        t = bench_run( NB_RUNS, [&]() {
+            std::unordered_map<std::string, void *> map;
+            for( const std::string & key : keys )
+            {
+                map[key] = NULL;
+            }
+            bench_keep( map.size() );
+        } );
+        snprintf( title, sizeof( title ), "unordered_map insert string %zu", nb );
+        bench_report( title, t, nb, 0 );
+
+        hash_map_t * map = hash_map_create( HASH_MAP_KEY_STRING, 0 );
+        chained_map naive_map;
+        std::unordered_map<std::string, void *> std_map;
+        for( const std::string & key : keys )
+        {
+            hash_map_set_string( map, key.c_str(), NULL );
+            naive_map.set( key, NULL );
+            std_map[key] = NULL;
+        }
+
+        t = bench_run( NB_RUNS, [&]() {
+            void * value;
+            size_t found = 0;
+            for( const std::string & key : shuffled )
+            {
+                found += ( 0 == hash_map_get_string_n( map, key.data(), key.size(), &value ) );
+            }
+            bench_keep( found );
+        } );
+        bench_report( "hash_map get string", t, nb, 0 );
+
+        t = bench_run( NB_RUNS, [&]() {
+            void * value;
+            size_t found = 0;
+            for( const std::string & key : shuffled )
+            {
+                found += naive_map.get( key.data(), key.size(), &value );
+            }
+            bench_keep( found );
+        } );
+        bench_report( "chained_map get string", t, nb, 0 );
+
+        t = bench_run( NB_RUNS, [&]() {
+            size_t found = 0;
+            for( const std::string & key : shuffled )
+            {
+                found += ( std_map.find( key ) != std_map.end() );
+            }
+            bench_keep( found );
+        } );
+        bench_report( "unordered_map get string", t, nb, 0 );
+
+        hash_map_destroy( map );
+    }
+}
+
+int main( void )
+{
+    bench_uint64( 1000000 );
+    printf( "\r\n" );
+    bench_string( 200000 );
+
+    return 0;
+}
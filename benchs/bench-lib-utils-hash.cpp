@@ -0,0 +1,103 @@
+/*!
+ * @file: bench-lib-utils-hash.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of benchmark for hash functions.
+ */
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bench-utils.h"
+
+extern "C"
+{
+    #include "lib-utils-hash.h"
+}
+
+namespace
+{
+    const unsigned int NB_RUNS = 5;
+
+    // Bytes hashed for each input size
+    const size_t BENCH_BYTES = 64 * 1024 * 1024;
+
+    // Buffers start in the first OFFSET_WINDOW bytes of data (power of 2)
+    const size_t OFFSET_WINDOW = 2 * 1024 * 1024;
+
+    // Reference: byte by byte FNV-1a
+    uint64_t hash_fnv1a( const void * buf, size_t len )
+    {
+        const uint8_t * p = (const uint8_t *)buf;
+        uint64_t hash = 0xCBF29CE484222325ULL;
+
+        for( size_t i = 0; i < len; i++ )
+        {
+            hash ^= p[i];
+            hash *= 0x100000001B3ULL;
+        }
+
+        return hash;
+    }
+
+    // Hash BENCH_BYTES bytes by buffers of len bytes taken in data
+    template <typename F>
+    void bench_size( const char * name, const std::vector<uint8_t> & data, size_t len, F func )
+    {
+        size_t nb = BENCH_BYTES / len;
+        char title[64];
+        double t;
+
+        t = bench_run( NB_RUNS, [&]() {
+            uint64_t acc = 0;
+            size_t offset = 0;
+
+            for( size_t i = 0; i < nb; i++ )
+            {
+                acc += func( data.data() + offset, len );
+                offset = ( offset + 4099 ) & ( OFFSET_WINDOW - 1 );
+            }
+            bench_keep( acc );
+        } );
+
+        snprintf( title, sizeof( title ), "%-16s %8zu bytes", name, len );
+        bench_report( title, t, nb, (double)nb * len );
+    }
+}
+
+int main( void )
+{
+    static const size_t sizes[] = { 8, 16, 32, 64, 128, 256, 1024, 4096,
+                                    64 * 1024, 1024 * 1024 };
+    std::vector<uint8_t> data( OFFSET_WINDOW + 1024 * 1024 );
+    std::mt19937_64 gen( 42 );
+    hash_state_t state;
+
+    for( uint8_t & byte : data )
+    {
+        byte = (uint8_t)gen();
+    }
+
+    for( size_t len : sizes )
+    {
+        bench_size( "hash_buffer", data, len, []( const void * buf, size_t n ) {
+            return hash_buffer( buf, n );
+        } );
+        bench_size( "hash_state", data, len, [&]( const void * buf, size_t n ) {
+            hash_state_init( &state, 0 );
+            hash_state_update( &state, buf, n );
+            return hash_state_final( &state );
+        } );
+        bench_size( "std::hash", data, len, []( const void * buf, size_t n ) {
+            return (uint64_t)std::hash<std::string_view>()(
+                    std::string_view( (const char *)buf, n ) );
+        } );
+        bench_size( "FNV-1a", data, len, hash_fnv1a );
+        printf( "\r\n" );
+    }
+
+    return 0;
+}
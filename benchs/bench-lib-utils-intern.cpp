@@ -0,0 +1,131 @@
+/*!
+ * @file: bench-lib-utils-intern.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of benchmark for string interning table.
+ */
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "bench-utils.h"
+
+extern "C"
+{
+    #include "lib-utils-intern.h"
+    #include "lib-utils-string.h"
+}
+
+namespace
+{
+    const unsigned int NB_RUNS = 3;
+
+    // Build nb_values strings taken among nb_distinct keys
+    std::vector<std::string> build_keys( size_t nb_values, size_t nb_distinct )
+    {
+        std::mt19937 gen( 42 );
+        std::vector<std::string> values;
+
+        for( size_t i = 0; i < nb_values; i++ )
+        {
+            values.push_back( "config.section." + std::to_string( gen() % nb_distinct ) );
+        }
+
+        return values;
+    }
+
+    // Compare memory of copies and of interned strings
+    void bench_memory( const std::vector<std::string> & values )
+    {
+        intern_table_t * table = intern_table_create( 0 );
+        std::vector<char *> copies;
+        size_t copies_memory = 0;
+        double t;
+
+        t = bench_run( 1, [&]() {
+            for( const std::string & value : values )
+            {
+                copies.push_back( allocate_and_copy_string( value.c_str() ) );
+            }
+        } );
+        for( const std::string & value : values )
+        {
+            // malloc header and 16 bytes granularity
+            copies_memory += ( value.size() + 1 + sizeof( size_t ) + 15 ) / 16 * 16;
+        }
+        bench_report( "allocate_and_copy_string", t, values.size(), 0 );
+        printf( "  -> %zu strings, about %zu KB\r\n", values.size(), copies_memory / 1024 );
+
+        t = bench_run( 1, [&]() {
+            for( const std::string & value : values )
+            {
+                bench_keep( intern_string( table, value.c_str() ) );
+            }
+        } );
+        bench_report( "intern_string", t, values.size(), 0 );
+        printf( "  -> %zu distinct strings, %zu KB\r\n",
+                intern_table_get_count( table ), intern_table_get_memory( table ) / 1024 );
+
+        for( char * copy : copies )
+        {
+            free( copy );
+        }
+        intern_table_destroy( table );
+    }
+
+    // Lookup of interned strings by 1 to max_threads threads simultaneously
+    void bench_concurrent_lookup( const std::vector<std::string> & values,
+                                  unsigned int max_threads )
+    {
+        intern_table_t * table = intern_table_create( 0 );
+        char name[64];
+
+        for( const std::string & value : values )
+        {
+            intern_string( table, value.c_str() );
+        }
+
+        for( unsigned int nb_threads = 1; nb_threads <= max_threads; nb_threads *= 2 )
+        {
+            double t = bench_run( NB_RUNS, [&]() {
+                std::vector<std::thread> threads;
+
+                for( unsigned int i = 0; i < nb_threads; i++ )
+                {
+                    threads.emplace_back( [&]() {
+                        for( const std::string & value : values )
+                        {
+                            bench_keep( intern_string( table, value.c_str() ) );
+                        }
+                    } );
+                }
+                for( std::thread & thread : threads )
+                {
+                    thread.join();
+                }
+            } );
+
+            snprintf( name, sizeof( name ), "intern_string lookup %2u threads", nb_threads );
+            bench_report( name, t, values.size() * nb_threads, 0 );
+        }
+
+        intern_table_destroy( table );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    long nb_cpus = sysconf( _SC_NPROCESSORS_ONLN );
+    unsigned int max_threads = ( argc > 1 ) ? strtoul( argv[1], NULL, 10 ) :
+                               ( nb_cpus > 0 ) ? (unsigned int)nb_cpus : 1;
+    std::vector<std::string> values = build_keys( 1000000, 1000 );
+
+    bench_memory( values );
+    bench_concurrent_lookup( values, max_threads );
+
+    return 0;
+}
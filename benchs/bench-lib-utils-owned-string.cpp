@@ -0,0 +1,150 @@
+/*!
+ * @file: bench-lib-utils-owned-string.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of benchmark of owned strings against one malloc per
+ *         string.
+ */
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench-utils.h"
+
+extern "C"
+{
+    #include "lib-utils-owned-string.h"
+    #include "lib-utils-string.h"
+}
+
+namespace
+{
+    const unsigned int NB_RUNS = 5;
+
+    // Bench copy, scan and release of nb_strings option like values (90% are
+    // shorter than 20 bytes)
+    void bench_strings( size_t nb_strings )
+    {
+        std::mt19937 gen( 42 );
+        std::vector<std::string> values( nb_strings );
+        std::vector<char *> copies( nb_strings );
+        std::vector<lu_string_t> strs( nb_strings );
+        std::vector<size_t> order( nb_strings );
+        arena_t * arena = arena_create( 0 );
+        size_t nb_large = 0;
+        size_t count = 0;
+        char name[96];
+        double t_ref;
+        double t;
+
+        for( std::string & value : values )
+        {
+            size_t len = ( gen() % 10 ) ? 4 + gen() % 16 : 30 + gen() % 30;
+
+            for( size_t i = 0; i < len; i++ )
+            {
+                value += (char)( 'a' + gen() % 4 );
+            }
+            nb_large += ( len > LU_STRING_SMALL_CAPACITY );
+        }
+        for( size_t i = 0; i < nb_strings; i++ )
+        {
+            lu_string_init( &strs[i], NULL );
+            order[i] = i;
+        }
+        std::shuffle( order.begin(), order.end(), gen );
+        printf( "%zu strings, %zu longer than %d bytes\r\n", nb_strings, nb_large, LU_STRING_SMALL_CAPACITY );
+
+        // Copy in random order (e.g. array sorted after creation): heap
+        // strings are not in array order
+        t_ref = bench_run( NB_RUNS, [&]() {
+            for( size_t i : order )
+            {
+                free( copies[i] );
+                copies[i] = allocate_and_copy_string( values[i].c_str() );
+            }
+            bench_keep( copies[0] );
+        } );
+        snprintf( name, sizeof( name ), "allocate_and_copy_string (%zu allocs)", nb_strings );
+        bench_report( name, t_ref, nb_strings, 0 );
+
+        t = bench_run( NB_RUNS, [&]() {
+            for( size_t i : order )
+            {
+                lu_string_assign( &strs[i], lu_strview( values[i].data(), values[i].size() ) );
+            }
+            bench_keep( strs[0] );
+        } );
+        snprintf( name, sizeof( name ), "lu_string_assign x%.1f (%zu allocs)", t_ref / t, nb_large );
+        bench_report( name, t, nb_strings, 0 );
+
+        // Scan in array order: compare each string to its neighbour
+        t_ref = bench_run( NB_RUNS, [&]() {
+            count = 0;
+            for( size_t i = 1; i < nb_strings; i++ )
+            {
+                count += ( strcmp( copies[i - 1], copies[i] ) < 0 );
+            }
+            bench_keep( count );
+        } );
+        bench_report( "strcmp scan", t_ref, nb_strings, 0 );
+
+        t = bench_run( NB_RUNS, [&]() {
+            count = 0;
+            for( size_t i = 1; i < nb_strings; i++ )
+            {
+                count += ( lu_string_compare( &strs[i - 1], &strs[i] ) < 0 );
+            }
+            bench_keep( count );
+        } );
+        snprintf( name, sizeof( name ), "lu_string_compare scan x%.1f", t_ref / t );
+        bench_report( name, t, nb_strings, 0 );
+
+        // Release (one run: strings are empty after)
+        t_ref = bench_run( 1, [&]() {
+            for( size_t i = 0; i < nb_strings; i++ )
+            {
+                free( copies[i] );
+                copies[i] = NULL;
+            }
+        } );
+        bench_report( "free", t_ref, nb_strings, 0 );
+
+        t = bench_run( 1, [&]() {
+            for( size_t i = 0; i < nb_strings; i++ )
+            {
+                lu_string_free( &strs[i] );
+            }
+        } );
+        snprintf( name, sizeof( name ), "lu_string_free x%.1f", t_ref / t );
+        bench_report( name, t, nb_strings, 0 );
+
+        // Long strings spilled to an arena: one reset releases everything
+        for( lu_string_t & str : strs )
+        {
+            lu_string_init( &str, arena );
+        }
+        t = bench_run( NB_RUNS, [&]() {
+            arena_reset( arena );
+            for( size_t i = 0; i < nb_strings; i++ )
+            {
+                lu_string_init( &strs[i], arena );
+                lu_string_assign( &strs[i], lu_strview( values[i].data(), values[i].size() ) );
+            }
+            bench_keep( strs[0] );
+        } );
+        bench_report( "lu_string_assign (arena)", t, nb_strings, 0 );
+
+        arena_destroy( arena );
+    }
+}
+
+int main( void )
+{
+    bench_strings( 1000000 );
+
+    return 0;
+}
@@ -0,0 +1,220 @@
+/*!
+ * @file: bench-lib-utils-params.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of benchmark of parameters parser against
+ *         getopt_long and of array parameters against splitting by hand.
+ */
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+
+#include "bench-utils.h"
+
+extern "C"
+{
+    #include "lib-utils-params.h"
+    #include "lib-utils-parse-number.h"
+}
+
+namespace
+{
+    const unsigned int NB_RUNS = 5;
+    const size_t NB_PARSES = 100000;
+    const size_t NB_OPTIONS = 32;
+
+    // Parameters of a generated application: one field per option
+    struct bench_params_t
+    {
+        uint32_t    values[NB_OPTIONS];
+    };
+
+    // Bench parse of command lines of nb_tokens tokens
+    void bench_parse( size_t nb_tokens )
+    {
+        std::vector<parameter_description_t> descriptions;
+        std::vector<std::string> longnames( NB_OPTIONS );
+        std::vector<struct option> options;
+        std::vector<std::string> strings;
+        std::vector<const char *> tokens;
+        std::vector<char *> argv;
+        std::string optstring;
+        params_index_t index;
+        bench_params_t params;
+        size_t errors = 0;
+        char name[96];
+        double t_ref;
+        double t;
+
+        // Options a..z and A..F take a uint32_t value
+        for( size_t i = 0; i < NB_OPTIONS; i++ )
+        {
+            char shortname = ( i < 26 ) ? (char)( 'a' + i ) : (char)( 'A' + i - 26 );
+
+            longnames[i] = "option-" + std::to_string( i );
+            descriptions.push_back( { U32_TYPE,
+                                      (uint32_t)( offsetof( bench_params_t, values ) + i * sizeof( uint32_t ) ),
+                                      sizeof( uint32_t ),
+                                      shortname,
+                                      longnames[i].c_str(),
+                                      "" } );
+            options.push_back( { longnames[i].c_str(), required_argument, NULL, shortname } );
+            optstring += shortname;
+            optstring += ':';
+        }
+        descriptions.push_back( { SENTINEL_TYPE, 0, 0, 0, NULL, NULL } );
+        options.push_back( { NULL, 0, NULL, 0 } );
+
+        // Half long options (--name=value), half short options (-x value)
+        for( size_t i = 0; strings.size() < nb_tokens; i++ )
+        {
+            const parameter_description_t & desc = descriptions[( i * 7 ) % NB_OPTIONS];
+
+            if( i % 2 )
+            {
+                strings.push_back( std::string( "--" ) + desc.arg_longname + "=" + std::to_string( i ) );
+            }
+            else
+            {
+                strings.push_back( std::string( "-" ) + desc.arg_shortname );
+                strings.push_back( std::to_string( i ) );
+            }
+        }
+        for( const std::string & str : strings )
+        {
+            tokens.push_back( str.c_str() );
+        }
+        printf( "%zu tokens, %zu options\r\n", tokens.size(), NB_OPTIONS );
+
+        if( 0 != params_index_init( &index, descriptions.data() ) )
+        {
+            printf( "params_index_init failed\r\n" );
+            return;
+        }
+
+        // getopt_long: global state reset and argv copied (permuted) per parse
+        opterr = 0;
+        t_ref = bench_run( NB_RUNS, [&]() {
+            for( size_t i = 0; i < NB_PARSES; i++ )
+            {
+                int c;
+
+                argv.assign( 1, (char *)"bench" );
+                for( const char * token : tokens )
+                {
+                    argv.push_back( (char *)token );
+                }
+                optind = 0;
+                while( -1 != ( c = getopt_long( (int)argv.size(), argv.data(), optstring.c_str(),
+                                               options.data(), NULL ) ) )
+                {
+                    const parameter_description_t * desc = params_index_find_shortname( &index, (char)c );
+
+                    errors += ( ! desc ) || ( 0 != set_param_value( desc, optarg, &params ) );
+                }
+            }
+            bench_keep( params );
+        } );
+        bench_report( "getopt_long", t_ref, NB_PARSES, 0 );
+
+        t = bench_run( NB_RUNS, [&]() {
+            for( size_t i = 0; i < NB_PARSES; i++ )
+            {
+                errors += ( 0 != parse_params_tokens( &index, tokens.size(), tokens.data(), &params ) );
+            }
+            bench_keep( params );
+        } );
+        snprintf( name, sizeof( name ), "parse_params_tokens x%.1f", t_ref / t );
+        bench_report( name, t, NB_PARSES, 0 );
+
+        if( errors )
+        {
+            printf( "%zu parse errors\r\n", errors );
+        }
+        params_index_release( &index );
+    }
+
+    // Bench parse of an array parameter of nb_ids elements (--ids 1,2,3...)
+    void bench_array( size_t nb_ids )
+    {
+        struct array_params_t
+        {
+            const char *    str;
+            param_array_t   ids;
+        };
+        const parameter_description_t descriptions[] =
+        {
+            { STR_TYPE, offsetof( array_params_t, str ), sizeof( char * ), 's', "str", "" },
+            { U32_ARRAY_TYPE, offsetof( array_params_t, ids ), sizeof( param_array_t ), 'i', "ids", "" },
+            { SENTINEL_TYPE, 0, 0, 0, NULL, NULL },
+        };
+        std::vector<uint32_t> ids( nb_ids );
+        std::string value;
+        array_params_t params = { NULL, { ids.data(), ids.size(), 0 } };
+        const size_t nb_parses = 10000000 / nb_ids;
+        size_t errors = 0;
+        char name[96];
+        double t_ref;
+        double t;
+
+        for( size_t i = 0; i < nb_ids; i++ )
+        {
+            value += std::to_string( ( i * 2654435761u ) % 1000000 ) + ",";
+        }
+        value.pop_back();
+        printf( "%zu elements, %zu bytes\r\n", nb_ids, value.size() );
+
+        // STR_TYPE value split and parsed element by element by application
+        t_ref = bench_run( NB_RUNS, [&]() {
+            for( size_t i = 0; i < nb_parses; i++ )
+            {
+                const char * ptr;
+                const char * end;
+                const char * sep;
+                size_t count = 0;
+
+                errors += ( 0 != set_param_value( &descriptions[0], value.c_str(), &params ) );
+                ptr = params.str;
+                end = ptr + strlen( ptr );
+                while( ( ptr < end ) && ( count < ids.size() ) )
+                {
+                    sep = (const char *)memchr( ptr, ',', (size_t)( end - ptr ) );
+                    sep = sep ? sep : end;
+                    errors += ( 0 != parse_uint32_n( ptr, (size_t)( sep - ptr ), &ids[count++] ) );
+                    ptr = sep + 1;
+                }
+            }
+            bench_keep( ids[0] );
+        } );
+        bench_report( "STR_TYPE + parse_uint32_n", t_ref, nb_parses * nb_ids, nb_parses * value.size() );
+
+        t = bench_run( NB_RUNS, [&]() {
+            for( size_t i = 0; i < nb_parses; i++ )
+            {
+                errors += ( 0 != set_param_value( &descriptions[1], value.c_str(), &params ) );
+            }
+            bench_keep( ids[0] );
+        } );
+        snprintf( name, sizeof( name ), "U32_ARRAY_TYPE x%.1f", t_ref / t );
+        bench_report( name, t, nb_parses * nb_ids, nb_parses * value.size() );
+
+        if( errors )
+        {
+            printf( "%zu parse errors\r\n", errors );
+        }
+    }
+}
+
+int main( void )
+{
+    bench_parse( 4 );
+    bench_parse( 16 );
+    bench_parse( 64 );
+    bench_array( 1000 );
+    bench_array( 100000 );
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+/*!
+ * @file: bench-lib-utils-parse-number-mt.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of benchmark for multithreaded number parsers.
+ */
+#include <random>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "bench-utils.h"
+
+extern "C"
+{
+    #include "lib-utils-parse-number.h"
+    #include "lib-utils-parse-number-mt.h"
+}
+
+namespace
+{
+    const unsigned int NB_RUNS = 3;
+
+    // Build a buffer of random uint32_t separated by '\n' of size bytes
+    std::string build_uint32_buffer( size_t size )
+    {
+        std::mt19937 gen( 42 );
+        std::string buf;
+
+        while( buf.size() < size )
+        {
+            buf += std::to_string( gen() );
+            buf += '\n';
+        }
+
+        return buf;
+    }
+
+    // Build a buffer of random double separated by '\n' of size bytes
+    std::string build_double_buffer( size_t size )
+    {
+        std::mt19937_64 gen( 42 );
+        std::uniform_real_distribution<double> dist( -1e6, 1e6 );
+        std::string buf;
+        char value[32];
+
+        while( buf.size() < size )
+        {
+            snprintf( value, sizeof( value ), "%.9g\n", dist( gen ) );
+            buf += value;
+        }
+
+        return buf;
+    }
+
+    // Bench single threaded parser then multithreaded parser from 1 to
+    // max_threads threads
+    template <typename T>
+    void bench_scaling( const char * type_name,
+            const std::string & buf,
+            unsigned int max_threads,
+            size_t (*parse_array)( const char *, size_t, char, T *, size_t, size_t * ),
+            size_t (*parse_array_mt)( parse_pool_t *, const char *, size_t, char, T *,
+                                      size_t, size_t * ) )
+    {
+        std::vector<T> out( buf.size() / 2 );
+        size_t consumed;
+        size_t nb = 0;
+        char name[64];
+        double t_single;
+        double t;
+
+        t_single = bench_run( NB_RUNS, [&]() {
+            nb = parse_array( buf.data(), buf.size(), '\n', out.data(), out.size(),
+                              &consumed );
+            bench_keep( out );
+        } );
+        snprintf( name, sizeof( name ), "parse_%s_array", type_name );
+        bench_report( name, t_single, nb, buf.size() );
+
+        for( unsigned int nb_threads = 1; nb_threads <= max_threads; nb_threads *= 2 )
+        {
+            parse_pool_t * pool = parse_pool_create( nb_threads );
+
+            if( ! pool )
+            {
+                printf( "Can not create pool of %u threads\r\n", nb_threads );
+                return;
+            }
+
+            t = bench_run( NB_RUNS, [&]() {
+                nb = parse_array_mt( pool, buf.data(), buf.size(), '\n', out.data(),
+                                     out.size(), &consumed );
+                bench_keep( out );
+            } );
+            parse_pool_destroy( pool );
+
+            snprintf( name, sizeof( name ), "parse_%s_array_mt %2u threads x%.2f",
+                      type_name, nb_threads, t_single / t );
+            bench_report( name, t, nb, buf.size() );
+
+            // Always end with max_threads
+            if( ( nb_threads < max_threads ) && ( nb_threads * 2 > max_threads ) )
+            {
+                nb_threads = max_threads / 2;
+            }
+        }
+    }
+}
+
+int main( int argc, char** argv )
+{
+    size_t size_mb = ( argc > 1 ) ? strtoull( argv[1], NULL, 10 ) : 256;
+    long nb_cpus = sysconf( _SC_NPROCESSORS_ONLN );
+    unsigned int max_threads = ( argc > 2 ) ? strtoul( argv[2], NULL, 10 ) :
+                               ( nb_cpus > 0 ) ? (unsigned int)nb_cpus : 1;
+    std::string buf;
+
+    printf( "Buffers of %zu MB, up to %u threads\r\n", size_mb, max_threads );
+
+    buf = build_uint32_buffer( size_mb * 1024 * 1024 );
+    bench_scaling( "uint32", buf, max_threads, parse_uint32_array,
+                   parse_uint32_array_mt );
+
+    buf = build_double_buffer( size_mb * 1024 * 1024 );
+    bench_scaling( "double", buf, max_threads, parse_double_array,
+                   parse_double_array_mt );
+
+    return 0;
+}
@@ -0,0 +1,261 @@
+/*!
+ * @file: bench-lib-utils-parse-number.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of benchmark for number parser functions.
+ */
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench-utils.h"
+#include "lib-utils-parse-number.hpp"
+
+extern "C"
+{
+    #include "lib-utils-parse-number.h"
+    #include "lib-utils-tab.h"
+}
+
+namespace
+{
+    const unsigned int NB_RUNS = 5;
+
+    // Build a buffer of nb_values random uint32_t separated by delim
+    std::string build_uint32_buffer( size_t nb_values, char delim )
+    {
+        std::mt19937 gen( 42 );
+        std::string buf;
+
+        for( size_t i = 0; i < nb_values; i++ )
+        {
+            buf += std::to_string( gen() );
+            buf += delim;
+        }
+
+        return buf;
+    }
+
+    // Build nb_values random strings of uint64_t with nb_digits digits
+    std::vector<std::string> build_uint64_strings( size_t nb_values,
+                                                   unsigned int nb_digits )
+    {
+        std::mt19937_64 gen( 42 );
+        std::vector<std::string> values;
+
+        for( size_t i = 0; i < nb_values; i++ )
+        {
+            std::string str = std::to_string( gen() );
+
+            str.resize( nb_digits, '1' );
+            str[0] = ( '0' == str[0] ) ? '1' : str[0];
+            values.push_back( str );
+        }
+
+        return values;
+    }
+
+    // Bench parse_uint64 on strings with each instruction set
+    void bench_isa( size_t nb_values, unsigned int nb_digits )
+    {
+        const parse_number_isa_t isas[] = { PARSE_NUMBER_ISA_SCALAR,
+                                            PARSE_NUMBER_ISA_SSE42 };
+        const char * names[] = { "scalar", "sse4.2" };
+        std::vector<std::string> values = build_uint64_strings( nb_values,
+                                                                nb_digits );
+        std::vector<uint64_t> out( nb_values );
+        char name[64];
+
+        for( unsigned int i = 0; i < GET_NB_ELEMENTS( isas ); i++ )
+        {
+            if( 0 != parse_number_set_isa( isas[i] ) )
+            {
+                continue;
+            }
+
+            double t = bench_run( NB_RUNS, [&]() {
+                for( size_t j = 0; j < nb_values; j++ )
+                {
+                    parse_uint64( values[j].c_str(), &out[j] );
+                }
+                bench_keep( out );
+            } );
+
+            snprintf( name, sizeof( name ), "parse_uint64 %u digits (%s)",
+                      nb_digits, names[i] );
+            bench_report( name, t, nb_values, nb_values * nb_digits );
+        }
+    }
+
+    // Bench C parse_uint32_n (library call) against inlined C++ parse<T>
+    void bench_inline( size_t nb_values, unsigned int nb_digits )
+    {
+        std::vector<std::string> values = build_uint64_strings( nb_values,
+                                                                nb_digits );
+        std::vector<std::string_view> views( values.begin(), values.end() );
+        std::vector<uint32_t> out( nb_values );
+        char name[64];
+        double t_c;
+        double t;
+
+        t_c = bench_run( NB_RUNS, [&]() {
+            for( size_t j = 0; j < nb_values; j++ )
+            {
+                parse_uint32_n( views[j].data(), views[j].size(), &out[j] );
+            }
+            bench_keep( out );
+        } );
+        snprintf( name, sizeof( name ), "parse_uint32_n %u digits", nb_digits );
+        bench_report( name, t_c, nb_values, nb_values * nb_digits );
+
+        t = bench_run( NB_RUNS, [&]() {
+            for( size_t j = 0; j < nb_values; j++ )
+            {
+                lib_utils::parse( views[j], out[j] );
+            }
+            bench_keep( out );
+        } );
+        snprintf( name, sizeof( name ), "parse<uint32_t> %u digits x%.1f",
+                  nb_digits, t_c / t );
+        bench_report( name, t, nb_values, nb_values * nb_digits );
+    }
+
+    // Build a buffer of nb_values NUL terminated double float strings in
+    // printf format (contiguous to bench parsing, not cache misses)
+    std::string build_double_buffer( size_t nb_values,
+                                     const char * format,
+                                     double min,
+                                     double max )
+    {
+        std::mt19937_64 gen( 42 );
+        std::uniform_real_distribution<double> dist( min, max );
+        std::string buf;
+        char str[64];
+
+        for( size_t i = 0; i < nb_values; i++ )
+        {
+            snprintf( str, sizeof( str ), format, dist( gen ) );
+            buf.append( str, strlen( str ) + 1 );
+        }
+
+        return buf;
+    }
+
+    // Bench parse_double against strtod on a corpus
+    void bench_double( const char * corpus, size_t nb_values,
+                       const std::string & buf )
+    {
+        std::vector<double> out( nb_values );
+        char name[64];
+        double t_strtod;
+        double t;
+
+        t_strtod = bench_run( NB_RUNS, [&]() {
+            const char * p = buf.data();
+            for( size_t j = 0; j < nb_values; j++ )
+            {
+                char * end;
+                out[j] = strtod( p, &end );
+                p = end + 1;
+            }
+            bench_keep( out );
+        } );
+        snprintf( name, sizeof( name ), "strtod (%s)", corpus );
+        bench_report( name, t_strtod, nb_values, buf.size() );
+
+        t = bench_run( NB_RUNS, [&]() {
+            const char * p = buf.data();
+            for( size_t j = 0; j < nb_values; j++ )
+            {
+                size_t len = strlen( p );
+                parse_double_n( p, len, &out[j] );
+                p += len + 1;
+            }
+            bench_keep( out );
+        } );
+        snprintf( name, sizeof( name ), "parse_double (%s) x%.1f", corpus,
+                  t_strtod / t );
+        bench_report( name, t, nb_values, buf.size() );
+    }
+
+    // Scalar path: split buffer and copy each token before calling parse_uint32
+    size_t parse_scalar( const std::string & buf, char delim, uint32_t * out )
+    {
+        const char * p = buf.data();
+        const char * end = p + buf.size();
+        char token[32];
+        size_t nb = 0;
+
+        while( p < end )
+        {
+            const char * sep = (const char *)memchr( p, delim, end - p );
+            size_t len;
+
+            if( ! sep )
+            {
+                sep = end;
+            }
+
+            len = sep - p;
+            if( len >= sizeof( token ) )
+            {
+                break;
+            }
+            memcpy( token, p, len );
+            token[len] = '\0';
+
+            if( 0 != parse_uint32( token, &out[nb] ) )
+            {
+                break;
+            }
+            nb++;
+            p = sep + 1;
+        }
+
+        return nb;
+    }
+}
+
+int main( int argc, char** argv )
+{
+    size_t nb_values = ( argc > 1 ) ? strtoull( argv[1], NULL, 10 ) : 1000000;
+    std::string buf = build_uint32_buffer( nb_values, ',' );
+    std::vector<uint32_t> out( nb_values );
+    size_t nb = 0;
+    double t;
+
+    printf( "Parse %zu uint32_t (%zu bytes)\r\n", nb_values, buf.size() );
+
+    t = bench_run( NB_RUNS, [&]() {
+        nb = parse_scalar( buf, ',', out.data() );
+        bench_keep( nb );
+    } );
+    bench_report( "parse_uint32 (copy + scalar)", t, nb, buf.size() );
+
+    t = bench_run( NB_RUNS, [&]() {
+        size_t consumed;
+        nb = parse_uint32_array( buf.data(), buf.size(), ',', out.data(),
+                                 out.size(), &consumed );
+        bench_keep( nb );
+    } );
+    bench_report( "parse_uint32_array", t, nb, buf.size() );
+
+    bench_isa( nb_values, 8 );
+    bench_isa( nb_values, 16 );
+    bench_isa( nb_values, 19 );
+
+    bench_inline( nb_values, 3 );
+    bench_inline( nb_values, 9 );
+
+    bench_double( "%.17g", nb_values,
+                  build_double_buffer( nb_values, "%.17g", -1e6, 1e6 ) );
+    bench_double( "prices", nb_values,
+                  build_double_buffer( nb_values, "%.2f", 0, 10000 ) );
+    bench_double( "integers", nb_values,
+                  build_double_buffer( nb_values, "%.0f", 0, 1e9 ) );
+    bench_double( "scientific", nb_values,
+                  build_double_buffer( nb_values, "%.6e", -1e200, 1e200 ) );
+
+    return ( nb == nb_values ) ? 0 : 1;
+}
@@ -0,0 +1,159 @@
+/*!
+ * @file: bench-lib-utils-perfect-hash.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of benchmark of option lookup by perfect hash and by
+ *         direct table against linear scan of option descriptions.
+ */
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench-utils.h"
+
+extern "C"
+{
+    #include "lib-utils-perfect-hash.h"
+}
+
+namespace
+{
+    const unsigned int NB_RUNS = 5;
+    const size_t NB_LOOKUPS = 1000000;
+
+    // Option description (as parameter_description_t of applications)
+    struct option_t
+    {
+        int             type;
+        char            shortname;
+        const char *    longname;
+    };
+
+    // Find option by long name with a linear scan
+    const option_t * find_linear( const std::vector<option_t> & options, const char * name )
+    {
+        for( const option_t & option : options )
+        {
+            if( 0 == strcmp( option.longname, name ) )
+            {
+                return &option;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Find option by short name with a linear scan
+    const option_t * find_linear( const std::vector<option_t> & options, char name )
+    {
+        for( const option_t & option : options )
+        {
+            if( option.shortname == name )
+            {
+                return &option;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Bench lookups of nb_options options (command lines of NB_LOOKUPS options)
+    void bench_options( size_t nb_options )
+    {
+        const char * shortnames = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+        std::mt19937 gen( 42 );
+        std::vector<std::string> names( nb_options );
+        std::vector<option_t> options( nb_options );
+        std::vector<const char *> long_args( NB_LOOKUPS );
+        std::vector<char> short_args( NB_LOOKUPS );
+        int16_t by_shortname[256];
+        perfect_hash_t * hash = NULL;
+        size_t nb_shortnames = std::min( nb_options, strlen( shortnames ) );
+        size_t found = 0;
+        char name[96];
+        double t_ref;
+        double t;
+
+        for( size_t i = 0; i < nb_options; i++ )
+        {
+            names[i] = "option-" + std::to_string( gen() % 1000 ) + "-" + std::to_string( i );
+            options[i].type = 0;
+            options[i].shortname = ( i < nb_shortnames ) ? shortnames[i] : 0;
+            options[i].longname = names[i].c_str();
+        }
+        for( size_t i = 0; i < NB_LOOKUPS; i++ )
+        {
+            long_args[i] = options[gen() % nb_options].longname;
+            short_args[i] = shortnames[gen() % nb_shortnames];
+        }
+        printf( "%zu options\r\n", nb_options );
+
+        // Long names
+        t_ref = bench_run( NB_RUNS, [&]() {
+            found = 0;
+            for( const char * arg : long_args )
+            {
+                found += ( nullptr != find_linear( options, arg ) );
+            }
+            bench_keep( found );
+        } );
+        bench_report( "linear scan (long name)", t_ref, NB_LOOKUPS, 0 );
+
+        t = bench_run( NB_RUNS, [&]() {
+            perfect_hash_destroy( hash );
+            hash = perfect_hash_create( &options[0].longname, nb_options, sizeof( options[0] ) );
+        } );
+        snprintf( name, sizeof( name ), "perfect_hash_create (%.2f us)", t * 1e6 );
+        bench_report( name, t, nb_options, 0 );
+
+        t = bench_run( NB_RUNS, [&]() {
+            found = 0;
+            for( const char * arg : long_args )
+            {
+                found += ( PERFECT_HASH_NOT_FOUND != perfect_hash_lookup( hash, arg ) );
+            }
+            bench_keep( found );
+        } );
+        snprintf( name, sizeof( name ), "perfect_hash_lookup (long name) x%.1f", t_ref / t );
+        bench_report( name, t, NB_LOOKUPS, 0 );
+
+        // Short names
+        t_ref = bench_run( NB_RUNS, [&]() {
+            found = 0;
+            for( char arg : short_args )
+            {
+                found += ( nullptr != find_linear( options, arg ) );
+            }
+            bench_keep( found );
+        } );
+        bench_report( "linear scan (short name)", t_ref, NB_LOOKUPS, 0 );
+
+        memset( by_shortname, -1, sizeof( by_shortname ) );
+        for( size_t i = 0; i < nb_shortnames; i++ )
+        {
+            by_shortname[(unsigned char)options[i].shortname] = (int16_t)i;
+        }
+        t = bench_run( NB_RUNS, [&]() {
+            found = 0;
+            for( char arg : short_args )
+            {
+                found += ( by_shortname[(unsigned char)arg] >= 0 );
+            }
+            bench_keep( found );
+        } );
+        snprintf( name, sizeof( name ), "256 entries table (short name) x%.1f", t_ref / t );
+        bench_report( name, t, NB_LOOKUPS, 0 );
+
+        perfect_hash_destroy( hash );
+    }
+}
+
+int main( void )
+{
+    bench_options( 10 );
+    bench_options( 100 );
+    bench_options( 1000 );
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*!
+ * @file: bench-lib-utils-search.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of benchmark for search functions on long haystacks.
+ */
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "bench-utils.h"
+
+extern "C"
+{
+    #include "lib-utils-search.h"
+}
+
+namespace
+{
+    const unsigned int NB_RUNS = 5;
+
+    const char * ISA_NAMES[] = { "scalar", "ssse3", "avx2" };
+
+    // Build a log like haystack of len bytes (lower case words, spaces and
+    // digits) without '#', '|', '@' and "ERROR"
+    std::string build_haystack( size_t len )
+    {
+        std::mt19937 gen( 42 );
+        std::string str( len, ' ' );
+
+        for( size_t i = 0; i < len; i++ )
+        {
+            unsigned int r = gen() % 32;
+
+            str[i] = ( r < 26 ) ? (char)( 'a' + r ) : ( r < 30 ) ? ' ' : (char)( '0' + r );
+        }
+
+        return str;
+    }
+
+    // Bench functions with a match at the end of haystack (whole buffer is
+    // scanned)
+    void bench_search( size_t len )
+    {
+        std::string hay = build_haystack( len );
+        const char * buf;
+        const char * found = NULL;
+        search_set_t set;
+        char name[64];
+        double t;
+
+        hay[len - 8] = '@';
+        memcpy( &hay[len - 6], "ERROR", 5 );
+        buf = hay.c_str();
+        search_set_init( &set, "#|@", 3 );
+
+        printf( "Haystack %zu KB\r\n", len / 1024 );
+
+        t = bench_run( NB_RUNS, [&]() { found = (const char *)memchr( buf, '@', len ); bench_keep( found ); } );
+        bench_report( "memchr", t, 1, len );
+        t = bench_run( NB_RUNS, [&]() { found = strpbrk( buf, "#|@" ); bench_keep( found ); } );
+        bench_report( "strpbrk 3 bytes", t, 1, len );
+        t = bench_run( NB_RUNS, [&]() { found = buf + strcspn( buf, "#|@\t\r\n" ); bench_keep( found ); } );
+        bench_report( "strcspn 6 bytes", t, 1, len );
+        t = bench_run( NB_RUNS, [&]() { found = strstr( buf, "ERROR" ); bench_keep( found ); } );
+        bench_report( "strstr", t, 1, len );
+        t = bench_run( NB_RUNS, [&]() { found = (const char *)memmem( buf, len, "ERROR", 5 ); bench_keep( found ); } );
+        bench_report( "memmem", t, 1, len );
+
+        for( int isa = SEARCH_ISA_SCALAR; isa <= SEARCH_ISA_AVX2; isa++ )
+        {
+            if( 0 != search_set_isa( (search_isa_t)isa ) )
+            {
+                continue;
+            }
+
+            t = bench_run( NB_RUNS, [&]() { found = search_byte( buf, len, '@' ); bench_keep( found ); } );
+            snprintf( name, sizeof( name ), "search_byte %s", ISA_NAMES[isa] );
+            bench_report( name, t, 1, len );
+
+            t = bench_run( NB_RUNS, [&]() { found = search_byte3( buf, len, '#', '|', '@' ); bench_keep( found ); } );
+            snprintf( name, sizeof( name ), "search_byte3 %s", ISA_NAMES[isa] );
+            bench_report( name, t, 1, len );
+
+            search_set_init( &set, "#|@\t\r\n", 6 );
+            t = bench_run( NB_RUNS, [&]() { found = search_any_of( buf, len, &set ); bench_keep( found ); } );
+            snprintf( name, sizeof( name ), "search_any_of 6 bytes %s", ISA_NAMES[isa] );
+            bench_report( name, t, 1, len );
+
+            t = bench_run( NB_RUNS, [&]() { found = search_substring( buf, len, "ERROR", 5 ); bench_keep( found ); } );
+            snprintf( name, sizeof( name ), "search_substring %s", ISA_NAMES[isa] );
+            bench_report( name, t, 1, len );
+        }
+
+        search_set_isa( SEARCH_ISA_AVX2 );
+    }
+}
+
+int main( void )
+{
+    bench_search( 64 * 1024 );
+    bench_search( 16 * 1024 * 1024 );
+
+    return 0;
+}
@@ -0,0 +1,319 @@
+/*!
+ * @file: bench-lib-utils-string.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of benchmark for string functions.
+ */
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench-utils.h"
+
+extern "C"
+{
+    #include "lib-utils-arena.h"
+    #include "lib-utils-format-number.h"
+    #include "lib-utils-parse-number.h"
+    #include "lib-utils-string.h"
+}
+
+namespace
+{
+    const unsigned int NB_RUNS = 5;
+
+    // Build nb_values random strings of 4 to 32 characters
+    std::vector<std::string> build_strings( size_t nb_values )
+    {
+        std::mt19937 gen( 42 );
+        std::vector<std::string> values;
+
+        for( size_t i = 0; i < nb_values; i++ )
+        {
+            values.push_back( std::string( 4 + gen() % 29, 'a' + gen() % 26 ) );
+        }
+
+        return values;
+    }
+
+    // Bench copy and concat of short strings then release of all of them with
+    // malloc/free and with an arena
+    void bench_arena( size_t nb_values )
+    {
+        std::vector<std::string> values = build_strings( nb_values );
+        std::vector<char *> out( nb_values );
+        arena_t * arena = arena_create( 0 );
+        size_t nb_bytes = 0;
+        double t_malloc;
+        double t;
+        char name[64];
+
+        for( const std::string & value : values )
+        {
+            nb_bytes += value.size();
+        }
+
+        t_malloc = bench_run( NB_RUNS, [&]() {
+            for( size_t i = 0; i < nb_values; i++ )
+            {
+                out[i] = allocate_and_copy_string( values[i].c_str() );
+            }
+            bench_keep( out );
+            for( size_t i = 0; i < nb_values; i++ )
+            {
+                free( out[i] );
+            }
+        } );
+        bench_report( "allocate_and_copy_string + free", t_malloc, nb_values, nb_bytes );
+
+        t = bench_run( NB_RUNS, [&]() {
+            for( size_t i = 0; i < nb_values; i++ )
+            {
+                out[i] = allocate_and_copy_string_arena( arena, values[i].c_str() );
+            }
+            bench_keep( out );
+            arena_reset( arena );
+        } );
+        snprintf( name, sizeof( name ), "allocate_and_copy_string_arena x%.1f", t_malloc / t );
+        bench_report( name, t, nb_values, nb_bytes );
+
+        t_malloc = bench_run( NB_RUNS, [&]() {
+            for( size_t i = 0; i < nb_values; i++ )
+            {
+                out[i] = allocate_and_concat_string( values[i].c_str(),
+                                                     values[nb_values - 1 - i].c_str() );
+            }
+            bench_keep( out );
+            for( size_t i = 0; i < nb_values; i++ )
+            {
+                free( out[i] );
+            }
+        } );
+        bench_report( "allocate_and_concat_string + free", t_malloc, nb_values, 2 * nb_bytes );
+
+        t = bench_run( NB_RUNS, [&]() {
+            for( size_t i = 0; i < nb_values; i++ )
+            {
+                out[i] = allocate_and_concat_string_arena( arena, values[i].c_str(),
+                                                           values[nb_values - 1 - i].c_str() );
+            }
+            bench_keep( out );
+            arena_reset( arena );
+        } );
+        snprintf( name, sizeof( name ), "allocate_and_concat_string_arena x%.1f", t_malloc / t );
+        bench_report( name, t, nb_values, 2 * nb_bytes );
+
+        arena_destroy( arena );
+    }
+
+    // Previous implementation of allocate_and_concat_string (reference)
+    char * concat_strcat( const char * str1, const char * str2 )
+    {
+        char * ret = (char *)malloc( strlen( str1 ) + strlen( str2 ) + 1 );
+
+        if( ret )
+        {
+            strcpy( ret, str1 );
+            strcat( ret, str2 );
+        }
+
+        return ret;
+    }
+
+    // Bench concat of two long strings
+    void bench_concat_long( size_t len )
+    {
+        std::string str1( len, 'a' );
+        std::string str2( len, 'b' );
+        char * out = NULL;
+        char name[64];
+        double t_ref;
+        double t;
+
+        t_ref = bench_run( NB_RUNS, [&]() {
+            out = concat_strcat( str1.c_str(), str2.c_str() );
+            bench_keep( out );
+            free( out );
+        } );
+        snprintf( name, sizeof( name ), "strcpy + strcat %zu KB", len / 1024 );
+        bench_report( name, t_ref, 1, 2 * len );
+
+        t = bench_run( NB_RUNS, [&]() {
+            out = allocate_and_concat_string( str1.c_str(), str2.c_str() );
+            bench_keep( out );
+            free( out );
+        } );
+        snprintf( name, sizeof( name ), "allocate_and_concat_string %zu KB x%.1f",
+                  len / 1024, t_ref / t );
+        bench_report( name, t, 1, 2 * len );
+    }
+
+    // Bench building a string of many parts by chained concat and by one n-ary
+    // concat
+    void bench_concat_many( size_t nb_parts )
+    {
+        std::vector<std::string> values = build_strings( nb_parts );
+        std::vector<const char *> parts;
+        size_t nb_bytes = 0;
+        char * out = NULL;
+        char name[64];
+        double t_ref;
+        double t;
+
+        for( const std::string & value : values )
+        {
+            parts.push_back( value.c_str() );
+            nb_bytes += value.size();
+        }
+
+        t_ref = bench_run( NB_RUNS, [&]() {
+            out = allocate_and_copy_string( parts[0] );
+            for( size_t i = 1; i < nb_parts; i++ )
+            {
+                char * tmp = allocate_and_concat_string( out, parts[i] );
+
+                free( out );
+                out = tmp;
+            }
+            bench_keep( out );
+            free( out );
+        } );
+        snprintf( name, sizeof( name ), "chained concat %zu parts", nb_parts );
+        bench_report( name, t_ref, nb_parts, nb_bytes );
+
+        t = bench_run( NB_RUNS, [&]() {
+            out = allocate_and_concat_string_array( parts.data(), nb_parts );
+            bench_keep( out );
+            free( out );
+        } );
+        snprintf( name, sizeof( name ), "allocate_and_concat_string_array x%.0f",
+                  t_ref / t );
+        bench_report( name, t, nb_parts, nb_bytes );
+    }
+
+    // Bench generation of a report of nb_lines lines "name=value\n" by chained
+    // concat and with a string builder
+    void bench_builder( size_t nb_lines )
+    {
+        std::vector<std::string> names = build_strings( nb_lines );
+        string_builder_t builder = STRING_BUILDER_INIT;
+        char value[FORMAT_NUMBER_BUFFER_SIZE];
+        size_t nb_bytes = 0;
+        char * out = NULL;
+        char name[64];
+        double t_ref;
+        double t;
+
+        t_ref = bench_run( 1, [&]() {
+            out = allocate_and_copy_string( "report\n" );
+            for( size_t i = 0; i < nb_lines; i++ )
+            {
+                format_uint32( (uint32_t)i, value, sizeof( value ) );
+                char * tmp = allocate_and_concat_strings( 5, out, names[i].c_str(),
+                                                          "=", value, "\n" );
+
+                free( out );
+                out = tmp;
+            }
+            nb_bytes = strlen( out );
+            bench_keep( out );
+            free( out );
+        } );
+        snprintf( name, sizeof( name ), "chained concat report %zu KB",
+                  nb_bytes / 1024 );
+        bench_report( name, t_ref, nb_lines, nb_bytes );
+
+        t = bench_run( NB_RUNS, [&]() {
+            string_builder_append( &builder, "report\n" );
+            for( size_t i = 0; i < nb_lines; i++ )
+            {
+                string_builder_append_n( &builder, names[i].data(), names[i].size() );
+                string_builder_append_char( &builder, '=' );
+                string_builder_append_uint32( &builder, (uint32_t)i );
+                string_builder_append_char( &builder, '\n' );
+            }
+            out = string_builder_detach( &builder );
+            bench_keep( out );
+            free( out );
+        } );
+        snprintf( name, sizeof( name ), "string_builder report x%.0f", t_ref / t );
+        bench_report( name, t, nb_lines, nb_bytes );
+    }
+
+    // Bench split of a buffer of nb_values comma separated numbers with strtok
+    // (on a copy, strtok modifies its input) and with split iterator, then
+    // split and parse
+    void bench_split( size_t nb_values )
+    {
+        std::mt19937 gen( 42 );
+        std::string csv;
+        std::vector<char> copy;
+        string_split_t split;
+        const char * token;
+        size_t len;
+        size_t count = 0;
+        uint64_t sum = 0;
+        uint32_t value;
+        char name[64];
+        double t_ref;
+        double t;
+
+        for( size_t i = 0; i < nb_values; i++ )
+        {
+            csv += std::to_string( gen() % 100000 );
+            csv += ',';
+        }
+        copy.resize( csv.size() + 1 );
+
+        t_ref = bench_run( NB_RUNS, [&]() {
+            memcpy( copy.data(), csv.c_str(), csv.size() + 1 );
+            count = 0;
+            for( char * tok = strtok( copy.data(), "," ); tok; tok = strtok( NULL, "," ) )
+            {
+                count++;
+            }
+            bench_keep( count );
+        } );
+        bench_report( "strtok (copy)", t_ref, nb_values, csv.size() );
+
+        t = bench_run( NB_RUNS, [&]() {
+            count = 0;
+            string_split_init( &split, csv.data(), csv.size(), ',', STRING_SPLIT_SKIP_EMPTY );
+            while( 0 == string_split_next( &split, &token, &len ) )
+            {
+                count++;
+            }
+            bench_keep( count );
+        } );
+        snprintf( name, sizeof( name ), "string_split x%.1f", t_ref / t );
+        bench_report( name, t, nb_values, csv.size() );
+
+        t = bench_run( NB_RUNS, [&]() {
+            sum = 0;
+            string_split_init( &split, csv.data(), csv.size(), ',', STRING_SPLIT_SKIP_EMPTY );
+            while( 0 == string_split_next( &split, &token, &len ) )
+            {
+                if( 0 == parse_uint32_n( token, len, &value ) )
+                {
+                    sum += value;
+                }
+            }
+            bench_keep( sum );
+        } );
+        bench_report( "string_split + parse_uint32_n", t, nb_values, csv.size() );
+    }
+}
+
+int main( void )
+{
+    bench_arena( 500000 );
+    bench_concat_long( 64 * 1024 );
+    bench_concat_long( 16 * 1024 * 1024 );
+    bench_concat_many( 10000 );
+    bench_builder( 40000 );
+    bench_split( 2000000 );
+
+    return 0;
+}
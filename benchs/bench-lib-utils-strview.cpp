@@ -0,0 +1,124 @@
+/*!
+ * @file: bench-lib-utils-strview.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of benchmark of a key=value parsing pipeline with
+ *         NUL terminated strings against string views.
+ */
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench-utils.h"
+
+extern "C"
+{
+    #include "lib-utils-parse-number.h"
+    #include "lib-utils-string.h"
+}
+
+namespace
+{
+    const unsigned int NB_RUNS = 5;
+
+    // Bench parsing of nb_lines "  <prefix>key_<n> = <value>" lines (prefix
+    // of prefix_len bytes): keys are copied in an arena and values are summed
+    void bench_pipeline( size_t nb_lines, size_t prefix_len )
+    {
+        std::mt19937 gen( 42 );
+        std::string text;
+        std::vector<char> line_buf;
+        arena_t * arena = arena_create( 0 );
+        string_split_t split;
+        lu_strview_t line;
+        uint64_t sum = 0;
+        uint32_t value;
+        char name[64];
+        double t_ref;
+        double t;
+
+        printf( "Keys prefix %zu bytes\r\n", prefix_len );
+        for( size_t i = 0; i < nb_lines; i++ )
+        {
+            text += "  " + std::string( prefix_len, 'p' ) + "key_" + std::to_string( gen() % 100000 ) + " = " +
+                    std::to_string( gen() % 1000000 ) + "\n";
+        }
+        line_buf.resize( text.size() + 1 );
+
+        // Each token is copied to be NUL terminated, then scanned again by
+        // strchr, strlen of the copy and the parser
+        t_ref = bench_run( NB_RUNS, [&]() {
+            const char * token;
+            size_t len;
+
+            sum = 0;
+            arena_reset( arena );
+            string_split_init( &split, text.data(), text.size(), '\n', STRING_SPLIT_SKIP_EMPTY );
+            while( 0 == string_split_next( &split, &token, &len ) )
+            {
+                char * key = line_buf.data();
+                char * eq;
+
+                memcpy( key, token, len );
+                key[len] = '\0';
+                eq = strchr( key, '=' );
+                if( ! eq )
+                {
+                    continue;
+                }
+                *eq = '\0';
+                while( ' ' == *key )
+                {
+                    key++;
+                }
+                for( char * end = eq - 1; ( end >= key ) && ( ' ' == *end ); end-- )
+                {
+                    *end = '\0';
+                }
+                bench_keep( allocate_and_copy_string_arena( arena, key ) );
+                if( 0 == parse_uint32( eq + 1, &value ) )
+                {
+                    sum += value;
+                }
+            }
+            bench_keep( sum );
+        } );
+        bench_report( "NUL terminated copies", t_ref, nb_lines, text.size() );
+
+        // Slices of input are passed end to end
+        t = bench_run( NB_RUNS, [&]() {
+            sum = 0;
+            arena_reset( arena );
+            string_split_init( &split, text.data(), text.size(), '\n', STRING_SPLIT_SKIP_EMPTY );
+            while( 0 == string_split_next_view( &split, &line ) )
+            {
+                size_t eq = lu_strview_find_char( line, '=' );
+
+                if( LU_STRVIEW_NPOS == eq )
+                {
+                    continue;
+                }
+                bench_keep( allocate_and_copy_strview_arena( arena,
+                            lu_strview_trim( lu_strview_slice( line, 0, eq ) ) ) );
+                if( 0 == parse_uint32_view( lu_strview_slice( line, eq + 1, LU_STRVIEW_NPOS ), &value ) )
+                {
+                    sum += value;
+                }
+            }
+            bench_keep( sum );
+        } );
+        snprintf( name, sizeof( name ), "string views x%.1f", t_ref / t );
+        bench_report( name, t, nb_lines, text.size() );
+
+        arena_destroy( arena );
+    }
+}
+
+int main( void )
+{
+    bench_pipeline( 1000000, 0 );
+    bench_pipeline( 1000000, 64 );
+
+    return 0;
+}
@@ -0,0 +1,112 @@
+/*!
+ * @file: bench-lib-utils-tab.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of benchmark for growable arrays.
+ */
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "bench-utils.h"
+
+extern "C"
+{
+    #include "lib-utils-tab.h"
+}
+
+namespace
+{
+    const unsigned int NB_RUNS = 5;
+
+    #define LESS( a, b )    ( ( a ) < ( b ) )
+
+    TAB_DEFINE( uint32_tab, uint32_t )
+    TAB_DEFINE_SORT( uint32_tab, uint32_t, LESS )
+
+    // Bench appending nb_values elements one by one with a realloc per
+    // element (previous ad-hoc code) and with amortized push
+    void bench_push( size_t nb_values )
+    {
+        uint32_t * values = NULL;
+        uint32_tab_t tab = TAB_INIT;
+        char name[64];
+        double t_ref;
+        double t;
+
+        t_ref = bench_run( NB_RUNS, [&]() {
+            for( size_t i = 0; i < nb_values; i++ )
+            {
+                values = (uint32_t *)realloc( values, ( i + 1 ) * sizeof( uint32_t ) );
+                values[i] = (uint32_t)i;
+            }
+            bench_keep( values );
+            free( values );
+            values = NULL;
+        } );
+        bench_report( "realloc per element", t_ref, nb_values, 0 );
+
+        t = bench_run( NB_RUNS, [&]() {
+            for( size_t i = 0; i < nb_values; i++ )
+            {
+                uint32_tab_push( &tab, (uint32_t)i );
+            }
+            bench_keep( tab.data );
+            uint32_tab_free( &tab );
+        } );
+        snprintf( name, sizeof( name ), "uint32_tab_push x%.1f", t_ref / t );
+        bench_report( name, t, nb_values, 0 );
+    }
+
+    // qsort comparison function
+    int compare_uint32( const void * a, const void * b )
+    {
+        uint32_t va = *(const uint32_t *)a;
+        uint32_t vb = *(const uint32_t *)b;
+
+        return ( va > vb ) - ( va < vb );
+    }
+
+    // Bench sort of nb_values random elements with qsort and generated sort
+    void bench_sort( size_t nb_values )
+    {
+        std::mt19937 gen( 42 );
+        std::vector<uint32_t> input( nb_values );
+        uint32_tab_t tab = TAB_INIT;
+        char name[64];
+        double t_ref;
+        double t;
+
+        for( uint32_t & value : input )
+        {
+            value = gen();
+        }
+        uint32_tab_append( &tab, input.data(), nb_values );
+
+        t_ref = bench_run( NB_RUNS, [&]() {
+            memcpy( tab.data, input.data(), nb_values * sizeof( uint32_t ) );
+            qsort( tab.data, tab.size, sizeof( uint32_t ), compare_uint32 );
+            bench_keep( tab.data );
+        } );
+        bench_report( "qsort", t_ref, nb_values, 0 );
+
+        t = bench_run( NB_RUNS, [&]() {
+            memcpy( tab.data, input.data(), nb_values * sizeof( uint32_t ) );
+            uint32_tab_sort( &tab );
+            bench_keep( tab.data );
+        } );
+        snprintf( name, sizeof( name ), "uint32_tab_sort x%.1f", t_ref / t );
+        bench_report( name, t, nb_values, 0 );
+
+        uint32_tab_free( &tab );
+    }
+}
+
+int main( void )
+{
+    bench_push( 1000000 );
+    bench_sort( 1000000 );
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*!
+ * @file: bench-lib-utils-utf8.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of benchmark for UTF-8 validation and transcoding on
+ *         texts of various scripts.
+ */
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench-utils.h"
+
+extern "C"
+{
+    #include "lib-utils-utf8.h"
+}
+
+namespace
+{
+    const unsigned int NB_RUNS = 5;
+
+    const size_t TEXT_SIZE = 16 * 1024 * 1024;
+
+    const char * ISA_NAMES[] = { "scalar", "ssse3", "avx2" };
+
+    // Build a text of about TEXT_SIZE bytes from words of given characters
+    // separated by spaces
+    std::string build_text( const std::vector<std::string> & chars )
+    {
+        std::mt19937 gen( 42 );
+        std::string str;
+
+        str.reserve( TEXT_SIZE + 64 );
+        while( str.size() < TEXT_SIZE )
+        {
+            size_t word_len = 2 + gen() % 8;
+
+            for( size_t i = 0; i < word_len; i++ )
+            {
+                str += chars[gen() % chars.size()];
+            }
+            str += ' ';
+        }
+
+        return str;
+    }
+
+    // Bench validation, count and transcoding of text for every instruction
+    // set
+    void bench_text( const char * title, const std::string & text )
+    {
+        std::vector<uint16_t> out16( text.size() );
+        std::vector<uint32_t> out32( text.size() );
+        std::string back( text.size(), '\0' );
+        size_t nb16 = 0;
+        size_t nb32 = 0;
+        size_t nb = 0;
+        char name[64];
+        int ret = 0;
+        double t;
+
+        printf( "%s text %zu MB\r\n", title, text.size() / ( 1024 * 1024 ) );
+
+        for( int isa = UTF8_ISA_SCALAR; isa <= UTF8_ISA_AVX2; isa++ )
+        {
+            if( 0 != utf8_set_isa( (utf8_isa_t)isa ) )
+            {
+                continue;
+            }
+
+            t = bench_run( NB_RUNS, [&]() { ret = utf8_validate( text.data(), text.size(), NULL ); bench_keep( ret ); } );
+            snprintf( name, sizeof( name ), "utf8_validate %s", ISA_NAMES[isa] );
+            bench_report( name, t, 1, text.size() );
+
+            t = bench_run( NB_RUNS, [&]() { nb = utf8_count_code_points( text.data(), text.size() ); bench_keep( nb ); } );
+            snprintf( name, sizeof( name ), "utf8_count_code_points %s", ISA_NAMES[isa] );
+            bench_report( name, t, 1, text.size() );
+
+            t = bench_run( NB_RUNS, [&]() { ret = utf8_to_utf16( text.data(), text.size(), out16.data(), out16.size(), &nb16 ); bench_keep( ret ); } );
+            snprintf( name, sizeof( name ), "utf8_to_utf16 %s", ISA_NAMES[isa] );
+            bench_report( name, t, 1, text.size() );
+
+            t = bench_run( NB_RUNS, [&]() { ret = utf8_to_utf32( text.data(), text.size(), out32.data(), out32.size(), &nb32 ); bench_keep( ret ); } );
+            snprintf( name, sizeof( name ), "utf8_to_utf32 %s", ISA_NAMES[isa] );
+            bench_report( name, t, 1, text.size() );
+
+            t = bench_run( NB_RUNS, [&]() { ret = utf16_to_utf8( out16.data(), nb16, &back[0], back.size(), &nb ); bench_keep( ret ); } );
+            snprintf( name, sizeof( name ), "utf16_to_utf8 %s", ISA_NAMES[isa] );
+            bench_report( name, t, 1, text.size() );
+        }
+
+        utf8_set_isa( UTF8_ISA_AVX2 );
+    }
+}
+
+int main( void )
+{
+    bench_text( "ASCII", build_text( { "a", "b", "c", "d", "e", "f", "g", "h", "i", "j", "k", "l", "m",
+                                       "n", "o", "p", "q", "r", "s", "t", "u", "v", "w", "x", "y", "z" } ) );
+    bench_text( "Latin", build_text( { "a", "e", "i", "o", "u", "r", "s", "t", "n", "l",
+                                       "\xc3\xa9", "\xc3\xa8", "\xc3\xa0", "\xc3\xa7" } ) );
+    bench_text( "CJK", build_text( { "\xe4\xb8\x80", "\xe4\xba\xba", "\xe5\xa4\xa7", "\xe6\x97\xa5",
+                                     "\xe6\x9c\xac", "\xe4\xb8\xad", "\xe5\x9b\xbd" } ) );
+    bench_text( "Emoji", build_text( { "\xf0\x9f\x98\x80", "\xf0\x9f\x98\x82", "\xf0\x9f\x91\x8d",
+                                       "\xf0\x9f\x8e\x89", "a", "b" } ) );
+
+    return 0;
+}
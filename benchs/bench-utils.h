@@ -0,0 +1,74 @@
+/*!
+ * @file: bench-utils.h
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of helpers shared by benchmarks.
+ */
+#ifndef BENCH_UTILS_H__
+#define BENCH_UTILS_H__
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/*!
+ * @brief Prevent compiler to optimize away a computed value.
+ * @param value Value to keep.
+ * @return None.
+ */
+template <typename T>
+static inline void bench_keep( const T & value )
+{
+    asm volatile( "" : : "g"( &value ) : "memory" );
+}
+
+/*!
+ * @brief Run function nb_runs times and return the best duration.
+ * @param nb_runs   Number of runs.
+ * @param func      Function to bench.
+ * @return Best duration of one run in seconds.
+ */
+template <typename F>
+static double bench_run( unsigned int nb_runs, F func )
+{
+    double best = 0.0;
+
+    for( unsigned int i = 0; i < nb_runs; i++ )
+    {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start;
+
+        if( ( 0 == i ) || ( elapsed.count() < best ) )
+        {
+            best = elapsed.count();
+        }
+    }
+
+    return best;
+}
+
+/*!
+ * @brief Display benchmark result.
+ * @param name      Benchmark name.
+ * @param seconds   Duration in seconds.
+ * @param nb_items  Number of items processed.
+ * @param nb_bytes  Number of bytes processed (0 if not relevant).
+ * @return None.
+ */
+static inline void bench_report( const char * name,
+                                 double seconds,
+                                 double nb_items,
+                                 double nb_bytes )
+{
+    printf( "%-40s %10.3f ms %12.2f Mitems/s", name, seconds * 1e3,
+            nb_items / seconds / 1e6 );
+    if( nb_bytes > 0 )
+    {
+        printf( " %8.3f GB/s", nb_bytes / seconds / 1e9 );
+    }
+    printf( "\r\n" );
+}
+
+#endif /* BENCH_UTILS_H__ */
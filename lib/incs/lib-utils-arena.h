@@ -0,0 +1,74 @@
+/*!
+ * @file: lib-utils-arena.h
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of arena (bump) allocator.
+ *
+ * Memory is taken from large blocks by moving a pointer. Allocations are not
+ * freed one by one: arena_reset releases all of them at once (blocks are kept
+ * to be reused) and arena_destroy gives blocks back to the system.
+ */
+#ifndef LIB_UTILS_ARENA_H__
+#define LIB_UTILS_ARENA_H__
+
+#include <stddef.h>
+
+/*!
+ * @brief Default size of arena blocks.
+ */
+#define ARENA_DEFAULT_BLOCK_SIZE    ( 64 * 1024 )
+
+/*!
+ * @struct arena_t
+ * @brief Arena allocator (private).
+ */
+typedef struct arena_t arena_t;
+
+/*!
+ * @brief Create an arena (no block is allocated before first allocation).
+ * @param block_size    Size of blocks (0 for default size, larger allocations
+ *                      get their own block).
+ * @return The arena on success otherwise NULL.
+ */
+arena_t * arena_create( size_t block_size );
+
+/*!
+ * @brief Release all memory of arena.
+ * @param arena     Arena (can be NULL).
+ * @return None.
+ */
+void arena_destroy( arena_t * arena );
+
+/*!
+ * @brief Allocate memory aligned for any type (as malloc) from arena.
+ * @param arena     Arena.
+ * @param size      Size in bytes.
+ * @return The allocated memory on success otherwise NULL.
+ */
+void * arena_alloc( arena_t * arena, size_t size );
+
+/*!
+ * @brief Allocate memory with a given alignment from arena.
+ * @param arena     Arena.
+ * @param size      Size in bytes.
+ * @param alignment Alignment in bytes (power of 2).
+ * @return The allocated memory on success otherwise NULL.
+ */
+void * arena_alloc_aligned( arena_t * arena, size_t size, size_t alignment );
+
+/*!
+ * @brief Release all allocations of arena in constant time (memory returned
+ *        before is no longer valid, blocks are reused by next allocations).
+ * @param arena     Arena.
+ * @return None.
+ */
+void arena_reset( arena_t * arena );
+
+/*!
+ * @brief Return size of memory reserved by arena blocks.
+ * @param arena     Arena.
+ * @return The size in bytes of all blocks (0 if arena is NULL).
+ */
+size_t arena_get_capacity( const arena_t * arena );
+
+#endif /* LIB_UTILS_ARENA_H__ */
@@ -0,0 +1,102 @@
+/*!
+ * @file: lib-utils-file-reader.h
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of function to read large delimited files.
+ *
+ * File is split into records (lines terminated by '\n', a '\r' before '\n' is
+ * removed) and records into fields (separated by delimiter) without copy:
+ * returned pointers reference the mapped file or the read buffer and are not
+ * NUL terminated, so fields are given directly to parse_<type>_n functions.
+ * Records are always contiguous even when they span two read chunks.
+ */
+#ifndef LIB_UTILS_FILE_READER_H__
+#define LIB_UTILS_FILE_READER_H__
+
+#include <stddef.h>
+
+/*!
+ * @brief Default size of read chunk.
+ */
+#define FILE_READER_DEFAULT_CHUNK_SIZE  ( 1024 * 1024 )
+
+/*!
+ * @enum file_reader_mode_t
+ * @brief Method used to access file content.
+ */
+typedef enum file_reader_mode_t
+{
+    FILE_READER_MODE_AUTO   = 0,    /*!< mmap if supported otherwise read. */
+    FILE_READER_MODE_MMAP   = 1,    /*!< Map whole file in memory. */
+    FILE_READER_MODE_READ   = 2,    /*!< Read file by chunks. */
+} file_reader_mode_t;
+
+/*!
+ * @struct file_reader_t
+ * @brief File reader context (fields are private).
+ */
+typedef struct file_reader_t
+{
+    int             fd;             /*!< File descriptor. */
+    char            delim;          /*!< Field delimiter. */
+    int             eof;            /*!< Non zero when whole file is read. */
+    char *          map;            /*!< Mapped file (NULL in read mode). */
+    size_t          map_size;       /*!< Size of mapped file. */
+    char *          buffer;         /*!< Read buffer (NULL in mmap mode). */
+    size_t          buffer_size;    /*!< Allocated size of read buffer. */
+    const char *    data;           /*!< Available data (map or buffer). */
+    size_t          data_len;       /*!< Length of available data. */
+    size_t          pos;            /*!< Start of next record in data. */
+    size_t          scan;           /*!< Data already searched for '\n'. */
+    const char *    record;         /*!< Current record. */
+    size_t          record_len;     /*!< Length of current record. */
+    size_t          field_pos;      /*!< Start of next field in record. */
+} file_reader_t;
+
+/*!
+ * @brief Open file to read.
+ * @param reader        Reader context to initialize.
+ * @param path          Path of file.
+ * @param delim         Field delimiter.
+ * @param mode          Method used to access file content.
+ * @param chunk_size    Size of read chunk (0 for default size, buffer grows
+ *                      if a record is larger).
+ * @return 0 on success otherwise -1.
+ */
+int file_reader_open( file_reader_t * reader,
+                      const char * path,
+                      char delim,
+                      file_reader_mode_t mode,
+                      size_t chunk_size );
+
+/*!
+ * @brief Close file and release reader resources.
+ * @param reader    Reader context.
+ * @return None.
+ */
+void file_reader_close( file_reader_t * reader );
+
+/*!
+ * @brief Go to next record (previous record and fields are no longer valid).
+ * @param reader    Reader context.
+ * @param record    Pointer to store record (can be NULL).
+ * @param len       Pointer to store length of record (can be NULL).
+ * @return 1 if a record is available, 0 at end of file otherwise -1 (read
+ *         error).
+ */
+int file_reader_next_record( file_reader_t * reader,
+                             const char ** record,
+                             size_t * len );
+
+/*!
+ * @brief Return next field of current record (an empty record has no field).
+ * @param reader    Reader context.
+ * @param field     Pointer to store field.
+ * @param len       Pointer to store length of field.
+ * @return 1 if a field is available, 0 at end of record otherwise -1.
+ */
+int file_reader_next_field( file_reader_t * reader,
+                            const char ** field,
+                            size_t * len );
+
+#endif /* LIB_UTILS_FILE_READER_H__ */
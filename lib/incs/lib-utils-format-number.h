@@ -0,0 +1,103 @@
+/*!
+ * @file: lib-utils-format-number.h
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of function to format number into string.
+ */
+#ifndef LIB_UTILS_FORMAT_NUMBER_H__
+#define LIB_UTILS_FORMAT_NUMBER_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * @brief Size of buffer large enough for any formatted number (including NUL
+ *        terminator).
+ */
+#define FORMAT_NUMBER_BUFFER_SIZE   ( 32 )
+
+/*
+ * Number formatters.
+ *
+ * Write number in decimal (or hexadecimal) into caller buffer followed by NUL
+ * terminator. Output does not depend on locale, no memory is allocated and
+ * output is accepted by the parse_<type> function of the same type. Buffer is
+ * left unchanged on error.
+ */
+
+/*!
+ * @brief Format uint32_t into string.
+ * @param number    Value to format.
+ * @param buf       Buffer to store string.
+ * @param size      Size of buffer in bytes.
+ * @return Length of string (without NUL terminator) otherwise -1 (buffer too
+ *         small).
+ */
+int format_uint32(uint32_t number, char * buf, size_t size);
+
+/*!
+ * @brief Format int32_t into string.
+ * @param number    Value to format.
+ * @param buf       Buffer to store string.
+ * @param size      Size of buffer in bytes.
+ * @return Length of string (without NUL terminator) otherwise -1 (buffer too
+ *         small).
+ */
+int format_int32(int32_t number, char * buf, size_t size);
+
+/*!
+ * @brief Format uint32_t into hexadecimal string (lower case, without 0x
+ *        prefix).
+ * @param hex       Value to format.
+ * @param buf       Buffer to store string.
+ * @param size      Size of buffer in bytes.
+ * @return Length of string (without NUL terminator) otherwise -1 (buffer too
+ *         small).
+ */
+int format_hex32(uint32_t hex, char * buf, size_t size);
+
+/*!
+ * @brief Format uint64_t into string.
+ * @param number    Value to format.
+ * @param buf       Buffer to store string.
+ * @param size      Size of buffer in bytes.
+ * @return Length of string (without NUL terminator) otherwise -1 (buffer too
+ *         small).
+ */
+int format_uint64(uint64_t number, char * buf, size_t size);
+
+/*!
+ * @brief Format int64_t into string.
+ * @param number    Value to format.
+ * @param buf       Buffer to store string.
+ * @param size      Size of buffer in bytes.
+ * @return Length of string (without NUL terminator) otherwise -1 (buffer too
+ *         small).
+ */
+int format_int64(int64_t number, char * buf, size_t size);
+
+/*!
+ * @brief Format uint64_t into hexadecimal string (lower case, without 0x
+ *        prefix).
+ * @param hex       Value to format.
+ * @param buf       Buffer to store string.
+ * @param size      Size of buffer in bytes.
+ * @return Length of string (without NUL terminator) otherwise -1 (buffer too
+ *         small).
+ */
+int format_hex64(uint64_t hex, char * buf, size_t size);
+
+/*!
+ * @brief Format double float into the shortest string parsed back to the same
+ *        value. Fixed notation is used when decimal exponent is in [-5, 17[
+ *        otherwise scientific notation (for example "1.5e+300"), infinity and
+ *        NaN are written "inf", "-inf" and "nan".
+ * @param number    Value to format.
+ * @param buf       Buffer to store string.
+ * @param size      Size of buffer in bytes.
+ * @return Length of string (without NUL terminator) otherwise -1 (buffer too
+ *         small).
+ */
+int format_double(double number, char * buf, size_t size);
+
+#endif /* LIB_UTILS_FORMAT_NUMBER_H__ */
@@ -0,0 +1,164 @@
+/*!
+ * @file: lib-utils-hash-map.h
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of open addressing hash map.
+ *
+ * Entries are stored in one flat array with one control byte per entry
+ * (empty, deleted or 7 bits of hash of key): a lookup compares the control
+ * bytes of 16 entries at once and reads only entries whose bits match.
+ * Keys are either 64 bits integers or strings (copied by the map), values are
+ * pointers owned by the caller. Adding or removing entries invalidates
+ * iteration positions.
+ */
+#ifndef LIB_UTILS_HASH_MAP_H__
+#define LIB_UTILS_HASH_MAP_H__
+
+#include <stddef.h>
+
+#include "lib-utils-types.h"
+
+/*!
+ * @brief Default number of entries reserved by hash map.
+ */
+#define HASH_MAP_DEFAULT_CAPACITY   ( 14 )
+
+/*!
+ * @enum hash_map_key_t
+ * @brief Type of keys of hash map.
+ */
+typedef enum hash_map_key_t
+{
+    HASH_MAP_KEY_UINT64 = 0,    /*!< 64 bits unsigned integer keys. */
+    HASH_MAP_KEY_STRING,        /*!< NUL terminated string keys. */
+} hash_map_key_t;
+
+/*!
+ * @struct hash_map_t
+ * @brief Hash map (private).
+ */
+typedef struct hash_map_t hash_map_t;
+
+/*!
+ * @struct hash_map_entry_t
+ * @brief Entry of hash map returned by iteration.
+ */
+typedef struct hash_map_entry_t
+{
+    uint64_t        key_uint64; /*!< Integer key (HASH_MAP_KEY_UINT64). */
+    const char *    key_string; /*!< String key (HASH_MAP_KEY_STRING). */
+    void *          value;      /*!< Value. */
+} hash_map_entry_t;
+
+/*!
+ * @brief Create a hash map.
+ * @param key_type  Type of keys.
+ * @param capacity  Number of entries to reserve (0 for default).
+ * @return The hash map on success otherwise NULL.
+ */
+hash_map_t * hash_map_create( hash_map_key_t key_type, size_t capacity );
+
+/*!
+ * @brief Release hash map and its copies of keys (values are not released).
+ * @param map   Hash map (can be NULL).
+ * @return None.
+ */
+void hash_map_destroy( hash_map_t * map );
+
+/*!
+ * @brief Remove all entries of hash map (memory is kept).
+ * @param map   Hash map.
+ * @return None.
+ */
+void hash_map_clear( hash_map_t * map );
+
+/*!
+ * @brief Reserve memory for a number of entries.
+ * @param map       Hash map.
+ * @param capacity  Number of entries.
+ * @return 0 on success otherwise -1.
+ */
+int hash_map_reserve( hash_map_t * map, size_t capacity );
+
+/*!
+ * @brief Return number of entries of hash map.
+ * @param map   Hash map.
+ * @return The number of entries (0 if map is NULL).
+ */
+size_t hash_map_get_count( const hash_map_t * map );
+
+/*!
+ * @brief Add entry or replace value of existing key (integer keys).
+ * @param map   Hash map.
+ * @param key   Key.
+ * @param value Value.
+ * @return 0 on success otherwise -1.
+ */
+int hash_map_set_uint64( hash_map_t * map, uint64_t key, void * value );
+
+/*!
+ * @brief Find value of key (integer keys).
+ * @param map   Hash map.
+ * @param key   Key.
+ * @param value Value of key on return (can be NULL).
+ * @return 0 if key is found otherwise -1.
+ */
+int hash_map_get_uint64( const hash_map_t * map, uint64_t key, void ** value );
+
+/*!
+ * @brief Remove entry of key (integer keys).
+ * @param map   Hash map.
+ * @param key   Key.
+ * @return 0 if key was found otherwise -1.
+ */
+int hash_map_remove_uint64( hash_map_t * map, uint64_t key );
+
+/*!
+ * @brief Add entry or replace value of existing key (string keys).
+ * @param map   Hash map.
+ * @param key   Key (copied, can be empty).
+ * @param value Value.
+ * @return 0 on success otherwise -1.
+ */
+int hash_map_set_string( hash_map_t * map, const char * key, void * value );
+
+/*!
+ * @brief Find value of key (string keys).
+ * @param map   Hash map.
+ * @param key   Key.
+ * @param value Value of key on return (can be NULL).
+ * @return 0 if key is found otherwise -1.
+ */
+int hash_map_get_string( const hash_map_t * map, const char * key, void ** value );
+
+/*!
+ * @brief Find value of key given by a buffer (string keys).
+ * @param map   Hash map.
+ * @param key   Key (NUL termination not required).
+ * @param len   Length of key in bytes.
+ * @param value Value of key on return (can be NULL).
+ * @return 0 if key is found otherwise -1.
+ */
+int hash_map_get_string_n( const hash_map_t * map,
+                           const char * key,
+                           size_t len,
+                           void ** value );
+
+/*!
+ * @brief Remove entry of key (string keys).
+ * @param map   Hash map.
+ * @param key   Key.
+ * @return 0 if key was found otherwise -1.
+ */
+int hash_map_remove_string( hash_map_t * map, const char * key );
+
+/*!
+ * @brief Get next entry of hash map (entries are returned in no order).
+ * @param map   Hash map.
+ * @param pos   Iteration position (0 to get first entry, updated on return).
+ * @param entry Entry on return.
+ * @return 0 if an entry is returned otherwise -1 (end of map).
+ */
+int hash_map_next( const hash_map_t * map, size_t * pos, hash_map_entry_t * entry );
+
+#endif /* LIB_UTILS_HASH_MAP_H__ */
@@ -0,0 +1,99 @@
+/*!
+ * @file: lib-utils-hash.h
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of fast non-cryptographic hash functions.
+ *
+ * Hashes are 64 bits wyhash (final version 4) values: same results as the
+ * reference implementation and its published test vectors on any platform.
+ * They are not suitable for cryptography (use a random seed for tables
+ * exposed to untrusted keys).
+ */
+#ifndef LIB_UTILS_HASH_H__
+#define LIB_UTILS_HASH_H__
+
+#include <stddef.h>
+
+#include "lib-utils-types.h"
+
+/*!
+ * @brief Seed of unseeded hash functions.
+ */
+#define HASH_DEFAULT_SEED   ( 0 )
+
+/*!
+ * @brief Size of blocks processed by hash functions.
+ */
+#define HASH_BLOCK_SIZE     ( 48 )
+
+/*!
+ * @struct hash_state_t
+ * @brief State of incremental hash (fields are private).
+ */
+typedef struct hash_state_t
+{
+    uint64_t    seed[3];                        /*!< Lanes of hash. */
+    uint64_t    length;                         /*!< Number of bytes hashed. */
+    size_t      pending;                        /*!< Number of pending bytes. */
+    uint8_t     buffer[16 + HASH_BLOCK_SIZE];   /*!< End of last block then
+                                                     pending bytes. */
+} hash_state_t;
+
+/*!
+ * @brief Hash buffer.
+ * @param buf   Buffer.
+ * @param len   Length of buffer in bytes.
+ * @return The hash of buffer (0 if buf is NULL).
+ */
+uint64_t hash_buffer( const void * buf, size_t len );
+
+/*!
+ * @brief Hash buffer with a seed.
+ * @param buf   Buffer.
+ * @param len   Length of buffer in bytes.
+ * @param seed  Seed (different seeds give unrelated hashes).
+ * @return The hash of buffer (0 if buf is NULL).
+ */
+uint64_t hash_buffer_seed( const void * buf, size_t len, uint64_t seed );
+
+/*!
+ * @brief Hash NUL terminated string (same hash as its characters buffer).
+ * @param str   String.
+ * @return The hash of string (0 if str is NULL).
+ */
+uint64_t hash_string( const char * str );
+
+/*!
+ * @brief Hash NUL terminated string with a seed.
+ * @param str   String.
+ * @param seed  Seed.
+ * @return The hash of string (0 if str is NULL).
+ */
+uint64_t hash_string_seed( const char * str, uint64_t seed );
+
+/*!
+ * @brief Start incremental hash.
+ * @param state Hash state.
+ * @param seed  Seed.
+ * @return None.
+ */
+void hash_state_init( hash_state_t * state, uint64_t seed );
+
+/*!
+ * @brief Add buffer to incremental hash.
+ * @param state Hash state.
+ * @param buf   Buffer (can be NULL if len is 0).
+ * @param len   Length of buffer in bytes.
+ * @return 0 on success otherwise -1.
+ */
+int hash_state_update( hash_state_t * state, const void * buf, size_t len );
+
+/*!
+ * @brief Return hash of all added buffers (same as hash_buffer_seed of their
+ *        concatenation, state can still be updated).
+ * @param state Hash state.
+ * @return The hash (0 if state is NULL).
+ */
+uint64_t hash_state_final( const hash_state_t * state );
+
+#endif /* LIB_UTILS_HASH_H__ */
@@ -0,0 +1,84 @@
+/*!
+ * @file: lib-utils-intern.h
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of string interning table.
+ *
+ * An intern table keeps one copy of each distinct string and always returns
+ * the same pointer for equal strings: interned strings are compared by
+ * pointer. Copies are stored in an arena and are valid until the table is
+ * destroyed. Tables can be used by several threads simultaneously: lookups of
+ * already interned strings take no lock and write no shared memory.
+ */
+#ifndef LIB_UTILS_INTERN_H__
+#define LIB_UTILS_INTERN_H__
+
+#include <stddef.h>
+
+/*!
+ * @brief Default number of slots of intern table (grows when half full).
+ */
+#define INTERN_TABLE_DEFAULT_CAPACITY   ( 256 )
+
+/*!
+ * @struct intern_table_t
+ * @brief String interning table (private).
+ */
+typedef struct intern_table_t intern_table_t;
+
+/*!
+ * @brief Create an intern table.
+ * @param capacity  Expected number of distinct strings (0 for default).
+ * @return The intern table on success otherwise NULL.
+ */
+intern_table_t * intern_table_create( size_t capacity );
+
+/*!
+ * @brief Release intern table and all interned strings.
+ * @param table     Intern table (can be NULL).
+ * @return None.
+ */
+void intern_table_destroy( intern_table_t * table );
+
+/*!
+ * @brief Return canonical copy of string (added if not yet interned).
+ * @param table     Intern table.
+ * @param str       String to intern (can be empty).
+ * @return The interned string on success otherwise NULL.
+ */
+const char * intern_string( intern_table_t * table, const char * str );
+
+/*!
+ * @brief Return canonical copy of buffer (added if not yet interned).
+ * @param table     Intern table.
+ * @param str       Buffer to intern (NUL termination not required).
+ * @param len       Length of buffer in bytes.
+ * @return The interned NUL terminated string on success otherwise NULL.
+ */
+const char * intern_string_n( intern_table_t * table,
+                              const char * str,
+                              size_t len );
+
+/*!
+ * @brief Return canonical copy of string if already interned.
+ * @param table     Intern table.
+ * @param str       String to look for.
+ * @return The interned string if found otherwise NULL.
+ */
+const char * intern_lookup( intern_table_t * table, const char * str );
+
+/*!
+ * @brief Return number of distinct strings of intern table.
+ * @param table     Intern table.
+ * @return The number of interned strings (0 if table is NULL).
+ */
+size_t intern_table_get_count( intern_table_t * table );
+
+/*!
+ * @brief Return memory used by intern table (slots and string storage).
+ * @param table     Intern table.
+ * @return The size in bytes (0 if table is NULL).
+ */
+size_t intern_table_get_memory( intern_table_t * table );
+
+#endif /* LIB_UTILS_INTERN_H__ */
@@ -0,0 +1,152 @@
+/*!
+ * @file: lib-utils-owned-string.h
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of owned string with small string optimization.
+ *
+ * Strings up to LU_STRING_SMALL_CAPACITY bytes are stored inside the
+ * lu_string_t itself: no allocation, no pointer to follow and nothing to free.
+ * Longer strings spill to a buffer allocated from the heap or from the arena
+ * given at initialization. A string is stored inline if and only if its length
+ * is lower or equal to LU_STRING_SMALL_CAPACITY. The string is always NUL
+ * terminated.
+ */
+#ifndef LIB_UTILS_OWNED_STRING_H__
+#define LIB_UTILS_OWNED_STRING_H__
+
+#include <stddef.h>
+
+#include "lib-utils-arena.h"
+#include "lib-utils-strview.h"
+
+/*!
+ * @brief Maximum length of a string stored inline (NUL excluded).
+ */
+#define LU_STRING_SMALL_CAPACITY    ( 23 )
+
+/*!
+ * @brief Static initializer of an empty string which spills to the heap.
+ */
+#define LU_STRING_INIT              { { { 0 } }, 0, NULL }
+
+/*!
+ * @struct lu_string_t
+ * @brief Owned string (fields are private).
+ */
+typedef struct lu_string_t
+{
+    union
+    {
+        char        small[LU_STRING_SMALL_CAPACITY + 1];    /*!< Inline
+                                                                 storage. */
+        struct
+        {
+            char *  data;       /*!< Spilled buffer. */
+            size_t  capacity;   /*!< Allocated size of buffer (NUL
+                                     included). */
+        } large;
+    } u;
+    size_t          len;        /*!< Length of string. */
+    arena_t *       arena;      /*!< Arena of spilled buffers (NULL for
+                                     heap). */
+} lu_string_t;
+
+/*!
+ * @brief Initialize an empty string.
+ * @param str   String to initialize.
+ * @param arena Arena to allocate long strings from (NULL for heap, must
+ *              outlive string).
+ * @return 0 on success otherwise -1.
+ */
+int lu_string_init( lu_string_t * str, arena_t * arena );
+
+/*!
+ * @brief Release buffer of string (string is empty after and can be reused,
+ *        arena buffers are released by arena_reset or arena_destroy).
+ * @param str   String (can be NULL).
+ * @return None.
+ */
+void lu_string_free( lu_string_t * str );
+
+/*!
+ * @brief Replace content of string.
+ * @param str   String.
+ * @param view  New content (can be empty, can be a part of str).
+ * @return 0 on success otherwise -1 (str is unchanged).
+ */
+int lu_string_assign( lu_string_t * str, lu_strview_t view );
+
+/*!
+ * @brief Copy string (dst keeps its own allocator).
+ * @param dst   Initialized string to replace.
+ * @param src   String to copy.
+ * @return 0 on success otherwise -1 (dst is unchanged).
+ */
+int lu_string_copy( lu_string_t * dst, const lu_string_t * src );
+
+/*!
+ * @brief Move string: dst takes content and allocator of src without copy of
+ *        spilled buffer, src is empty after.
+ * @param dst   Initialized string to replace (its buffer is released).
+ * @param src   String to move.
+ * @return 0 on success otherwise -1.
+ */
+int lu_string_move( lu_string_t * dst, lu_string_t * src );
+
+/*!
+ * @brief Append bytes to string (amortized constant time).
+ * @param str   String.
+ * @param view  Bytes to append (can be empty, can be a part of str).
+ * @return 0 on success otherwise -1 (str is unchanged).
+ */
+int lu_string_concat( lu_string_t * str, lu_strview_t view );
+
+/*!
+ * @brief Compare two strings (see lu_strview_compare).
+ * @param str1  First string.
+ * @param str2  Second string.
+ * @return Negative value if str1 < str2, 0 if equal otherwise positive value.
+ */
+int lu_string_compare( const lu_string_t * str1, const lu_string_t * str2 );
+
+/*!
+ * @brief Check if string is stored inline.
+ * @param str   String.
+ * @return Non zero if string is stored inline otherwise 0.
+ */
+static inline int lu_string_is_small( const lu_string_t * str )
+{
+    return str->len <= LU_STRING_SMALL_CAPACITY;
+}
+
+/*!
+ * @brief Borrow NUL terminated string (valid until next modification).
+ * @param str   String.
+ * @return The NUL terminated string.
+ */
+static inline const char * lu_string_cstr( const lu_string_t * str )
+{
+    return lu_string_is_small( str ) ? str->u.small : str->u.large.data;
+}
+
+/*!
+ * @brief Return length of string.
+ * @param str   String.
+ * @return The length of string in bytes.
+ */
+static inline size_t lu_string_length( const lu_string_t * str )
+{
+    return str->len;
+}
+
+/*!
+ * @brief Borrow view of string (valid until next modification).
+ * @param str   String.
+ * @return The view.
+ */
+static inline lu_strview_t lu_string_view( const lu_string_t * str )
+{
+    return lu_strview( lu_string_cstr( str ), str->len );
+}
+
+#endif /* LIB_UTILS_OWNED_STRING_H__ */
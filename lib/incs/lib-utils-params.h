@@ -0,0 +1,286 @@
+/*!
+ * @file: lib-utils-params.h
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of command line parameters parser driven by parameters
+ *         descriptions.
+ *
+ * A table of parameter_description_t (terminated by a SENTINEL_TYPE entry)
+ * describes where and how each option is stored in a parameters structure.
+ * Array parameters (--ids 1,2,3) are parsed in one pass by array number
+ * parsers into a param_array_t buffer preallocated by caller.
+ * An index built once from the table resolves short names with a 256 entries
+ * table and long names with a perfect hash. parse_params_tokens parses any
+ * array of tokens with an index: it has no global state, does not modify
+ * tokens and does not allocate, so it can be called repeatedly and from
+ * several threads sharing the same index.
+ *
+ * Parameters can also be read from files mapped in memory and tokenized in
+ * place (no allocation per token, STR_TYPE values point into the file):
+ * response files hold command line tokens separated by white spaces (quotes
+ * and backslash escapes like a shell) and config files hold one
+ * "longname = value" per line ('#' or ';' starts a comment line).
+ */
+#ifndef LIB_UTILS_PARAMS_H__
+#define LIB_UTILS_PARAMS_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lib-utils-perfect-hash.h"
+
+/*!
+ * @struct param_type_t
+ * @brief Parameters type enumeration.
+ */
+typedef enum param_type_t
+{
+    U8_TYPE         = 0,    /*!< Parameter is uint8_t*/
+    I8_TYPE         = 1,    /*!< Parameter is int8_t */
+    HEX8_TYPE       = 2,    /*!< Parameter is hex store in uint8_t */
+    U16_TYPE        = 3,    /*!< Parameter is uint16_t*/
+    I16_TYPE        = 4,    /*!< Parameter is int16_t */
+    HEX16_TYPE      = 5,    /*!< Parameter is hex store in uint16_t */
+    U32_TYPE        = 6,    /*!< Parameter is uint32_t*/
+    I32_TYPE        = 7,    /*!< Parameter is int32_t */
+    HEX32_TYPE      = 8,    /*!< Parameter is hex store in uint32_t */
+    U64_TYPE        = 9,    /*!< Parameter is uint64_t*/
+    I64_TYPE        = 10,   /*!< Parameter is int64_t */
+    HEX64_TYPE      = 11,   /*!< Parameter is hex store in uint64_t */
+    DFLOAT_TYPE     = 12,   /*!< Parameter is double float */
+    STR_TYPE        = 13,   /*!< Parameter is C string (const char *
+                                 pointing into tokens). */
+    BOOL_TYPE       = 14,   /*!< Parameter is boolean. */
+    CHAR_TYPE       = 15,   /*!< Parameter is char. */
+    U8_ARRAY_TYPE   = 16,   /*!< Parameter is array of uint8_t. */
+    I8_ARRAY_TYPE   = 17,   /*!< Parameter is array of int8_t. */
+    HEX8_ARRAY_TYPE = 18,   /*!< Parameter is array of hex in uint8_t. */
+    U16_ARRAY_TYPE  = 19,   /*!< Parameter is array of uint16_t. */
+    I16_ARRAY_TYPE  = 20,   /*!< Parameter is array of int16_t. */
+    HEX16_ARRAY_TYPE = 21,  /*!< Parameter is array of hex in uint16_t. */
+    U32_ARRAY_TYPE  = 22,   /*!< Parameter is array of uint32_t. */
+    I32_ARRAY_TYPE  = 23,   /*!< Parameter is array of int32_t. */
+    HEX32_ARRAY_TYPE = 24,  /*!< Parameter is array of hex in uint32_t. */
+    U64_ARRAY_TYPE  = 25,   /*!< Parameter is array of uint64_t. */
+    I64_ARRAY_TYPE  = 26,   /*!< Parameter is array of int64_t. */
+    HEX64_ARRAY_TYPE = 27,  /*!< Parameter is array of hex in uint64_t. */
+    DFLOAT_ARRAY_TYPE = 28, /*!< Parameter is array of double float. */
+    SENTINEL_TYPE   = -1,   /*!< Sentinelle value. */
+} param_type_t;
+
+/*!
+ * @brief Separator of elements in value of an array parameter.
+ */
+#define PARAM_ARRAY_DELIMITER   ','
+
+/*!
+ * @struct param_array_t
+ * @brief Value of an array parameter (<type>_ARRAY_TYPE): a buffer
+ *        preallocated by caller, filled by parser without allocation.
+ */
+typedef struct param_array_t
+{
+    void *          values;     /*!< Buffer of capacity elements (element
+                                     type given by description). */
+    size_t          capacity;   /*!< Number of elements of values. */
+    size_t          count;      /*!< Number of parsed elements. On error,
+                                     index of invalid element (capacity if
+                                     too many elements). */
+} param_array_t;
+
+/*!
+ * @struct parameter_description_t
+ * @brief Parameter description.
+ */
+typedef struct parameter_description_t
+{
+    int8_t          type;           /*!< Parameter type (see param_type_t
+                                         enum). */
+    uint32_t        offset;         /*!< Offset in parameters struct (in
+                                         bytes). */
+    uint32_t        size;           /*!< Size of parameters (in bytes,
+                                         sizeof( param_array_t ) for
+                                         arrays). */
+    char            arg_shortname;  /*!< Short name of parameter option in
+                                         command line (0 if none). */
+    const char *    arg_longname;   /*!< Long name of parameter option in
+                                         command line (NULL if none). */
+    const char *    help;           /*!< Help string to describe how to use
+                                         parameter. */
+} parameter_description_t;
+
+/*!
+ * @struct params_file_t
+ * @brief Parameters file loaded in memory (fields are private).
+ */
+typedef struct params_file_t
+{
+    char *          data;       /*!< Content of file followed by a NUL
+                                     byte (modified by parsing). */
+    size_t          size;       /*!< Size of file. */
+    size_t          map_size;   /*!< Size of mapping (0 if data is
+                                     allocated). */
+} params_file_t;
+
+/*!
+ * @struct params_index_t
+ * @brief Index of a parameters description table (read only once built).
+ */
+typedef struct params_index_t
+{
+    const parameter_description_t * descriptions;   /*!< Indexed table. */
+    uint16_t                        by_shortname[256];  /*!< Index plus one
+                                                             of description by
+                                                             short name (0 if
+                                                             none). */
+    perfect_hash_t *                by_longname;    /*!< Perfect hash of long
+                                                         names. */
+    size_t                          nb_descriptions;    /*!< Number of indexed
+                                                             descriptions. */
+    bool *                          command_line_only;  /*!< Parameters
+                                                             rejected in files
+                                                             (by description,
+                                                             NULL if none). */
+} params_index_t;
+
+/*!
+ * @brief Build index of a parameters description table (release it with
+ *        params_index_release).
+ * @param index         Index to build.
+ * @param descriptions  Table terminated by a SENTINEL_TYPE entry (must
+ *                      outlive index).
+ * @return 0 on success otherwise -1 (allocation failure or duplicated names).
+ */
+int params_index_init( params_index_t * index,
+                       const parameter_description_t * descriptions );
+
+/*!
+ * @brief Release index of parameters descriptions.
+ * @param index Index (can be NULL).
+ * @return None.
+ */
+void params_index_release( params_index_t * index );
+
+/*!
+ * @brief Accept a parameter only on command line: response and config files
+ *        setting it are rejected (for example option naming a config file
+ *        read before command line).
+ * @param index Index of parameters descriptions.
+ * @param desc  Parameter description (entry of indexed table).
+ * @return 0 on success otherwise -1.
+ */
+int params_index_set_command_line_only( params_index_t * index,
+                                        const parameter_description_t * desc );
+
+/*!
+ * @brief Find parameter description by short name.
+ * @param index     Index of parameters descriptions.
+ * @param shortname Short name of parameter option.
+ * @return The parameter description otherwise NULL.
+ */
+const parameter_description_t * params_index_find_shortname(
+                                        const params_index_t * index,
+                                        char shortname );
+
+/*!
+ * @brief Find parameter description by long name.
+ * @param index     Index of parameters descriptions.
+ * @param longname  Long name of parameter option (NUL termination not
+ *                  required).
+ * @param len       Length of long name.
+ * @return The parameter description otherwise NULL.
+ */
+const parameter_description_t * params_index_find_longname(
+                                        const params_index_t * index,
+                                        const char * longname,
+                                        size_t len );
+
+/*!
+ * @brief Parse value of a parameter and store it in parameters struct.
+ * @param desc      Parameter description.
+ * @param value     String contains parameter value (STR_TYPE keeps pointer on
+ *                  it, BOOL_TYPE accepts NULL for true, "true", "false", "1"
+ *                  or "0", array types accept elements separated by
+ *                  PARAM_ARRAY_DELIMITER and replace previous elements).
+ * @param params    Parameters struct.
+ * @return 0 on success otherwise -1 (for arrays, count of param_array_t is
+ *         the index of invalid element).
+ */
+int set_param_value( const parameter_description_t * desc,
+                     const char * value,
+                     void * params );
+
+/*!
+ * @brief Parse options of an array of tokens (re-entrant).
+ *
+ * Accepted forms are -f, -abc (grouped flags), -o value, -ovalue,
+ * --flag, --option value and --option=value. Long names must be complete
+ * (no abbreviation). Tokens which are not options (including "-") are
+ * skipped and "--" ends options.
+ *
+ * @param index     Index of parameters descriptions.
+ * @param nb_tokens Number of tokens.
+ * @param tokens    Tokens (not modified, argv + 1 for a command line).
+ * @param params    Parameters struct (initialized with defaults by caller).
+ * @return 0 on success otherwise -1 (unknown option, missing or invalid
+ *         value).
+ */
+int parse_params_tokens( const params_index_t * index,
+                         size_t nb_tokens,
+                         const char * const * tokens,
+                         void * params );
+
+/*!
+ * @brief Load file of parameters (mapped privately, read if mmap is not
+ *        supported).
+ * @param file  File to initialize.
+ * @param path  Path of file.
+ * @return 0 on success otherwise -1.
+ */
+int params_file_open( params_file_t * file, const char * path );
+
+/*!
+ * @brief Release file of parameters (STR_TYPE values read from file are no
+ *        longer valid).
+ * @param file  File (can be NULL).
+ * @return None.
+ */
+void params_file_close( params_file_t * file );
+
+/*!
+ * @brief Parse a response file: its tokens are parsed as parse_params_tokens
+ *        does (a file can be parsed only once: it is tokenized in place).
+ *
+ * Tokens are separated by white spaces. Quotes ('...' or "...") keep white
+ * spaces, a backslash escapes next character (except inside '...'). Nested
+ * response files (tokens starting with '@') are not supported.
+ *
+ * @param index     Index of parameters descriptions.
+ * @param file      Loaded file.
+ * @param params    Parameters struct.
+ * @return 0 on success otherwise -1 (also for command line only parameters).
+ */
+int parse_params_response_file( const params_index_t * index,
+                                params_file_t * file,
+                                void * params );
+
+/*!
+ * @brief Parse a config file: one "longname = value" or "longname" (flag)
+ *        per line (a file can be parsed only once: it is tokenized in place).
+ *
+ * White spaces around names and values are ignored, a value can be quoted to
+ * keep them. Lines starting with '#' or ';' and empty lines are ignored.
+ * Flags accept a true/false value.
+ *
+ * @param index     Index of parameters descriptions.
+ * @param file      Loaded file.
+ * @param params    Parameters struct.
+ * @return 0 on success otherwise -1 (unknown name, invalid value or command
+ *         line only parameter).
+ */
+int parse_params_config_file( const params_index_t * index,
+                              params_file_t * file,
+                              void * params );
+
+#endif /* LIB_UTILS_PARAMS_H__ */
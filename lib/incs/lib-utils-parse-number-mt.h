@@ -0,0 +1,336 @@
+/*!
+ * @file: lib-utils-parse-number-mt.h
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of multithreaded array number parsers.
+ *
+ * The buffer is split into chunks just after a delimiter, so that no value is
+ * cut. Delimiters of each chunk are counted to know where its values go in the
+ * output array, then chunks are parsed in parallel by the threads of a parse
+ * pool directly in the caller array. Returned value and *consumed are the same
+ * as the single threaded parse_<type>_array functions (see
+ * lib-utils-parse-number.h). Elements of out after the returned count may be
+ * modified.
+ */
+#ifndef LIB_UTILS_PARSE_NUMBER_MT_H__
+#define LIB_UTILS_PARSE_NUMBER_MT_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * @brief Minimum size of a chunk (smaller buffers are not split).
+ */
+#define PARSE_POOL_MIN_CHUNK_SIZE   ( 64 * 1024 )
+
+/*!
+ * @brief Number of chunks per thread (balance load between threads).
+ */
+#define PARSE_POOL_CHUNKS_PER_THREAD    4
+
+/*!
+ * @struct parse_pool_t
+ * @brief Pool of parse threads (private).
+ */
+typedef struct parse_pool_t parse_pool_t;
+
+/*!
+ * @brief Create a parse pool and start its threads.
+ * @param nb_threads    Number of threads parsing a buffer, including the
+ *                      calling thread (1 to parse in calling thread only).
+ * @return The parse pool on success otherwise NULL.
+ */
+parse_pool_t * parse_pool_create( unsigned int nb_threads );
+
+/*!
+ * @brief Stop threads and release parse pool.
+ * @param pool  Parse pool (can be NULL).
+ * @return None.
+ */
+void parse_pool_destroy( parse_pool_t * pool );
+
+/*!
+ * @brief Return number of threads of parse pool.
+ * @param pool  Parse pool.
+ * @return The number of threads (0 if pool is NULL).
+ */
+unsigned int parse_pool_get_nb_threads( const parse_pool_t * pool );
+
+/*
+ * Multithreaded array parsers.
+ *
+ * A parse pool runs one parse at a time: it must not be used by several
+ * threads simultaneously.
+ */
+
+/*!
+ * @brief Parse uint8_t separated by delim from buffer with pool threads.
+ * @param pool      Parse pool.
+ * @param buf       Buffer contains uint8_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_uint8_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             uint8_t * out,
+                             size_t max_out,
+                             size_t * consumed );
+
+/*!
+ * @brief Parse int8_t separated by delim from buffer with pool threads.
+ * @param pool      Parse pool.
+ * @param buf       Buffer contains int8_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_int8_array_mt( parse_pool_t * pool,
+                            const char * buf,
+                            size_t len,
+                            char delim,
+                            int8_t * out,
+                            size_t max_out,
+                            size_t * consumed );
+
+/*!
+ * @brief Parse hexadecimal uint8_t separated by delim from buffer with pool
+ *        threads.
+ * @param pool      Parse pool.
+ * @param buf       Buffer contains hexadecimal uint8_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_hex8_array_mt( parse_pool_t * pool,
+                            const char * buf,
+                            size_t len,
+                            char delim,
+                            uint8_t * out,
+                            size_t max_out,
+                            size_t * consumed );
+
+/*!
+ * @brief Parse uint16_t separated by delim from buffer with pool threads.
+ * @param pool      Parse pool.
+ * @param buf       Buffer contains uint16_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_uint16_array_mt( parse_pool_t * pool,
+                              const char * buf,
+                              size_t len,
+                              char delim,
+                              uint16_t * out,
+                              size_t max_out,
+                              size_t * consumed );
+
+/*!
+ * @brief Parse int16_t separated by delim from buffer with pool threads.
+ * @param pool      Parse pool.
+ * @param buf       Buffer contains int16_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_int16_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             int16_t * out,
+                             size_t max_out,
+                             size_t * consumed );
+
+/*!
+ * @brief Parse hexadecimal uint16_t separated by delim from buffer with pool
+ *        threads.
+ * @param pool      Parse pool.
+ * @param buf       Buffer contains hexadecimal uint16_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_hex16_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             uint16_t * out,
+                             size_t max_out,
+                             size_t * consumed );
+
+/*!
+ * @brief Parse uint32_t separated by delim from buffer with pool threads.
+ * @param pool      Parse pool.
+ * @param buf       Buffer contains uint32_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_uint32_array_mt( parse_pool_t * pool,
+                              const char * buf,
+                              size_t len,
+                              char delim,
+                              uint32_t * out,
+                              size_t max_out,
+                              size_t * consumed );
+
+/*!
+ * @brief Parse int32_t separated by delim from buffer with pool threads.
+ * @param pool      Parse pool.
+ * @param buf       Buffer contains int32_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_int32_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             int32_t * out,
+                             size_t max_out,
+                             size_t * consumed );
+
+/*!
+ * @brief Parse hexadecimal uint32_t separated by delim from buffer with pool
+ *        threads.
+ * @param pool      Parse pool.
+ * @param buf       Buffer contains hexadecimal uint32_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_hex32_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             uint32_t * out,
+                             size_t max_out,
+                             size_t * consumed );
+
+/*!
+ * @brief Parse uint64_t separated by delim from buffer with pool threads.
+ * @param pool      Parse pool.
+ * @param buf       Buffer contains uint64_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_uint64_array_mt( parse_pool_t * pool,
+                              const char * buf,
+                              size_t len,
+                              char delim,
+                              uint64_t * out,
+                              size_t max_out,
+                              size_t * consumed );
+
+/*!
+ * @brief Parse int64_t separated by delim from buffer with pool threads.
+ * @param pool      Parse pool.
+ * @param buf       Buffer contains int64_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_int64_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             int64_t * out,
+                             size_t max_out,
+                             size_t * consumed );
+
+/*!
+ * @brief Parse hexadecimal uint64_t separated by delim from buffer with pool
+ *        threads.
+ * @param pool      Parse pool.
+ * @param buf       Buffer contains hexadecimal uint64_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_hex64_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             uint64_t * out,
+                             size_t max_out,
+                             size_t * consumed );
+
+/*!
+ * @brief Parse double separated by delim from buffer with pool threads.
+ * @param pool      Parse pool.
+ * @param buf       Buffer contains double to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_double_array_mt( parse_pool_t * pool,
+                              const char * buf,
+                              size_t len,
+                              char delim,
+                              double * out,
+                              size_t max_out,
+                              size_t * consumed );
+
+/*!
+ * @brief Parse float separated by delim from buffer with pool threads.
+ * @param pool      Parse pool.
+ * @param buf       Buffer contains float to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_float_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             float * out,
+                             size_t max_out,
+                             size_t * consumed );
+
+#endif /* LIB_UTILS_PARSE_NUMBER_MT_H__ */
@@ -1,116 +1,699 @@
-/*!
- * @file: lib-utils-parse-number.h
- * @date: 2023-01-04
- * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
- * @brief: Declaration of function to parse string contains number.
- */
-#ifndef LIB_UTILS_PARSE_NUMBER_H__
-#define LIB_UTILS_PARSE_NUMBER_H__
-
-#include <stdint.h>
-
-/*!
- * @brief Parse uint8_t from string.
- * @param str       String contains uint8_t to parse.
- * @param number    Pointer on uint8_t to store value.
- * @return 0 on success otherwise -1.
- */
-int parse_uint8(const char * str, uint8_t * number);
-
-/*!
- * @brief Parse int8_t from string.
- * @param str       String contains int8_t to parse.
- * @param number    Pointer on int8_t to store value.
- * @return 0 on success otherwise -1.
- */
-int parse_int8(const char * str, int8_t * number);
-
-/*!
- * @brief Parse hexadecimal value on uint8_t from string.
- * @param str   String contains hexadecimal value on uint8_t to parse.
- * @param hex   Pointer on uint8_t to store value.
- * @return 0 on success otherwise -1.
- */
-int parse_hex8(const char * str, uint8_t * hex);
-
-/*!
- * @brief Parse uint16_t from string.
- * @param str       String contains uint16_t to parse.
- * @param number    Pointer on uint16_t to store value.
- * @return 0 on success otherwise -1.
- */
-int parse_uint16(const char * str, uint16_t * number);
-
-/*!
- * @brief Parse int16_t from string.
- * @param str       String contains int16_t to parse.
- * @param number    Pointer on int16_t to store value.
- * @return 0 on success otherwise -1.
- */
-int parse_int16(const char * str, int16_t * number);
-
-/*!
- * @brief Parse hexadecimal value on uint16_t from string.
- * @param str   String contains hexadecimal value on uint16_t to parse.
- * @param hex   Pointer on uint16_t to store value.
- * @return 0 on success otherwise -1.
- */
-int parse_hex16(const char * str, uint16_t * hex);
-
-/*!
- * @brief Parse uint32_t from string.
- * @param str       String contains uint32_t to parse.
- * @param number    Pointer on uint32_t to store value.
- * @return 0 on success otherwise -1.
- */
-int parse_uint32(const char * str, uint32_t * number);
-
-/*!
- * @brief Parse int32_t from string.
- * @param str       String contains int32_t to parse.
- * @param number    Pointer on int32_t to store value.
- * @return 0 on success otherwise -1.
- */
-int parse_int32(const char * str, int32_t * number);
-
-/*!
- * @brief Parse hexadecimal value on uint32_t from string.
- * @param str   String contains hexadecimal value on uint32_t to parse.
- * @param hex   Pointer on uint32_t to store value.
- * @return 0 on success otherwise -1.
- */
-int parse_hex32(const char * str, uint32_t * hex);
-
-/*!
- * @brief Parse uint64_t from string.
- * @param str       String contains uint64_t to parse.
- * @param number    Pointer on uint64_t to store value.
- * @return 0 on success otherwise -1.
- */
-int parse_uint64(const char * str, uint64_t * number);
-
-/*!
- * @brief Parse int64_t from string.
- * @param str       String contains int64_t to parse.
- * @param number    Pointer on int64_t to store value.
- * @return 0 on success otherwise -1.
- */
-int parse_int64(const char * str, int64_t * number);
-
-/*!
- * @brief Parse hexadecimal value on uint64_t from string.
- * @param str   String contains hexadecimal value on uint64_t to parse.
- * @param hex   Pointer on uint64_t to store value.
- * @return 0 on success otherwise -1.
- */
-int parse_hex64(const char * str, uint64_t * hex);
-
-/*!
- * @brief Parse double float value from string.
- * @param str       String contains double float value to parse.
- * @param number    Pointer on double to store value.
- * @return 0 on success otherwise -1.
- */
-int parse_double(const char * str, double * number);
-
+/*!
+ * @file: lib-utils-parse-number.h
+ * @date: 2023-01-04
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of function to parse string contains number.
+ */
+#ifndef LIB_UTILS_PARSE_NUMBER_H__
+#define LIB_UTILS_PARSE_NUMBER_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lib-utils-strview.h"
+
+/*!
+ * @enum parse_number_isa_t
+ * @brief Instruction set used to convert decimal digits.
+ */
+typedef enum parse_number_isa_t
+{
+    PARSE_NUMBER_ISA_SCALAR = 0,    /*!< Portable C implementation. */
+    PARSE_NUMBER_ISA_SSE42  = 1,    /*!< x86 SSE4.2 implementation (16 digits
+                                         per step). */
+} parse_number_isa_t;
+
+/*!
+ * @brief Select instruction set used by number parsers (by default the best
+ *        one supported by CPU is selected on first use). Result of parsers
+ *        does not depend on instruction set.
+ * @param isa   Instruction set to use.
+ * @return 0 on success otherwise -1 (instruction set not supported by CPU or
+ *         target).
+ */
+int parse_number_set_isa( parse_number_isa_t isa );
+
+/*!
+ * @brief Return instruction set used by number parsers.
+ * @return The instruction set used by number parsers.
+ */
+parse_number_isa_t parse_number_get_isa( void );
+
+/*!
+ * @brief Parse uint8_t from string.
+ * @param str       String contains uint8_t to parse.
+ * @param number    Pointer on uint8_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_uint8(const char * str, uint8_t * number);
+
+/*!
+ * @brief Parse uint8_t from buffer (NUL termination not required).
+ * @param str       Buffer contains uint8_t to parse.
+ * @param len       Length of buffer in bytes (nothing is read after).
+ * @param number    Pointer on uint8_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_uint8_n(const char * str, size_t len, uint8_t * number);
+
+/*!
+ * @brief Parse int8_t from string.
+ * @param str       String contains int8_t to parse.
+ * @param number    Pointer on int8_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_int8(const char * str, int8_t * number);
+
+/*!
+ * @brief Parse int8_t from buffer (NUL termination not required).
+ * @param str       Buffer contains int8_t to parse.
+ * @param len       Length of buffer in bytes (nothing is read after).
+ * @param number    Pointer on int8_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_int8_n(const char * str, size_t len, int8_t * number);
+
+/*!
+ * @brief Parse hexadecimal value on uint8_t from string.
+ * @param str   String contains hexadecimal value on uint8_t to parse.
+ * @param hex   Pointer on uint8_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_hex8(const char * str, uint8_t * hex);
+
+/*!
+ * @brief Parse hexadecimal value on uint8_t from buffer (NUL termination not
+ *        required).
+ * @param str   Buffer contains hexadecimal value on uint8_t to parse.
+ * @param len   Length of buffer in bytes (nothing is read after).
+ * @param hex   Pointer on uint8_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_hex8_n(const char * str, size_t len, uint8_t * hex);
+
+/*!
+ * @brief Parse uint16_t from string.
+ * @param str       String contains uint16_t to parse.
+ * @param number    Pointer on uint16_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_uint16(const char * str, uint16_t * number);
+
+/*!
+ * @brief Parse uint16_t from buffer (NUL termination not required).
+ * @param str       Buffer contains uint16_t to parse.
+ * @param len       Length of buffer in bytes (nothing is read after).
+ * @param number    Pointer on uint16_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_uint16_n(const char * str, size_t len, uint16_t * number);
+
+/*!
+ * @brief Parse int16_t from string.
+ * @param str       String contains int16_t to parse.
+ * @param number    Pointer on int16_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_int16(const char * str, int16_t * number);
+
+/*!
+ * @brief Parse int16_t from buffer (NUL termination not required).
+ * @param str       Buffer contains int16_t to parse.
+ * @param len       Length of buffer in bytes (nothing is read after).
+ * @param number    Pointer on int16_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_int16_n(const char * str, size_t len, int16_t * number);
+
+/*!
+ * @brief Parse hexadecimal value on uint16_t from string.
+ * @param str   String contains hexadecimal value on uint16_t to parse.
+ * @param hex   Pointer on uint16_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_hex16(const char * str, uint16_t * hex);
+
+/*!
+ * @brief Parse hexadecimal value on uint16_t from buffer (NUL termination not
+ *        required).
+ * @param str   Buffer contains hexadecimal value on uint16_t to parse.
+ * @param len   Length of buffer in bytes (nothing is read after).
+ * @param hex   Pointer on uint16_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_hex16_n(const char * str, size_t len, uint16_t * hex);
+
+/*!
+ * @brief Parse uint32_t from string.
+ * @param str       String contains uint32_t to parse.
+ * @param number    Pointer on uint32_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_uint32(const char * str, uint32_t * number);
+
+/*!
+ * @brief Parse uint32_t from buffer (NUL termination not required).
+ * @param str       Buffer contains uint32_t to parse.
+ * @param len       Length of buffer in bytes (nothing is read after).
+ * @param number    Pointer on uint32_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_uint32_n(const char * str, size_t len, uint32_t * number);
+
+/*!
+ * @brief Parse int32_t from string.
+ * @param str       String contains int32_t to parse.
+ * @param number    Pointer on int32_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_int32(const char * str, int32_t * number);
+
+/*!
+ * @brief Parse int32_t from buffer (NUL termination not required).
+ * @param str       Buffer contains int32_t to parse.
+ * @param len       Length of buffer in bytes (nothing is read after).
+ * @param number    Pointer on int32_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_int32_n(const char * str, size_t len, int32_t * number);
+
+/*!
+ * @brief Parse hexadecimal value on uint32_t from string.
+ * @param str   String contains hexadecimal value on uint32_t to parse.
+ * @param hex   Pointer on uint32_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_hex32(const char * str, uint32_t * hex);
+
+/*!
+ * @brief Parse hexadecimal value on uint32_t from buffer (NUL termination not
+ *        required).
+ * @param str   Buffer contains hexadecimal value on uint32_t to parse.
+ * @param len   Length of buffer in bytes (nothing is read after).
+ * @param hex   Pointer on uint32_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_hex32_n(const char * str, size_t len, uint32_t * hex);
+
+/*!
+ * @brief Parse uint64_t from string.
+ * @param str       String contains uint64_t to parse.
+ * @param number    Pointer on uint64_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_uint64(const char * str, uint64_t * number);
+
+/*!
+ * @brief Parse uint64_t from buffer (NUL termination not required).
+ * @param str       Buffer contains uint64_t to parse.
+ * @param len       Length of buffer in bytes (nothing is read after).
+ * @param number    Pointer on uint64_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_uint64_n(const char * str, size_t len, uint64_t * number);
+
+/*!
+ * @brief Parse int64_t from string.
+ * @param str       String contains int64_t to parse.
+ * @param number    Pointer on int64_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_int64(const char * str, int64_t * number);
+
+/*!
+ * @brief Parse int64_t from buffer (NUL termination not required).
+ * @param str       Buffer contains int64_t to parse.
+ * @param len       Length of buffer in bytes (nothing is read after).
+ * @param number    Pointer on int64_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_int64_n(const char * str, size_t len, int64_t * number);
+
+/*!
+ * @brief Parse hexadecimal value on uint64_t from string.
+ * @param str   String contains hexadecimal value on uint64_t to parse.
+ * @param hex   Pointer on uint64_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_hex64(const char * str, uint64_t * hex);
+
+/*!
+ * @brief Parse hexadecimal value on uint64_t from buffer (NUL termination not
+ *        required).
+ * @param str   Buffer contains hexadecimal value on uint64_t to parse.
+ * @param len   Length of buffer in bytes (nothing is read after).
+ * @param hex   Pointer on uint64_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_hex64_n(const char * str, size_t len, uint64_t * hex);
+
+/*!
+ * @brief Parse double float value from string (same syntax as strtod in "C"
+ *        locale, correctly rounded to nearest even).
+ * @param str       String contains double float value to parse.
+ * @param number    Pointer on double to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_double(const char * str, double * number);
+
+/*!
+ * @brief Parse double float value from buffer (NUL termination not required).
+ * @param str       Buffer contains double float value to parse.
+ * @param len       Length of buffer in bytes (nothing is read after).
+ * @param number    Pointer on double to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_double_n(const char * str, size_t len, double * number);
+
+/*!
+ * @brief Parse float value from string.
+ * @param str       String contains float value to parse.
+ * @param number    Pointer on float to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_float(const char * str, float * number);
+
+/*!
+ * @brief Parse float value from buffer (NUL termination not required).
+ * @param str       Buffer contains float value to parse.
+ * @param len       Length of buffer in bytes (nothing is read after).
+ * @param number    Pointer on float to store value.
+ * @return 0 on success otherwise -1.
+ */
+int parse_float_n(const char * str, size_t len, float * number);
+
+/*
+ * View parsers.
+ *
+ * Same as parse_<type>_n on the bytes of a view: slices of a buffer are parsed
+ * without copy nor length scan.
+ */
+
+/*!
+ * @brief Parse uint8_t from view.
+ * @param str       View contains uint8_t to parse.
+ * @param number    Pointer on uint8_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+static inline int parse_uint8_view( lu_strview_t str, uint8_t * number )
+{
+    return parse_uint8_n( str.ptr, str.len, number );
+}
+
+/*!
+ * @brief Parse int8_t from view.
+ * @param str       View contains int8_t to parse.
+ * @param number    Pointer on int8_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+static inline int parse_int8_view( lu_strview_t str, int8_t * number )
+{
+    return parse_int8_n( str.ptr, str.len, number );
+}
+
+/*!
+ * @brief Parse hexadecimal value on uint8_t from view.
+ * @param str   View contains hexadecimal value on uint8_t to parse.
+ * @param hex   Pointer on uint8_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+static inline int parse_hex8_view( lu_strview_t str, uint8_t * hex )
+{
+    return parse_hex8_n( str.ptr, str.len, hex );
+}
+
+/*!
+ * @brief Parse uint16_t from view.
+ * @param str       View contains uint16_t to parse.
+ * @param number    Pointer on uint16_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+static inline int parse_uint16_view( lu_strview_t str, uint16_t * number )
+{
+    return parse_uint16_n( str.ptr, str.len, number );
+}
+
+/*!
+ * @brief Parse int16_t from view.
+ * @param str       View contains int16_t to parse.
+ * @param number    Pointer on int16_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+static inline int parse_int16_view( lu_strview_t str, int16_t * number )
+{
+    return parse_int16_n( str.ptr, str.len, number );
+}
+
+/*!
+ * @brief Parse hexadecimal value on uint16_t from view.
+ * @param str   View contains hexadecimal value on uint16_t to parse.
+ * @param hex   Pointer on uint16_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+static inline int parse_hex16_view( lu_strview_t str, uint16_t * hex )
+{
+    return parse_hex16_n( str.ptr, str.len, hex );
+}
+
+/*!
+ * @brief Parse uint32_t from view.
+ * @param str       View contains uint32_t to parse.
+ * @param number    Pointer on uint32_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+static inline int parse_uint32_view( lu_strview_t str, uint32_t * number )
+{
+    return parse_uint32_n( str.ptr, str.len, number );
+}
+
+/*!
+ * @brief Parse int32_t from view.
+ * @param str       View contains int32_t to parse.
+ * @param number    Pointer on int32_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+static inline int parse_int32_view( lu_strview_t str, int32_t * number )
+{
+    return parse_int32_n( str.ptr, str.len, number );
+}
+
+/*!
+ * @brief Parse hexadecimal value on uint32_t from view.
+ * @param str   View contains hexadecimal value on uint32_t to parse.
+ * @param hex   Pointer on uint32_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+static inline int parse_hex32_view( lu_strview_t str, uint32_t * hex )
+{
+    return parse_hex32_n( str.ptr, str.len, hex );
+}
+
+/*!
+ * @brief Parse uint64_t from view.
+ * @param str       View contains uint64_t to parse.
+ * @param number    Pointer on uint64_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+static inline int parse_uint64_view( lu_strview_t str, uint64_t * number )
+{
+    return parse_uint64_n( str.ptr, str.len, number );
+}
+
+/*!
+ * @brief Parse int64_t from view.
+ * @param str       View contains int64_t to parse.
+ * @param number    Pointer on int64_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+static inline int parse_int64_view( lu_strview_t str, int64_t * number )
+{
+    return parse_int64_n( str.ptr, str.len, number );
+}
+
+/*!
+ * @brief Parse hexadecimal value on uint64_t from view.
+ * @param str   View contains hexadecimal value on uint64_t to parse.
+ * @param hex   Pointer on uint64_t to store value.
+ * @return 0 on success otherwise -1.
+ */
+static inline int parse_hex64_view( lu_strview_t str, uint64_t * hex )
+{
+    return parse_hex64_n( str.ptr, str.len, hex );
+}
+
+/*!
+ * @brief Parse double from view.
+ * @param str       View contains double to parse.
+ * @param number    Pointer on double to store value.
+ * @return 0 on success otherwise -1.
+ */
+static inline int parse_double_view( lu_strview_t str, double * number )
+{
+    return parse_double_n( str.ptr, str.len, number );
+}
+
+/*!
+ * @brief Parse float from view.
+ * @param str       View contains float to parse.
+ * @param number    Pointer on float to store value.
+ * @return 0 on success otherwise -1.
+ */
+static inline int parse_float_view( lu_strview_t str, float * number )
+{
+    return parse_float_n( str.ptr, str.len, number );
+}
+
+/*
+ * Array parsers.
+ *
+ * Parse a buffer (NUL termination not required) of numbers separated by delim
+ * in one call. Each element follows the rules of the single value parser.
+ * Parsing stops at the end of the buffer, when max_out elements are stored or
+ * on the first invalid element. On return, *consumed is the number of bytes
+ * of buf consumed:
+ *  - *consumed == len: the whole buffer has been parsed (a trailing delimiter
+ *    is accepted),
+ *  - otherwise if returned value is lower than max_out, the element at index
+ *    returned value (starting at buf + *consumed) is invalid,
+ *  - otherwise out is full and parsing can restart at buf + *consumed.
+ */
+
+/*!
+ * @brief Parse uint8_t separated by delim from buffer.
+ * @param buf       Buffer contains uint8_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_uint8_array( const char * buf,
+                           size_t len,
+                           char delim,
+                           uint8_t * out,
+                           size_t max_out,
+                           size_t * consumed );
+
+/*!
+ * @brief Parse int8_t separated by delim from buffer.
+ * @param buf       Buffer contains int8_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_int8_array( const char * buf,
+                          size_t len,
+                          char delim,
+                          int8_t * out,
+                          size_t max_out,
+                          size_t * consumed );
+
+/*!
+ * @brief Parse hexadecimal values on uint8_t separated by delim from buffer.
+ * @param buf       Buffer contains hexadecimal values on uint8_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_hex8_array( const char * buf,
+                          size_t len,
+                          char delim,
+                          uint8_t * out,
+                          size_t max_out,
+                          size_t * consumed );
+
+/*!
+ * @brief Parse uint16_t separated by delim from buffer.
+ * @param buf       Buffer contains uint16_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_uint16_array( const char * buf,
+                            size_t len,
+                            char delim,
+                            uint16_t * out,
+                            size_t max_out,
+                            size_t * consumed );
+
+/*!
+ * @brief Parse int16_t separated by delim from buffer.
+ * @param buf       Buffer contains int16_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_int16_array( const char * buf,
+                           size_t len,
+                           char delim,
+                           int16_t * out,
+                           size_t max_out,
+                           size_t * consumed );
+
+/*!
+ * @brief Parse hexadecimal values on uint16_t separated by delim from buffer.
+ * @param buf       Buffer contains hexadecimal values on uint16_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_hex16_array( const char * buf,
+                           size_t len,
+                           char delim,
+                           uint16_t * out,
+                           size_t max_out,
+                           size_t * consumed );
+
+/*!
+ * @brief Parse uint32_t separated by delim from buffer.
+ * @param buf       Buffer contains uint32_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_uint32_array( const char * buf,
+                            size_t len,
+                            char delim,
+                            uint32_t * out,
+                            size_t max_out,
+                            size_t * consumed );
+
+/*!
+ * @brief Parse int32_t separated by delim from buffer.
+ * @param buf       Buffer contains int32_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_int32_array( const char * buf,
+                           size_t len,
+                           char delim,
+                           int32_t * out,
+                           size_t max_out,
+                           size_t * consumed );
+
+/*!
+ * @brief Parse hexadecimal values on uint32_t separated by delim from buffer.
+ * @param buf       Buffer contains hexadecimal values on uint32_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_hex32_array( const char * buf,
+                           size_t len,
+                           char delim,
+                           uint32_t * out,
+                           size_t max_out,
+                           size_t * consumed );
+
+/*!
+ * @brief Parse uint64_t separated by delim from buffer.
+ * @param buf       Buffer contains uint64_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_uint64_array( const char * buf,
+                            size_t len,
+                            char delim,
+                            uint64_t * out,
+                            size_t max_out,
+                            size_t * consumed );
+
+/*!
+ * @brief Parse int64_t separated by delim from buffer.
+ * @param buf       Buffer contains int64_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_int64_array( const char * buf,
+                           size_t len,
+                           char delim,
+                           int64_t * out,
+                           size_t max_out,
+                           size_t * consumed );
+
+/*!
+ * @brief Parse hexadecimal values on uint64_t separated by delim from buffer.
+ * @param buf       Buffer contains hexadecimal values on uint64_t to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_hex64_array( const char * buf,
+                           size_t len,
+                           char delim,
+                           uint64_t * out,
+                           size_t max_out,
+                           size_t * consumed );
+
+/*!
+ * @brief Parse double separated by delim from buffer.
+ * @param buf       Buffer contains double to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_double_array( const char * buf,
+                           size_t len,
+                           char delim,
+                           double * out,
+                           size_t max_out,
+                           size_t * consumed );
+
+/*!
+ * @brief Parse float separated by delim from buffer.
+ * @param buf       Buffer contains float to parse.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Character between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+size_t parse_float_array( const char * buf,
+                          size_t len,
+                          char delim,
+                          float * out,
+                          size_t max_out,
+                          size_t * consumed );
+
 #endif /* LIB_UTILS_PARSE_NUMBER_H__ */
\ No newline at end of file
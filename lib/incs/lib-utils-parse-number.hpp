@@ -0,0 +1,355 @@
+/*!
+ * @file: lib-utils-parse-number.hpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of C++17 inline parsers of string contains number.
+ *
+ * Integer parsers are header only constexpr functions: they are evaluated at
+ * compile time for literal input and inlined in the caller otherwise. They
+ * accept exactly the same inputs and give the same results as the
+ * parse_<type>_n functions of lib-utils-parse-number.h. Float parsers are
+ * provided for a uniform interface and call the C functions.
+ */
+#ifndef LIB_UTILS_PARSE_NUMBER_HPP__
+#define LIB_UTILS_PARSE_NUMBER_HPP__
+
+#if __cplusplus < 201703L
+#error "lib-utils-parse-number.hpp requires C++17"
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+extern "C"
+{
+    #include "lib-utils-parse-number.h"
+}
+
+namespace lib_utils
+{
+    namespace detail
+    {
+        /*!
+         * @brief Integer types supported by parsers.
+         */
+        template <typename T>
+        inline constexpr bool is_parse_integer_v =
+                std::is_integral_v<T> && ! std::is_same_v<T, bool> &&
+                ( sizeof( T ) <= sizeof( uint64_t ) );
+
+        /*!
+         * @brief Check if character is a white space (same set as isspace()
+         *        in "C" locale).
+         * @param c     Character to check.
+         * @return true if character is a white space.
+         */
+        constexpr bool is_space( char c ) noexcept
+        {
+            return ( ' ' == c ) || ( ( c >= '\t' ) && ( c <= '\r' ) );
+        }
+
+        /*!
+         * @brief Return value of digit in base.
+         * @param c     Character to convert.
+         * @param base  Base (10 or 16).
+         * @return Value of digit otherwise -1 if not a digit of base.
+         */
+        constexpr int digit_value( char c, unsigned int base ) noexcept
+        {
+            if ( ( c >= '0' ) && ( c <= '9' ) )
+            {
+                return c - '0';
+            }
+
+            if ( ( 16 == base ) && ( ( c | 0x20 ) >= 'a' ) && ( ( c | 0x20 ) <= 'f' ) )
+            {
+                return ( c | 0x20 ) - 'a' + 10;
+            }
+
+            return -1;
+        }
+
+        /*!
+         * @brief Parse 8 decimal digits at once (SWAR on a 64 bits word, bytes
+         *        are combined by shifts to stay constexpr).
+         * @param str       Buffer contains digits.
+         * @param i         Index of first digit (8 bytes are readable).
+         * @param digits    Value of digits.
+         * @return true if the 8 bytes are decimal digits.
+         */
+        constexpr bool parse_eight_digits( std::string_view str,
+                                           size_t i,
+                                           uint64_t & digits ) noexcept
+        {
+            uint64_t v = 0;
+
+            for ( size_t j = 0; j < 8; j++ )
+            {
+                v |= (uint64_t)(unsigned char)str[i + j] << ( 8 * j );
+            }
+
+            if ( ( ( v & 0xF0F0F0F0F0F0F0F0 ) |
+                   ( ( ( v + 0x0606060606060606 ) & 0xF0F0F0F0F0F0F0F0 ) >> 4 ) ) !=
+                 0x3333333333333333 )
+            {
+                return false;
+            }
+
+            v = ( ( v & 0x0F0F0F0F0F0F0F0F ) * 2561 ) >> 8;
+            v = ( ( v & 0x00FF00FF00FF00FF ) * 6553601 ) >> 16;
+            digits = ( ( v & 0x0000FFFF0000FFFF ) * 42949672960001 ) >> 32;
+
+            return true;
+        }
+
+        /*!
+         * @brief Parse number with the same rules as parse_number_buffer (white
+         *        spaces, sign, 0x prefix in base 16, whole buffer consumed).
+         * @param str       Buffer contains number.
+         * @param base      Base (10 or 16).
+         * @param magnitude Absolute value of number.
+         * @param negative  true if number has a minus sign.
+         * @return true on success otherwise false (invalid or more than 64
+         *         bits).
+         */
+        constexpr bool parse_magnitude( std::string_view str,
+                                        unsigned int base,
+                                        uint64_t & magnitude,
+                                        bool & negative ) noexcept
+        {
+            const size_t    max_digits = ( 16 == base ) ? 16 : 19;
+            size_t          i = 0;
+            size_t          begin = 0;
+            size_t          fast_end = 0;
+            uint64_t        value = 0;
+            uint64_t        digits = 0;
+            int             digit = 0;
+
+            while ( ( i < str.size() ) && is_space( str[i] ) )
+            {
+                i++;
+            }
+
+            negative = false;
+            if ( ( i < str.size() ) && ( ( '+' == str[i] ) || ( '-' == str[i] ) ) )
+            {
+                negative = ( '-' == str[i] );
+                i++;
+            }
+
+            /* 0x prefix is only skipped when followed by an hexadecimal digit */
+            if ( ( 16 == base ) && ( ( str.size() - i ) > 2 ) && ( '0' == str[i] ) &&
+                 ( 'x' == ( str[i + 1] | 0x20 ) ) && ( digit_value( str[i + 2], 16 ) >= 0 ) )
+            {
+                i += 2;
+            }
+
+            begin = i;
+            while ( ( i < str.size() ) && ( '0' == str[i] ) )
+            {
+                i++;
+            }
+
+            /* Up to 19 decimal (16 hexadecimal) digits can not overflow */
+            fast_end = i + std::min( str.size() - i, max_digits );
+            if ( 10 == base )
+            {
+                while ( ( ( fast_end - i ) >= 8 ) && parse_eight_digits( str, i, digits ) )
+                {
+                    value = value * 100000000 + digits;
+                    i += 8;
+                }
+            }
+
+            for ( ; i < fast_end; i++ )
+            {
+                digit = digit_value( str[i], base );
+                if ( digit < 0 )
+                {
+                    return false;
+                }
+                value = value * base + digit;
+            }
+
+            if ( i < str.size() )
+            {
+                /* Only a last 20th decimal digit can be valid */
+                digit = digit_value( str[i], base );
+                if ( ( 10 != base ) || ( digit < 0 ) || ( ( i + 1 ) != str.size() ) ||
+                     ( value > std::numeric_limits<uint64_t>::max() / 10 ) ||
+                     ( ( value == std::numeric_limits<uint64_t>::max() / 10 ) &&
+                       ( digit > 5 ) ) )
+                {
+                    return false;
+                }
+                value = value * 10 + digit;
+                i++;
+            }
+
+            magnitude = value;
+
+            return i != begin;
+        }
+
+        /*!
+         * @brief Parse integer type in base.
+         * @param str       Buffer contains number.
+         * @param base      Base (10 or 16).
+         * @param number    Reference to store value.
+         * @return true on success otherwise false.
+         */
+        template <typename T>
+        constexpr bool parse_integer( std::string_view str,
+                                      unsigned int base,
+                                      T & number ) noexcept
+        {
+            using unsigned_t = std::make_unsigned_t<T>;
+            uint64_t    magnitude = 0;
+            bool        negative = false;
+
+            if ( ! parse_magnitude( str, base, magnitude, negative ) )
+            {
+                return false;
+            }
+
+            if constexpr ( std::is_signed_v<T> )
+            {
+                const uint64_t limit = negative ?
+                        (uint64_t)std::numeric_limits<unsigned_t>::max() / 2 + 1 :
+                        (uint64_t)std::numeric_limits<T>::max();
+
+                if ( magnitude > limit )
+                {
+                    return false;
+                }
+
+                number = negative ? (T)( -(T)( magnitude - 1 ) - 1 ) : (T)magnitude;
+            }
+            else
+            {
+                /* Only "-0" is a valid negative unsigned number */
+                if ( ( magnitude > std::numeric_limits<T>::max() ) ||
+                     ( negative && ( 0 != magnitude ) ) )
+                {
+                    return false;
+                }
+
+                number = (T)magnitude;
+            }
+
+            return true;
+        }
+    }
+
+    /*!
+     * @brief Parse decimal integer from buffer (NUL termination not required).
+     * @param str       Buffer contains integer to parse.
+     * @param number    Reference to store value.
+     * @return 0 on success otherwise -1.
+     */
+    template <typename T, std::enable_if_t<detail::is_parse_integer_v<T>, int> = 0>
+    constexpr int parse( std::string_view str, T & number ) noexcept
+    {
+        return detail::parse_integer( str, 10, number ) ? 0 : -1;
+    }
+
+    /*!
+     * @brief Parse decimal integer from buffer (NUL termination not required).
+     * @param str   Buffer contains integer to parse.
+     * @return The value on success otherwise std::nullopt.
+     */
+    template <typename T, std::enable_if_t<detail::is_parse_integer_v<T>, int> = 0>
+    constexpr std::optional<T> parse( std::string_view str ) noexcept
+    {
+        T number = 0;
+
+        if ( ! detail::parse_integer( str, 10, number ) )
+        {
+            return std::nullopt;
+        }
+
+        return number;
+    }
+
+    /*!
+     * @brief Parse hexadecimal unsigned integer from buffer (NUL termination
+     *        not required, 0x prefix is optional).
+     * @param str       Buffer contains hexadecimal value to parse.
+     * @param number    Reference to store value.
+     * @return 0 on success otherwise -1.
+     */
+    template <typename T, std::enable_if_t<detail::is_parse_integer_v<T> &&
+                                           std::is_unsigned_v<T>, int> = 0>
+    constexpr int parse_hex( std::string_view str, T & number ) noexcept
+    {
+        return detail::parse_integer( str, 16, number ) ? 0 : -1;
+    }
+
+    /*!
+     * @brief Parse hexadecimal unsigned integer from buffer (NUL termination
+     *        not required, 0x prefix is optional).
+     * @param str   Buffer contains hexadecimal value to parse.
+     * @return The value on success otherwise std::nullopt.
+     */
+    template <typename T, std::enable_if_t<detail::is_parse_integer_v<T> &&
+                                           std::is_unsigned_v<T>, int> = 0>
+    constexpr std::optional<T> parse_hex( std::string_view str ) noexcept
+    {
+        T number = 0;
+
+        if ( ! detail::parse_integer( str, 16, number ) )
+        {
+            return std::nullopt;
+        }
+
+        return number;
+    }
+
+    /*!
+     * @brief Parse float or double from buffer (NUL termination not required)
+     *        with parse_float_n or parse_double_n (not constexpr).
+     * @param str       Buffer contains value to parse.
+     * @param number    Reference to store value.
+     * @return 0 on success otherwise -1.
+     */
+    template <typename T, std::enable_if_t<std::is_same_v<T, float> ||
+                                           std::is_same_v<T, double>, int> = 0>
+    inline int parse( std::string_view str, T & number ) noexcept
+    {
+        if constexpr ( std::is_same_v<T, float> )
+        {
+            return parse_float_n( str.data(), str.size(), &number );
+        }
+        else
+        {
+            return parse_double_n( str.data(), str.size(), &number );
+        }
+    }
+
+    /*!
+     * @brief Parse float or double from buffer (NUL termination not required)
+     *        with parse_float_n or parse_double_n (not constexpr).
+     * @param str   Buffer contains value to parse.
+     * @return The value on success otherwise std::nullopt.
+     */
+    template <typename T, std::enable_if_t<std::is_same_v<T, float> ||
+                                           std::is_same_v<T, double>, int> = 0>
+    inline std::optional<T> parse( std::string_view str ) noexcept
+    {
+        T number = 0;
+
+        if ( 0 != parse<T>( str, number ) )
+        {
+            return std::nullopt;
+        }
+
+        return number;
+    }
+}
+
+#endif /* LIB_UTILS_PARSE_NUMBER_HPP__ */
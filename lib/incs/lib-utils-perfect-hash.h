@@ -0,0 +1,76 @@
+/*!
+ * @file: lib-utils-perfect-hash.h
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of perfect hash of a static set of strings.
+ *
+ * A perfect hash maps each string of a set known at creation to its own slot:
+ * a lookup hashes the key once, reads one displacement and compares one
+ * string, whatever the size of the set (hash and displace construction).
+ * Keys are not copied: they are read from a table of records (one key
+ * pointer every stride bytes) which must outlive the perfect hash.
+ */
+#ifndef LIB_UTILS_PERFECT_HASH_H__
+#define LIB_UTILS_PERFECT_HASH_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * @brief Value returned by lookups when key is not in set.
+ */
+#define PERFECT_HASH_NOT_FOUND      ( (size_t)-1 )
+
+/*!
+ * @struct perfect_hash_t
+ * @brief Perfect hash (private).
+ */
+typedef struct perfect_hash_t perfect_hash_t;
+
+/*!
+ * @brief Create perfect hash of keys of a table of records.
+ * @param keys      Address of key (const char *) of first record.
+ * @param nb_keys   Number of records.
+ * @param stride    Size of a record in bytes (sizeof( const char * ) for an
+ *                  array of strings).
+ * @return The perfect hash on success otherwise NULL (allocation failure or
+ *         duplicated keys). NULL keys are skipped.
+ */
+perfect_hash_t * perfect_hash_create( const char * const * keys,
+                                      size_t nb_keys,
+                                      size_t stride );
+
+/*!
+ * @brief Release perfect hash (keys are not released).
+ * @param hash      Perfect hash (can be NULL).
+ * @return None.
+ */
+void perfect_hash_destroy( perfect_hash_t * hash );
+
+/*!
+ * @brief Find record of key.
+ * @param hash      Perfect hash.
+ * @param key       Key to search (NUL termination not required).
+ * @param len       Length of key in bytes.
+ * @return The index of record of key otherwise PERFECT_HASH_NOT_FOUND.
+ */
+size_t perfect_hash_lookup_n( const perfect_hash_t * hash,
+                              const char * key,
+                              size_t len );
+
+/*!
+ * @brief Find record of NUL terminated key.
+ * @param hash      Perfect hash.
+ * @param key       Key to search.
+ * @return The index of record of key otherwise PERFECT_HASH_NOT_FOUND.
+ */
+size_t perfect_hash_lookup( const perfect_hash_t * hash, const char * key );
+
+/*!
+ * @brief Return number of keys of perfect hash.
+ * @param hash      Perfect hash.
+ * @return The number of (non NULL) keys.
+ */
+size_t perfect_hash_get_count( const perfect_hash_t * hash );
+
+#endif /* LIB_UTILS_PERFECT_HASH_H__ */
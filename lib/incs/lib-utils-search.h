@@ -0,0 +1,160 @@
+/*!
+ * @file: lib-utils-search.h
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of functions to search bytes and strings in buffers.
+ *
+ * All functions work on length bounded buffers (NUL termination not required,
+ * NUL is an ordinary byte) and never read outside of them. Vectorized
+ * implementations are selected at runtime (see search_set_isa), results do not
+ * depend on instruction set.
+ */
+#ifndef LIB_UTILS_SEARCH_H__
+#define LIB_UTILS_SEARCH_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * @enum search_isa_t
+ * @brief Instruction set used by search functions.
+ */
+typedef enum search_isa_t
+{
+    SEARCH_ISA_SCALAR   = 0,    /*!< Portable C implementation. */
+    SEARCH_ISA_SSSE3    = 1,    /*!< x86 SSSE3 implementation (16 bytes per
+                                     step). */
+    SEARCH_ISA_AVX2     = 2,    /*!< x86 AVX2 implementation (32 bytes per
+                                     step). */
+} search_isa_t;
+
+/*!
+ * @struct search_set_t
+ * @brief Set of bytes (character class) for search_any_of and search_none_of.
+ *        Bit ( c >> 4 ) & 7 of table[c >> 7][c & 15] is set if c is in set.
+ */
+typedef struct search_set_t
+{
+    uint8_t table[2][16];   /*!< Bitmaps indexed by low nibble of bytes. */
+} search_set_t;
+
+/*!
+ * @brief Select instruction set used by search functions (by default the best
+ *        one supported by CPU is selected on first use).
+ * @param isa   Instruction set to use.
+ * @return 0 on success otherwise -1 (instruction set not supported by CPU or
+ *         target).
+ */
+int search_set_isa( search_isa_t isa );
+
+/*!
+ * @brief Return instruction set used by search functions.
+ * @return The instruction set used by search functions.
+ */
+search_isa_t search_get_isa( void );
+
+/*!
+ * @brief Search first occurrence of a byte (same result as memchr).
+ * @param buf   Buffer to search in.
+ * @param len   Length of buffer in bytes.
+ * @param c     Byte to search.
+ * @return Pointer on first occurrence of c on success otherwise NULL.
+ */
+const char * search_byte( const char * buf, size_t len, char c );
+
+/*!
+ * @brief Search first occurrence of one of two bytes.
+ * @param buf   Buffer to search in.
+ * @param len   Length of buffer in bytes.
+ * @param c1    First byte to search.
+ * @param c2    Second byte to search.
+ * @return Pointer on first occurrence of c1 or c2 on success otherwise NULL.
+ */
+const char * search_byte2( const char * buf, size_t len, char c1, char c2 );
+
+/*!
+ * @brief Search first occurrence of one of three bytes.
+ * @param buf   Buffer to search in.
+ * @param len   Length of buffer in bytes.
+ * @param c1    First byte to search.
+ * @param c2    Second byte to search.
+ * @param c3    Third byte to search.
+ * @return Pointer on first occurrence of c1, c2 or c3 on success otherwise
+ *         NULL.
+ */
+const char * search_byte3( const char * buf,
+                           size_t len,
+                           char c1,
+                           char c2,
+                           char c3 );
+
+/*!
+ * @brief Initialize set of bytes.
+ * @param set       Set to initialize.
+ * @param chars     Bytes of set (can contain NUL).
+ * @param nb_chars  Number of bytes (0 for an empty set).
+ * @return 0 on success otherwise -1.
+ */
+int search_set_init( search_set_t * set, const char * chars, size_t nb_chars );
+
+/*!
+ * @brief Add a range of bytes to set (e.g. '0' to '9').
+ * @param set   Set to update.
+ * @param first First byte of range.
+ * @param last  Last byte of range (included, unsigned order).
+ * @return 0 on success otherwise -1.
+ */
+int search_set_add_range( search_set_t * set, char first, char last );
+
+/*!
+ * @brief Check if byte is in set.
+ * @param set   Set of bytes.
+ * @param c     Byte to check.
+ * @return Non zero if c is in set otherwise 0.
+ */
+static inline int search_set_contains( const search_set_t * set, char c )
+{
+    uint8_t b = (uint8_t)c;
+
+    return ( set->table[b >> 7][b & 0x0F] >> ( ( b >> 4 ) & 7 ) ) & 1;
+}
+
+/*!
+ * @brief Search first byte that is in set (same result as strpbrk on a
+ *        bounded buffer).
+ * @param buf   Buffer to search in.
+ * @param len   Length of buffer in bytes.
+ * @param set   Set of bytes.
+ * @return Pointer on first byte in set on success otherwise NULL.
+ */
+const char * search_any_of( const char * buf,
+                            size_t len,
+                            const search_set_t * set );
+
+/*!
+ * @brief Search first byte that is not in set (buf + strspn on a bounded
+ *        buffer).
+ * @param buf   Buffer to search in.
+ * @param len   Length of buffer in bytes.
+ * @param set   Set of bytes.
+ * @return Pointer on first byte not in set on success otherwise NULL.
+ */
+const char * search_none_of( const char * buf,
+                             size_t len,
+                             const search_set_t * set );
+
+/*!
+ * @brief Search first occurrence of a substring (same result as memmem).
+ *        Worst case time is linear in len + needle_len.
+ * @param buf           Buffer to search in.
+ * @param len           Length of buffer in bytes.
+ * @param needle        Substring to search.
+ * @param needle_len    Length of substring in bytes (buf is returned if 0).
+ * @return Pointer on first occurrence of needle on success otherwise NULL.
+ */
+const char * search_substring( const char * buf,
+                               size_t len,
+                               const char * needle,
+                               size_t needle_len );
+
+#endif /* LIB_UTILS_SEARCH_H__ */
@@ -1,30 +1,419 @@
-/*!
- * @file: lib-utils-string.h
- * @date: 2024-02-05
- * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
- * @brief: Declaration of function prototype to manage string.
- */
-#ifndef LIB_UTILS_STRING_H__
-#define LIB_UTILS_STRING_H__
-
-#define _STRINGIFY_1( str )   #str
-#define _STRINGIFY( x )       _STRINGIFY_1( x )
-
-/*!
- * @brief Allocate and copy string (user must free returned string when not 
- *        used).
- * @param str   String to copy.
- * @return The copy of the string on success otherwise NULL.
- */
-char * allocate_and_copy_string( const char * str);
-
-/*!
- * @brief Allocate and concat two strings str1 and str2 (user must free returned
- *        string when not used).
- * @param str1  Base string .
- * @param str2  String to concat.
- * @return The string concat on success otherwise NULL.
- */
-char * allocate_and_concat_string( const char * str1, const char * str2 );
-
+/*!
+ * @file: lib-utils-string.h
+ * @date: 2024-02-05
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of function prototype to manage string.
+ */
+#ifndef LIB_UTILS_STRING_H__
+#define LIB_UTILS_STRING_H__
+
+#include <stddef.h>
+
+#include "lib-utils-arena.h"
+#include "lib-utils-search.h"
+#include "lib-utils-strview.h"
+#include "lib-utils-types.h"
+
+#define _STRINGIFY_1( str )   #str
+#define _STRINGIFY( x )       _STRINGIFY_1( x )
+
+/*!
+ * @brief Minimum capacity of string builder buffer (capacity is doubled when
+ *        full).
+ */
+#define STRING_BUILDER_MIN_CAPACITY ( 64 )
+
+/*!
+ * @brief Static initializer of an empty string builder.
+ */
+#define STRING_BUILDER_INIT         { NULL, 0, 0 }
+
+/*!
+ * @brief Split flag: do not return empty tokens (e.g. runs of delimiters).
+ */
+#define STRING_SPLIT_SKIP_EMPTY     ( 1u << 0 )
+
+/*!
+ * @brief Split flag: delimiters between double quotes do not split. Quotes
+ *        are kept in token except both quotes of a token which starts and
+ *        ends with a quote (doubled quotes are not unescaped). An unclosed
+ *        quote runs to end of buffer.
+ */
+#define STRING_SPLIT_QUOTES         ( 1u << 1 )
+
+/*!
+ * @brief Quote character of STRING_SPLIT_QUOTES.
+ */
+#define STRING_SPLIT_QUOTE_CHAR     ( '"' )
+
+/*!
+ * @enum string_split_mode_t
+ * @brief Kind of delimiter of a split iterator.
+ */
+typedef enum string_split_mode_t
+{
+    STRING_SPLIT_BYTE = 0,  /*!< Single byte delimiter. */
+    STRING_SPLIT_STRING,    /*!< Multi byte delimiter. */
+    STRING_SPLIT_ANY_OF,    /*!< Any byte of a set. */
+} string_split_mode_t;
+
+/*!
+ * @struct string_split_t
+ * @brief Iterator over tokens of a buffer (fields are private). Tokens are
+ *        views over the buffer: nothing is allocated nor modified.
+ */
+typedef struct string_split_t
+{
+    const char *        pos;        /*!< Start of next token (NULL after last
+                                         token). */
+    const char *        end;        /*!< End of buffer. */
+    const char *        delim;      /*!< Delimiter (STRING_SPLIT_STRING). */
+    char                byte;       /*!< Delimiter (STRING_SPLIT_BYTE). */
+    const char *        quote;      /*!< Next quote (cached, end if none,
+                                         STRING_SPLIT_QUOTES). */
+    size_t              delim_len;  /*!< Length of delimiter in bytes. */
+    search_set_t        set;        /*!< Delimiters (STRING_SPLIT_ANY_OF). */
+    string_split_mode_t mode;       /*!< Kind of delimiter. */
+    unsigned int        flags;      /*!< STRING_SPLIT_<flag> combination. */
+} string_split_t;
+
+/*!
+ * @struct string_builder_t
+ * @brief Growable string (fields are private, buffer is always NUL terminated
+ *        once allocated).
+ */
+typedef struct string_builder_t
+{
+    char *  data;       /*!< Buffer (NULL before first allocation). */
+    size_t  len;        /*!< Length of string. */
+    size_t  capacity;   /*!< Allocated size of buffer. */
+} string_builder_t;
+
+/*!
+ * @brief Allocate and copy string (user must free returned string when not 
+ *        used).
+ * @param str   String to copy.
+ * @return The copy of the string on success otherwise NULL (str is NULL or
+ *         empty).
+ */
+char * allocate_and_copy_string( const char * str);
+
+/*!
+ * @brief Allocate and concat two strings str1 and str2 (user must free returned
+ *        string when not used).
+ * @param str1  Base string .
+ * @param str2  String to concat.
+ * @return The string concat on success otherwise NULL (a string is NULL or
+ *         empty, see allocate_and_concat_strings to accept empty strings).
+ */
+char * allocate_and_concat_string( const char * str1, const char * str2 );
+
+/*!
+ * @brief Allocate and concat count strings given as arguments in one copy (user
+ *        must free returned string when not used).
+ * @param count Number of strings.
+ * @param ...   Strings to concat (const char *, can be empty unlike strings
+ *              of allocate_and_concat_string).
+ * @return The string concat on success otherwise NULL (count is 0 or a string
+ *         is NULL).
+ */
+char * allocate_and_concat_strings( size_t count, ... );
+
+/*!
+ * @brief Allocate and concat count strings of array in one copy (user must
+ *        free returned string when not used).
+ * @param parts Strings to concat (can be empty unlike strings of
+ *              allocate_and_concat_string).
+ * @param count Number of strings.
+ * @return The string concat on success otherwise NULL (count is 0 or a string
+ *         is NULL).
+ */
+char * allocate_and_concat_string_array( const char * const * parts, size_t count );
+
+/*!
+ * @brief Allocate from arena and copy string (released by arena_reset or
+ *        arena_destroy).
+ * @param arena Arena to allocate from.
+ * @param str   String to copy.
+ * @return The copy of the string on success otherwise NULL (str is NULL or
+ *         empty).
+ */
+char * allocate_and_copy_string_arena( arena_t * arena, const char * str );
+
+/*!
+ * @brief Allocate from arena and concat two strings str1 and str2 (released by
+ *        arena_reset or arena_destroy).
+ * @param arena Arena to allocate from.
+ * @param str1  Base string.
+ * @param str2  String to concat.
+ * @return The string concat on success otherwise NULL (a string is NULL or
+ *         empty).
+ */
+char * allocate_and_concat_string_arena( arena_t * arena,
+                                         const char * str1,
+                                         const char * str2 );
+
+/*!
+ * @brief Allocate and copy view in a NUL terminated string (user must free
+ *        returned string when not used).
+ * @param str   View to copy (can be empty).
+ * @return The copy of the view on success otherwise NULL.
+ */
+char * allocate_and_copy_strview( lu_strview_t str );
+
+/*!
+ * @brief Allocate and concat two views in a NUL terminated string (user must
+ *        free returned string when not used).
+ * @param str1  Base view (can be empty).
+ * @param str2  View to concat (can be empty).
+ * @return The string concat on success otherwise NULL.
+ */
+char * allocate_and_concat_strview( lu_strview_t str1, lu_strview_t str2 );
+
+/*!
+ * @brief Allocate from arena and copy view in a NUL terminated string
+ *        (released by arena_reset or arena_destroy).
+ * @param arena Arena to allocate from.
+ * @param str   View to copy (can be empty).
+ * @return The copy of the view on success otherwise NULL.
+ */
+char * allocate_and_copy_strview_arena( arena_t * arena, lu_strview_t str );
+
+/*!
+ * @brief Allocate from arena and concat two views in a NUL terminated string
+ *        (released by arena_reset or arena_destroy).
+ * @param arena Arena to allocate from.
+ * @param str1  Base view (can be empty).
+ * @param str2  View to concat (can be empty).
+ * @return The string concat on success otherwise NULL.
+ */
+char * allocate_and_concat_strview_arena( arena_t * arena,
+                                          lu_strview_t str1,
+                                          lu_strview_t str2 );
+
+/*!
+ * @brief Initialize string builder.
+ * @param builder   String builder.
+ * @param capacity  Initial capacity in bytes (0 to allocate on first append).
+ * @return 0 on success otherwise -1.
+ */
+int string_builder_init( string_builder_t * builder, size_t capacity );
+
+/*!
+ * @brief Release string builder buffer (builder is empty after).
+ * @param builder   String builder (can be NULL).
+ * @return None.
+ */
+void string_builder_free( string_builder_t * builder );
+
+/*!
+ * @brief Ensure that len bytes can be appended without reallocation.
+ * @param builder   String builder.
+ * @param len       Number of bytes to append.
+ * @return 0 on success otherwise -1 (builder is unchanged).
+ */
+int string_builder_reserve( string_builder_t * builder, size_t len );
+
+/*!
+ * @brief Empty string builder (capacity is kept).
+ * @param builder   String builder.
+ * @return None.
+ */
+void string_builder_clear( string_builder_t * builder );
+
+/*!
+ * @brief Append string.
+ * @param builder   String builder.
+ * @param str       String to append (can be empty).
+ * @return 0 on success otherwise -1 (builder is unchanged).
+ */
+int string_builder_append( string_builder_t * builder, const char * str );
+
+/*!
+ * @brief Append buffer (NUL termination not required).
+ * @param builder   String builder.
+ * @param str       Buffer to append.
+ * @param len       Length of buffer in bytes.
+ * @return 0 on success otherwise -1 (builder is unchanged).
+ */
+int string_builder_append_n( string_builder_t * builder,
+                             const char * str,
+                             size_t len );
+
+/*!
+ * @brief Append view.
+ * @param builder   String builder.
+ * @param str       View to append (can be empty).
+ * @return 0 on success otherwise -1 (builder is unchanged).
+ */
+int string_builder_append_view( string_builder_t * builder, lu_strview_t str );
+
+/*!
+ * @brief Append character.
+ * @param builder   String builder.
+ * @param c         Character to append.
+ * @return 0 on success otherwise -1 (builder is unchanged).
+ */
+int string_builder_append_char( string_builder_t * builder, char c );
+
+/*!
+ * @brief Append uint32_t in decimal.
+ * @param builder   String builder.
+ * @param number    Value to append.
+ * @return 0 on success otherwise -1 (builder is unchanged).
+ */
+int string_builder_append_uint32( string_builder_t * builder, uint32_t number );
+
+/*!
+ * @brief Append int32_t in decimal.
+ * @param builder   String builder.
+ * @param number    Value to append.
+ * @return 0 on success otherwise -1 (builder is unchanged).
+ */
+int string_builder_append_int32( string_builder_t * builder, int32_t number );
+
+/*!
+ * @brief Append uint32_t in hexadecimal (lower case, no prefix).
+ * @param builder   String builder.
+ * @param hex       Value to append.
+ * @return 0 on success otherwise -1 (builder is unchanged).
+ */
+int string_builder_append_hex32( string_builder_t * builder, uint32_t hex );
+
+/*!
+ * @brief Append uint64_t in decimal.
+ * @param builder   String builder.
+ * @param number    Value to append.
+ * @return 0 on success otherwise -1 (builder is unchanged).
+ */
+int string_builder_append_uint64( string_builder_t * builder, uint64_t number );
+
+/*!
+ * @brief Append int64_t in decimal.
+ * @param builder   String builder.
+ * @param number    Value to append.
+ * @return 0 on success otherwise -1 (builder is unchanged).
+ */
+int string_builder_append_int64( string_builder_t * builder, int64_t number );
+
+/*!
+ * @brief Append uint64_t in hexadecimal (lower case, no prefix).
+ * @param builder   String builder.
+ * @param hex       Value to append.
+ * @return 0 on success otherwise -1 (builder is unchanged).
+ */
+int string_builder_append_hex64( string_builder_t * builder, uint64_t hex );
+
+/*!
+ * @brief Append double (shortest round trip form, see format_double).
+ * @param builder   String builder.
+ * @param number    Value to append.
+ * @return 0 on success otherwise -1 (builder is unchanged).
+ */
+int string_builder_append_double( string_builder_t * builder, double number );
+
+/*!
+ * @brief Borrow string of builder (valid until next modification of builder).
+ * @param builder   String builder.
+ * @return The NUL terminated string ("" if empty) otherwise NULL.
+ */
+const char * string_builder_get( const string_builder_t * builder );
+
+/*!
+ * @brief Borrow view of builder string (valid until next modification of
+ *        builder).
+ * @param builder   String builder.
+ * @return The view (empty if builder is NULL or empty).
+ */
+lu_strview_t string_builder_view( const string_builder_t * builder );
+
+/*!
+ * @brief Return length of string of builder.
+ * @param builder   String builder.
+ * @return The length of string (0 if builder is NULL).
+ */
+size_t string_builder_get_length( const string_builder_t * builder );
+
+/*!
+ * @brief Take string of builder (user must free returned string when not
+ *        used, builder is empty after).
+ * @param builder   String builder.
+ * @return The NUL terminated string on success otherwise NULL.
+ */
+char * string_builder_detach( string_builder_t * builder );
+
+/*!
+ * @brief Initialize iterator over tokens separated by a byte. N delimiters
+ *        give N + 1 tokens ("a,,b" gives "a", "" and "b", an empty buffer gives
+ *        one empty token) unless STRING_SPLIT_SKIP_EMPTY is set.
+ * @param split Iterator to initialize.
+ * @param buf   Buffer to split (NUL termination not required, must stay valid
+ *              while iterating).
+ * @param len   Length of buffer in bytes.
+ * @param delim Delimiter.
+ * @param flags STRING_SPLIT_<flag> combination (0 for none).
+ * @return 0 on success otherwise -1.
+ */
+int string_split_init( string_split_t * split,
+                       const char * buf,
+                       size_t len,
+                       char delim,
+                       unsigned int flags );
+
+/*!
+ * @brief Initialize iterator over tokens separated by a string (e.g. "\r\n"
+ *        or ", "), see string_split_init.
+ * @param split     Iterator to initialize.
+ * @param buf       Buffer to split.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Delimiter (must stay valid while iterating).
+ * @param delim_len Length of delimiter in bytes (not 0).
+ * @param flags     STRING_SPLIT_<flag> combination (0 for none).
+ * @return 0 on success otherwise -1.
+ */
+int string_split_init_string( string_split_t * split,
+                              const char * buf,
+                              size_t len,
+                              const char * delim,
+                              size_t delim_len,
+                              unsigned int flags );
+
+/*!
+ * @brief Initialize iterator over tokens separated by any byte of a set (e.g.
+ *        " \t\r\n"), see string_split_init.
+ * @param split     Iterator to initialize.
+ * @param buf       Buffer to split.
+ * @param len       Length of buffer in bytes.
+ * @param delims    Delimiters.
+ * @param nb_delims Number of delimiters (not 0).
+ * @param flags     STRING_SPLIT_<flag> combination (0 for none).
+ * @return 0 on success otherwise -1.
+ */
+int string_split_init_any( string_split_t * split,
+                           const char * buf,
+                           size_t len,
+                           const char * delims,
+                           size_t nb_delims,
+                           unsigned int flags );
+
+/*!
+ * @brief Return next token (thread safe for distinct iterators, buffer is not
+ *        modified).
+ * @param split     Iterator.
+ * @param token     Pointer to store start of token (in buffer).
+ * @param token_len Pointer to store length of token in bytes.
+ * @return 0 if a token is returned otherwise -1 (no more token).
+ */
+int string_split_next( string_split_t * split,
+                       const char ** token,
+                       size_t * token_len );
+
+/*!
+ * @brief Return next token as a view, see string_split_next.
+ * @param split Iterator.
+ * @param token Pointer to store token (view in buffer).
+ * @return 0 if a token is returned otherwise -1 (no more token).
+ */
+int string_split_next_view( string_split_t * split, lu_strview_t * token );
+
 #endif /* LIB_UTILS_STRING_H__ */
\ No newline at end of file
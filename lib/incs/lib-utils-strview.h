@@ -0,0 +1,234 @@
+/*!
+ * @file: lib-utils-strview.h
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of immutable string view and its helpers.
+ *
+ * A view is a pointer and a length over bytes owned by someone else (NUL
+ * termination not required, NUL is an ordinary byte). Views are passed and
+ * returned by value, nothing is allocated nor copied: a slice of a view
+ * points in the same buffer. A view with a NULL pointer and a length of 0 is
+ * a valid empty view. Small helpers are inline so a pipeline of slices costs
+ * no call.
+ */
+#ifndef LIB_UTILS_STRVIEW_H__
+#define LIB_UTILS_STRVIEW_H__
+
+#include <stddef.h>
+#include <string.h>
+
+/*!
+ * @brief Position returned by find functions when nothing is found (also
+ *        length of lu_strview_slice to keep end of view).
+ */
+#define LU_STRVIEW_NPOS         ( (size_t)-1 )
+
+/*!
+ * @brief Static initializer of a view over a string literal (length is
+ *        computed at compile time).
+ */
+#define LU_STRVIEW_LITERAL( str )   { ( str ), sizeof( str ) - 1 }
+
+/*!
+ * @brief printf format of a view (use with LU_STRVIEW_ARG).
+ */
+#define LU_STRVIEW_FMT          "%.*s"
+
+/*!
+ * @brief printf arguments of a view (use with LU_STRVIEW_FMT).
+ */
+#define LU_STRVIEW_ARG( view )  (int)( view ).len, ( view ).ptr
+
+/*!
+ * @struct lu_strview_t
+ * @brief Immutable view over a string.
+ */
+typedef struct lu_strview_t
+{
+    const char *    ptr;    /*!< First byte (can be NULL if len is 0). */
+    size_t          len;    /*!< Length in bytes. */
+} lu_strview_t;
+
+/*!
+ * @brief Build a view over a buffer.
+ * @param ptr   Buffer (NUL termination not required).
+ * @param len   Length of buffer in bytes.
+ * @return The view.
+ */
+static inline lu_strview_t lu_strview( const char * ptr, size_t len )
+{
+    lu_strview_t view = { ptr, len };
+
+    return view;
+}
+
+/*!
+ * @brief Check if character is a white space (same set as isspace() in "C"
+ *        locale).
+ * @param c     Character to check.
+ * @return Non zero if c is a white space otherwise 0.
+ */
+static inline int lu_strview_is_space( char c )
+{
+    return ( ' ' == c ) || ( ( c >= '\t' ) && ( c <= '\r' ) );
+}
+
+/*!
+ * @brief Build a view over a NUL terminated string (length is measured once).
+ * @param str   String (can be NULL for an empty view).
+ * @return The view.
+ */
+lu_strview_t lu_strview_from_cstr( const char * str );
+
+/*!
+ * @brief Compare two views (same order as memcmp, a view is lower than views
+ *        it is a prefix of).
+ * @param view1 First view.
+ * @param view2 Second view.
+ * @return Negative value if view1 < view2, 0 if equal otherwise positive
+ *         value.
+ */
+static inline int lu_strview_compare( lu_strview_t view1, lu_strview_t view2 )
+{
+    size_t  len = ( view1.len < view2.len ) ? view1.len : view2.len;
+    int     ret = 0;
+
+    /* memcmp requires valid pointers even for a length of 0 */
+    if ( len > 0 )
+    {
+        ret = memcmp( view1.ptr, view2.ptr, len );
+    }
+
+    if ( 0 == ret )
+    {
+        ret = ( view1.len > view2.len ) - ( view1.len < view2.len );
+    }
+
+    return ret;
+}
+
+/*!
+ * @brief Check if two views have same bytes.
+ * @param view1 First view.
+ * @param view2 Second view.
+ * @return 1 if views are equal otherwise 0.
+ */
+static inline int lu_strview_equals( lu_strview_t view1, lu_strview_t view2 )
+{
+    /* memcmp requires valid pointers even for a length of 0 */
+    return ( view1.len == view2.len ) &&
+           ( ( 0 == view1.len ) || ( 0 == memcmp( view1.ptr, view2.ptr, view1.len ) ) );
+}
+
+/*!
+ * @brief Check if view starts with prefix.
+ * @param view      View to check.
+ * @param prefix    Prefix (an empty prefix always matches).
+ * @return 1 if view starts with prefix otherwise 0.
+ */
+static inline int lu_strview_starts_with( lu_strview_t view, lu_strview_t prefix )
+{
+    return ( view.len >= prefix.len ) &&
+           ( ( 0 == prefix.len ) || ( 0 == memcmp( view.ptr, prefix.ptr, prefix.len ) ) );
+}
+
+/*!
+ * @brief Check if view ends with suffix.
+ * @param view      View to check.
+ * @param suffix    Suffix (an empty suffix always matches).
+ * @return 1 if view ends with suffix otherwise 0.
+ */
+static inline int lu_strview_ends_with( lu_strview_t view, lu_strview_t suffix )
+{
+    return ( view.len >= suffix.len ) &&
+           ( ( 0 == suffix.len ) ||
+             ( 0 == memcmp( view.ptr + view.len - suffix.len, suffix.ptr, suffix.len ) ) );
+}
+
+/*!
+ * @brief Search first occurrence of a byte.
+ * @param view  View to search in.
+ * @param c     Byte to search.
+ * @return The position of c otherwise LU_STRVIEW_NPOS.
+ */
+static inline size_t lu_strview_find_char( lu_strview_t view, char c )
+{
+    const char * found = view.len ? (const char *)memchr( view.ptr, c, view.len ) : NULL;
+
+    return found ? (size_t)( found - view.ptr ) : LU_STRVIEW_NPOS;
+}
+
+/*!
+ * @brief Search first occurrence of a substring (see search_substring).
+ * @param view      View to search in.
+ * @param needle    Substring to search (an empty needle is found at 0).
+ * @return The position of needle otherwise LU_STRVIEW_NPOS.
+ */
+size_t lu_strview_find( lu_strview_t view, lu_strview_t needle );
+
+/*!
+ * @brief Return a part of view (bounds are clamped to view).
+ * @param view  View to slice.
+ * @param start Position of first byte (empty view at end if after end).
+ * @param len   Maximum length in bytes (LU_STRVIEW_NPOS to keep end of view).
+ * @return The slice (points in same buffer as view).
+ */
+static inline lu_strview_t lu_strview_slice( lu_strview_t view, size_t start, size_t len )
+{
+    if ( start > view.len )
+    {
+        start = view.len;
+    }
+    if ( len > view.len - start )
+    {
+        len = view.len - start;
+    }
+
+    /* Keep NULL pointer of an empty view (no arithmetic on NULL) */
+    return lu_strview( view.ptr ? view.ptr + start : NULL, len );
+}
+
+/*!
+ * @brief Remove leading white spaces (same set as isspace() in "C" locale).
+ * @param view  View to trim.
+ * @return The trimmed view.
+ */
+static inline lu_strview_t lu_strview_trim_left( lu_strview_t view )
+{
+    size_t i = 0;
+
+    while ( ( i < view.len ) && lu_strview_is_space( view.ptr[i] ) )
+    {
+        i++;
+    }
+
+    return lu_strview_slice( view, i, LU_STRVIEW_NPOS );
+}
+
+/*!
+ * @brief Remove trailing white spaces (same set as isspace() in "C" locale).
+ * @param view  View to trim.
+ * @return The trimmed view.
+ */
+static inline lu_strview_t lu_strview_trim_right( lu_strview_t view )
+{
+    while ( ( view.len > 0 ) && lu_strview_is_space( view.ptr[view.len - 1] ) )
+    {
+        view.len--;
+    }
+
+    return view;
+}
+
+/*!
+ * @brief Remove leading and trailing white spaces (same set as isspace() in
+ *        "C" locale).
+ * @param view  View to trim.
+ * @return The trimmed view.
+ */
+static inline lu_strview_t lu_strview_trim( lu_strview_t view )
+{
+    return lu_strview_trim_right( lu_strview_trim_left( view ) );
+}
+
+#endif /* LIB_UTILS_STRVIEW_H__ */
@@ -1,17 +1,351 @@
-/*!
- * @file: lib-utils-list.h
- * @date: 2024-01-26
- * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
- * @brief: Declaration of list macro.
- */
-#ifndef LIB_UTILS_LIST_H__
-#define LIB_UTILS_LIST_H__
-
-/*!
- * @brief Compute the number of element in table.
- * @param tab   Table to get the number of element.
- * @return The number of element of table.
- */
-#define GET_NB_ELEMENTS( tab ) ( sizeof( tab ) / sizeof( tab[0] ) )
-
-#endif /* LIB_UTILS_LIST_H__ */
\ No newline at end of file
+/*!
+ * @file: lib-utils-list.h
+ * @date: 2024-01-26
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of list macro.
+ *
+ * TAB_DEFINE( name, type ) generates a growable array name_t of elements of
+ * type and its static inline functions name_<function> (push, append, extend,
+ * reserve, resize, shrink_to_fit...). TAB_DEFINE_SORT( name, type, less )
+ * adds an in place sort name_sort using less( a, b ) to compare elements.
+ */
+#ifndef LIB_UTILS_LIST_H__
+#define LIB_UTILS_LIST_H__
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*!
+ * @brief Compute the number of element in table.
+ * @param tab   Table to get the number of element.
+ * @return The number of element of table.
+ */
+#define GET_NB_ELEMENTS( tab ) ( sizeof( tab ) / sizeof( tab[0] ) )
+
+/*!
+ * @brief Minimum number of elements allocated by growable arrays.
+ */
+#define TAB_MIN_CAPACITY    ( 8 )
+
+/*!
+ * @brief Initializer of empty growable array.
+ */
+#define TAB_INIT            { NULL, 0, 0 }
+
+/*!
+ * @brief Grow memory of array to hold at least a number of elements
+ *        (geometric growth: appends are amortized constant time).
+ * @param data      Elements (updated on success).
+ * @param capacity  Number of allocated elements (updated on success).
+ * @param elem_size Size of an element in bytes.
+ * @param needed    Number of elements to hold.
+ * @return 0 on success otherwise -1.
+ */
+int tab_grow( void ** data, size_t * capacity, size_t elem_size, size_t needed );
+
+/*!
+ * @brief Set memory of array to an exact number of elements.
+ * @param data      Elements (updated on success, NULL if capacity is 0).
+ * @param capacity  Number of allocated elements (updated on success).
+ * @param elem_size Size of an element in bytes.
+ * @param new_capacity  Number of elements to allocate.
+ * @return 0 on success otherwise -1.
+ */
+int tab_set_capacity( void ** data,
+                      size_t * capacity,
+                      size_t elem_size,
+                      size_t new_capacity );
+
+/*!
+ * @brief Define growable array type name_t of elements of type and its
+ *        functions. Functions return 0 on success otherwise -1 (array is
+ *        unchanged on error).
+ * @param name  Name of array type and prefix of its functions.
+ * @param type  Type of elements (copied with memcpy).
+ */
+#define TAB_DEFINE( name, type ) \
+    typedef struct name##_t \
+    { \
+        type *  data; \
+        size_t  size; \
+        size_t  capacity; \
+    } name##_t; \
+    \
+    static inline void name##_init( name##_t * tab ) \
+    { \
+        if ( tab ) \
+        { \
+            tab->data = NULL; \
+            tab->size = 0; \
+            tab->capacity = 0; \
+        } \
+    } \
+    \
+    static inline void name##_free( name##_t * tab ) \
+    { \
+        if ( tab ) \
+        { \
+            free( tab->data ); \
+            name##_init( tab ); \
+        } \
+    } \
+    \
+    static inline void name##_clear( name##_t * tab ) \
+    { \
+        if ( tab ) \
+        { \
+            tab->size = 0; \
+        } \
+    } \
+    \
+    static inline int name##_set_capacity( name##_t * tab, size_t capacity ) \
+    { \
+        void * data = tab->data; \
+        if ( 0 != tab_set_capacity( &data, &tab->capacity, sizeof( type ), capacity ) ) \
+        { \
+            return -1; \
+        } \
+        tab->data = (type *)data; \
+        return 0; \
+    } \
+    \
+    static inline int name##_reserve( name##_t * tab, size_t capacity ) \
+    { \
+        if ( ! tab ) \
+        { \
+            return -1; \
+        } \
+        return ( capacity <= tab->capacity ) ? 0 : name##_set_capacity( tab, capacity ); \
+    } \
+    \
+    static inline int name##_shrink_to_fit( name##_t * tab ) \
+    { \
+        if ( ! tab ) \
+        { \
+            return -1; \
+        } \
+        return name##_set_capacity( tab, tab->size ); \
+    } \
+    \
+    static inline type * name##_extend( name##_t * tab, size_t nb ) \
+    { \
+        void * data; \
+        type * ret; \
+        if ( ( ! tab ) || ( nb > (size_t)-1 - tab->size ) ) \
+        { \
+            return NULL; \
+        } \
+        if ( tab->size + nb > tab->capacity ) \
+        { \
+            data = tab->data; \
+            if ( 0 != tab_grow( &data, &tab->capacity, sizeof( type ), tab->size + nb ) ) \
+            { \
+                return NULL; \
+            } \
+            tab->data = (type *)data; \
+        } \
+        ret = tab->data + tab->size; \
+        tab->size += nb; \
+        return ret; \
+    } \
+    \
+    static inline int name##_push( name##_t * tab, type value ) \
+    { \
+        type * slot; \
+        if ( tab && ( tab->size < tab->capacity ) ) \
+        { \
+            tab->data[tab->size++] = value; \
+            return 0; \
+        } \
+        slot = name##_extend( tab, 1 ); \
+        if ( ! slot ) \
+        { \
+            return -1; \
+        } \
+        *slot = value; \
+        return 0; \
+    } \
+    \
+    static inline int name##_append( name##_t * tab, const type * values, size_t nb ) \
+    { \
+        type * slots; \
+        if ( ( ! tab ) || ( ( ! values ) && ( nb > 0 ) ) ) \
+        { \
+            return -1; \
+        } \
+        if ( 0 == nb ) \
+        { \
+            return 0; \
+        } \
+        slots = name##_extend( tab, nb ); \
+        if ( ! slots ) \
+        { \
+            return -1; \
+        } \
+        memcpy( slots, values, nb * sizeof( type ) ); \
+        return 0; \
+    } \
+    \
+    static inline int name##_resize( name##_t * tab, size_t size ) \
+    { \
+        size_t old_size; \
+        if ( ! tab ) \
+        { \
+            return -1; \
+        } \
+        old_size = tab->size; \
+        if ( size <= old_size ) \
+        { \
+            tab->size = size; \
+            return 0; \
+        } \
+        if ( ! name##_extend( tab, size - old_size ) ) \
+        { \
+            return -1; \
+        } \
+        memset( tab->data + old_size, 0, ( size - old_size ) * sizeof( type ) ); \
+        return 0; \
+    }
+
+/*!
+ * @brief Define in place sort name_sort of growable array name_t (introsort:
+ *        quicksort, heapsort when partitions are unbalanced, insertion sort
+ *        of small partitions; not stable).
+ * @param name  Name of array type defined by TAB_DEFINE.
+ * @param type  Type of elements.
+ * @param less  Function or macro less( a, b ) non zero if a is before b.
+ */
+#define TAB_DEFINE_SORT( name, type, less ) \
+    static inline void name##_sort_insertion( type * a, size_t n ) \
+    { \
+        size_t i; \
+        size_t j; \
+        type value; \
+        for ( i = 1; i < n; i++ ) \
+        { \
+            value = a[i]; \
+            for ( j = i; ( j > 0 ) && less( value, a[j - 1] ); j-- ) \
+            { \
+                a[j] = a[j - 1]; \
+            } \
+            a[j] = value; \
+        } \
+    } \
+    \
+    static inline void name##_sort_sift_down( type * a, size_t i, size_t n ) \
+    { \
+        size_t child; \
+        type value = a[i]; \
+        while ( ( child = 2 * i + 1 ) < n ) \
+        { \
+            if ( ( child + 1 < n ) && less( a[child], a[child + 1] ) ) \
+            { \
+                child++; \
+            } \
+            if ( ! less( value, a[child] ) ) \
+            { \
+                break; \
+            } \
+            a[i] = a[child]; \
+            i = child; \
+        } \
+        a[i] = value; \
+    } \
+    \
+    static inline void name##_sort_heap( type * a, size_t n ) \
+    { \
+        size_t i; \
+        type value; \
+        for ( i = n / 2; i > 0; i-- ) \
+        { \
+            name##_sort_sift_down( a, i - 1, n ); \
+        } \
+        for ( i = n; i > 1; i-- ) \
+        { \
+            value = a[0]; \
+            a[0] = a[i - 1]; \
+            a[i - 1] = value; \
+            name##_sort_sift_down( a, 0, i - 1 ); \
+        } \
+    } \
+    \
+    static inline void name##_sort_range( type * a, size_t n, unsigned int depth ) \
+    { \
+        size_t i; \
+        size_t j; \
+        type pivot; \
+        type value; \
+        while ( n > 16 ) \
+        { \
+            if ( 0 == depth-- ) \
+            { \
+                name##_sort_heap( a, n ); \
+                return; \
+            } \
+            /* Median of first, middle and last elements */ \
+            pivot = a[n / 2]; \
+            if ( less( pivot, a[0] ) ) \
+            { \
+                pivot = less( a[n - 1], a[0] ) ? \
+                        ( less( pivot, a[n - 1] ) ? a[n - 1] : pivot ) : a[0]; \
+            } \
+            else if ( less( a[n - 1], pivot ) ) \
+            { \
+                pivot = less( a[n - 1], a[0] ) ? a[0] : a[n - 1]; \
+            } \
+            /* Hoare partition: a[0..j] <= pivot <= a[j+1..n-1] */ \
+            i = 0; \
+            j = n - 1; \
+            while ( 1 ) \
+            { \
+                while ( less( a[i], pivot ) ) \
+                { \
+                    i++; \
+                } \
+                while ( less( pivot, a[j] ) ) \
+                { \
+                    j--; \
+                } \
+                if ( i >= j ) \
+                { \
+                    break; \
+                } \
+                value = a[i]; \
+                a[i] = a[j]; \
+                a[j] = value; \
+                i++; \
+                j--; \
+            } \
+            /* Recurse on smaller part: stack depth is logarithmic */ \
+            if ( j + 1 < n - j - 1 ) \
+            { \
+                name##_sort_range( a, j + 1, depth ); \
+                a += j + 1; \
+                n -= j + 1; \
+            } \
+            else \
+            { \
+                name##_sort_range( a + j + 1, n - j - 1, depth ); \
+                n = j + 1; \
+            } \
+        } \
+        name##_sort_insertion( a, n ); \
+    } \
+    \
+    static inline void name##_sort( name##_t * tab ) \
+    { \
+        unsigned int depth = 0; \
+        size_t n; \
+        if ( ( ! tab ) || ( tab->size < 2 ) ) \
+        { \
+            return; \
+        } \
+        for ( n = tab->size; n > 1; n >>= 1 ) \
+        { \
+            depth += 2; \
+        } \
+        name##_sort_range( tab->data, tab->size, depth ); \
+    }
+
+#endif /* LIB_UTILS_LIST_H__ */
@@ -0,0 +1,248 @@
+/*!
+ * @file: lib-utils-tab.hpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of C++17 growable array template.
+ *
+ * lib_utils::tab<T> is the C++ counterpart of arrays generated by TAB_DEFINE:
+ * same memory management (tab_grow, tab_set_capacity), elements are
+ * trivially copyable and functions report errors by returning false instead
+ * of throwing.
+ */
+#ifndef LIB_UTILS_TAB_HPP__
+#define LIB_UTILS_TAB_HPP__
+
+#if __cplusplus < 201703L
+#error "lib-utils-tab.hpp requires C++17"
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+extern "C"
+{
+    #include "lib-utils-tab.h"
+}
+
+namespace lib_utils
+{
+    /*!
+     * @brief Growable array of trivially copyable elements.
+     */
+    template <typename T>
+    class tab
+    {
+        static_assert( std::is_trivially_copyable_v<T>,
+                       "lib_utils::tab elements must be trivially copyable" );
+
+    public:
+        tab() noexcept = default;
+
+        tab( const tab & ) = delete;
+
+        tab & operator=( const tab & ) = delete;
+
+        tab( tab && other ) noexcept
+            : m_data( std::exchange( other.m_data, nullptr ) ),
+              m_size( std::exchange( other.m_size, 0 ) ),
+              m_capacity( std::exchange( other.m_capacity, 0 ) )
+        {
+        }
+
+        tab & operator=( tab && other ) noexcept
+        {
+            if ( this != &other )
+            {
+                std::free( m_data );
+                m_data = std::exchange( other.m_data, nullptr );
+                m_size = std::exchange( other.m_size, 0 );
+                m_capacity = std::exchange( other.m_capacity, 0 );
+            }
+            return *this;
+        }
+
+        ~tab()
+        {
+            std::free( m_data );
+        }
+
+        /*!
+         * @brief Reserve memory for a number of elements.
+         * @param capacity  Number of elements.
+         * @return true on success.
+         */
+        bool reserve( size_t capacity ) noexcept
+        {
+            return ( capacity <= m_capacity ) || set_capacity( capacity );
+        }
+
+        /*!
+         * @brief Release memory not used by elements.
+         * @return true on success.
+         */
+        bool shrink_to_fit() noexcept
+        {
+            return set_capacity( m_size );
+        }
+
+        /*!
+         * @brief Add uninitialized elements at end of array.
+         * @param nb    Number of elements (not 0).
+         * @return The first added element on success otherwise nullptr.
+         */
+        T * extend( size_t nb ) noexcept
+        {
+            void * data = m_data;
+            T * ret;
+
+            if ( ( nb > (size_t)-1 - m_size ) ||
+                 ( ( m_size + nb > m_capacity ) &&
+                   ( 0 != tab_grow( &data, &m_capacity, sizeof( T ), m_size + nb ) ) ) )
+            {
+                return nullptr;
+            }
+            m_data = static_cast<T *>( data );
+            ret = m_data + m_size;
+            m_size += nb;
+
+            return ret;
+        }
+
+        /*!
+         * @brief Add element at end of array (amortized constant time).
+         * @param value Element.
+         * @return true on success.
+         */
+        bool push_back( const T & value ) noexcept
+        {
+            T * slot;
+
+            if ( m_size < m_capacity )
+            {
+                m_data[m_size++] = value;
+                return true;
+            }
+
+            slot = extend( 1 );
+            if ( ! slot )
+            {
+                return false;
+            }
+            *slot = value;
+
+            return true;
+        }
+
+        /*!
+         * @brief Add elements at end of array (one copy).
+         * @param values    Elements.
+         * @param nb        Number of elements.
+         * @return true on success.
+         */
+        bool append( const T * values, size_t nb ) noexcept
+        {
+            T * slots;
+
+            if ( 0 == nb )
+            {
+                return true;
+            }
+
+            slots = values ? extend( nb ) : nullptr;
+            if ( ! slots )
+            {
+                return false;
+            }
+            std::memcpy( static_cast<void *>( slots ), values, nb * sizeof( T ) );
+
+            return true;
+        }
+
+        /*!
+         * @brief Change number of elements (added elements are value
+         *        initialized).
+         * @param size  Number of elements.
+         * @return true on success.
+         */
+        bool resize( size_t size ) noexcept
+        {
+            size_t old_size = m_size;
+
+            if ( size <= old_size )
+            {
+                m_size = size;
+                return true;
+            }
+
+            if ( ! extend( size - old_size ) )
+            {
+                return false;
+            }
+            std::fill( m_data + old_size, m_data + size, T() );
+
+            return true;
+        }
+
+        /*!
+         * @brief Remove all elements (memory is kept).
+         * @return None.
+         */
+        void clear() noexcept
+        {
+            m_size = 0;
+        }
+
+        /*!
+         * @brief Sort elements in place.
+         * @param less  Comparison function.
+         * @return None.
+         */
+        template <typename Compare = std::less<T>>
+        void sort( Compare less = Compare() )
+        {
+            std::sort( begin(), end(), less );
+        }
+
+        T * data() noexcept { return m_data; }
+        const T * data() const noexcept { return m_data; }
+        size_t size() const noexcept { return m_size; }
+        size_t capacity() const noexcept { return m_capacity; }
+        bool empty() const noexcept { return 0 == m_size; }
+        T * begin() noexcept { return m_data; }
+        T * end() noexcept { return m_data + m_size; }
+        const T * begin() const noexcept { return m_data; }
+        const T * end() const noexcept { return m_data + m_size; }
+        T & operator[]( size_t i ) noexcept { return m_data[i]; }
+        const T & operator[]( size_t i ) const noexcept { return m_data[i]; }
+
+    private:
+        /*!
+         * @brief Set memory to an exact number of elements.
+         * @param capacity  Number of elements.
+         * @return true on success.
+         */
+        bool set_capacity( size_t capacity ) noexcept
+        {
+            void * data = m_data;
+
+            if ( 0 != tab_set_capacity( &data, &m_capacity, sizeof( T ), capacity ) )
+            {
+                return false;
+            }
+            m_data = static_cast<T *>( data );
+
+            return true;
+        }
+
+        T *     m_data = nullptr;   /*!< Elements. */
+        size_t  m_size = 0;         /*!< Number of elements. */
+        size_t  m_capacity = 0;     /*!< Number of allocated elements. */
+    };
+}
+
+#endif /* LIB_UTILS_TAB_HPP__ */
@@ -0,0 +1,152 @@
+/*!
+ * @file: lib-utils-utf8.h
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Declaration of functions to validate and transcode UTF-8.
+ *
+ * Valid UTF-8 follows RFC 3629: shortest form only, no surrogate (U+D800 to
+ * U+DFFF) and no code point above U+10FFFF. UTF-16 and UTF-32 are in native
+ * byte order. Vectorized implementations are selected at runtime (see
+ * utf8_set_isa), results do not depend on instruction set.
+ */
+#ifndef LIB_UTILS_UTF8_H__
+#define LIB_UTILS_UTF8_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * @enum utf8_isa_t
+ * @brief Instruction set used by UTF-8 functions.
+ */
+typedef enum utf8_isa_t
+{
+    UTF8_ISA_SCALAR = 0,    /*!< Portable C implementation. */
+    UTF8_ISA_SSSE3  = 1,    /*!< x86 SSSE3 implementation (16 bytes per
+                                 step). */
+    UTF8_ISA_AVX2   = 2,    /*!< x86 AVX2 implementation (32 bytes per
+                                 step). */
+} utf8_isa_t;
+
+/*!
+ * @brief Select instruction set used by UTF-8 functions (by default the best
+ *        one supported by CPU is selected on first use).
+ * @param isa   Instruction set to use.
+ * @return 0 on success otherwise -1 (instruction set not supported by CPU or
+ *         target).
+ */
+int utf8_set_isa( utf8_isa_t isa );
+
+/*!
+ * @brief Return instruction set used by UTF-8 functions.
+ * @return The instruction set used by UTF-8 functions.
+ */
+utf8_isa_t utf8_get_isa( void );
+
+/*!
+ * @brief Validate UTF-8 buffer.
+ * @param buf           Buffer to validate (NUL is a valid character).
+ * @param len           Length of buffer in bytes.
+ * @param error_offset  Pointer to store offset of first invalid sequence (can
+ *                      be NULL, unchanged if buffer is valid).
+ * @return 0 if buffer is valid UTF-8 otherwise -1.
+ */
+int utf8_validate( const char * buf, size_t len, size_t * error_offset );
+
+/*!
+ * @brief Count code points of valid UTF-8 buffer.
+ * @param buf   Valid UTF-8 buffer.
+ * @param len   Length of buffer in bytes.
+ * @return The number of code points (0 if buf is NULL).
+ */
+size_t utf8_count_code_points( const char * buf, size_t len );
+
+/*!
+ * @brief Return number of UTF-16 code units of valid UTF-8 buffer.
+ * @param buf   Valid UTF-8 buffer.
+ * @param len   Length of buffer in bytes.
+ * @return The number of UTF-16 code units (0 if buf is NULL).
+ */
+size_t utf8_utf16_length( const char * buf, size_t len );
+
+/*!
+ * @brief Return number of UTF-8 bytes of valid UTF-16 buffer.
+ * @param buf   Valid UTF-16 buffer.
+ * @param len   Number of code units.
+ * @return The number of bytes (0 if buf is NULL).
+ */
+size_t utf16_utf8_length( const uint16_t * buf, size_t len );
+
+/*!
+ * @brief Return number of UTF-8 bytes of valid UTF-32 buffer.
+ * @param buf   Valid UTF-32 buffer.
+ * @param len   Number of code points.
+ * @return The number of bytes (0 if buf is NULL).
+ */
+size_t utf32_utf8_length( const uint32_t * buf, size_t len );
+
+/*!
+ * @brief Transcode UTF-8 to UTF-16 (input is validated).
+ * @param buf       UTF-8 buffer.
+ * @param len       Length of buffer in bytes.
+ * @param out       Array to store code units (see utf8_utf16_length).
+ * @param max_out   Maximum number of code units to store in out.
+ * @param nb_out    Pointer to store number of code units stored.
+ * @return 0 on success otherwise -1 (invalid input or out too small).
+ */
+int utf8_to_utf16( const char * buf,
+                   size_t len,
+                   uint16_t * out,
+                   size_t max_out,
+                   size_t * nb_out );
+
+/*!
+ * @brief Transcode UTF-8 to UTF-32 (input is validated).
+ * @param buf       UTF-8 buffer.
+ * @param len       Length of buffer in bytes.
+ * @param out       Array to store code points (see utf8_count_code_points).
+ * @param max_out   Maximum number of code points to store in out.
+ * @param nb_out    Pointer to store number of code points stored.
+ * @return 0 on success otherwise -1 (invalid input or out too small).
+ */
+int utf8_to_utf32( const char * buf,
+                   size_t len,
+                   uint32_t * out,
+                   size_t max_out,
+                   size_t * nb_out );
+
+/*!
+ * @brief Transcode UTF-16 to UTF-8 (input is validated: surrogates must be
+ *        paired).
+ * @param buf       UTF-16 buffer.
+ * @param len       Number of code units.
+ * @param out       Buffer to store bytes (see utf16_utf8_length, not NUL
+ *                  terminated).
+ * @param max_out   Maximum number of bytes to store in out.
+ * @param nb_out    Pointer to store number of bytes stored.
+ * @return 0 on success otherwise -1 (invalid input or out too small).
+ */
+int utf16_to_utf8( const uint16_t * buf,
+                   size_t len,
+                   char * out,
+                   size_t max_out,
+                   size_t * nb_out );
+
+/*!
+ * @brief Transcode UTF-32 to UTF-8 (input is validated: no surrogate, no code
+ *        point above U+10FFFF).
+ * @param buf       UTF-32 buffer.
+ * @param len       Number of code points.
+ * @param out       Buffer to store bytes (see utf32_utf8_length, not NUL
+ *                  terminated).
+ * @param max_out   Maximum number of bytes to store in out.
+ * @param nb_out    Pointer to store number of bytes stored.
+ * @return 0 on success otherwise -1 (invalid input or out too small).
+ */
+int utf32_to_utf8( const uint32_t * buf,
+                   size_t len,
+                   char * out,
+                   size_t max_out,
+                   size_t * nb_out );
+
+#endif /* LIB_UTILS_UTF8_H__ */
@@ -0,0 +1,205 @@
+/*!
+ * @file: lib-utils-arena.c
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of arena (bump) allocator.
+ */
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "lib-utils-arena.h"
+#include "lib-utils-assert.h"
+
+/*!
+ * @struct arena_block_t
+ * @brief Block of memory of arena (blocks are chained in allocation order).
+ */
+typedef struct arena_block_t
+{
+    struct arena_block_t *  next;       /*!< Next block. */
+    size_t                  size;       /*!< Size of data in bytes. */
+    max_align_t             data[];     /*!< Memory given to allocations. */
+} arena_block_t;
+
+struct arena_t
+{
+    arena_block_t *     first;          /*!< First block. */
+    arena_block_t *     current;        /*!< Block used by allocations. */
+    uintptr_t           pos;            /*!< Next free byte of current block. */
+    uintptr_t           end;            /*!< End of current block. */
+    size_t              block_size;     /*!< Default size of new blocks. */
+    size_t              capacity;       /*!< Size of all blocks. */
+};
+
+/*!
+ * @brief Allocate from current block if there is enough space.
+ * @param arena     Arena.
+ * @param size      Size in bytes.
+ * @param alignment Alignment in bytes (power of 2).
+ * @return The allocated memory on success otherwise NULL.
+ */
+static inline void * alloc_from_current( arena_t * arena,
+                                         size_t size,
+                                         size_t alignment );
+
+/*!
+ * @brief Select current block.
+ * @param arena     Arena.
+ * @param block     New current block.
+ * @return None.
+ */
+static inline void set_current_block( arena_t * arena, arena_block_t * block );
+
+/*!
+ * @brief Allocate when current block is full: use next blocks (kept after a
+ *        reset) or add a new block.
+ * @param arena     Arena.
+ * @param size      Size in bytes.
+ * @param alignment Alignment in bytes (power of 2).
+ * @return The allocated memory on success otherwise NULL.
+ */
+static void * alloc_slow( arena_t * arena, size_t size, size_t alignment );
+
+arena_t * arena_create( size_t block_size )
+{
+    arena_t * arena = calloc( 1, sizeof( *arena ) );
+
+    if ( arena )
+    {
+        arena->block_size = block_size ? block_size : ARENA_DEFAULT_BLOCK_SIZE;
+    }
+
+    return arena;
+}
+
+void arena_destroy( arena_t * arena )
+{
+    arena_block_t * block;
+    arena_block_t * next;
+
+    if ( ! arena )
+    {
+        return;
+    }
+
+    for ( block = arena->first; block; block = next )
+    {
+        next = block->next;
+        free( block );
+    }
+
+    free( arena );
+}
+
+void * arena_alloc( arena_t * arena, size_t size )
+{
+    return arena_alloc_aligned( arena, size, _Alignof( max_align_t ) );
+}
+
+void * arena_alloc_aligned( arena_t * arena, size_t size, size_t alignment )
+{
+    void * ret;
+
+    ASSERT_PTR( arena, NULL );
+
+    if ( ( 0 == alignment ) || ( 0 != ( alignment & ( alignment - 1 ) ) ) )
+    {
+        return NULL;
+    }
+
+    ret = alloc_from_current( arena, size, alignment );
+    if ( ! ret )
+    {
+        ret = alloc_slow( arena, size, alignment );
+    }
+
+    return ret;
+}
+
+void arena_reset( arena_t * arena )
+{
+    ASSERT_PTR( arena, );
+
+    set_current_block( arena, arena->first );
+}
+
+size_t arena_get_capacity( const arena_t * arena )
+{
+    return arena ? arena->capacity : 0;
+}
+
+void * alloc_from_current( arena_t * arena, size_t size, size_t alignment )
+{
+    uintptr_t aligned = ( arena->pos + alignment - 1 ) & ~(uintptr_t)( alignment - 1 );
+
+    if ( ( ! arena->current ) || ( aligned < arena->pos ) ||
+         ( aligned > arena->end ) || ( size > arena->end - aligned ) )
+    {
+        return NULL;
+    }
+
+    arena->pos = aligned + size;
+
+    return (void *)aligned;
+}
+
+void set_current_block( arena_t * arena, arena_block_t * block )
+{
+    arena->current = block;
+    arena->pos = block ? (uintptr_t)block->data : 0;
+    arena->end = block ? arena->pos + block->size : 0;
+}
+
+void * alloc_slow( arena_t * arena, size_t size, size_t alignment )
+{
+    arena_block_t * block;
+    size_t          block_size;
+    void *          ret;
+
+    /* Blocks kept by a reset */
+    while ( arena->current && arena->current->next )
+    {
+        set_current_block( arena, arena->current->next );
+        ret = alloc_from_current( arena, size, alignment );
+        if ( ret )
+        {
+            return ret;
+        }
+    }
+
+    /* Data is aligned on max_align_t: padding only for larger alignments */
+    block_size = size + alignment - 1;
+    if ( block_size < size )
+    {
+        return NULL;
+    }
+    if ( block_size < arena->block_size )
+    {
+        block_size = arena->block_size;
+    }
+    if ( block_size > SIZE_MAX - sizeof( *block ) )
+    {
+        return NULL;
+    }
+
+    block = malloc( sizeof( *block ) + block_size );
+    if ( ! block )
+    {
+        return NULL;
+    }
+    block->next = NULL;
+    block->size = block_size;
+    arena->capacity += block_size;
+
+    if ( arena->current )
+    {
+        arena->current->next = block;
+    }
+    else
+    {
+        arena->first = block;
+    }
+    set_current_block( arena, block );
+
+    return alloc_from_current( arena, size, alignment );
+}
@@ -0,0 +1,294 @@
+/*!
+ * @file: lib-utils-file-reader.c
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of function to read large delimited files.
+ */
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <sys/mman.h>
+
+/*!
+ * @brief mmap is available for this target.
+ */
+#define HAVE_FILE_READER_MMAP 1
+#endif
+
+#include "lib-utils-assert.h"
+#include "lib-utils-file-reader.h"
+
+#ifndef O_BINARY
+/*!
+ * @brief No line ending translation (only defined on Windows).
+ */
+#define O_BINARY 0
+#endif
+
+/*!
+ * @brief Map whole file in memory.
+ * @param reader    Reader context (file is opened).
+ * @return 0 on success otherwise -1.
+ */
+static int map_file( file_reader_t * reader );
+
+/*!
+ * @brief Read next chunk of file in buffer after unconsumed data (moved at
+ *        start of buffer, buffer grows if full).
+ * @param reader    Reader context.
+ * @return 0 on success otherwise -1.
+ */
+static int fill_buffer( file_reader_t * reader );
+
+int file_reader_open( file_reader_t * reader,
+                      const char * path,
+                      char delim,
+                      file_reader_mode_t mode,
+                      size_t chunk_size )
+{
+    ASSERT_PTR( reader, -1 );
+    ASSERT_STR_NOT_NULL( path, -1 );
+
+    memset( reader, 0, sizeof( *reader ) );
+    reader->delim = delim;
+    reader->fd = open( path, O_RDONLY | O_BINARY );
+    if ( reader->fd < 0 )
+    {
+        return -1;
+    }
+
+    if ( ( FILE_READER_MODE_READ != mode ) && ( 0 == map_file( reader ) ) )
+    {
+        return 0;
+    }
+
+    if ( FILE_READER_MODE_MMAP == mode )
+    {
+        file_reader_close( reader );
+        return -1;
+    }
+
+    reader->buffer_size = chunk_size ? chunk_size : FILE_READER_DEFAULT_CHUNK_SIZE;
+    reader->buffer = malloc( reader->buffer_size );
+    if ( ! reader->buffer )
+    {
+        file_reader_close( reader );
+        return -1;
+    }
+    reader->data = reader->buffer;
+
+    return 0;
+}
+
+void file_reader_close( file_reader_t * reader )
+{
+    if ( ! reader )
+    {
+        return;
+    }
+
+#ifdef HAVE_FILE_READER_MMAP
+    if ( reader->map )
+    {
+        munmap( reader->map, reader->map_size );
+    }
+#endif
+
+    free( reader->buffer );
+
+    if ( reader->fd >= 0 )
+    {
+        close( reader->fd );
+    }
+
+    memset( reader, 0, sizeof( *reader ) );
+    reader->fd = -1;
+}
+
+int file_reader_next_record( file_reader_t * reader,
+                             const char ** record,
+                             size_t * len )
+{
+    const char * eol;
+
+    ASSERT_PTR( reader, -1 );
+    ASSERT_PTR( reader->data, -1 );
+
+    while ( 1 )
+    {
+        eol = memchr( reader->data + reader->scan, '\n',
+                      reader->data_len - reader->scan );
+        if ( eol )
+        {
+            reader->record = reader->data + reader->pos;
+            reader->record_len = eol - reader->record;
+            reader->pos = eol - reader->data + 1;
+            reader->scan = reader->pos;
+            break;
+        }
+
+        reader->scan = reader->data_len;
+
+        if ( reader->eof )
+        {
+            /* Last record without '\n' */
+            if ( reader->pos == reader->data_len )
+            {
+                reader->record_len = 0;
+                reader->field_pos = 1;
+                return 0;
+            }
+
+            reader->record = reader->data + reader->pos;
+            reader->record_len = reader->data_len - reader->pos;
+            reader->pos = reader->data_len;
+            break;
+        }
+
+        if ( 0 != fill_buffer( reader ) )
+        {
+            return -1;
+        }
+    }
+
+    if ( ( reader->record_len > 0 ) &&
+         ( '\r' == reader->record[reader->record_len - 1] ) )
+    {
+        reader->record_len--;
+    }
+
+    /* Empty record has no field */
+    reader->field_pos = ( reader->record_len > 0 ) ? 0 : 1;
+
+    if ( record )
+    {
+        *record = reader->record;
+    }
+
+    if ( len )
+    {
+        *len = reader->record_len;
+    }
+
+    return 1;
+}
+
+int file_reader_next_field( file_reader_t * reader,
+                            const char ** field,
+                            size_t * len )
+{
+    const char * sep;
+
+    ASSERT_PTR( reader, -1 );
+    ASSERT_PTR( field, -1 );
+    ASSERT_PTR( len, -1 );
+
+    if ( ( ! reader->record ) || ( reader->field_pos > reader->record_len ) )
+    {
+        return 0;
+    }
+
+    *field = reader->record + reader->field_pos;
+    sep = memchr( *field, reader->delim, reader->record_len - reader->field_pos );
+    if ( sep )
+    {
+        *len = sep - *field;
+    }
+    else
+    {
+        *len = reader->record_len - reader->field_pos;
+    }
+    reader->field_pos += *len + 1;
+
+    return 1;
+}
+
+int map_file( file_reader_t * reader )
+{
+#ifdef HAVE_FILE_READER_MMAP
+    struct stat st;
+
+    if ( ( 0 != fstat( reader->fd, &st ) ) || ( ! S_ISREG( st.st_mode ) ) )
+    {
+        return -1;
+    }
+
+    reader->eof = 1;
+    if ( 0 == st.st_size )
+    {
+        /* Nothing to map: empty data */
+        reader->data = "";
+        return 0;
+    }
+
+    reader->map = mmap( NULL, st.st_size, PROT_READ, MAP_PRIVATE, reader->fd, 0 );
+    if ( MAP_FAILED == reader->map )
+    {
+        reader->map = NULL;
+        reader->eof = 0;
+        return -1;
+    }
+
+    madvise( reader->map, st.st_size, MADV_SEQUENTIAL );
+    reader->map_size = st.st_size;
+    reader->data = reader->map;
+    reader->data_len = reader->map_size;
+
+    return 0;
+#else
+    (void)reader;
+
+    return -1;
+#endif
+}
+
+int fill_buffer( file_reader_t * reader )
+{
+    size_t      remaining = reader->data_len - reader->pos;
+    size_t      new_size;
+    char *      new_buffer;
+    ssize_t     ret;
+
+    if ( reader->pos > 0 )
+    {
+        memmove( reader->buffer, reader->buffer + reader->pos, remaining );
+        reader->scan -= reader->pos;
+        reader->data_len = remaining;
+        reader->pos = 0;
+    }
+
+    if ( reader->data_len == reader->buffer_size )
+    {
+        /* Record larger than buffer */
+        new_size = reader->buffer_size * 2;
+        new_buffer = realloc( reader->buffer, new_size );
+        if ( ! new_buffer )
+        {
+            return -1;
+        }
+        reader->buffer = new_buffer;
+        reader->buffer_size = new_size;
+        reader->data = new_buffer;
+    }
+
+    do
+    {
+        ret = read( reader->fd, reader->buffer + reader->data_len,
+                    reader->buffer_size - reader->data_len );
+    } while ( ( ret < 0 ) && ( EINTR == errno ) );
+
+    if ( ret < 0 )
+    {
+        return -1;
+    }
+
+    reader->eof = ( 0 == ret );
+    reader->data_len += ret;
+
+    return 0;
+}
@@ -0,0 +1,724 @@
+/*!
+ * @file: lib-utils-hash-map.c
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of open addressing hash map.
+ *
+ * SwissTable layout: hash is split in h1 (position of first group to probe)
+ * and h2 (7 bits stored in control byte). Groups of GROUP_SIZE control bytes
+ * are probed with a quadratic (triangular) sequence which visits all groups
+ * because the number of slots is a power of 2. The first GROUP_SIZE control
+ * bytes are cloned after the last one so a group can be loaded at any slot.
+ */
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+
+/*!
+ * @brief SSE2 group probing is available for this target.
+ */
+#define HAVE_HASH_MAP_SSE2 1
+#endif
+
+#include "lib-utils-assert.h"
+#include "lib-utils-hash.h"
+#include "lib-utils-hash-map.h"
+
+/*!
+ * @brief Number of control bytes compared at once.
+ */
+#define GROUP_SIZE      ( 16 )
+
+/*!
+ * @brief Control byte of empty slot (stops probing).
+ */
+#define CTRL_EMPTY      ( (uint8_t)0x80 )
+
+/*!
+ * @brief Control byte of removed entry (probing continues).
+ */
+#define CTRL_DELETED    ( (uint8_t)0xFE )
+
+/*!
+ * @struct hash_map_slot_t
+ * @brief Slot of hash map (slots of integer keys end before string).
+ */
+typedef struct hash_map_slot_t
+{
+    uint64_t    key;        /*!< Integer key or hash of string key. */
+    void *      value;      /*!< Value. */
+    char *      string;     /*!< Copy of string key. */
+    size_t      len;        /*!< Length of string key. */
+} hash_map_slot_t;
+
+struct hash_map_t
+{
+    hash_map_key_t      key_type;       /*!< Type of keys. */
+    uint8_t *           ctrl;           /*!< Control bytes (nb_slots +
+                                             GROUP_SIZE). */
+    uint8_t *           slots;          /*!< Slots. */
+    size_t              slot_size;      /*!< Size of a slot in bytes. */
+    size_t              nb_slots;       /*!< Number of slots (power of 2). */
+    size_t              count;          /*!< Number of entries. */
+    size_t              growth_left;    /*!< Empty slots usable before resize. */
+};
+
+/*!
+ * @brief Hash integer key (bits mixer of MurmurHash3).
+ * @param key   Key.
+ * @return The hash.
+ */
+static inline uint64_t hash_uint64( uint64_t key );
+
+/*!
+ * @brief Return slot of hash map.
+ * @param map   Hash map.
+ * @param i     Index of slot.
+ * @return The slot.
+ */
+static inline hash_map_slot_t * get_slot( const hash_map_t * map, size_t i );
+
+/*!
+ * @brief Return maximum number of entries and deleted slots of a table (7/8
+ *        of slots).
+ * @param nb_slots  Number of slots.
+ * @return The maximum load.
+ */
+static inline size_t get_max_load( size_t nb_slots );
+
+/*!
+ * @brief Return bit mask of control bytes of group equal to a byte.
+ * @param ctrl  First control byte of group.
+ * @param byte  Byte to find.
+ * @return The mask (bit i set if ctrl[i] equals byte).
+ */
+static inline uint32_t match_byte( const uint8_t * ctrl, uint8_t byte );
+
+/*!
+ * @brief Return bit mask of empty or deleted slots of group.
+ * @param ctrl  First control byte of group.
+ * @return The mask (bit i set if slot i is free).
+ */
+static inline uint32_t match_free( const uint8_t * ctrl );
+
+/*!
+ * @brief Set control byte of slot (and its clone).
+ * @param map   Hash map.
+ * @param i     Index of slot.
+ * @param ctrl  Control byte.
+ * @return None.
+ */
+static inline void set_ctrl( hash_map_t * map, size_t i, uint8_t ctrl );
+
+/*!
+ * @brief Find slot of key.
+ * @param map       Hash map.
+ * @param hash      Hash of key.
+ * @param key       Integer key (HASH_MAP_KEY_UINT64).
+ * @param string    String key (HASH_MAP_KEY_STRING).
+ * @param len       Length of string key.
+ * @return The index of slot if found otherwise number of slots.
+ */
+static size_t find_slot( const hash_map_t * map,
+                         uint64_t hash,
+                         uint64_t key,
+                         const char * string,
+                         size_t len );
+
+/*!
+ * @brief Find first free slot of probe sequence of a hash.
+ * @param map   Hash map.
+ * @param hash  Hash.
+ * @return The index of slot.
+ */
+static size_t find_free_slot( const hash_map_t * map, uint64_t hash );
+
+/*!
+ * @brief Allocate slots and move entries to them.
+ * @param map       Hash map.
+ * @param nb_slots  New number of slots (power of 2, at least GROUP_SIZE).
+ * @return 0 on success otherwise -1.
+ */
+static int resize( hash_map_t * map, size_t nb_slots );
+
+/*!
+ * @brief Compute number of slots needed for a number of entries.
+ * @param capacity  Number of entries.
+ * @param nb_slots  Number of slots on return.
+ * @return 0 on success otherwise -1 (too many entries).
+ */
+static int get_nb_slots( size_t capacity, size_t * nb_slots );
+
+/*!
+ * @brief Add entry of a key known to be absent.
+ * @param map       Hash map.
+ * @param hash      Hash of key.
+ * @param key       Integer key or hash of string key.
+ * @param string    Copy of string key (NULL for integer keys).
+ * @param len       Length of string key.
+ * @param value     Value.
+ * @return 0 on success otherwise -1.
+ */
+static int insert_slot( hash_map_t * map,
+                        uint64_t hash,
+                        uint64_t key,
+                        char * string,
+                        size_t len,
+                        void * value );
+
+/*!
+ * @brief Remove entry of slot.
+ * @param map   Hash map.
+ * @param i     Index of slot.
+ * @return None.
+ */
+static void remove_slot( hash_map_t * map, size_t i );
+
+hash_map_t * hash_map_create( hash_map_key_t key_type, size_t capacity )
+{
+    hash_map_t *    map;
+    size_t          nb_slots;
+
+    if ( ( ( HASH_MAP_KEY_UINT64 != key_type ) && ( HASH_MAP_KEY_STRING != key_type ) ) ||
+         ( 0 != get_nb_slots( capacity ? capacity : HASH_MAP_DEFAULT_CAPACITY,
+                              &nb_slots ) ) )
+    {
+        return NULL;
+    }
+
+    map = calloc( 1, sizeof( *map ) );
+    if ( ! map )
+    {
+        return NULL;
+    }
+    map->key_type = key_type;
+    map->slot_size = ( HASH_MAP_KEY_STRING == key_type ) ?
+                     sizeof( hash_map_slot_t ) : offsetof( hash_map_slot_t, string );
+
+    if ( 0 != resize( map, nb_slots ) )
+    {
+        free( map );
+        return NULL;
+    }
+
+    return map;
+}
+
+void hash_map_destroy( hash_map_t * map )
+{
+    if ( ! map )
+    {
+        return;
+    }
+
+    hash_map_clear( map );
+    free( map->ctrl );
+    free( map->slots );
+    free( map );
+}
+
+void hash_map_clear( hash_map_t * map )
+{
+    size_t i;
+
+    ASSERT_PTR( map, );
+
+    if ( HASH_MAP_KEY_STRING == map->key_type )
+    {
+        for ( i = 0; i < map->nb_slots; i++ )
+        {
+            if ( map->ctrl[i] < CTRL_EMPTY )
+            {
+                free( get_slot( map, i )->string );
+            }
+        }
+    }
+
+    memset( map->ctrl, CTRL_EMPTY, map->nb_slots + GROUP_SIZE );
+    map->count = 0;
+    map->growth_left = get_max_load( map->nb_slots );
+}
+
+int hash_map_reserve( hash_map_t * map, size_t capacity )
+{
+    size_t nb_slots;
+
+    ASSERT_PTR( map, -1 );
+
+    if ( capacity < map->count )
+    {
+        capacity = map->count;
+    }
+
+    if ( 0 != get_nb_slots( capacity, &nb_slots ) )
+    {
+        return -1;
+    }
+
+    return ( nb_slots > map->nb_slots ) ? resize( map, nb_slots ) : 0;
+}
+
+size_t hash_map_get_count( const hash_map_t * map )
+{
+    return map ? map->count : 0;
+}
+
+int hash_map_set_uint64( hash_map_t * map, uint64_t key, void * value )
+{
+    uint64_t    hash;
+    size_t      i;
+
+    ASSERT_PTR( map, -1 );
+
+    if ( HASH_MAP_KEY_UINT64 != map->key_type )
+    {
+        return -1;
+    }
+
+    hash = hash_uint64( key );
+    i = find_slot( map, hash, key, NULL, 0 );
+    if ( i < map->nb_slots )
+    {
+        get_slot( map, i )->value = value;
+        return 0;
+    }
+
+    return insert_slot( map, hash, key, NULL, 0, value );
+}
+
+int hash_map_get_uint64( const hash_map_t * map, uint64_t key, void ** value )
+{
+    size_t i;
+
+    ASSERT_PTR( map, -1 );
+
+    if ( HASH_MAP_KEY_UINT64 != map->key_type )
+    {
+        return -1;
+    }
+
+    i = find_slot( map, hash_uint64( key ), key, NULL, 0 );
+    if ( i == map->nb_slots )
+    {
+        return -1;
+    }
+
+    if ( value )
+    {
+        *value = get_slot( map, i )->value;
+    }
+
+    return 0;
+}
+
+int hash_map_remove_uint64( hash_map_t * map, uint64_t key )
+{
+    size_t i;
+
+    ASSERT_PTR( map, -1 );
+
+    if ( HASH_MAP_KEY_UINT64 != map->key_type )
+    {
+        return -1;
+    }
+
+    i = find_slot( map, hash_uint64( key ), key, NULL, 0 );
+    if ( i == map->nb_slots )
+    {
+        return -1;
+    }
+
+    remove_slot( map, i );
+
+    return 0;
+}
+
+int hash_map_set_string( hash_map_t * map, const char * key, void * value )
+{
+    uint64_t    hash;
+    size_t      len;
+    size_t      i;
+    char *      copy;
+
+    ASSERT_PTR( map, -1 );
+    ASSERT_PTR( key, -1 );
+
+    if ( HASH_MAP_KEY_STRING != map->key_type )
+    {
+        return -1;
+    }
+
+    len = strlen( key );
+    hash = hash_buffer( key, len );
+    i = find_slot( map, hash, hash, key, len );
+    if ( i < map->nb_slots )
+    {
+        get_slot( map, i )->value = value;
+        return 0;
+    }
+
+    copy = malloc( len + 1 );
+    if ( ! copy )
+    {
+        return -1;
+    }
+    memcpy( copy, key, len + 1 );
+
+    if ( 0 != insert_slot( map, hash, hash, copy, len, value ) )
+    {
+        free( copy );
+        return -1;
+    }
+
+    return 0;
+}
+
+int hash_map_get_string( const hash_map_t * map, const char * key, void ** value )
+{
+    ASSERT_PTR( key, -1 );
+
+    return hash_map_get_string_n( map, key, strlen( key ), value );
+}
+
+int hash_map_get_string_n( const hash_map_t * map,
+                           const char * key,
+                           size_t len,
+                           void ** value )
+{
+    uint64_t    hash;
+    size_t      i;
+
+    ASSERT_PTR( map, -1 );
+    ASSERT_PTR( key, -1 );
+
+    if ( HASH_MAP_KEY_STRING != map->key_type )
+    {
+        return -1;
+    }
+
+    hash = hash_buffer( key, len );
+    i = find_slot( map, hash, hash, key, len );
+    if ( i == map->nb_slots )
+    {
+        return -1;
+    }
+
+    if ( value )
+    {
+        *value = get_slot( map, i )->value;
+    }
+
+    return 0;
+}
+
+int hash_map_remove_string( hash_map_t * map, const char * key )
+{
+    uint64_t    hash;
+    size_t      len;
+    size_t      i;
+
+    ASSERT_PTR( map, -1 );
+    ASSERT_PTR( key, -1 );
+
+    if ( HASH_MAP_KEY_STRING != map->key_type )
+    {
+        return -1;
+    }
+
+    len = strlen( key );
+    hash = hash_buffer( key, len );
+    i = find_slot( map, hash, hash, key, len );
+    if ( i == map->nb_slots )
+    {
+        return -1;
+    }
+
+    free( get_slot( map, i )->string );
+    remove_slot( map, i );
+
+    return 0;
+}
+
+int hash_map_next( const hash_map_t * map, size_t * pos, hash_map_entry_t * entry )
+{
+    hash_map_slot_t *   slot;
+    size_t              i;
+
+    ASSERT_PTR( map, -1 );
+    ASSERT_PTR( pos, -1 );
+    ASSERT_PTR( entry, -1 );
+
+    for ( i = *pos; i < map->nb_slots; i++ )
+    {
+        if ( map->ctrl[i] < CTRL_EMPTY )
+        {
+            slot = get_slot( map, i );
+            if ( HASH_MAP_KEY_UINT64 == map->key_type )
+            {
+                entry->key_uint64 = slot->key;
+                entry->key_string = NULL;
+            }
+            else
+            {
+                entry->key_uint64 = 0;
+                entry->key_string = slot->string;
+            }
+            entry->value = slot->value;
+            *pos = i + 1;
+            return 0;
+        }
+    }
+
+    *pos = map->nb_slots;
+
+    return -1;
+}
+
+uint64_t hash_uint64( uint64_t key )
+{
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    key *= 0xC4CEB9FE1A85EC53ULL;
+    key ^= key >> 33;
+
+    return key;
+}
+
+hash_map_slot_t * get_slot( const hash_map_t * map, size_t i )
+{
+    return (hash_map_slot_t *)( map->slots + i * map->slot_size );
+}
+
+size_t get_max_load( size_t nb_slots )
+{
+    return nb_slots - nb_slots / 8;
+}
+
+uint32_t match_byte( const uint8_t * ctrl, uint8_t byte )
+{
+#ifdef HAVE_HASH_MAP_SSE2
+    __m128i group = _mm_loadu_si128( (const __m128i *)ctrl );
+
+    return (uint32_t)_mm_movemask_epi8( _mm_cmpeq_epi8( group, _mm_set1_epi8( (char)byte ) ) );
+#else
+    uint32_t    mask = 0;
+    int         i;
+
+    for ( i = 0; i < GROUP_SIZE; i++ )
+    {
+        mask |= (uint32_t)( ctrl[i] == byte ) << i;
+    }
+
+    return mask;
+#endif
+}
+
+uint32_t match_free( const uint8_t * ctrl )
+{
+#ifdef HAVE_HASH_MAP_SSE2
+    /* Empty and deleted control bytes are the only ones with high bit set */
+    return (uint32_t)_mm_movemask_epi8( _mm_loadu_si128( (const __m128i *)ctrl ) );
+#else
+    uint32_t    mask = 0;
+    int         i;
+
+    for ( i = 0; i < GROUP_SIZE; i++ )
+    {
+        mask |= (uint32_t)( ctrl[i] >> 7 ) << i;
+    }
+
+    return mask;
+#endif
+}
+
+void set_ctrl( hash_map_t * map, size_t i, uint8_t ctrl )
+{
+    map->ctrl[i] = ctrl;
+    if ( i < GROUP_SIZE )
+    {
+        map->ctrl[map->nb_slots + i] = ctrl;
+    }
+}
+
+size_t find_slot( const hash_map_t * map,
+                  uint64_t hash,
+                  uint64_t key,
+                  const char * string,
+                  size_t len )
+{
+    size_t              mask = map->nb_slots - 1;
+    size_t              pos = (size_t)( hash >> 7 ) & mask;
+    size_t              step = 0;
+    uint32_t            bits;
+    size_t              i;
+    hash_map_slot_t *   slot;
+
+    while ( 1 )
+    {
+        bits = match_byte( map->ctrl + pos, (uint8_t)( hash & 0x7F ) );
+        while ( bits )
+        {
+            i = ( pos + (size_t)__builtin_ctz( bits ) ) & mask;
+            slot = get_slot( map, i );
+            if ( ( slot->key == key ) &&
+                 ( ( ! string ) ||
+                   ( ( slot->len == len ) &&
+                     ( 0 == memcmp( slot->string, string, len ) ) ) ) )
+            {
+                return i;
+            }
+            bits &= bits - 1;
+        }
+
+        /* An empty slot ends the probe sequence */
+        if ( match_byte( map->ctrl + pos, CTRL_EMPTY ) )
+        {
+            return map->nb_slots;
+        }
+
+        step += GROUP_SIZE;
+        pos = ( pos + step ) & mask;
+    }
+}
+
+size_t find_free_slot( const hash_map_t * map, uint64_t hash )
+{
+    size_t      mask = map->nb_slots - 1;
+    size_t      pos = (size_t)( hash >> 7 ) & mask;
+    size_t      step = 0;
+    uint32_t    bits;
+
+    while ( 1 )
+    {
+        bits = match_free( map->ctrl + pos );
+        if ( bits )
+        {
+            return ( pos + (size_t)__builtin_ctz( bits ) ) & mask;
+        }
+
+        step += GROUP_SIZE;
+        pos = ( pos + step ) & mask;
+    }
+}
+
+int resize( hash_map_t * map, size_t nb_slots )
+{
+    uint8_t *           old_ctrl = map->ctrl;
+    uint8_t *           old_slots = map->slots;
+    size_t              old_nb_slots = map->nb_slots;
+    hash_map_slot_t *   slot;
+    uint64_t            hash;
+    size_t              i;
+    size_t              j;
+
+    map->ctrl = malloc( nb_slots + GROUP_SIZE );
+    map->slots = malloc( nb_slots * map->slot_size );
+    if ( ( ! map->ctrl ) || ( ! map->slots ) )
+    {
+        free( map->ctrl );
+        free( map->slots );
+        map->ctrl = old_ctrl;
+        map->slots = old_slots;
+        return -1;
+    }
+    memset( map->ctrl, CTRL_EMPTY, nb_slots + GROUP_SIZE );
+    map->nb_slots = nb_slots;
+
+    /* Deleted slots are dropped */
+    for ( i = 0; i < old_nb_slots; i++ )
+    {
+        if ( old_ctrl[i] < CTRL_EMPTY )
+        {
+            slot = (hash_map_slot_t *)( old_slots + i * map->slot_size );
+            hash = ( HASH_MAP_KEY_UINT64 == map->key_type ) ?
+                   hash_uint64( slot->key ) : slot->key;
+            j = find_free_slot( map, hash );
+            set_ctrl( map, j, (uint8_t)( hash & 0x7F ) );
+            memcpy( get_slot( map, j ), slot, map->slot_size );
+        }
+    }
+    map->growth_left = get_max_load( nb_slots ) - map->count;
+
+    free( old_ctrl );
+    free( old_slots );
+
+    return 0;
+}
+
+int get_nb_slots( size_t capacity, size_t * nb_slots )
+{
+    size_t n = GROUP_SIZE;
+
+    while ( get_max_load( n ) < capacity )
+    {
+        if ( n > SIZE_MAX / 2 / sizeof( hash_map_slot_t ) )
+        {
+            return -1;
+        }
+        n *= 2;
+    }
+
+    *nb_slots = n;
+
+    return 0;
+}
+
+int insert_slot( hash_map_t * map,
+                 uint64_t hash,
+                 uint64_t key,
+                 char * string,
+                 size_t len,
+                 void * value )
+{
+    hash_map_slot_t *   slot;
+    size_t              nb_slots = map->nb_slots;
+    size_t              i;
+
+    i = find_free_slot( map, hash );
+
+    /* Reusing a deleted slot does not consume an empty one */
+    if ( ( 0 == map->growth_left ) && ( CTRL_DELETED != map->ctrl[i] ) )
+    {
+        /* Grow only if deleted slots are not the cause of full table */
+        if ( map->count >= get_max_load( nb_slots ) / 2 )
+        {
+            if ( nb_slots > SIZE_MAX / 4 / sizeof( hash_map_slot_t ) )
+            {
+                return -1;
+            }
+            nb_slots *= 2;
+        }
+        if ( 0 != resize( map, nb_slots ) )
+        {
+            return -1;
+        }
+        i = find_free_slot( map, hash );
+    }
+
+    if ( CTRL_EMPTY == map->ctrl[i] )
+    {
+        map->growth_left--;
+    }
+    set_ctrl( map, i, (uint8_t)( hash & 0x7F ) );
+    slot = get_slot( map, i );
+    slot->key = key;
+    slot->value = value;
+    if ( string )
+    {
+        slot->string = string;
+        slot->len = len;
+    }
+    map->count++;
+
+    return 0;
+}
+
+void remove_slot( hash_map_t * map, size_t i )
+{
+    set_ctrl( map, i, CTRL_DELETED );
+    map->count--;
+}
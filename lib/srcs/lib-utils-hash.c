@@ -0,0 +1,320 @@
+/*!
+ * @file: lib-utils-hash.c
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of fast non-cryptographic hash functions.
+ *
+ * wyhash: buffers are read by 48 bytes blocks on three independent lanes (the
+ * 64x64 -> 128 bits multiplications of the lanes run in parallel), short
+ * buffers are read with overlapping loads without loop.
+ */
+#include <string.h>
+
+#include "lib-utils-assert.h"
+#include "lib-utils-hash.h"
+
+/*!
+ * @brief Secret of wyhash (default parameters).
+ */
+static const uint64_t g_secret[4] =
+{
+    0x2D358DCCAA6C78A5ULL, 0x8BB84B93962EACC9ULL,
+    0x4B33A62ED433D4A3ULL, 0x4D5A2DA51DE1AA47ULL
+};
+
+/*!
+ * @brief Multiply two 64 bits integers.
+ * @param a     First operand, low 64 bits of product on return.
+ * @param b     Second operand, high 64 bits of product on return.
+ * @return None.
+ */
+static inline void multiply( uint64_t * a, uint64_t * b );
+
+/*!
+ * @brief Mix two 64 bits integers (xor of product halves).
+ * @param a     First integer.
+ * @param b     Second integer.
+ * @return The mixed value.
+ */
+static inline uint64_t mix( uint64_t a, uint64_t b );
+
+/*!
+ * @brief Read 8 bytes as little endian integer.
+ * @param p     Bytes (no alignment required).
+ * @return The integer.
+ */
+static inline uint64_t read64( const uint8_t * p );
+
+/*!
+ * @brief Read 4 bytes as little endian integer.
+ * @param p     Bytes (no alignment required).
+ * @return The integer.
+ */
+static inline uint64_t read32( const uint8_t * p );
+
+/*!
+ * @brief Process a block of HASH_BLOCK_SIZE bytes.
+ * @param lanes Lanes of hash.
+ * @param p     Block.
+ * @return None.
+ */
+static inline void process_block( uint64_t lanes[3], const uint8_t * p );
+
+/*!
+ * @brief Hash buffer of at most 16 bytes.
+ * @param p     Buffer.
+ * @param len   Length of buffer.
+ * @param seed  Mixed seed.
+ * @return The hash.
+ */
+static inline uint64_t hash_short( const uint8_t * p, size_t len, uint64_t seed );
+
+/*!
+ * @brief Hash last bytes of buffer longer than 16 bytes.
+ * @param p     Last bytes (preceded by at least 16 bytes if len > 48).
+ * @param nb    Number of last bytes (1 to HASH_BLOCK_SIZE).
+ * @param len   Length of whole buffer.
+ * @param seed  Seed after blocks.
+ * @return The hash.
+ */
+static inline uint64_t hash_tail( const uint8_t * p,
+                                  size_t nb,
+                                  uint64_t len,
+                                  uint64_t seed );
+
+/*!
+ * @brief Mix seed as first step of hash.
+ * @param seed  Seed.
+ * @return The mixed seed.
+ */
+static inline uint64_t mix_seed( uint64_t seed );
+
+uint64_t hash_buffer( const void * buf, size_t len )
+{
+    return hash_buffer_seed( buf, len, HASH_DEFAULT_SEED );
+}
+
+uint64_t hash_buffer_seed( const void * buf, size_t len, uint64_t seed )
+{
+    const uint8_t * p = buf;
+    uint64_t        lanes[3];
+    size_t          nb = len;
+
+    ASSERT_PTR( buf, 0 );
+
+    seed = mix_seed( seed );
+
+    if ( len <= 16 )
+    {
+        return hash_short( p, len, seed );
+    }
+
+    if ( nb > HASH_BLOCK_SIZE )
+    {
+        lanes[0] = seed;
+        lanes[1] = seed;
+        lanes[2] = seed;
+        do
+        {
+            process_block( lanes, p );
+            p += HASH_BLOCK_SIZE;
+            nb -= HASH_BLOCK_SIZE;
+        } while ( nb > HASH_BLOCK_SIZE );
+        seed = lanes[0] ^ lanes[1] ^ lanes[2];
+    }
+
+    return hash_tail( p, nb, len, seed );
+}
+
+uint64_t hash_string( const char * str )
+{
+    return hash_string_seed( str, HASH_DEFAULT_SEED );
+}
+
+uint64_t hash_string_seed( const char * str, uint64_t seed )
+{
+    ASSERT_PTR( str, 0 );
+
+    return hash_buffer_seed( str, strlen( str ), seed );
+}
+
+void hash_state_init( hash_state_t * state, uint64_t seed )
+{
+    ASSERT_PTR( state, );
+
+    state->seed[0] = mix_seed( seed );
+    state->seed[1] = state->seed[0];
+    state->seed[2] = state->seed[0];
+    state->length = 0;
+    state->pending = 0;
+}
+
+int hash_state_update( hash_state_t * state, const void * buf, size_t len )
+{
+    const uint8_t * p = buf;
+    uint8_t *       pending;
+    size_t          nb;
+
+    ASSERT_PTR( state, -1 );
+
+    if ( 0 == len )
+    {
+        return 0;
+    }
+
+    ASSERT_PTR( buf, -1 );
+
+    state->length += len;
+    pending = state->buffer + 16;
+
+    /* A block is processed only when more bytes follow (as hash_buffer) */
+    if ( state->pending + len <= HASH_BLOCK_SIZE )
+    {
+        memcpy( pending + state->pending, p, len );
+        state->pending += len;
+        return 0;
+    }
+
+    if ( state->pending > 0 )
+    {
+        nb = HASH_BLOCK_SIZE - state->pending;
+        memcpy( pending + state->pending, p, nb );
+        p += nb;
+        len -= nb;
+        process_block( state->seed, pending );
+        memcpy( state->buffer, pending + HASH_BLOCK_SIZE - 16, 16 );
+    }
+
+    if ( len > HASH_BLOCK_SIZE )
+    {
+        do
+        {
+            process_block( state->seed, p );
+            p += HASH_BLOCK_SIZE;
+            len -= HASH_BLOCK_SIZE;
+        } while ( len > HASH_BLOCK_SIZE );
+        memcpy( state->buffer, p - 16, 16 );
+    }
+
+    /* Last bytes of hash_buffer may overlap end of previous block */
+    memcpy( pending, p, len );
+    state->pending = len;
+
+    return 0;
+}
+
+uint64_t hash_state_final( const hash_state_t * state )
+{
+    uint64_t seed;
+
+    ASSERT_PTR( state, 0 );
+
+    seed = state->seed[0];
+
+    if ( state->length <= 16 )
+    {
+        return hash_short( state->buffer + 16, state->length, seed );
+    }
+
+    if ( state->length > HASH_BLOCK_SIZE )
+    {
+        seed ^= state->seed[1] ^ state->seed[2];
+    }
+
+    return hash_tail( state->buffer + 16, state->pending, state->length, seed );
+}
+
+void multiply( uint64_t * a, uint64_t * b )
+{
+    unsigned __int128 r = (unsigned __int128)*a * *b;
+
+    *a = (uint64_t)r;
+    *b = (uint64_t)( r >> 64 );
+}
+
+uint64_t mix( uint64_t a, uint64_t b )
+{
+    multiply( &a, &b );
+
+    return a ^ b;
+}
+
+uint64_t read64( const uint8_t * p )
+{
+    uint64_t v;
+
+    memcpy( &v, p, sizeof( v ) );
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64( v );
+#endif
+
+    return v;
+}
+
+uint64_t read32( const uint8_t * p )
+{
+    uint32_t v;
+
+    memcpy( &v, p, sizeof( v ) );
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap32( v );
+#endif
+
+    return v;
+}
+
+void process_block( uint64_t lanes[3], const uint8_t * p )
+{
+    lanes[0] = mix( read64( p ) ^ g_secret[1], read64( p + 8 ) ^ lanes[0] );
+    lanes[1] = mix( read64( p + 16 ) ^ g_secret[2], read64( p + 24 ) ^ lanes[1] );
+    lanes[2] = mix( read64( p + 32 ) ^ g_secret[3], read64( p + 40 ) ^ lanes[2] );
+}
+
+uint64_t hash_short( const uint8_t * p, size_t len, uint64_t seed )
+{
+    uint64_t    a = 0;
+    uint64_t    b = 0;
+    size_t      shift;
+
+    if ( len >= 4 )
+    {
+        /* Two overlapping reads of 4 bytes from each end */
+        shift = ( len >> 3 ) << 2;
+        a = ( read32( p ) << 32 ) | read32( p + shift );
+        b = ( read32( p + len - 4 ) << 32 ) | read32( p + len - 4 - shift );
+    }
+    else if ( len > 0 )
+    {
+        a = ( (uint64_t)p[0] << 16 ) | ( (uint64_t)p[len >> 1] << 8 ) | p[len - 1];
+    }
+
+    a ^= g_secret[1];
+    b ^= seed;
+    multiply( &a, &b );
+
+    return mix( a ^ g_secret[0] ^ len, b ^ g_secret[1] );
+}
+
+uint64_t hash_tail( const uint8_t * p, size_t nb, uint64_t len, uint64_t seed )
+{
+    uint64_t a;
+    uint64_t b;
+
+    while ( nb > 16 )
+    {
+        seed = mix( read64( p ) ^ g_secret[1], read64( p + 8 ) ^ seed );
+        p += 16;
+        nb -= 16;
+    }
+
+    a = read64( p + nb - 16 ) ^ g_secret[1];
+    b = read64( p + nb - 8 ) ^ seed;
+    multiply( &a, &b );
+
+    return mix( a ^ g_secret[0] ^ len, b ^ g_secret[1] );
+}
+
+uint64_t mix_seed( uint64_t seed )
+{
+    return seed ^ mix( seed ^ g_secret[0], g_secret[1] );
+}
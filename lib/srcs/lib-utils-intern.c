@@ -0,0 +1,326 @@
+/*!
+ * @file: lib-utils-intern.c
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of string interning table.
+ */
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lib-utils-arena.h"
+#include "lib-utils-assert.h"
+#include "lib-utils-hash.h"
+#include "lib-utils-intern.h"
+
+/*!
+ * @struct intern_entry_t
+ * @brief Slot of intern table (empty when str is NULL, str is written last).
+ */
+typedef struct intern_entry_t
+{
+    const char *    str;        /*!< Interned string. */
+    size_t          len;        /*!< Length of string. */
+    uint64_t        hash;       /*!< Hash of string. */
+} intern_entry_t;
+
+/*!
+ * @struct intern_slots_t
+ * @brief Slots of intern table (replaced when table grows, previous slots are
+ *        kept until table is destroyed for readers still using them).
+ */
+typedef struct intern_slots_t
+{
+    struct intern_slots_t * previous;   /*!< Previous (smaller) slots. */
+    size_t                  nb_slots;   /*!< Number of slots (power of 2). */
+    intern_entry_t          entries[];  /*!< Slots (open addressing). */
+} intern_slots_t;
+
+struct intern_table_t
+{
+    pthread_mutex_t     mutex;      /*!< Serialize insertions. */
+    intern_slots_t *    slots;      /*!< Current slots (atomic). */
+    size_t              count;      /*!< Number of interned strings. */
+    arena_t *           arena;      /*!< Storage of interned strings. */
+};
+
+/*!
+ * @brief Allocate empty slots.
+ * @param nb_slots  Number of slots (power of 2).
+ * @return The slots on success otherwise NULL.
+ */
+static intern_slots_t * create_slots( size_t nb_slots );
+
+/*!
+ * @brief Find slot of string or empty slot where to insert it (linear
+ *        probing, no lock needed).
+ * @param slots     Slots of table.
+ * @param str       String.
+ * @param len       Length of string.
+ * @param hash      Hash of string.
+ * @return The slot.
+ */
+static intern_entry_t * find_slot( intern_slots_t * slots,
+                                   const char * str,
+                                   size_t len,
+                                   uint64_t hash );
+
+/*!
+ * @brief Replace slots of table by slots twice larger.
+ * @param table     Intern table (mutex locked).
+ * @return 0 on success otherwise -1.
+ */
+static int grow_table( intern_table_t * table );
+
+intern_table_t * intern_table_create( size_t capacity )
+{
+    intern_table_t *    table;
+    size_t              nb_slots = INTERN_TABLE_DEFAULT_CAPACITY;
+
+    if ( capacity > SIZE_MAX / 4 / sizeof( intern_entry_t ) )
+    {
+        return NULL;
+    }
+
+    /* Keep table at most half full */
+    while ( nb_slots < capacity * 2 )
+    {
+        nb_slots *= 2;
+    }
+
+    table = calloc( 1, sizeof( *table ) );
+    if ( ! table )
+    {
+        return NULL;
+    }
+
+    table->slots = create_slots( nb_slots );
+    table->arena = arena_create( 0 );
+    if ( ( ! table->slots ) || ( ! table->arena ) ||
+         ( 0 != pthread_mutex_init( &table->mutex, NULL ) ) )
+    {
+        arena_destroy( table->arena );
+        free( table->slots );
+        free( table );
+        return NULL;
+    }
+
+    return table;
+}
+
+void intern_table_destroy( intern_table_t * table )
+{
+    intern_slots_t * slots;
+    intern_slots_t * previous;
+
+    if ( ! table )
+    {
+        return;
+    }
+
+    for ( slots = table->slots; slots; slots = previous )
+    {
+        previous = slots->previous;
+        free( slots );
+    }
+
+    pthread_mutex_destroy( &table->mutex );
+    arena_destroy( table->arena );
+    free( table );
+}
+
+const char * intern_string( intern_table_t * table, const char * str )
+{
+    ASSERT_PTR( str, NULL );
+
+    return intern_string_n( table, str, strlen( str ) );
+}
+
+const char * intern_string_n( intern_table_t * table,
+                              const char * str,
+                              size_t len )
+{
+    intern_entry_t *    entry;
+    const char *        ret;
+    uint64_t            hash;
+    char *              copy;
+
+    ASSERT_PTR( table, NULL );
+    ASSERT_PTR( str, NULL );
+
+    hash = hash_buffer( str, len );
+
+    /* Already interned: no lock */
+    entry = find_slot( __atomic_load_n( &table->slots, __ATOMIC_ACQUIRE ),
+                       str, len, hash );
+    ret = __atomic_load_n( &entry->str, __ATOMIC_ACQUIRE );
+    if ( ret )
+    {
+        return ret;
+    }
+
+    pthread_mutex_lock( &table->mutex );
+
+    /* Another thread may have interned it meanwhile */
+    entry = find_slot( table->slots, str, len, hash );
+    if ( ! entry->str )
+    {
+        if ( ( table->count + 1 ) * 2 > table->slots->nb_slots )
+        {
+            if ( 0 != grow_table( table ) )
+            {
+                pthread_mutex_unlock( &table->mutex );
+                return NULL;
+            }
+            entry = find_slot( table->slots, str, len, hash );
+        }
+
+        copy = arena_alloc_aligned( table->arena, len + 1, 1 );
+        if ( ! copy )
+        {
+            pthread_mutex_unlock( &table->mutex );
+            return NULL;
+        }
+        memcpy( copy, str, len );
+        copy[len] = '\0';
+
+        /* Publish string after its length and hash */
+        entry->len = len;
+        entry->hash = hash;
+        __atomic_store_n( &entry->str, copy, __ATOMIC_RELEASE );
+        table->count++;
+    }
+    ret = entry->str;
+
+    pthread_mutex_unlock( &table->mutex );
+
+    return ret;
+}
+
+const char * intern_lookup( intern_table_t * table, const char * str )
+{
+    intern_entry_t *    entry;
+    size_t              len;
+
+    ASSERT_PTR( table, NULL );
+    ASSERT_PTR( str, NULL );
+
+    len = strlen( str );
+    entry = find_slot( __atomic_load_n( &table->slots, __ATOMIC_ACQUIRE ),
+                       str, len, hash_buffer( str, len ) );
+
+    return __atomic_load_n( &entry->str, __ATOMIC_ACQUIRE );
+}
+
+size_t intern_table_get_count( intern_table_t * table )
+{
+    size_t count;
+
+    if ( ! table )
+    {
+        return 0;
+    }
+
+    pthread_mutex_lock( &table->mutex );
+    count = table->count;
+    pthread_mutex_unlock( &table->mutex );
+
+    return count;
+}
+
+size_t intern_table_get_memory( intern_table_t * table )
+{
+    intern_slots_t *    slots;
+    size_t              memory;
+
+    if ( ! table )
+    {
+        return 0;
+    }
+
+    pthread_mutex_lock( &table->mutex );
+    memory = sizeof( *table ) + arena_get_capacity( table->arena );
+    for ( slots = table->slots; slots; slots = slots->previous )
+    {
+        memory += sizeof( *slots ) + slots->nb_slots * sizeof( *slots->entries );
+    }
+    pthread_mutex_unlock( &table->mutex );
+
+    return memory;
+}
+
+intern_slots_t * create_slots( size_t nb_slots )
+{
+    intern_slots_t * slots;
+
+    slots = calloc( 1, sizeof( *slots ) + nb_slots * sizeof( *slots->entries ) );
+    if ( slots )
+    {
+        slots->nb_slots = nb_slots;
+    }
+
+    return slots;
+}
+
+intern_entry_t * find_slot( intern_slots_t * slots,
+                            const char * str,
+                            size_t len,
+                            uint64_t hash )
+{
+    size_t              mask = slots->nb_slots - 1;
+    size_t              i = (size_t)hash & mask;
+    intern_entry_t *    entry;
+    const char *        entry_str;
+
+    /* Slots are never full: an empty slot ends the search */
+    while ( 1 )
+    {
+        entry = &slots->entries[i];
+        entry_str = __atomic_load_n( &entry->str, __ATOMIC_ACQUIRE );
+        if ( ( ! entry_str ) ||
+             ( ( entry->hash == hash ) && ( entry->len == len ) &&
+               ( 0 == memcmp( entry_str, str, len ) ) ) )
+        {
+            return entry;
+        }
+        i = ( i + 1 ) & mask;
+    }
+}
+
+int grow_table( intern_table_t * table )
+{
+    intern_slots_t *    old_slots = table->slots;
+    intern_slots_t *    slots;
+    intern_entry_t *    entry;
+    size_t              mask;
+    size_t              i;
+    size_t              j;
+
+    slots = create_slots( old_slots->nb_slots * 2 );
+    if ( ! slots )
+    {
+        return -1;
+    }
+
+    mask = slots->nb_slots - 1;
+    for ( i = 0; i < old_slots->nb_slots; i++ )
+    {
+        entry = &old_slots->entries[i];
+        if ( entry->str )
+        {
+            j = (size_t)entry->hash & mask;
+            while ( slots->entries[j].str )
+            {
+                j = ( j + 1 ) & mask;
+            }
+            slots->entries[j] = *entry;
+        }
+    }
+
+    /* Readers may still use previous slots: free them with the table */
+    slots->previous = old_slots;
+    __atomic_store_n( &table->slots, slots, __ATOMIC_RELEASE );
+
+    return 0;
+}
@@ -0,0 +1,234 @@
+/*!
+ * @file: lib-utils-owned-string.c
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of owned string with small string optimization.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "lib-utils-assert.h"
+#include "lib-utils-owned-string.h"
+
+/*!
+ * @brief Allocate a buffer for a spilled string.
+ * @param str   String (gives allocator).
+ * @param size  Size of buffer in bytes.
+ * @return The buffer on success otherwise NULL.
+ */
+static inline char * lu_string_alloc( const lu_string_t * str, size_t size );
+
+/*!
+ * @brief Release spilled buffer of string (string must be updated after).
+ * @param str   String.
+ * @return None.
+ */
+static inline void lu_string_release( lu_string_t * str );
+
+/*!
+ * @brief Store a spilled buffer in string (previous buffer is released).
+ * @param str       String.
+ * @param data      Buffer (NUL terminated).
+ * @param len       Length of string in buffer.
+ * @param capacity  Size of buffer in bytes.
+ * @return None.
+ */
+static inline void lu_string_set_large( lu_string_t * str,
+                                        char * data,
+                                        size_t len,
+                                        size_t capacity );
+
+int lu_string_init( lu_string_t * str, arena_t * arena )
+{
+    ASSERT_PTR( str, -1 );
+
+    str->u.small[0] = '\0';
+    str->len = 0;
+    str->arena = arena;
+
+    return 0;
+}
+
+void lu_string_free( lu_string_t * str )
+{
+    if ( str )
+    {
+        lu_string_release( str );
+        str->u.small[0] = '\0';
+        str->len = 0;
+    }
+}
+
+int lu_string_assign( lu_string_t * str, lu_strview_t view )
+{
+    char    tmp[LU_STRING_SMALL_CAPACITY + 1];
+    char *  data;
+
+    ASSERT_PTR( str, -1 );
+    if ( ( ! view.ptr ) && ( view.len > 0 ) )
+    {
+        return -1;
+    }
+
+    if ( view.len <= LU_STRING_SMALL_CAPACITY )
+    {
+        /* View can be a part of spilled buffer released below */
+        if ( view.len > 0 )
+        {
+            memcpy( tmp, view.ptr, view.len );
+        }
+        lu_string_release( str );
+        memcpy( str->u.small, tmp, view.len );
+        str->u.small[view.len] = '\0';
+        str->len = view.len;
+    }
+    else if ( ( ! lu_string_is_small( str ) ) && ( view.len < str->u.large.capacity ) )
+    {
+        /* Spilled buffer is reused */
+        memmove( str->u.large.data, view.ptr, view.len );
+        str->u.large.data[view.len] = '\0';
+        str->len = view.len;
+    }
+    else
+    {
+        if ( view.len + 1 == 0 )
+        {
+            return -1;
+        }
+        data = lu_string_alloc( str, view.len + 1 );
+        if ( ! data )
+        {
+            return -1;
+        }
+        memcpy( data, view.ptr, view.len );
+        data[view.len] = '\0';
+        lu_string_set_large( str, data, view.len, view.len + 1 );
+    }
+
+    return 0;
+}
+
+int lu_string_copy( lu_string_t * dst, const lu_string_t * src )
+{
+    ASSERT_PTR( dst, -1 );
+    ASSERT_PTR( src, -1 );
+
+    if ( dst == src )
+    {
+        return 0;
+    }
+
+    return lu_string_assign( dst, lu_string_view( src ) );
+}
+
+int lu_string_move( lu_string_t * dst, lu_string_t * src )
+{
+    ASSERT_PTR( dst, -1 );
+    ASSERT_PTR( src, -1 );
+
+    if ( dst != src )
+    {
+        lu_string_release( dst );
+        *dst = *src;
+        src->u.small[0] = '\0';
+        src->len = 0;
+    }
+
+    return 0;
+}
+
+int lu_string_concat( lu_string_t * str, lu_strview_t view )
+{
+    size_t  len;
+    size_t  capacity;
+    char *  data;
+
+    ASSERT_PTR( str, -1 );
+    if ( ( ! view.ptr ) && ( view.len > 0 ) )
+    {
+        return -1;
+    }
+    if ( 0 == view.len )
+    {
+        /* Nothing to copy (view.ptr can be NULL) */
+        return 0;
+    }
+
+    len = str->len + view.len;
+    if ( ( len < str->len ) || ( len + 1 == 0 ) )
+    {
+        return -1;
+    }
+
+    if ( len <= LU_STRING_SMALL_CAPACITY )
+    {
+        /* memmove: view can be a part of string itself */
+        memmove( str->u.small + str->len, view.ptr, view.len );
+        str->u.small[len] = '\0';
+    }
+    else if ( ( ! lu_string_is_small( str ) ) && ( len < str->u.large.capacity ) )
+    {
+        memmove( str->u.large.data + str->len, view.ptr, view.len );
+        str->u.large.data[len] = '\0';
+    }
+    else
+    {
+        /* Geometric growth: appends are amortized constant time */
+        capacity = lu_string_is_small( str ) ? 2 * ( LU_STRING_SMALL_CAPACITY + 1 ) :
+                                               2 * str->u.large.capacity;
+        if ( capacity <= len )
+        {
+            capacity = len + 1;
+        }
+
+        data = lu_string_alloc( str, capacity );
+        if ( ! data )
+        {
+            return -1;
+        }
+        /* Old buffer is released after copy: view can be a part of it */
+        memcpy( data, lu_string_cstr( str ), str->len );
+        memcpy( data + str->len, view.ptr, view.len );
+        data[len] = '\0';
+        lu_string_set_large( str, data, len, capacity );
+        return 0;
+    }
+    str->len = len;
+
+    return 0;
+}
+
+int lu_string_compare( const lu_string_t * str1, const lu_string_t * str2 )
+{
+    return lu_strview_compare( lu_string_view( str1 ), lu_string_view( str2 ) );
+}
+
+char * lu_string_alloc( const lu_string_t * str, size_t size )
+{
+    if ( str->arena )
+    {
+        return arena_alloc_aligned( str->arena, size, 1 );
+    }
+
+    return malloc( size );
+}
+
+void lu_string_release( lu_string_t * str )
+{
+    /* Arena buffers are released with arena */
+    if ( ( ! lu_string_is_small( str ) ) && ( ! str->arena ) )
+    {
+        free( str->u.large.data );
+    }
+}
+
+void lu_string_set_large( lu_string_t * str,
+                          char * data,
+                          size_t len,
+                          size_t capacity )
+{
+    lu_string_release( str );
+    str->u.large.data = data;
+    str->u.large.capacity = capacity;
+    str->len = len;
+}
@@ -0,0 +1,870 @@
+/*!
+ * @file: lib-utils-params.c
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of command line parameters parser driven by
+ *         parameters descriptions.
+ */
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <sys/mman.h>
+
+/*!
+ * @brief mmap is available for this target.
+ */
+#define HAVE_PARAMS_FILE_MMAP 1
+#endif
+
+#include "lib-utils-assert.h"
+#include "lib-utils-params.h"
+#include "lib-utils-parse-number.h"
+#include "lib-utils-strview.h"
+
+#ifndef O_BINARY
+/*!
+ * @brief No line ending translation (only defined on Windows).
+ */
+#define O_BINARY 0
+#endif
+
+/*!
+ * @brief Parse one token of a command line.
+ * @param index     Index of parameters descriptions.
+ * @param token     Token.
+ * @param next      Next token (value of option, can be NULL).
+ * @param used_next Set to true if next token is the value of option.
+ * @param end       Set to true if token ends options ("--").
+ * @param from_file True if token is read from a file.
+ * @param params    Parameters struct.
+ * @return 0 on success otherwise -1.
+ */
+static int parse_token( const params_index_t * index,
+                        const char * token,
+                        const char * next,
+                        bool * used_next,
+                        bool * end,
+                        bool from_file,
+                        void * params );
+
+/*!
+ * @brief Parse a long option token (without leading "--").
+ * @param index     Index of parameters descriptions.
+ * @param name      Long option (name or name=value).
+ * @param next      Next token (value of option, can be NULL).
+ * @param used_next Set to true if next token is the value of option.
+ * @param from_file True if token is read from a file.
+ * @param params    Parameters struct.
+ * @return 0 on success otherwise -1.
+ */
+static int parse_long_option( const params_index_t * index,
+                              const char * name,
+                              const char * next,
+                              bool * used_next,
+                              bool from_file,
+                              void * params );
+
+/*!
+ * @brief Parse a short options token (without leading "-").
+ * @param index     Index of parameters descriptions.
+ * @param names     Short options (grouped flags, last one can take a value).
+ * @param next      Next token (value of option, can be NULL).
+ * @param used_next Set to true if next token is the value of option.
+ * @param from_file True if token is read from a file.
+ * @param params    Parameters struct.
+ * @return 0 on success otherwise -1.
+ */
+static int parse_short_options( const params_index_t * index,
+                                const char * names,
+                                const char * next,
+                                bool * used_next,
+                                bool from_file,
+                                void * params );
+
+/*!
+ * @brief Store value of an option (rejected if option is read from a file
+ *        and accepted only on command line).
+ * @param index     Index of parameters descriptions.
+ * @param desc      Parameter description (from index).
+ * @param value     Value of option (NULL for flags).
+ * @param from_file True if option is read from a file.
+ * @param params    Parameters struct.
+ * @return 0 on success otherwise -1.
+ */
+static inline int set_option_value( const params_index_t * index,
+                                    const parameter_description_t * desc,
+                                    const char * value,
+                                    bool from_file,
+                                    void * params );
+
+/*!
+ * @brief Parse value of a flag.
+ * @param value     Value (NULL for true).
+ * @param flag      Parsed value.
+ * @return 0 on success otherwise -1.
+ */
+static int parse_flag( const char * value, bool * flag );
+
+/*!
+ * @brief Parse value of an array parameter in one pass.
+ * @param type      Type of array parameter.
+ * @param value     Elements separated by PARAM_ARRAY_DELIMITER.
+ * @param array     Array to fill (count is index of invalid element on
+ *                  error).
+ * @return 0 on success otherwise -1.
+ */
+static int parse_array( int8_t type, const char * value, param_array_t * array );
+
+/*!
+ * @brief Read whole file in an allocated buffer.
+ * @param file  File to fill.
+ * @param fd    Opened file.
+ * @param size  Size of file.
+ * @return 0 on success otherwise -1.
+ */
+static int read_file( params_file_t * file, int fd, size_t size );
+
+/*!
+ * @brief Extract next token of a response file and NUL terminate it in place
+ *        (quotes and escapes are removed).
+ * @param file  Loaded file.
+ * @param pos   Position in file (updated).
+ * @param token Extracted token.
+ * @return 1 if a token is extracted, 0 at end of file otherwise -1
+ *         (unterminated quote).
+ */
+static int next_response_token( params_file_t * file, size_t * pos, char ** token );
+
+/*!
+ * @brief NUL terminate a view of file in place.
+ * @param file  Loaded file.
+ * @param view  View on data of file (followed by at least one byte).
+ * @return The NUL terminated string.
+ */
+static inline char * terminate_view( params_file_t * file, lu_strview_t view );
+
+int params_index_init( params_index_t * index,
+                       const parameter_description_t * descriptions )
+{
+    size_t      nb_descriptions;
+    uint8_t     shortname;
+
+    ASSERT_PTR( index, -1 );
+    ASSERT_PTR( descriptions, -1 );
+
+    index->descriptions = descriptions;
+    index->by_longname = NULL;
+    index->command_line_only = NULL;
+    memset( index->by_shortname, 0, sizeof( index->by_shortname ) );
+
+    for ( nb_descriptions = 0;
+          SENTINEL_TYPE != descriptions[nb_descriptions].type;
+          nb_descriptions++ )
+    {
+        shortname = (uint8_t)descriptions[nb_descriptions].arg_shortname;
+        if ( 0 == shortname )
+        {
+            continue;
+        }
+        if ( ( 0 != index->by_shortname[shortname] ) ||
+             ( nb_descriptions >= UINT16_MAX ) )
+        {
+            return -1;
+        }
+        index->by_shortname[shortname] = (uint16_t)( nb_descriptions + 1 );
+    }
+
+    index->nb_descriptions = nb_descriptions;
+    index->by_longname = perfect_hash_create( &descriptions[0].arg_longname,
+                                              nb_descriptions,
+                                              sizeof( descriptions[0] ) );
+
+    return index->by_longname ? 0 : -1;
+}
+
+int params_index_set_command_line_only( params_index_t * index,
+                                        const parameter_description_t * desc )
+{
+    ASSERT_PTR( index, -1 );
+    ASSERT_PTR( desc, -1 );
+    if ( ( desc < index->descriptions ) ||
+         ( desc >= index->descriptions + index->nb_descriptions ) )
+    {
+        return -1;
+    }
+
+    /* Allocated on first use: most indexes have no such parameter */
+    if ( ! index->command_line_only )
+    {
+        index->command_line_only = calloc( index->nb_descriptions, sizeof( bool ) );
+        if ( ! index->command_line_only )
+        {
+            return -1;
+        }
+    }
+    index->command_line_only[desc - index->descriptions] = true;
+
+    return 0;
+}
+
+void params_index_release( params_index_t * index )
+{
+    if ( index )
+    {
+        perfect_hash_destroy( index->by_longname );
+        index->by_longname = NULL;
+        free( index->command_line_only );
+        index->command_line_only = NULL;
+    }
+}
+
+const parameter_description_t * params_index_find_shortname(
+                                        const params_index_t * index,
+                                        char shortname )
+{
+    uint16_t i;
+
+    ASSERT_PTR( index, NULL );
+
+    i = index->by_shortname[(uint8_t)shortname];
+
+    return ( ( i > 0 ) && ( 0 != shortname ) ) ? &index->descriptions[i - 1] : NULL;
+}
+
+const parameter_description_t * params_index_find_longname(
+                                        const params_index_t * index,
+                                        const char * longname,
+                                        size_t len )
+{
+    size_t i;
+
+    ASSERT_PTR( index, NULL );
+    ASSERT_PTR( longname, NULL );
+
+    i = perfect_hash_lookup_n( index->by_longname, longname, len );
+
+    return ( PERFECT_HASH_NOT_FOUND != i ) ? &index->descriptions[i] : NULL;
+}
+
+int set_param_value( const parameter_description_t * desc,
+                     const char * value,
+                     void * params )
+{
+    int         ret = 0;
+    uint8_t *   ptr8;
+
+    ASSERT_PTR( desc, -1 );
+    ASSERT_PTR( params, -1 );
+
+    if ( ( BOOL_TYPE != desc->type ) && ( ! value ) )
+    {
+        return -1;
+    }
+
+    ptr8 = &( (uint8_t *)params )[desc->offset];
+    switch ( desc->type )
+    {
+        case U8_TYPE:
+            ret = parse_uint8( value, ptr8 );
+            break;
+        case I8_TYPE:
+            ret = parse_int8( value, (int8_t *)ptr8 );
+            break;
+        case HEX8_TYPE:
+            ret = parse_hex8( value, ptr8 );
+            break;
+        case U16_TYPE:
+            ret = parse_uint16( value, (uint16_t *)ptr8 );
+            break;
+        case I16_TYPE:
+            ret = parse_int16( value, (int16_t *)ptr8 );
+            break;
+        case HEX16_TYPE:
+            ret = parse_hex16( value, (uint16_t *)ptr8 );
+            break;
+        case U32_TYPE:
+            ret = parse_uint32( value, (uint32_t *)ptr8 );
+            break;
+        case I32_TYPE:
+            ret = parse_int32( value, (int32_t *)ptr8 );
+            break;
+        case HEX32_TYPE:
+            ret = parse_hex32( value, (uint32_t *)ptr8 );
+            break;
+        case U64_TYPE:
+            ret = parse_uint64( value, (uint64_t *)ptr8 );
+            break;
+        case I64_TYPE:
+            ret = parse_int64( value, (int64_t *)ptr8 );
+            break;
+        case HEX64_TYPE:
+            ret = parse_hex64( value, (uint64_t *)ptr8 );
+            break;
+        case DFLOAT_TYPE:
+            ret = parse_double( value, (double *)ptr8 );
+            break;
+        case STR_TYPE:
+            /* Value points into tokens (no copy) */
+            *( (const char **)ptr8 ) = value;
+            break;
+        case BOOL_TYPE:
+            ret = parse_flag( value, (bool *)ptr8 );
+            break;
+        case CHAR_TYPE:
+            *ptr8 = (uint8_t)value[0];
+            break;
+        case U8_ARRAY_TYPE:
+        case I8_ARRAY_TYPE:
+        case HEX8_ARRAY_TYPE:
+        case U16_ARRAY_TYPE:
+        case I16_ARRAY_TYPE:
+        case HEX16_ARRAY_TYPE:
+        case U32_ARRAY_TYPE:
+        case I32_ARRAY_TYPE:
+        case HEX32_ARRAY_TYPE:
+        case U64_ARRAY_TYPE:
+        case I64_ARRAY_TYPE:
+        case HEX64_ARRAY_TYPE:
+        case DFLOAT_ARRAY_TYPE:
+            ret = ( sizeof( param_array_t ) == desc->size ) ?
+                  parse_array( desc->type, value, (param_array_t *)ptr8 ) : -1;
+            break;
+        default:
+            ret = -1;
+            break;
+    }
+
+    return ret;
+}
+
+int parse_params_tokens( const params_index_t * index,
+                         size_t nb_tokens,
+                         const char * const * tokens,
+                         void * params )
+{
+    const char *    token;
+    const char *    next;
+    bool            used_next;
+    bool            end;
+    size_t          i;
+    int             ret = 0;
+
+    ASSERT_PTR( index, -1 );
+    ASSERT_PTR( params, -1 );
+    if ( ( ! tokens ) && ( nb_tokens > 0 ) )
+    {
+        return -1;
+    }
+
+    for ( i = 0; ( i < nb_tokens ) && ( 0 == ret ); i++ )
+    {
+        token = tokens[i];
+        if ( ! token )
+        {
+            return -1;
+        }
+
+        next = ( i + 1 < nb_tokens ) ? tokens[i + 1] : NULL;
+        ret = parse_token( index, token, next, &used_next, &end, false, params );
+        if ( end )
+        {
+            break;
+        }
+        i += used_next;
+    }
+
+    return ret;
+}
+
+int params_file_open( params_file_t * file, const char * path )
+{
+    struct stat st;
+    int         fd;
+    int         ret = -1;
+
+    ASSERT_PTR( file, -1 );
+    ASSERT_PTR( path, -1 );
+
+    file->data = NULL;
+    file->size = 0;
+    file->map_size = 0;
+
+    fd = open( path, O_RDONLY | O_BINARY );
+    if ( fd < 0 )
+    {
+        return -1;
+    }
+
+    if ( ( 0 == fstat( fd, &st ) ) && S_ISREG( st.st_mode ) &&
+         ( (uint64_t)st.st_size < SIZE_MAX ) )
+    {
+        file->size = (size_t)st.st_size;
+#ifdef HAVE_PARAMS_FILE_MMAP
+        /* Anonymous mapping one byte larger than file: NUL byte after the
+           file even when its size is a multiple of page size */
+        file->map_size = file->size + 1;
+        file->data = mmap( NULL, file->map_size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+        if ( MAP_FAILED == file->data )
+        {
+            file->data = NULL;
+        }
+        else if ( ( file->size > 0 ) &&
+                  ( MAP_FAILED == mmap( file->data, file->size,
+                                        PROT_READ | PROT_WRITE,
+                                        MAP_PRIVATE | MAP_FIXED, fd, 0 ) ) )
+        {
+            munmap( file->data, file->map_size );
+            file->data = NULL;
+        }
+        else
+        {
+            /* Private copy on write mapping: tokenized in place */
+            ret = 0;
+        }
+        if ( 0 != ret )
+        {
+            file->map_size = 0;
+            ret = read_file( file, fd, file->size );
+        }
+#else
+        ret = read_file( file, fd, file->size );
+#endif
+    }
+
+    close( fd );
+
+    return ret;
+}
+
+void params_file_close( params_file_t * file )
+{
+    if ( file && file->data )
+    {
+#ifdef HAVE_PARAMS_FILE_MMAP
+        if ( file->map_size > 0 )
+        {
+            munmap( file->data, file->map_size );
+        }
+        else
+#endif
+        {
+            free( file->data );
+        }
+        file->data = NULL;
+        file->size = 0;
+        file->map_size = 0;
+    }
+}
+
+int parse_params_response_file( const params_index_t * index,
+                                params_file_t * file,
+                                void * params )
+{
+    char *  token;
+    char *  next;
+    bool    used_next = false;
+    bool    end = false;
+    size_t  pos = 0;
+    int     status;
+    int     next_status;
+    int     ret = 0;
+
+    ASSERT_PTR( index, -1 );
+    ASSERT_PTR( file, -1 );
+    ASSERT_PTR( file->data, -1 );
+    ASSERT_PTR( params, -1 );
+
+    status = next_response_token( file, &pos, &token );
+    while ( ( 1 == status ) && ( 0 == ret ) && ( ! end ) )
+    {
+        /* Next token is extracted before: it can be value of option */
+        next_status = next_response_token( file, &pos, &next );
+        if ( ( next_status < 0 ) || ( '@' == token[0] ) )
+        {
+            return -1;
+        }
+
+        ret = parse_token( index, token, ( 1 == next_status ) ? next : NULL,
+                           &used_next, &end, true, params );
+        if ( used_next )
+        {
+            status = next_response_token( file, &pos, &token );
+        }
+        else
+        {
+            status = next_status;
+            token = next;
+        }
+    }
+
+    return ( status < 0 ) ? -1 : ret;
+}
+
+int parse_params_config_file( const params_index_t * index,
+                              params_file_t * file,
+                              void * params )
+{
+    const parameter_description_t * desc;
+    lu_strview_t                    data;
+    lu_strview_t                    line;
+    lu_strview_t                    name;
+    lu_strview_t                    value;
+    size_t                          len;
+    size_t                          sep;
+    int                             ret = 0;
+
+    ASSERT_PTR( index, -1 );
+    ASSERT_PTR( file, -1 );
+    ASSERT_PTR( file->data, -1 );
+    ASSERT_PTR( params, -1 );
+
+    data = lu_strview( file->data, file->size );
+    while ( ( data.len > 0 ) && ( 0 == ret ) )
+    {
+        len = lu_strview_find_char( data, '\n' );
+        line = lu_strview_trim( lu_strview_slice( data, 0, len ) );
+        data = lu_strview_slice( data, ( LU_STRVIEW_NPOS == len ) ? data.len : len + 1, LU_STRVIEW_NPOS );
+
+        if ( ( 0 == line.len ) || ( '#' == line.ptr[0] ) || ( ';' == line.ptr[0] ) )
+        {
+            continue;
+        }
+
+        sep = lu_strview_find_char( line, '=' );
+        name = lu_strview_trim_right( lu_strview_slice( line, 0, sep ) );
+        desc = params_index_find_longname( index, name.ptr, name.len );
+        if ( ! desc )
+        {
+            return -1;
+        }
+
+        if ( LU_STRVIEW_NPOS == sep )
+        {
+            /* Name alone: flag */
+            ret = set_option_value( index, desc, NULL, true, params );
+            continue;
+        }
+
+        value = lu_strview_trim_left( lu_strview_slice( line, sep + 1, LU_STRVIEW_NPOS ) );
+        if ( ( value.len >= 2 ) && ( ( '"' == value.ptr[0] ) || ( '\'' == value.ptr[0] ) ) &&
+             ( value.ptr[value.len - 1] == value.ptr[0] ) )
+        {
+            value = lu_strview_slice( value, 1, value.len - 2 );
+        }
+
+        /* Byte after value is a separator, a quote or the final NUL */
+        ret = set_option_value( index, desc, terminate_view( file, value ), true, params );
+    }
+
+    return ret;
+}
+
+int parse_token( const params_index_t * index,
+                 const char * token,
+                 const char * next,
+                 bool * used_next,
+                 bool * end,
+                 bool from_file,
+                 void * params )
+{
+    *used_next = false;
+    *end = false;
+
+    /* Operands (and "-") are skipped */
+    if ( ( '-' != token[0] ) || ( '\0' == token[1] ) )
+    {
+        return 0;
+    }
+
+    if ( '-' != token[1] )
+    {
+        return parse_short_options( index, token + 1, next, used_next, from_file, params );
+    }
+
+    if ( '\0' == token[2] )
+    {
+        /* "--" ends options */
+        *end = true;
+        return 0;
+    }
+
+    return parse_long_option( index, token + 2, next, used_next, from_file, params );
+}
+
+int parse_long_option( const params_index_t * index,
+                       const char * name,
+                       const char * next,
+                       bool * used_next,
+                       bool from_file,
+                       void * params )
+{
+    const parameter_description_t * desc;
+    const char *                    value;
+    size_t                          len;
+
+    value = strchr( name, '=' );
+    len = value ? (size_t)( value - name ) : strlen( name );
+
+    desc = params_index_find_longname( index, name, len );
+    if ( ! desc )
+    {
+        return -1;
+    }
+
+    if ( BOOL_TYPE == desc->type )
+    {
+        /* Flags take no value */
+        return value ? -1 : set_option_value( index, desc, NULL, from_file, params );
+    }
+
+    if ( value )
+    {
+        value++;
+    }
+    else
+    {
+        value = next;
+        *used_next = true;
+    }
+
+    return set_option_value( index, desc, value, from_file, params );
+}
+
+int parse_short_options( const params_index_t * index,
+                         const char * names,
+                         const char * next,
+                         bool * used_next,
+                         bool from_file,
+                         void * params )
+{
+    const parameter_description_t * desc;
+    int                             ret = 0;
+
+    for ( ; ( '\0' != *names ) && ( 0 == ret ); names++ )
+    {
+        desc = params_index_find_shortname( index, *names );
+        if ( ! desc )
+        {
+            return -1;
+        }
+
+        if ( BOOL_TYPE == desc->type )
+        {
+            ret = set_option_value( index, desc, NULL, from_file, params );
+        }
+        else if ( '\0' != names[1] )
+        {
+            /* Rest of token is the value */
+            return set_option_value( index, desc, names + 1, from_file, params );
+        }
+        else
+        {
+            *used_next = true;
+            return set_option_value( index, desc, next, from_file, params );
+        }
+    }
+
+    return ret;
+}
+
+int set_option_value( const params_index_t * index,
+                      const parameter_description_t * desc,
+                      const char * value,
+                      bool from_file,
+                      void * params )
+{
+    if ( from_file && index->command_line_only &&
+         index->command_line_only[desc - index->descriptions] )
+    {
+        return -1;
+    }
+
+    return set_param_value( desc, value, params );
+}
+
+int parse_flag( const char * value, bool * flag )
+{
+    if ( ( ! value ) || ( 0 == strcmp( value, "true" ) ) || ( 0 == strcmp( value, "1" ) ) )
+    {
+        *flag = true;
+    }
+    else if ( ( 0 == strcmp( value, "false" ) ) || ( 0 == strcmp( value, "0" ) ) )
+    {
+        *flag = false;
+    }
+    else
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+int parse_array( int8_t type, const char * value, param_array_t * array )
+{
+    const char  delim = PARAM_ARRAY_DELIMITER;
+    size_t      len = strlen( value );
+    size_t      cap = array->capacity;
+    void *      out = array->values;
+    size_t      consumed = 0;
+    size_t      count;
+
+    if ( ( ! out ) && ( cap > 0 ) )
+    {
+        return -1;
+    }
+
+    /* One call of array parser: no split nor copy of elements */
+    switch ( type )
+    {
+        case U8_ARRAY_TYPE:
+            count = parse_uint8_array( value, len, delim, out, cap, &consumed );
+            break;
+        case I8_ARRAY_TYPE:
+            count = parse_int8_array( value, len, delim, out, cap, &consumed );
+            break;
+        case HEX8_ARRAY_TYPE:
+            count = parse_hex8_array( value, len, delim, out, cap, &consumed );
+            break;
+        case U16_ARRAY_TYPE:
+            count = parse_uint16_array( value, len, delim, out, cap, &consumed );
+            break;
+        case I16_ARRAY_TYPE:
+            count = parse_int16_array( value, len, delim, out, cap, &consumed );
+            break;
+        case HEX16_ARRAY_TYPE:
+            count = parse_hex16_array( value, len, delim, out, cap, &consumed );
+            break;
+        case U32_ARRAY_TYPE:
+            count = parse_uint32_array( value, len, delim, out, cap, &consumed );
+            break;
+        case I32_ARRAY_TYPE:
+            count = parse_int32_array( value, len, delim, out, cap, &consumed );
+            break;
+        case HEX32_ARRAY_TYPE:
+            count = parse_hex32_array( value, len, delim, out, cap, &consumed );
+            break;
+        case U64_ARRAY_TYPE:
+            count = parse_uint64_array( value, len, delim, out, cap, &consumed );
+            break;
+        case I64_ARRAY_TYPE:
+            count = parse_int64_array( value, len, delim, out, cap, &consumed );
+            break;
+        case HEX64_ARRAY_TYPE:
+            count = parse_hex64_array( value, len, delim, out, cap, &consumed );
+            break;
+        default:
+            count = parse_double_array( value, len, delim, out, cap, &consumed );
+            break;
+    }
+
+    /* Whole value parsed otherwise element at index count is invalid (or
+       buffer is full) */
+    array->count = count;
+
+    return ( consumed == len ) ? 0 : -1;
+}
+
+int read_file( params_file_t * file, int fd, size_t size )
+{
+    size_t  done = 0;
+    ssize_t ret;
+
+    file->data = malloc( size + 1 );
+    if ( ! file->data )
+    {
+        return -1;
+    }
+
+    while ( done < size )
+    {
+        ret = read( fd, file->data + done, size - done );
+        if ( ( ret < 0 ) && ( EINTR == errno ) )
+        {
+            continue;
+        }
+        if ( ret <= 0 )
+        {
+            free( file->data );
+            file->data = NULL;
+            return -1;
+        }
+        done += (size_t)ret;
+    }
+    file->data[size] = '\0';
+
+    return 0;
+}
+
+int next_response_token( params_file_t * file, size_t * pos, char ** token )
+{
+    char *  data = file->data;
+    size_t  size = file->size;
+    size_t  i = *pos;
+    char *  out;
+    char    quote;
+
+    /* NUL bytes written by previous tokens are separators */
+    while ( ( i < size ) && ( lu_strview_is_space( data[i] ) || ( '\0' == data[i] ) ) )
+    {
+        i++;
+    }
+    if ( i >= size )
+    {
+        *pos = i;
+        return 0;
+    }
+
+    /* Token is unquoted in place: out never passes i */
+    *token = out = &data[i];
+    while ( ( i < size ) && ( ! lu_strview_is_space( data[i] ) ) && ( '\0' != data[i] ) )
+    {
+        if ( ( '\'' == data[i] ) || ( '"' == data[i] ) )
+        {
+            quote = data[i++];
+            while ( ( i < size ) && ( quote != data[i] ) )
+            {
+                if ( ( '"' == quote ) && ( '\\' == data[i] ) && ( i + 1 < size ) )
+                {
+                    i++;
+                }
+                *out++ = data[i++];
+            }
+            if ( i >= size )
+            {
+                return -1;
+            }
+            i++;
+        }
+        else
+        {
+            if ( ( '\\' == data[i] ) && ( i + 1 < size ) )
+            {
+                i++;
+            }
+            *out++ = data[i++];
+        }
+    }
+
+    /* data[size] exists: file is followed by a NUL byte */
+    *out = '\0';
+    *pos = ( i < size ) ? i + 1 : i;
+
+    return 1;
+}
+
+char * terminate_view( params_file_t * file, lu_strview_t view )
+{
+    char * str = file->data + ( view.ptr - file->data );
+
+    str[view.len] = '\0';
+
+    return str;
+}
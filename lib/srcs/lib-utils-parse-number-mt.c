@@ -0,0 +1,709 @@
+/*!
+ * @file: lib-utils-parse-number-mt.c
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of multithreaded array number parsers.
+ */
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lib-utils-assert.h"
+#include "lib-utils-parse-number.h"
+#include "lib-utils-parse-number-mt.h"
+
+/*!
+ * @enum array_type_t
+ * @brief Type of array elements (select single threaded array parser).
+ */
+typedef enum array_type_t
+{
+    ARRAY_TYPE_UINT8,
+    ARRAY_TYPE_INT8,
+    ARRAY_TYPE_HEX8,
+    ARRAY_TYPE_UINT16,
+    ARRAY_TYPE_INT16,
+    ARRAY_TYPE_HEX16,
+    ARRAY_TYPE_UINT32,
+    ARRAY_TYPE_INT32,
+    ARRAY_TYPE_HEX32,
+    ARRAY_TYPE_UINT64,
+    ARRAY_TYPE_INT64,
+    ARRAY_TYPE_HEX64,
+    ARRAY_TYPE_DOUBLE,
+    ARRAY_TYPE_FLOAT,
+} array_type_t;
+
+/*!
+ * @enum parse_step_t
+ * @brief Work done on each chunk by pool threads.
+ */
+typedef enum parse_step_t
+{
+    PARSE_STEP_COUNT,       /*!< Count values of chunk. */
+    PARSE_STEP_PARSE,       /*!< Parse values of chunk in output array. */
+} parse_step_t;
+
+/*!
+ * @struct parse_chunk_t
+ * @brief Part of buffer parsed by one thread.
+ */
+typedef struct parse_chunk_t
+{
+    size_t      begin;          /*!< Offset of chunk in buffer. */
+    size_t      len;            /*!< Length of chunk. */
+    size_t      nb_values;      /*!< Number of values (delimiters count). */
+    size_t      offset;         /*!< Index of first value in output array. */
+    size_t      nb;             /*!< Number of values parsed. */
+    size_t      consumed;       /*!< Number of bytes consumed in chunk. */
+} parse_chunk_t;
+
+/*!
+ * @struct parse_job_t
+ * @brief Parse of one buffer.
+ */
+typedef struct parse_job_t
+{
+    const char *    buf;            /*!< Buffer to parse. */
+    char            delim;          /*!< Delimiter between two values. */
+    array_type_t    type;           /*!< Type of values. */
+    size_t          size;           /*!< Size of one value in bytes. */
+    void *          out;            /*!< Output array. */
+    size_t          max_out;        /*!< Size of output array. */
+    parse_step_t    step;           /*!< Current step. */
+    size_t          next_chunk;     /*!< Next chunk to process. */
+    size_t          nb_chunks;      /*!< Number of chunks. */
+    parse_chunk_t * chunks;         /*!< Chunks of buffer. */
+} parse_job_t;
+
+struct parse_pool_t
+{
+    pthread_mutex_t     mutex;          /*!< Protect pool fields. */
+    pthread_cond_t      start_cond;     /*!< Signal a new step to threads. */
+    pthread_cond_t      done_cond;      /*!< Signal end of step to caller. */
+    pthread_t *         threads;        /*!< Pool threads. */
+    unsigned int        nb_threads;     /*!< Number of threads (with caller). */
+    unsigned int        nb_started;     /*!< Number of started pool threads. */
+    unsigned int        nb_running;     /*!< Pool threads running a step. */
+    unsigned int        generation;     /*!< Incremented at each step. */
+    int                 stop;           /*!< Non zero to stop threads. */
+    parse_job_t *       job;            /*!< Current job. */
+    parse_chunk_t *     chunks;         /*!< Chunks (one set per pool). */
+};
+
+/*!
+ * @brief Main function of pool threads.
+ * @param arg   Parse pool.
+ * @return NULL.
+ */
+static void * pool_thread( void * arg );
+
+/*!
+ * @brief Run current step of job in pool threads and calling thread, return
+ *        when all chunks are processed.
+ * @param pool  Parse pool.
+ * @param job   Job to run.
+ * @return None.
+ */
+static void pool_run_step( parse_pool_t * pool, parse_job_t * job );
+
+/*!
+ * @brief Process chunks of current step until all are taken.
+ * @param pool  Parse pool.
+ * @param job   Current job.
+ * @return None.
+ */
+static void process_chunks( parse_pool_t * pool, parse_job_t * job );
+
+/*!
+ * @brief Count delimiters in buffer.
+ * @param buf   Buffer.
+ * @param len   Length of buffer in bytes.
+ * @param delim Delimiter.
+ * @return The number of delimiters.
+ */
+static size_t count_delimiters( const char * buf, size_t len, char delim );
+
+/*!
+ * @brief Call single threaded array parser of type.
+ * @param type      Type of values.
+ * @param buf       Buffer contains values.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Delimiter between two values.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+static size_t parse_array( array_type_t type,
+                           const char * buf,
+                           size_t len,
+                           char delim,
+                           void * out,
+                           size_t max_out,
+                           size_t * consumed );
+
+/*!
+ * @brief Split buffer in chunks, parse chunks with pool threads and merge
+ *        results.
+ * @param pool      Parse pool.
+ * @param buf       Buffer contains values.
+ * @param len       Length of buffer in bytes.
+ * @param delim     Delimiter between two values.
+ * @param type      Type of values.
+ * @param size      Size of one value in bytes.
+ * @param out       Array to store values.
+ * @param max_out   Maximum number of values to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of values stored in out.
+ */
+static size_t parse_array_mt( parse_pool_t * pool,
+                              const char * buf,
+                              size_t len,
+                              char delim,
+                              array_type_t type,
+                              size_t size,
+                              void * out,
+                              size_t max_out,
+                              size_t * consumed );
+
+parse_pool_t * parse_pool_create( unsigned int nb_threads )
+{
+    parse_pool_t * pool;
+
+    if ( 0 == nb_threads )
+    {
+        return NULL;
+    }
+
+    pool = calloc( 1, sizeof( *pool ) );
+    if ( ! pool )
+    {
+        return NULL;
+    }
+
+    pool->nb_threads = nb_threads;
+    pool->threads = calloc( nb_threads, sizeof( *pool->threads ) );
+    pool->chunks = calloc( (size_t)nb_threads * PARSE_POOL_CHUNKS_PER_THREAD,
+                           sizeof( *pool->chunks ) );
+    if ( ( ! pool->threads ) || ( ! pool->chunks ) )
+    {
+        free( pool->threads );
+        free( pool->chunks );
+        free( pool );
+        return NULL;
+    }
+
+    pthread_mutex_init( &pool->mutex, NULL );
+    pthread_cond_init( &pool->start_cond, NULL );
+    pthread_cond_init( &pool->done_cond, NULL );
+
+    /* Calling thread is the first parse thread */
+    for ( pool->nb_started = 0; pool->nb_started < nb_threads - 1; pool->nb_started++ )
+    {
+        if ( 0 != pthread_create( &pool->threads[pool->nb_started], NULL,
+                                  pool_thread, pool ) )
+        {
+            parse_pool_destroy( pool );
+            return NULL;
+        }
+    }
+
+    return pool;
+}
+
+void parse_pool_destroy( parse_pool_t * pool )
+{
+    unsigned int i;
+
+    if ( ! pool )
+    {
+        return;
+    }
+
+    pthread_mutex_lock( &pool->mutex );
+    pool->stop = 1;
+    pthread_cond_broadcast( &pool->start_cond );
+    pthread_mutex_unlock( &pool->mutex );
+
+    for ( i = 0; i < pool->nb_started; i++ )
+    {
+        pthread_join( pool->threads[i], NULL );
+    }
+
+    pthread_cond_destroy( &pool->done_cond );
+    pthread_cond_destroy( &pool->start_cond );
+    pthread_mutex_destroy( &pool->mutex );
+    free( pool->chunks );
+    free( pool->threads );
+    free( pool );
+}
+
+unsigned int parse_pool_get_nb_threads( const parse_pool_t * pool )
+{
+    return pool ? pool->nb_threads : 0;
+}
+
+size_t parse_uint8_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             uint8_t * out,
+                             size_t max_out,
+                             size_t * consumed )
+{
+    return parse_array_mt( pool, buf, len, delim, ARRAY_TYPE_UINT8,
+                           sizeof( *out ), out, max_out, consumed );
+}
+
+size_t parse_int8_array_mt( parse_pool_t * pool,
+                            const char * buf,
+                            size_t len,
+                            char delim,
+                            int8_t * out,
+                            size_t max_out,
+                            size_t * consumed )
+{
+    return parse_array_mt( pool, buf, len, delim, ARRAY_TYPE_INT8,
+                           sizeof( *out ), out, max_out, consumed );
+}
+
+size_t parse_hex8_array_mt( parse_pool_t * pool,
+                            const char * buf,
+                            size_t len,
+                            char delim,
+                            uint8_t * out,
+                            size_t max_out,
+                            size_t * consumed )
+{
+    return parse_array_mt( pool, buf, len, delim, ARRAY_TYPE_HEX8,
+                           sizeof( *out ), out, max_out, consumed );
+}
+
+size_t parse_uint16_array_mt( parse_pool_t * pool,
+                              const char * buf,
+                              size_t len,
+                              char delim,
+                              uint16_t * out,
+                              size_t max_out,
+                              size_t * consumed )
+{
+    return parse_array_mt( pool, buf, len, delim, ARRAY_TYPE_UINT16,
+                           sizeof( *out ), out, max_out, consumed );
+}
+
+size_t parse_int16_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             int16_t * out,
+                             size_t max_out,
+                             size_t * consumed )
+{
+    return parse_array_mt( pool, buf, len, delim, ARRAY_TYPE_INT16,
+                           sizeof( *out ), out, max_out, consumed );
+}
+
+size_t parse_hex16_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             uint16_t * out,
+                             size_t max_out,
+                             size_t * consumed )
+{
+    return parse_array_mt( pool, buf, len, delim, ARRAY_TYPE_HEX16,
+                           sizeof( *out ), out, max_out, consumed );
+}
+
+size_t parse_uint32_array_mt( parse_pool_t * pool,
+                              const char * buf,
+                              size_t len,
+                              char delim,
+                              uint32_t * out,
+                              size_t max_out,
+                              size_t * consumed )
+{
+    return parse_array_mt( pool, buf, len, delim, ARRAY_TYPE_UINT32,
+                           sizeof( *out ), out, max_out, consumed );
+}
+
+size_t parse_int32_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             int32_t * out,
+                             size_t max_out,
+                             size_t * consumed )
+{
+    return parse_array_mt( pool, buf, len, delim, ARRAY_TYPE_INT32,
+                           sizeof( *out ), out, max_out, consumed );
+}
+
+size_t parse_hex32_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             uint32_t * out,
+                             size_t max_out,
+                             size_t * consumed )
+{
+    return parse_array_mt( pool, buf, len, delim, ARRAY_TYPE_HEX32,
+                           sizeof( *out ), out, max_out, consumed );
+}
+
+size_t parse_uint64_array_mt( parse_pool_t * pool,
+                              const char * buf,
+                              size_t len,
+                              char delim,
+                              uint64_t * out,
+                              size_t max_out,
+                              size_t * consumed )
+{
+    return parse_array_mt( pool, buf, len, delim, ARRAY_TYPE_UINT64,
+                           sizeof( *out ), out, max_out, consumed );
+}
+
+size_t parse_int64_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             int64_t * out,
+                             size_t max_out,
+                             size_t * consumed )
+{
+    return parse_array_mt( pool, buf, len, delim, ARRAY_TYPE_INT64,
+                           sizeof( *out ), out, max_out, consumed );
+}
+
+size_t parse_hex64_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             uint64_t * out,
+                             size_t max_out,
+                             size_t * consumed )
+{
+    return parse_array_mt( pool, buf, len, delim, ARRAY_TYPE_HEX64,
+                           sizeof( *out ), out, max_out, consumed );
+}
+
+size_t parse_double_array_mt( parse_pool_t * pool,
+                              const char * buf,
+                              size_t len,
+                              char delim,
+                              double * out,
+                              size_t max_out,
+                              size_t * consumed )
+{
+    return parse_array_mt( pool, buf, len, delim, ARRAY_TYPE_DOUBLE,
+                           sizeof( *out ), out, max_out, consumed );
+}
+
+size_t parse_float_array_mt( parse_pool_t * pool,
+                             const char * buf,
+                             size_t len,
+                             char delim,
+                             float * out,
+                             size_t max_out,
+                             size_t * consumed )
+{
+    return parse_array_mt( pool, buf, len, delim, ARRAY_TYPE_FLOAT,
+                           sizeof( *out ), out, max_out, consumed );
+}
+
+void * pool_thread( void * arg )
+{
+    parse_pool_t *  pool = arg;
+    unsigned int    generation = 0;
+    parse_job_t *   job;
+
+    pthread_mutex_lock( &pool->mutex );
+    while ( 1 )
+    {
+        while ( ( ! pool->stop ) && ( generation == pool->generation ) )
+        {
+            pthread_cond_wait( &pool->start_cond, &pool->mutex );
+        }
+
+        if ( pool->stop )
+        {
+            break;
+        }
+
+        generation = pool->generation;
+        job = pool->job;
+        pthread_mutex_unlock( &pool->mutex );
+
+        process_chunks( pool, job );
+
+        pthread_mutex_lock( &pool->mutex );
+        pool->nb_running--;
+        if ( 0 == pool->nb_running )
+        {
+            pthread_cond_signal( &pool->done_cond );
+        }
+    }
+    pthread_mutex_unlock( &pool->mutex );
+
+    return NULL;
+}
+
+void pool_run_step( parse_pool_t * pool, parse_job_t * job )
+{
+    pthread_mutex_lock( &pool->mutex );
+    job->next_chunk = 0;
+    pool->job = job;
+    pool->nb_running = pool->nb_started;
+    pool->generation++;
+    pthread_cond_broadcast( &pool->start_cond );
+    pthread_mutex_unlock( &pool->mutex );
+
+    process_chunks( pool, job );
+
+    pthread_mutex_lock( &pool->mutex );
+    while ( pool->nb_running > 0 )
+    {
+        pthread_cond_wait( &pool->done_cond, &pool->mutex );
+    }
+    pthread_mutex_unlock( &pool->mutex );
+}
+
+void process_chunks( parse_pool_t * pool, parse_job_t * job )
+{
+    parse_chunk_t * chunk;
+    size_t          max_out;
+
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pool->mutex );
+        chunk = ( job->next_chunk < job->nb_chunks ) ?
+                &job->chunks[job->next_chunk++] : NULL;
+        pthread_mutex_unlock( &pool->mutex );
+
+        if ( ! chunk )
+        {
+            break;
+        }
+
+        if ( PARSE_STEP_COUNT == job->step )
+        {
+            chunk->nb_values = count_delimiters( job->buf + chunk->begin,
+                                                 chunk->len, job->delim );
+            /* Last value without delimiter */
+            if ( ( chunk->len > 0 ) &&
+                 ( job->delim != job->buf[chunk->begin + chunk->len - 1] ) )
+            {
+                chunk->nb_values++;
+            }
+        }
+        else if ( chunk->offset < job->max_out )
+        {
+            max_out = job->max_out - chunk->offset;
+            if ( max_out > chunk->nb_values )
+            {
+                max_out = chunk->nb_values;
+            }
+            chunk->nb = parse_array( job->type, job->buf + chunk->begin,
+                                     chunk->len, job->delim,
+                                     (char *)job->out + chunk->offset * job->size,
+                                     max_out, &chunk->consumed );
+        }
+        else
+        {
+            /* Output array already full */
+            chunk->nb = 0;
+            chunk->consumed = 0;
+        }
+    }
+}
+
+size_t count_delimiters( const char * buf, size_t len, char delim )
+{
+    const uint64_t  ones = 0x0101010101010101ULL;
+    const uint64_t  low7 = 0x7F7F7F7F7F7F7F7FULL;
+    const uint64_t  low8 = 0x00FF00FF00FF00FFULL;
+    const uint64_t  pattern = ones * (uint8_t)delim;
+    size_t          count = 0;
+    size_t          i = 0;
+    size_t          j;
+    uint64_t        word;
+    uint64_t        sums;
+
+    while ( i + sizeof( word ) <= len )
+    {
+        /* Bytes equal to delim become zero, each zero byte adds 1 to its
+         * byte of sums (at most 255 words before a byte overflows) */
+        sums = 0;
+        for ( j = 0; ( j < 255 ) && ( i + sizeof( word ) <= len ); j++ )
+        {
+            memcpy( &word, buf + i, sizeof( word ) );
+            word ^= pattern;
+            sums += ~( ( ( word & low7 ) + low7 ) | word | low7 ) >> 7;
+            i += sizeof( word );
+        }
+
+        /* Add the eight bytes of sums */
+        sums = ( sums & low8 ) + ( ( sums >> 8 ) & low8 );
+        count += ( sums * 0x0001000100010001ULL ) >> 48;
+    }
+
+    for ( ; i < len; i++ )
+    {
+        count += ( delim == buf[i] );
+    }
+
+    return count;
+}
+
+size_t parse_array( array_type_t type,
+                    const char * buf,
+                    size_t len,
+                    char delim,
+                    void * out,
+                    size_t max_out,
+                    size_t * consumed )
+{
+    size_t nb = 0;
+
+    switch ( type )
+    {
+        case ARRAY_TYPE_UINT8:
+            nb = parse_uint8_array( buf, len, delim, out, max_out, consumed );
+        break;
+        case ARRAY_TYPE_INT8:
+            nb = parse_int8_array( buf, len, delim, out, max_out, consumed );
+        break;
+        case ARRAY_TYPE_HEX8:
+            nb = parse_hex8_array( buf, len, delim, out, max_out, consumed );
+        break;
+        case ARRAY_TYPE_UINT16:
+            nb = parse_uint16_array( buf, len, delim, out, max_out, consumed );
+        break;
+        case ARRAY_TYPE_INT16:
+            nb = parse_int16_array( buf, len, delim, out, max_out, consumed );
+        break;
+        case ARRAY_TYPE_HEX16:
+            nb = parse_hex16_array( buf, len, delim, out, max_out, consumed );
+        break;
+        case ARRAY_TYPE_UINT32:
+            nb = parse_uint32_array( buf, len, delim, out, max_out, consumed );
+        break;
+        case ARRAY_TYPE_INT32:
+            nb = parse_int32_array( buf, len, delim, out, max_out, consumed );
+        break;
+        case ARRAY_TYPE_HEX32:
+            nb = parse_hex32_array( buf, len, delim, out, max_out, consumed );
+        break;
+        case ARRAY_TYPE_UINT64:
+            nb = parse_uint64_array( buf, len, delim, out, max_out, consumed );
+        break;
+        case ARRAY_TYPE_INT64:
+            nb = parse_int64_array( buf, len, delim, out, max_out, consumed );
+        break;
+        case ARRAY_TYPE_HEX64:
+            nb = parse_hex64_array( buf, len, delim, out, max_out, consumed );
+        break;
+        case ARRAY_TYPE_DOUBLE:
+            nb = parse_double_array( buf, len, delim, out, max_out, consumed );
+        break;
+        case ARRAY_TYPE_FLOAT:
+            nb = parse_float_array( buf, len, delim, out, max_out, consumed );
+        break;
+    }
+
+    return nb;
+}
+
+size_t parse_array_mt( parse_pool_t * pool,
+                       const char * buf,
+                       size_t len,
+                       char delim,
+                       array_type_t type,
+                       size_t size,
+                       void * out,
+                       size_t max_out,
+                       size_t * consumed )
+{
+    parse_job_t     job;
+    parse_chunk_t * chunk;
+    const char *    sep;
+    size_t          nb_chunks;
+    size_t          begin;
+    size_t          end;
+    size_t          offset;
+    size_t          nb;
+    size_t          i;
+
+    ASSERT_PTR( consumed, 0 );
+    *consumed = 0;
+    ASSERT_PTR( pool, 0 );
+    ASSERT_PTR( buf, 0 );
+    ASSERT_PTR( out, 0 );
+
+    nb_chunks = len / PARSE_POOL_MIN_CHUNK_SIZE;
+    if ( nb_chunks > (size_t)pool->nb_threads * PARSE_POOL_CHUNKS_PER_THREAD )
+    {
+        nb_chunks = (size_t)pool->nb_threads * PARSE_POOL_CHUNKS_PER_THREAD;
+    }
+
+    if ( ( nb_chunks <= 1 ) || ( 1 == pool->nb_threads ) )
+    {
+        return parse_array( type, buf, len, delim, out, max_out, consumed );
+    }
+
+    /* Split just after a delimiter so that no value is cut */
+    job.nb_chunks = 0;
+    for ( begin = 0; begin < len; begin = end )
+    {
+        end = ( job.nb_chunks + 1 < nb_chunks ) ?
+              begin + ( len - begin ) / ( nb_chunks - job.nb_chunks ) : len;
+        if ( end < len )
+        {
+            sep = memchr( buf + end, delim, len - end );
+            end = sep ? (size_t)( sep - buf ) + 1 : len;
+        }
+
+        chunk = &pool->chunks[job.nb_chunks++];
+        chunk->begin = begin;
+        chunk->len = end - begin;
+    }
+
+    job.buf = buf;
+    job.delim = delim;
+    job.type = type;
+    job.size = size;
+    job.out = out;
+    job.max_out = max_out;
+    job.chunks = pool->chunks;
+
+    job.step = PARSE_STEP_COUNT;
+    pool_run_step( pool, &job );
+
+    offset = 0;
+    for ( i = 0; i < job.nb_chunks; i++ )
+    {
+        job.chunks[i].offset = offset;
+        offset += job.chunks[i].nb_values;
+    }
+
+    job.step = PARSE_STEP_PARSE;
+    pool_run_step( pool, &job );
+
+    /* Merge in order: stop at first chunk not completely parsed (invalid
+     * value or output array full) */
+    nb = 0;
+    *consumed = len;
+    for ( i = 0; i < job.nb_chunks; i++ )
+    {
+        chunk = &job.chunks[i];
+        nb += chunk->nb;
+        if ( ( chunk->nb != chunk->nb_values ) || ( chunk->consumed != chunk->len ) )
+        {
+            *consumed = chunk->begin + chunk->consumed;
+            break;
+        }
+    }
+
+    return nb;
+}
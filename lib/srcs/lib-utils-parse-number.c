@@ -1,370 +1,945 @@
-/*!
- * @file: lib-utils-parse-number.c
- * @date: 2024-01-04
- * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
- * @brief: Implementation of function to parse string contains number.
- */
-#include <stdlib.h>
-
-#include "lib-utils-assert.h"
-#include "lib-utils-parse-number.h"
-
-int parse_uint8(const char * str, uint8_t * num)
-{
-    int             ret;
-    char*           end;
-    unsigned long   tmp;
-
-    ASSERT_STR_NOT_NULL( str, -1 );
-    ASSERT_PTR( num, -1 );
-
-    tmp = strtoul( str, &end, 10 );
-
-    if ( *end )
-    {
-        ret = -1;
-    }
-    else if ( tmp > UINT8_MAX )
-    {
-        ret = -1;
-    }
-    else
-    {
-        *num = (uint8_t)tmp;
-        ret = 0;
-    }
-
-    return ret;
-}
-
-int parse_int8(const char * str, int8_t * num)
-{
-    int    ret;
-    char*  end;
-    long   tmp;
-
-    ASSERT_STR_NOT_NULL( str, -1 );
-    ASSERT_PTR( num, -1 );
-
-    tmp = strtol( str, &end, 10 );
-
-    if ( *end )
-    {
-        ret = -1;
-    }
-    else if ( ( tmp > INT8_MAX ) || ( tmp < INT8_MIN ) )
-    {
-        ret = -1;
-    }
-    else
-    {
-        *num = (int8_t)tmp;
-        ret = 0;
-    }
-
-    return ret;
-}
-
-int parse_hex8(const char * str, uint8_t * hex)
-{
-    int             ret;
-    char*           end;
-    unsigned long   tmp;
-
-    ASSERT_STR_NOT_NULL( str, -1 );
-    ASSERT_PTR( hex, -1 );
-
-    tmp = strtoul( str, &end, 16 );
-
-    if ( *end )
-    {
-        ret = -1;
-    }
-    else if ( tmp > UINT8_MAX )
-    {
-        ret = -1;
-    }
-    else
-    {
-        *hex = (uint8_t)tmp;
-        ret = 0;
-    }
-
-    return ret;
-}
-
-int parse_uint16(const char * str, uint16_t * num)
-{
-    int    ret;
-    char*  end;
-    unsigned long   tmp;
-
-    ASSERT_STR_NOT_NULL( str, -1 );
-    ASSERT_PTR( num, -1 );
-
-    tmp = strtoul( str, &end, 10 );
-
-    if ( *end )
-    {
-        ret = -1;
-    }
-    else if ( tmp > UINT16_MAX )
-    {
-        ret = -1;
-    }
-    else
-    {
-        *num = (uint16_t)tmp;
-        ret = 0;
-    }
-
-    return ret;
-}
-
-int parse_int16(const char * str, int16_t * num)
-{
-    int    ret;
-    char*  end;
-    long   tmp;
-
-    ASSERT_STR_NOT_NULL( str, -1 );
-    ASSERT_PTR( num, -1 );
-
-    tmp = strtol( str, &end, 10 );
-
-    if ( *end )
-    {
-        ret = -1;
-    }
-    else if ( ( tmp > INT16_MAX ) || ( tmp < INT16_MIN ) )
-    {
-        ret = -1;
-    }
-    else
-    {
-        *num = (int16_t)tmp;
-        ret = 0;
-    }
-
-    return ret;
-}
-
-int parse_hex16(const char * str, uint16_t * hex)
-{
-    int             ret;
-    char*           end;
-    unsigned long   tmp;
-
-    ASSERT_STR_NOT_NULL( str, -1 );
-    ASSERT_PTR( hex, -1 );
-
-    tmp = strtoul( str, &end, 16 );
-
-    if ( *end )
-    {
-        ret = -1;
-    }
-    else if ( tmp > UINT16_MAX )
-    {
-        ret = -1;
-    }
-    else
-    {
-        *hex = (uint16_t)tmp;
-        ret = 0;
-    }
-
-    return ret;
-}
-
-int parse_uint32(const char * str, uint32_t * num)
-{
-    int    ret;
-    char*  end;
-    unsigned long   tmp;
-
-    ASSERT_STR_NOT_NULL( str, -1 );
-    ASSERT_PTR( num, -1 );
-
-    tmp = strtoul( str, &end, 10 );
-
-    if ( *end )
-    {
-        ret = -1;
-    }
-    else if ( tmp > UINT32_MAX )
-    {
-        ret = -1;
-    }
-    else
-    {
-        *num = (uint32_t)tmp;
-        ret = 0;
-    }
-
-    return ret;
-}
-
-int parse_int32(const char * str, int32_t * num)
-{
-    int    ret;
-    char*  end;
-    int64_t tmp;
-
-    ASSERT_STR_NOT_NULL( str, -1 );
-    ASSERT_PTR( num, -1 );
-
-    tmp = strtoll( str, &end, 10 );
-
-    if ( *end )
-    {
-        ret = -1;
-    }
-    else if ( ( tmp > INT32_MAX ) || ( tmp < INT32_MIN ) )
-    {
-        ret = -1;
-    }
-    else
-    {
-        *num = (int32_t)tmp;
-        ret = 0;
-    }
-
-    return ret;
-}
-
-int parse_hex32(const char * str, uint32_t * hex)
-{
-    int             ret;
-    char*           end;
-    unsigned long long   tmp;
-
-    ASSERT_STR_NOT_NULL( str, -1 );
-    ASSERT_PTR( hex, -1 );
-
-    tmp = strtoull( str, &end, 16 );
-
-    if ( *end )
-    {
-        ret = -1;
-    }
-    else if ( tmp > UINT32_MAX )
-    {
-        ret = -1;
-    }
-    else
-    {
-        *hex = (uint32_t)tmp;
-        ret = 0;
-    }
-
-    return ret;
-}
-
-int parse_uint64(const char * str, uint64_t * num)
-{
-    int    ret;
-    char*  end;
-    unsigned long long  tmp;
-
-    ASSERT_STR_NOT_NULL( str, -1 );
-    ASSERT_PTR( num, -1 );
-
-    tmp = strtoull( str, &end, 10 );
-
-    if ( *end )
-    {
-        ret = -1;
-    }
-    else if ( tmp > UINT64_MAX )
-    {
-        ret = -1;
-    }
-    else
-    {
-        *num = (uint64_t)tmp;
-        ret = 0;
-    }
-
-    return ret;
-}
-
-int parse_int64(const char * str, int64_t * num)
-{
-    int    ret;
-    char*  end;
-    long long   tmp;
-
-    ASSERT_STR_NOT_NULL( str, -1 );
-    ASSERT_PTR( num, -1 );
-
-    tmp = strtoll( str, &end, 10 );
-
-    if ( *end )
-    {
-        ret = -1;
-    }
-    else if ( ( tmp > INT64_MAX ) || ( tmp < INT64_MIN ) )
-    {
-        ret = -1;
-    }
-    else
-    {
-        *num = (int64_t)tmp;
-        ret = 0;
-    }
-
-    return ret;
-}
-
-int parse_hex64(const char * str, uint64_t * hex)
-{
-    int             ret;
-    char*           end;
-    unsigned long long   tmp;
-
-    ASSERT_STR_NOT_NULL( str, -1 );
-    ASSERT_PTR( hex, -1 );
-
-    tmp = strtoull( str, &end, 16 );
-
-    if ( *end )
-    {
-        ret = -1;
-    }
-    else if ( tmp > UINT64_MAX )
-    {
-        ret = -1;
-    }
-    else
-    {
-        *hex = (uint64_t)tmp;
-        ret = 0;
-    }
-
-    return ret;
-}
-
-int parse_double(const char * str, double * number)
-{
-    int     ret;
-    char*   end;
-    double  tmp;
-
-    ASSERT_STR_NOT_NULL( str, -1 );
-    ASSERT_PTR( number, -1 );
-
-    tmp = strtod( str, &end );
-
-    if ( *end )
-    {
-        ret = -1;
-    }
-    else
-    {
-        *number = tmp;
-        ret = 0;
-    }
-
-    return ret;
-}
+/*!
+ * @file: lib-utils-parse-number.c
+ * @date: 2024-01-04
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of function to parse string contains number.
+ */
+#include <string.h>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <immintrin.h>
+
+/*!
+ * @brief SSE4.2 implementation is available for this target.
+ */
+#define HAVE_PARSE_NUMBER_SSE42 1
+#endif
+
+#include "lib-utils-assert.h"
+#include "lib-utils-parse-number.h"
+
+/*!
+ * @struct number_format_t
+ * @brief Description of the number type to parse from a buffer.
+ */
+typedef struct number_format_t
+{
+    unsigned int    base;       /*!< Numeric base (10 or 16). */
+    int             is_signed;  /*!< Non zero if number is signed. */
+    int64_t         min;        /*!< Minimum value (signed number only). */
+    uint64_t        max;        /*!< Maximum value. */
+    size_t          size;       /*!< Size of number in bytes. */
+} number_format_t;
+
+/*!
+ * @brief Instruction set used by parsers (-1 until first use, accessed
+ *        atomically: first parses can run concurrently).
+ */
+static int s_parse_number_isa = -1;
+
+#ifdef HAVE_PARSE_NUMBER_SSE42
+/*!
+ * @brief Shuffle masks to move the n first bytes of a register to its end
+ *        (load 16 bytes from index n, 0x80 clears the byte).
+ */
+static const uint8_t s_shift_digits_mask[32] =
+{
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
+};
+
+/*!
+ * @brief Convert up to 16 leading decimal digits with SSE4.2.
+ * @param p         Pointer on first character to parse.
+ * @param end       Pointer after the last character of number.
+ * @param rend      Pointer after the last readable character (at least 8
+ *                  bytes readable from p).
+ * @param value     Pointer to store parsed value.
+ * @return Number of digits converted.
+ */
+static unsigned int parse_16_digits_sse42( const char * p,
+                                           const char * end,
+                                           const char * rend,
+                                           uint64_t * value );
+#endif
+
+/*!
+ * @brief Return the instruction set used by parsers (detect it on first call).
+ * @return The instruction set used by parsers.
+ */
+static inline parse_number_isa_t get_parse_number_isa( void );
+
+/*!
+ * @brief Parse decimal digits from a bounded buffer.
+ * @param p         Pointer on first character to parse.
+ * @param end       Pointer after the last character of number.
+ * @param rend      Pointer after the last readable character (rend >= end),
+ *                  vectorized path may load bytes up to rend.
+ * @param value     Pointer to store parsed value.
+ * @return Pointer after the last digit parsed on success otherwise NULL if
+ *         value overflows uint64_t.
+ */
+static inline const char * parse_decimal_digits( const char * p,
+                                                 const char * end,
+                                                 const char * rend,
+                                                 uint64_t * value );
+
+/*!
+ * @brief Parse hexadecimal digits from a bounded buffer.
+ * @param p         Pointer on first character to parse.
+ * @param end       Pointer after the last character of buffer.
+ * @param value     Pointer to store parsed value.
+ * @return Pointer after the last digit parsed on success otherwise NULL if
+ *         value overflows uint64_t.
+ */
+static inline const char * parse_hex_digits( const char * p,
+                                             const char * end,
+                                             uint64_t * value );
+
+/*!
+ * @brief Parse number from a bounded buffer with the same rules as strtoul and
+ *        strtoll (leading white spaces, sign and 0x prefix in base 16) except
+ *        that the whole buffer must be a valid number in range of format.
+ * @param begin     Pointer on first character of number.
+ * @param end       Pointer after the last character of number.
+ * @param rend      Pointer after the last readable character (rend >= end).
+ * @param format    Number format description.
+ * @param number    Pointer on 64 bits value to store number (int64_t for
+ *                  signed format, uint64_t otherwise).
+ * @return 0 on success otherwise -1.
+ */
+static int parse_number_buffer( const char * begin,
+                                const char * end,
+                                const char * rend,
+                                const number_format_t * format,
+                                void * number );
+
+/*!
+ * @brief Parse a buffer of numbers separated by a delimiter.
+ * @param buf       Buffer contains numbers (NUL termination not required).
+ * @param len       Length of buffer in bytes.
+ * @param delim     Delimiter between two numbers.
+ * @param format    Number format description.
+ * @param out       Array to store numbers.
+ * @param max_out   Maximum number of elements to store in out.
+ * @param consumed  Pointer to store the number of bytes consumed in buf.
+ * @return The number of elements stored in out.
+ */
+static size_t parse_number_array( const char * buf,
+                                  size_t len,
+                                  char delim,
+                                  const number_format_t * format,
+                                  void * out,
+                                  size_t max_out,
+                                  size_t * consumed );
+
+int parse_uint8(const char * str, uint8_t * num)
+{
+    ASSERT_STR_NOT_NULL( str, -1 );
+
+    return parse_uint8_n( str, strlen( str ), num );
+}
+
+int parse_uint8_n(const char * str, size_t len, uint8_t * num)
+{
+    int         ret;
+    uint64_t    tmp;
+    const number_format_t format = { 10, 0, 0, UINT8_MAX, sizeof( *num ) };
+
+    ASSERT_PTR( str, -1 );
+    ASSERT_PTR( num, -1 );
+
+    ret = parse_number_buffer( str, str + len, str + len, &format, &tmp );
+
+    if ( 0 == ret )
+    {
+        *num = (uint8_t)tmp;
+    }
+
+    return ret;
+}
+
+int parse_int8(const char * str, int8_t * num)
+{
+    ASSERT_STR_NOT_NULL( str, -1 );
+
+    return parse_int8_n( str, strlen( str ), num );
+}
+
+int parse_int8_n(const char * str, size_t len, int8_t * num)
+{
+    int         ret;
+    int64_t     tmp;
+    const number_format_t format = { 10, 1, INT8_MIN, INT8_MAX, sizeof( *num ) };
+
+    ASSERT_PTR( str, -1 );
+    ASSERT_PTR( num, -1 );
+
+    ret = parse_number_buffer( str, str + len, str + len, &format, &tmp );
+
+    if ( 0 == ret )
+    {
+        *num = (int8_t)tmp;
+    }
+
+    return ret;
+}
+
+int parse_hex8(const char * str, uint8_t * hex)
+{
+    ASSERT_STR_NOT_NULL( str, -1 );
+
+    return parse_hex8_n( str, strlen( str ), hex );
+}
+
+int parse_hex8_n(const char * str, size_t len, uint8_t * hex)
+{
+    int         ret;
+    uint64_t    tmp;
+    const number_format_t format = { 16, 0, 0, UINT8_MAX, sizeof( *hex ) };
+
+    ASSERT_PTR( str, -1 );
+    ASSERT_PTR( hex, -1 );
+
+    ret = parse_number_buffer( str, str + len, str + len, &format, &tmp );
+
+    if ( 0 == ret )
+    {
+        *hex = (uint8_t)tmp;
+    }
+
+    return ret;
+}
+
+int parse_uint16(const char * str, uint16_t * num)
+{
+    ASSERT_STR_NOT_NULL( str, -1 );
+
+    return parse_uint16_n( str, strlen( str ), num );
+}
+
+int parse_uint16_n(const char * str, size_t len, uint16_t * num)
+{
+    int         ret;
+    uint64_t    tmp;
+    const number_format_t format = { 10, 0, 0, UINT16_MAX, sizeof( *num ) };
+
+    ASSERT_PTR( str, -1 );
+    ASSERT_PTR( num, -1 );
+
+    ret = parse_number_buffer( str, str + len, str + len, &format, &tmp );
+
+    if ( 0 == ret )
+    {
+        *num = (uint16_t)tmp;
+    }
+
+    return ret;
+}
+
+int parse_int16(const char * str, int16_t * num)
+{
+    ASSERT_STR_NOT_NULL( str, -1 );
+
+    return parse_int16_n( str, strlen( str ), num );
+}
+
+int parse_int16_n(const char * str, size_t len, int16_t * num)
+{
+    int         ret;
+    int64_t     tmp;
+    const number_format_t format = { 10, 1, INT16_MIN, INT16_MAX, sizeof( *num ) };
+
+    ASSERT_PTR( str, -1 );
+    ASSERT_PTR( num, -1 );
+
+    ret = parse_number_buffer( str, str + len, str + len, &format, &tmp );
+
+    if ( 0 == ret )
+    {
+        *num = (int16_t)tmp;
+    }
+
+    return ret;
+}
+
+int parse_hex16(const char * str, uint16_t * hex)
+{
+    ASSERT_STR_NOT_NULL( str, -1 );
+
+    return parse_hex16_n( str, strlen( str ), hex );
+}
+
+int parse_hex16_n(const char * str, size_t len, uint16_t * hex)
+{
+    int         ret;
+    uint64_t    tmp;
+    const number_format_t format = { 16, 0, 0, UINT16_MAX, sizeof( *hex ) };
+
+    ASSERT_PTR( str, -1 );
+    ASSERT_PTR( hex, -1 );
+
+    ret = parse_number_buffer( str, str + len, str + len, &format, &tmp );
+
+    if ( 0 == ret )
+    {
+        *hex = (uint16_t)tmp;
+    }
+
+    return ret;
+}
+
+int parse_uint32(const char * str, uint32_t * num)
+{
+    ASSERT_STR_NOT_NULL( str, -1 );
+
+    return parse_uint32_n( str, strlen( str ), num );
+}
+
+int parse_uint32_n(const char * str, size_t len, uint32_t * num)
+{
+    int         ret;
+    uint64_t    tmp;
+    const number_format_t format = { 10, 0, 0, UINT32_MAX, sizeof( *num ) };
+
+    ASSERT_PTR( str, -1 );
+    ASSERT_PTR( num, -1 );
+
+    ret = parse_number_buffer( str, str + len, str + len, &format, &tmp );
+
+    if ( 0 == ret )
+    {
+        *num = (uint32_t)tmp;
+    }
+
+    return ret;
+}
+
+int parse_int32(const char * str, int32_t * num)
+{
+    ASSERT_STR_NOT_NULL( str, -1 );
+
+    return parse_int32_n( str, strlen( str ), num );
+}
+
+int parse_int32_n(const char * str, size_t len, int32_t * num)
+{
+    int         ret;
+    int64_t     tmp;
+    const number_format_t format = { 10, 1, INT32_MIN, INT32_MAX, sizeof( *num ) };
+
+    ASSERT_PTR( str, -1 );
+    ASSERT_PTR( num, -1 );
+
+    ret = parse_number_buffer( str, str + len, str + len, &format, &tmp );
+
+    if ( 0 == ret )
+    {
+        *num = (int32_t)tmp;
+    }
+
+    return ret;
+}
+
+int parse_hex32(const char * str, uint32_t * hex)
+{
+    ASSERT_STR_NOT_NULL( str, -1 );
+
+    return parse_hex32_n( str, strlen( str ), hex );
+}
+
+int parse_hex32_n(const char * str, size_t len, uint32_t * hex)
+{
+    int         ret;
+    uint64_t    tmp;
+    const number_format_t format = { 16, 0, 0, UINT32_MAX, sizeof( *hex ) };
+
+    ASSERT_PTR( str, -1 );
+    ASSERT_PTR( hex, -1 );
+
+    ret = parse_number_buffer( str, str + len, str + len, &format, &tmp );
+
+    if ( 0 == ret )
+    {
+        *hex = (uint32_t)tmp;
+    }
+
+    return ret;
+}
+
+int parse_uint64(const char * str, uint64_t * num)
+{
+    ASSERT_STR_NOT_NULL( str, -1 );
+
+    return parse_uint64_n( str, strlen( str ), num );
+}
+
+int parse_uint64_n(const char * str, size_t len, uint64_t * num)
+{
+    int         ret;
+    uint64_t    tmp;
+    const number_format_t format = { 10, 0, 0, UINT64_MAX, sizeof( *num ) };
+
+    ASSERT_PTR( str, -1 );
+    ASSERT_PTR( num, -1 );
+
+    ret = parse_number_buffer( str, str + len, str + len, &format, &tmp );
+
+    if ( 0 == ret )
+    {
+        *num = (uint64_t)tmp;
+    }
+
+    return ret;
+}
+
+int parse_int64(const char * str, int64_t * num)
+{
+    ASSERT_STR_NOT_NULL( str, -1 );
+
+    return parse_int64_n( str, strlen( str ), num );
+}
+
+int parse_int64_n(const char * str, size_t len, int64_t * num)
+{
+    int         ret;
+    int64_t     tmp;
+    const number_format_t format = { 10, 1, INT64_MIN, INT64_MAX, sizeof( *num ) };
+
+    ASSERT_PTR( str, -1 );
+    ASSERT_PTR( num, -1 );
+
+    ret = parse_number_buffer( str, str + len, str + len, &format, &tmp );
+
+    if ( 0 == ret )
+    {
+        *num = (int64_t)tmp;
+    }
+
+    return ret;
+}
+
+int parse_hex64(const char * str, uint64_t * hex)
+{
+    ASSERT_STR_NOT_NULL( str, -1 );
+
+    return parse_hex64_n( str, strlen( str ), hex );
+}
+
+int parse_hex64_n(const char * str, size_t len, uint64_t * hex)
+{
+    int         ret;
+    uint64_t    tmp;
+    const number_format_t format = { 16, 0, 0, UINT64_MAX, sizeof( *hex ) };
+
+    ASSERT_PTR( str, -1 );
+    ASSERT_PTR( hex, -1 );
+
+    ret = parse_number_buffer( str, str + len, str + len, &format, &tmp );
+
+    if ( 0 == ret )
+    {
+        *hex = (uint64_t)tmp;
+    }
+
+    return ret;
+}
+
+size_t parse_uint8_array( const char * buf,
+                          size_t len,
+                          char delim,
+                          uint8_t * out,
+                          size_t max_out,
+                          size_t * consumed )
+{
+    const number_format_t format = { 10, 0, 0, UINT8_MAX, sizeof( *out ) };
+
+    return parse_number_array( buf, len, delim, &format, out, max_out, consumed );
+}
+
+size_t parse_int8_array( const char * buf,
+                         size_t len,
+                         char delim,
+                         int8_t * out,
+                         size_t max_out,
+                         size_t * consumed )
+{
+    const number_format_t format = { 10, 1, INT8_MIN, INT8_MAX, sizeof( *out ) };
+
+    return parse_number_array( buf, len, delim, &format, out, max_out, consumed );
+}
+
+size_t parse_hex8_array( const char * buf,
+                         size_t len,
+                         char delim,
+                         uint8_t * out,
+                         size_t max_out,
+                         size_t * consumed )
+{
+    const number_format_t format = { 16, 0, 0, UINT8_MAX, sizeof( *out ) };
+
+    return parse_number_array( buf, len, delim, &format, out, max_out, consumed );
+}
+
+size_t parse_uint16_array( const char * buf,
+                           size_t len,
+                           char delim,
+                           uint16_t * out,
+                           size_t max_out,
+                           size_t * consumed )
+{
+    const number_format_t format = { 10, 0, 0, UINT16_MAX, sizeof( *out ) };
+
+    return parse_number_array( buf, len, delim, &format, out, max_out, consumed );
+}
+
+size_t parse_int16_array( const char * buf,
+                          size_t len,
+                          char delim,
+                          int16_t * out,
+                          size_t max_out,
+                          size_t * consumed )
+{
+    const number_format_t format = { 10, 1, INT16_MIN, INT16_MAX, sizeof( *out ) };
+
+    return parse_number_array( buf, len, delim, &format, out, max_out, consumed );
+}
+
+size_t parse_hex16_array( const char * buf,
+                          size_t len,
+                          char delim,
+                          uint16_t * out,
+                          size_t max_out,
+                          size_t * consumed )
+{
+    const number_format_t format = { 16, 0, 0, UINT16_MAX, sizeof( *out ) };
+
+    return parse_number_array( buf, len, delim, &format, out, max_out, consumed );
+}
+
+size_t parse_uint32_array( const char * buf,
+                           size_t len,
+                           char delim,
+                           uint32_t * out,
+                           size_t max_out,
+                           size_t * consumed )
+{
+    const number_format_t format = { 10, 0, 0, UINT32_MAX, sizeof( *out ) };
+
+    return parse_number_array( buf, len, delim, &format, out, max_out, consumed );
+}
+
+size_t parse_int32_array( const char * buf,
+                          size_t len,
+                          char delim,
+                          int32_t * out,
+                          size_t max_out,
+                          size_t * consumed )
+{
+    const number_format_t format = { 10, 1, INT32_MIN, INT32_MAX, sizeof( *out ) };
+
+    return parse_number_array( buf, len, delim, &format, out, max_out, consumed );
+}
+
+size_t parse_hex32_array( const char * buf,
+                          size_t len,
+                          char delim,
+                          uint32_t * out,
+                          size_t max_out,
+                          size_t * consumed )
+{
+    const number_format_t format = { 16, 0, 0, UINT32_MAX, sizeof( *out ) };
+
+    return parse_number_array( buf, len, delim, &format, out, max_out, consumed );
+}
+
+size_t parse_uint64_array( const char * buf,
+                           size_t len,
+                           char delim,
+                           uint64_t * out,
+                           size_t max_out,
+                           size_t * consumed )
+{
+    const number_format_t format = { 10, 0, 0, UINT64_MAX, sizeof( *out ) };
+
+    return parse_number_array( buf, len, delim, &format, out, max_out, consumed );
+}
+
+size_t parse_int64_array( const char * buf,
+                          size_t len,
+                          char delim,
+                          int64_t * out,
+                          size_t max_out,
+                          size_t * consumed )
+{
+    const number_format_t format = { 10, 1, INT64_MIN, INT64_MAX, sizeof( *out ) };
+
+    return parse_number_array( buf, len, delim, &format, out, max_out, consumed );
+}
+
+size_t parse_hex64_array( const char * buf,
+                          size_t len,
+                          char delim,
+                          uint64_t * out,
+                          size_t max_out,
+                          size_t * consumed )
+{
+    const number_format_t format = { 16, 0, 0, UINT64_MAX, sizeof( *out ) };
+
+    return parse_number_array( buf, len, delim, &format, out, max_out, consumed );
+}
+
+int parse_number_set_isa( parse_number_isa_t isa )
+{
+    int ret = -1;
+
+    switch ( isa )
+    {
+        case PARSE_NUMBER_ISA_SCALAR:
+            __atomic_store_n( &s_parse_number_isa, isa, __ATOMIC_RELEASE );
+            ret = 0;
+        break;
+#ifdef HAVE_PARSE_NUMBER_SSE42
+        case PARSE_NUMBER_ISA_SSE42:
+            if ( __builtin_cpu_supports( "sse4.2" ) )
+            {
+                __atomic_store_n( &s_parse_number_isa, isa, __ATOMIC_RELEASE );
+                ret = 0;
+            }
+        break;
+#endif
+        default:
+            ret = -1;
+        break;
+    }
+
+    return ret;
+}
+
+parse_number_isa_t parse_number_get_isa( void )
+{
+    return get_parse_number_isa();
+}
+
+parse_number_isa_t get_parse_number_isa( void )
+{
+    int isa = __atomic_load_n( &s_parse_number_isa, __ATOMIC_ACQUIRE );
+
+    if ( isa < 0 )
+    {
+        /* Threads racing here select the same instruction set */
+        if ( 0 != parse_number_set_isa( PARSE_NUMBER_ISA_SSE42 ) )
+        {
+            parse_number_set_isa( PARSE_NUMBER_ISA_SCALAR );
+        }
+        isa = __atomic_load_n( &s_parse_number_isa, __ATOMIC_ACQUIRE );
+    }
+
+    return (parse_number_isa_t)isa;
+}
+
+#ifdef HAVE_PARSE_NUMBER_SSE42
+__attribute__(( target( "sse4.2" ) ))
+unsigned int parse_16_digits_sse42( const char * p,
+                                    const char * end,
+                                    const char * rend,
+                                    uint64_t * value )
+{
+    __m128i         chunk;
+    __m128i         digits;
+    unsigned int    mask;
+    unsigned int    nb_digits;
+
+    if ( ( rend - p ) >= 16 )
+    {
+        chunk = _mm_loadu_si128( (const __m128i *)p );
+    }
+    else
+    {
+        /* Upper 8 bytes are 0, so they are not digits */
+        chunk = _mm_loadl_epi64( (const __m128i *)p );
+    }
+
+    /* A byte is a digit if ( byte - '0' ) <= 9 as unsigned */
+    digits = _mm_sub_epi8( chunk, _mm_set1_epi8( '0' ) );
+    mask = _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_min_epu8( digits,
+                                                          _mm_set1_epi8( 9 ) ),
+                                              digits ) );
+    nb_digits = __builtin_ctz( ~mask );
+    if ( nb_digits > (unsigned int)( end - p ) )
+    {
+        nb_digits = end - p;
+    }
+
+    /* Move digits at the end of register (leading bytes are 0) */
+    digits = _mm_shuffle_epi8( digits,
+            _mm_loadu_si128( (const __m128i *)&s_shift_digits_mask[nb_digits] ) );
+
+    /* 16 x 1 digit -> 8 x 2 digits -> 4 x 4 digits -> 2 x 8 digits */
+    digits = _mm_maddubs_epi16( digits, _mm_setr_epi8( 10, 1, 10, 1, 10, 1, 10, 1,
+                                                       10, 1, 10, 1, 10, 1, 10, 1 ) );
+    digits = _mm_madd_epi16( digits, _mm_setr_epi16( 100, 1, 100, 1,
+                                                     100, 1, 100, 1 ) );
+    digits = _mm_packus_epi32( digits, digits );
+    digits = _mm_madd_epi16( digits, _mm_setr_epi16( 10000, 1, 10000, 1,
+                                                     10000, 1, 10000, 1 ) );
+
+    *value = (uint64_t)(uint32_t)_mm_cvtsi128_si32( digits ) * 100000000 +
+             (uint32_t)_mm_extract_epi32( digits, 1 );
+
+    return nb_digits;
+}
+#endif
+
+const char * parse_decimal_digits( const char * p,
+                                  const char * end,
+                                  const char * rend,
+                                  uint64_t * value )
+{
+    uint64_t        tmp = 0;
+    unsigned int    digit;
+    unsigned int    nb_digits = 0;
+    const char *    last;
+
+    /* Leading zeros do not count in the 20 digits of UINT64_MAX */
+    while ( ( p < end ) && ( '0' == *p ) )
+    {
+        p++;
+    }
+
+#ifdef HAVE_PARSE_NUMBER_SSE42
+    if ( ( ( rend - p ) >= 8 ) &&
+         ( PARSE_NUMBER_ISA_SSE42 == get_parse_number_isa() ) )
+    {
+        /* Remaining digits (if any) are converted by scalar code */
+        nb_digits = parse_16_digits_sse42( p, end, rend, &tmp );
+        p += nb_digits;
+    }
+#endif
+
+    /* 19 digits can not overflow uint64_t */
+    last = ( ( end - p ) > ( 19 - nb_digits ) ) ? p + ( 19 - nb_digits ) : end;
+    while ( p < last )
+    {
+        digit = (unsigned char)*p - '0';
+        if ( digit > 9 )
+        {
+            break;
+        }
+        tmp = tmp * 10 + digit;
+        p++;
+    }
+
+    if ( ( p == last ) && ( p < end ) )
+    {
+        digit = (unsigned char)*p - '0';
+        if ( digit <= 9 )
+        {
+            if ( ( tmp > UINT64_MAX / 10 ) ||
+                 ( ( tmp == UINT64_MAX / 10 ) && ( digit > UINT64_MAX % 10 ) ) )
+            {
+                return NULL;
+            }
+            tmp = tmp * 10 + digit;
+            p++;
+
+            if ( ( p < end ) && ( (unsigned char)( *p - '0' ) <= 9 ) )
+            {
+                return NULL;
+            }
+        }
+    }
+
+    *value = tmp;
+
+    return p;
+}
+
+const char * parse_hex_digits( const char * p,
+                              const char * end,
+                              uint64_t * value )
+{
+    uint64_t        tmp = 0;
+    unsigned int    digit;
+    unsigned int    nb_digits = 0;
+
+    /* Leading zeros do not count in the 16 digits of UINT64_MAX */
+    while ( ( p < end ) && ( '0' == *p ) )
+    {
+        p++;
+    }
+
+    while ( p < end )
+    {
+        if ( ( *p >= '0' ) && ( *p <= '9' ) )
+        {
+            digit = *p - '0';
+        }
+        else if ( ( ( *p | 0x20 ) >= 'a' ) && ( ( *p | 0x20 ) <= 'f' ) )
+        {
+            digit = ( *p | 0x20 ) - 'a' + 10;
+        }
+        else
+        {
+            break;
+        }
+
+        if ( 16 == nb_digits )
+        {
+            return NULL;
+        }
+
+        tmp = ( tmp << 4 ) | digit;
+        nb_digits++;
+        p++;
+    }
+
+    *value = tmp;
+
+    return p;
+}
+
+int parse_number_buffer( const char * begin,
+                         const char * end,
+                         const char * rend,
+                         const number_format_t * format,
+                         void * number )
+{
+    const char *    p = begin;
+    const char *    digits;
+    int             negative = 0;
+    uint64_t        limit;
+    uint64_t        tmp;
+
+    /* Same white spaces as isspace() in "C" locale */
+    while ( ( p < end ) && ( ( ' ' == *p ) || ( ( *p >= '\t' ) && ( *p <= '\r' ) ) ) )
+    {
+        p++;
+    }
+
+    if ( ( p < end ) && ( ( '+' == *p ) || ( '-' == *p ) ) )
+    {
+        negative = ( '-' == *p );
+        p++;
+    }
+
+    digits = p;
+    if ( 10 == format->base )
+    {
+        p = parse_decimal_digits( p, end, rend, &tmp );
+    }
+    else
+    {
+        /* strtoul only skips 0x prefix when followed by an hexadecimal digit */
+        if ( ( ( end - p ) > 2 ) && ( '0' == p[0] ) && ( 'x' == ( p[1] | 0x20 ) ) &&
+             ( ( ( p[2] >= '0' ) && ( p[2] <= '9' ) ) ||
+               ( ( ( p[2] | 0x20 ) >= 'a' ) && ( ( p[2] | 0x20 ) <= 'f' ) ) ) )
+        {
+            p += 2;
+            digits = p;
+        }
+        p = parse_hex_digits( p, end, &tmp );
+    }
+
+    if ( ( ! p ) || ( p != end ) || ( p == digits ) )
+    {
+        return -1;
+    }
+
+    if ( format->is_signed && negative )
+    {
+        limit = (uint64_t)( -( format->min + 1 ) ) + 1;
+    }
+    else
+    {
+        limit = format->max;
+    }
+
+    if ( tmp > limit )
+    {
+        return -1;
+    }
+
+    if ( ! format->is_signed )
+    {
+        /* Only "-0" is a valid negative unsigned number */
+        if ( negative && ( 0 != tmp ) )
+        {
+            return -1;
+        }
+
+        *(uint64_t *)number = tmp;
+    }
+    else if ( negative && ( 0 != tmp ) )
+    {
+        *(int64_t *)number = -(int64_t)( tmp - 1 ) - 1;
+    }
+    else
+    {
+        *(int64_t *)number = (int64_t)tmp;
+    }
+
+    return 0;
+}
+
+size_t parse_number_array( const char * buf,
+                           size_t len,
+                           char delim,
+                           const number_format_t * format,
+                           void * out,
+                           size_t max_out,
+                           size_t * consumed )
+{
+    const char *    p = buf;
+    const char *    end = buf + len;
+    const char *    token_end;
+    size_t          nb = 0;
+    union
+    {
+        uint64_t    u;
+        int64_t     i;
+    } value;
+
+    ASSERT_PTR( consumed, 0 );
+    *consumed = 0;
+    ASSERT_PTR( buf, 0 );
+    ASSERT_PTR( out, 0 );
+
+    while ( ( p < end ) && ( nb < max_out ) )
+    {
+        token_end = memchr( p, delim, end - p );
+        if ( ! token_end )
+        {
+            token_end = end;
+        }
+
+        if ( 0 != parse_number_buffer( p, token_end, end, format, &value ) )
+        {
+            break;
+        }
+
+        switch ( format->size )
+        {
+            case sizeof( uint8_t ):
+                ( (uint8_t *)out )[nb] = (uint8_t)value.u;
+            break;
+            case sizeof( uint16_t ):
+                ( (uint16_t *)out )[nb] = (uint16_t)value.u;
+            break;
+            case sizeof( uint32_t ):
+                ( (uint32_t *)out )[nb] = (uint32_t)value.u;
+            break;
+            default:
+                ( (uint64_t *)out )[nb] = value.u;
+            break;
+        }
+        nb++;
+
+        p = ( token_end < end ) ? token_end + 1 : end;
+    }
+
+    *consumed = p - buf;
+
+    return nb;
+}
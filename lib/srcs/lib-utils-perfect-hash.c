@@ -0,0 +1,445 @@
+/*!
+ * @file: lib-utils-perfect-hash.c
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of perfect hash of a static set of strings.
+ *
+ * Keys are dispatched into buckets (about 4 keys per bucket) by their hash.
+ * Buckets are placed from the largest to the smallest: for each bucket, the
+ * first displacement d which sends all its keys to free slots is stored. The
+ * slot of a key is ( f1 + d * f2 ) modulo number of slots, where f1 and f2
+ * (odd) are taken from its hash: as the number of slots is a power of 2, the
+ * displacements of a bucket visit all slots. When a bucket cannot be placed,
+ * the construction restarts with another seed, then with twice more slots
+ * when no seed works (dense tables of a few keys).
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "lib-utils-assert.h"
+#include "lib-utils-hash.h"
+#include "lib-utils-perfect-hash.h"
+
+/*!
+ * @brief Average number of keys per bucket.
+ */
+#define KEYS_PER_BUCKET     ( 4 )
+
+/*!
+ * @brief Number of seeds tried before construction fails.
+ */
+#define MAX_SEEDS           ( 16 )
+
+/*!
+ * @brief Number of times the number of slots is doubled before construction
+ *        fails.
+ */
+#define MAX_GROWTHS         ( 6 )
+
+/*!
+ * @brief Seed of first construction attempt.
+ */
+#define FIRST_SEED          ( 0x9e3779b97f4a7c15ULL )
+
+/*!
+ * @brief Return value of build_table when keys are duplicated.
+ */
+#define DUPLICATED_KEYS     ( -2 )
+
+/*!
+ * @struct perfect_hash_slot_t
+ * @brief Slot of perfect hash.
+ */
+typedef struct perfect_hash_slot_t
+{
+    uint32_t    index;      /*!< Index of record plus one (0 if empty). */
+    uint32_t    len;        /*!< Length of key. */
+} perfect_hash_slot_t;
+
+struct perfect_hash_t
+{
+    const char *            keys;           /*!< Address of first key. */
+    size_t                  stride;         /*!< Size of a record. */
+    size_t                  count;          /*!< Number of keys. */
+    uint64_t                seed;           /*!< Seed of key hashes. */
+    size_t                  bucket_mask;    /*!< Number of buckets - 1. */
+    size_t                  slot_mask;      /*!< Number of slots - 1. */
+    uint32_t *              displacements;  /*!< Displacement of buckets. */
+    perfect_hash_slot_t *   slots;          /*!< Slots. */
+};
+
+/*!
+ * @struct perfect_hash_build_t
+ * @brief Working buffers of construction.
+ */
+typedef struct perfect_hash_build_t
+{
+    uint64_t *  hashes;     /*!< Hash of keys (by record). */
+    uint32_t *  lengths;    /*!< Length of keys (by record). */
+    uint32_t *  records;    /*!< Records grouped by bucket. */
+    size_t *    starts;     /*!< First record of buckets in records. */
+    uint64_t *  order;      /*!< Buckets by decreasing size (size << 32 |
+                                 bucket). */
+} perfect_hash_build_t;
+
+/*!
+ * @brief Return key of record.
+ * @param hash      Perfect hash.
+ * @param index     Index of record.
+ * @return The key (can be NULL).
+ */
+static inline const char * get_key( const perfect_hash_t * hash, size_t index );
+
+/*!
+ * @brief Return slot of key.
+ * @param hash          Perfect hash.
+ * @param key_hash      Hash of key.
+ * @param displacement  Displacement of bucket of key.
+ * @return The index of slot.
+ */
+static inline size_t get_slot( const perfect_hash_t * hash,
+                               uint64_t key_hash,
+                               uint32_t displacement );
+
+/*!
+ * @brief Return smallest power of 2 greater or equal to value.
+ * @param value     Value (lower or equal to SIZE_MAX / 2).
+ * @return The power of 2.
+ */
+static size_t round_up_power_of_2( size_t value );
+
+/*!
+ * @brief Sort buckets by decreasing size (qsort callback).
+ * @param a     First bucket.
+ * @param b     Second bucket.
+ * @return Comparison result.
+ */
+static int compare_buckets( const void * a, const void * b );
+
+/*!
+ * @brief Try to place all keys with seed of perfect hash.
+ * @param hash      Perfect hash (seed set, slots and displacements are
+ *                  overwritten).
+ * @param build     Working buffers (lengths filled).
+ * @return 0 on success, DUPLICATED_KEYS if two keys are equal otherwise -1.
+ */
+static int build_table( perfect_hash_t * hash, perfect_hash_build_t * build );
+
+/*!
+ * @brief Find first displacement which sends all keys of bucket to free
+ *        slots and mark these slots.
+ * @param hash      Perfect hash.
+ * @param build     Working buffers.
+ * @param records   Records of bucket.
+ * @param size      Number of records of bucket.
+ * @return The displacement plus one on success otherwise 0.
+ */
+static uint64_t place_bucket( perfect_hash_t * hash,
+                              const perfect_hash_build_t * build,
+                              const uint32_t * records,
+                              size_t size );
+
+perfect_hash_t * perfect_hash_create( const char * const * keys,
+                                      size_t nb_keys,
+                                      size_t stride )
+{
+    perfect_hash_t *        hash = NULL;
+    perfect_hash_build_t    build;
+    size_t                  nb_buckets;
+    size_t                  nb_slots;
+    size_t                  count = 0;
+    size_t                  len;
+    size_t                  growth;
+    size_t                  i;
+    int                     status = -1;
+    int                     ret = 0;
+
+    ASSERT_PTR( keys, NULL );
+    if ( ( stride < sizeof( const char * ) ) || ( nb_keys >= UINT32_MAX ) ||
+         ( nb_keys > SIZE_MAX / stride ) )
+    {
+        return NULL;
+    }
+
+    for ( i = 0; i < nb_keys; i++ )
+    {
+        count += ( NULL != *(const char * const *)( (const char *)keys + i * stride ) );
+    }
+    nb_buckets = round_up_power_of_2( ( count + KEYS_PER_BUCKET - 1 ) / KEYS_PER_BUCKET );
+    nb_slots = round_up_power_of_2( count + count / 4 );
+
+    build.hashes = malloc( nb_keys * sizeof( *build.hashes ) + 1 );
+    build.lengths = malloc( nb_keys * sizeof( *build.lengths ) + 1 );
+    build.records = malloc( count * sizeof( *build.records ) + 1 );
+    build.starts = malloc( ( nb_buckets + 1 ) * sizeof( *build.starts ) );
+    build.order = malloc( nb_buckets * sizeof( *build.order ) );
+    if ( ! ( build.hashes && build.lengths && build.records &&
+             build.starts && build.order ) )
+    {
+        ret = -1;
+    }
+
+    for ( i = 0; ( i < nb_keys ) && ( 0 == ret ); i++ )
+    {
+        len = *(const char * const *)( (const char *)keys + i * stride ) ?
+              strlen( *(const char * const *)( (const char *)keys + i * stride ) ) : 0;
+        build.lengths[i] = (uint32_t)len;
+        ret = ( len < UINT32_MAX ) ? 0 : -1;
+    }
+
+    /* No seed places all keys: a table less dense gives more free slots to
+       last buckets */
+    for ( growth = 0; ( growth <= MAX_GROWTHS ) && ( 0 == ret ) && ( -1 == status ); growth++ )
+    {
+        free( hash );
+        hash = malloc( sizeof( *hash ) +
+                       nb_buckets * sizeof( *hash->displacements ) +
+                       ( nb_slots << growth ) * sizeof( *hash->slots ) );
+        if ( ! hash )
+        {
+            ret = -1;
+            break;
+        }
+
+        /* Slots first: aligned after structure */
+        hash->keys = (const char *)keys;
+        hash->stride = stride;
+        hash->count = count;
+        hash->bucket_mask = nb_buckets - 1;
+        hash->slot_mask = ( nb_slots << growth ) - 1;
+        hash->slots = (perfect_hash_slot_t *)( hash + 1 );
+        hash->displacements = (uint32_t *)( hash->slots + ( nb_slots << growth ) );
+
+        for ( i = 0; i < MAX_SEEDS; i++ )
+        {
+            hash->seed = FIRST_SEED * ( i + 1 );
+            status = build_table( hash, &build );
+            /* Duplicated keys cannot be placed with any seed */
+            if ( -1 != status )
+            {
+                break;
+            }
+        }
+    }
+    ret = ( ( 0 == ret ) && ( 0 == status ) ) ? 0 : -1;
+
+    free( build.hashes );
+    free( build.lengths );
+    free( build.records );
+    free( build.starts );
+    free( build.order );
+
+    if ( 0 != ret )
+    {
+        free( hash );
+        hash = NULL;
+    }
+
+    return hash;
+}
+
+void perfect_hash_destroy( perfect_hash_t * hash )
+{
+    free( hash );
+}
+
+size_t perfect_hash_lookup_n( const perfect_hash_t * hash,
+                              const char * key,
+                              size_t len )
+{
+    const perfect_hash_slot_t * slot;
+    uint64_t                    key_hash;
+
+    ASSERT_PTR( hash, PERFECT_HASH_NOT_FOUND );
+    ASSERT_PTR( key, PERFECT_HASH_NOT_FOUND );
+
+    key_hash = hash_buffer_seed( key, len, hash->seed );
+    slot = &hash->slots[get_slot( hash,
+                                  key_hash,
+                                  hash->displacements[key_hash & hash->bucket_mask] )];
+
+    /* Slot is empty (index 0) or holds the only key which can match */
+    if ( ( slot->len != len ) || ( 0 == slot->index ) ||
+         ( 0 != memcmp( get_key( hash, slot->index - 1 ), key, len ) ) )
+    {
+        return PERFECT_HASH_NOT_FOUND;
+    }
+
+    return slot->index - 1;
+}
+
+size_t perfect_hash_lookup( const perfect_hash_t * hash, const char * key )
+{
+    ASSERT_PTR( key, PERFECT_HASH_NOT_FOUND );
+
+    return perfect_hash_lookup_n( hash, key, strlen( key ) );
+}
+
+size_t perfect_hash_get_count( const perfect_hash_t * hash )
+{
+    ASSERT_PTR( hash, 0 );
+
+    return hash->count;
+}
+
+const char * get_key( const perfect_hash_t * hash, size_t index )
+{
+    return *(const char * const *)( hash->keys + index * hash->stride );
+}
+
+size_t get_slot( const perfect_hash_t * hash,
+                 uint64_t key_hash,
+                 uint32_t displacement )
+{
+    size_t f1 = (size_t)( key_hash >> 32 );
+    size_t f2 = (size_t)( key_hash >> 16 ) | 1;
+
+    return ( f1 + displacement * f2 ) & hash->slot_mask;
+}
+
+size_t round_up_power_of_2( size_t value )
+{
+    size_t power = 1;
+
+    while ( power < value )
+    {
+        power <<= 1;
+    }
+
+    return power;
+}
+
+int compare_buckets( const void * a, const void * b )
+{
+    uint64_t bucket_a = *(const uint64_t *)a;
+    uint64_t bucket_b = *(const uint64_t *)b;
+
+    return ( bucket_a < bucket_b ) - ( bucket_a > bucket_b );
+}
+
+int build_table( perfect_hash_t * hash, perfect_hash_build_t * build )
+{
+    size_t      nb_buckets = hash->bucket_mask + 1;
+    size_t      nb_records = 0;
+    size_t      bucket;
+    size_t      size;
+    size_t      i;
+    size_t      j;
+    size_t      k;
+    uint64_t    displacement;
+    const char * key;
+
+    memset( hash->slots, 0, ( hash->slot_mask + 1 ) * sizeof( *hash->slots ) );
+    memset( hash->displacements, 0, nb_buckets * sizeof( *hash->displacements ) );
+    memset( build->starts, 0, ( nb_buckets + 1 ) * sizeof( *build->starts ) );
+
+    /* Group records by bucket (counting sort) */
+    for ( i = 0; nb_records < hash->count; i++ )
+    {
+        key = get_key( hash, i );
+        if ( key )
+        {
+            build->hashes[i] = hash_buffer_seed( key, build->lengths[i], hash->seed );
+            build->starts[( build->hashes[i] & hash->bucket_mask ) + 1]++;
+            nb_records++;
+        }
+    }
+    for ( bucket = 0; bucket < nb_buckets; bucket++ )
+    {
+        build->order[bucket] = ( (uint64_t)build->starts[bucket + 1] << 32 ) | bucket;
+        build->starts[bucket + 1] += build->starts[bucket];
+    }
+    for ( i = 0, nb_records = 0; nb_records < hash->count; i++ )
+    {
+        if ( get_key( hash, i ) )
+        {
+            bucket = build->hashes[i] & hash->bucket_mask;
+            build->records[build->starts[bucket]++] = (uint32_t)i;
+            nb_records++;
+        }
+    }
+    /* starts now holds ends of buckets: shift back */
+    memmove( build->starts + 1, build->starts, nb_buckets * sizeof( *build->starts ) );
+    build->starts[0] = 0;
+
+    /* Largest buckets first: they have the most constraints */
+    qsort( build->order, nb_buckets, sizeof( *build->order ), compare_buckets );
+
+    for ( i = 0; i < nb_buckets; i++ )
+    {
+        bucket = (size_t)( build->order[i] & UINT32_MAX );
+        size = (size_t)( build->order[i] >> 32 );
+        if ( 0 == size )
+        {
+            break;
+        }
+
+        for ( j = 0; j < size; j++ )
+        {
+            for ( k = j + 1; k < size; k++ )
+            {
+                uint32_t r1 = build->records[build->starts[bucket] + j];
+                uint32_t r2 = build->records[build->starts[bucket] + k];
+
+                if ( ( build->hashes[r1] == build->hashes[r2] ) &&
+                     ( build->lengths[r1] == build->lengths[r2] ) &&
+                     ( 0 == memcmp( get_key( hash, r1 ), get_key( hash, r2 ), build->lengths[r1] ) ) )
+                {
+                    return DUPLICATED_KEYS;
+                }
+            }
+        }
+
+        displacement = place_bucket( hash, build, &build->records[build->starts[bucket]], size );
+        if ( 0 == displacement )
+        {
+            return -1;
+        }
+        hash->displacements[bucket] = (uint32_t)( displacement - 1 );
+    }
+
+    return 0;
+}
+
+uint64_t place_bucket( perfect_hash_t * hash,
+                       const perfect_hash_build_t * build,
+                       const uint32_t * records,
+                       size_t size )
+{
+    size_t      nb_slots = hash->slot_mask + 1;
+    size_t      slot;
+    size_t      i;
+    size_t      j;
+    uint64_t    displacement;
+
+    for ( displacement = 0;
+          ( displacement < nb_slots ) && ( displacement < UINT32_MAX );
+          displacement++ )
+    {
+        for ( i = 0; i < size; i++ )
+        {
+            slot = get_slot( hash, build->hashes[records[i]], (uint32_t)displacement );
+            if ( 0 != hash->slots[slot].index )
+            {
+                break;
+            }
+            hash->slots[slot].index = records[i] + 1;
+            hash->slots[slot].len = build->lengths[records[i]];
+        }
+
+        if ( i == size )
+        {
+            return displacement + 1;
+        }
+
+        /* Release slots taken by this attempt */
+        for ( j = 0; j < i; j++ )
+        {
+            slot = get_slot( hash, build->hashes[records[j]], (uint32_t)displacement );
+            hash->slots[slot].index = 0;
+            hash->slots[slot].len = 0;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,1008 @@
+/*!
+ * @file: lib-utils-search.c
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of functions to search bytes and strings in buffers.
+ *
+ * Vectorized byte scans compare 16 (SSSE3) or 32 (AVX2) bytes per step. Sets
+ * of bytes are tested with two nibble lookups (pshufb): the low nibble of a
+ * byte selects a bitmap of high nibbles in table[0] (bytes < 0x80) or
+ * table[1] (bytes >= 0x80). Substring search filters candidates on first and
+ * last bytes of needle and switches to Two-Way (linear worst case) when
+ * filtering produces too many false candidates.
+ */
+#include <stdint.h>
+#include <string.h>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <immintrin.h>
+
+/*!
+ * @brief SSSE3 and AVX2 implementations are available for this target.
+ */
+#define HAVE_SEARCH_X86 1
+#endif
+
+#include "lib-utils-assert.h"
+#include "lib-utils-search.h"
+
+/*!
+ * @brief Number of compared bytes allowed to filter candidates of substring
+ *        search before switching to Two-Way (in addition to a quarter of
+ *        scanned bytes).
+ */
+#define SUBSTRING_VERIFY_BUDGET     ( 4096 )
+
+/*!
+ * @struct search_impl_t
+ * @brief Implementation of search functions for an instruction set.
+ */
+typedef struct search_impl_t
+{
+    /*! Search first occurrence of c1, c2 or c3. */
+    const char * ( *bytes )( const char * buf,
+                             size_t len,
+                             uint8_t c1,
+                             uint8_t c2,
+                             uint8_t c3 );
+    /*! Search first byte in set (or not in set if negate is not 0). */
+    const char * ( *set )( const char * buf,
+                           size_t len,
+                           const search_set_t * set,
+                           int negate );
+    /*! Search needle (2 <= needle_len <= len). */
+    const char * ( *substring )( const char * buf,
+                                 size_t len,
+                                 const char * needle,
+                                 size_t needle_len );
+} search_impl_t;
+
+/*!
+ * @brief Search first occurrence of c1, c2 or c3 (portable C).
+ * @param buf   Buffer to search in.
+ * @param len   Length of buffer in bytes.
+ * @param c1    First byte to search.
+ * @param c2    Second byte to search.
+ * @param c3    Third byte to search.
+ * @return Pointer on first occurrence on success otherwise NULL.
+ */
+static const char * search_bytes_scalar( const char * buf,
+                                         size_t len,
+                                         uint8_t c1,
+                                         uint8_t c2,
+                                         uint8_t c3 );
+
+/*!
+ * @brief Search first byte in set or not in set (portable C).
+ * @param buf       Buffer to search in.
+ * @param len       Length of buffer in bytes.
+ * @param set       Set of bytes.
+ * @param negate    0 to search a byte in set, 1 a byte not in set.
+ * @return Pointer on first byte found on success otherwise NULL.
+ */
+static const char * search_set_scalar( const char * buf,
+                                       size_t len,
+                                       const search_set_t * set,
+                                       int negate );
+
+/*!
+ * @brief Search needle with Two-Way algorithm (Crochemore-Perrin, linear
+ *        worst case, constant space).
+ * @param buf           Buffer to search in.
+ * @param len           Length of buffer in bytes.
+ * @param needle        Substring to search.
+ * @param needle_len    Length of substring (2 <= needle_len).
+ * @return Pointer on first occurrence on success otherwise NULL.
+ */
+static const char * search_substring_scalar( const char * buf,
+                                             size_t len,
+                                             const char * needle,
+                                             size_t needle_len );
+
+#ifdef HAVE_SEARCH_X86
+/*!
+ * @brief Search first occurrence of c1, c2 or c3 with SSSE3.
+ * @param buf   Buffer to search in.
+ * @param len   Length of buffer in bytes.
+ * @param c1    First byte to search.
+ * @param c2    Second byte to search.
+ * @param c3    Third byte to search.
+ * @return Pointer on first occurrence on success otherwise NULL.
+ */
+static const char * search_bytes_ssse3( const char * buf,
+                                        size_t len,
+                                        uint8_t c1,
+                                        uint8_t c2,
+                                        uint8_t c3 );
+
+/*!
+ * @brief Search first byte in set or not in set with SSSE3.
+ * @param buf       Buffer to search in.
+ * @param len       Length of buffer in bytes.
+ * @param set       Set of bytes.
+ * @param negate    0 to search a byte in set, 1 a byte not in set.
+ * @return Pointer on first byte found on success otherwise NULL.
+ */
+static const char * search_set_ssse3( const char * buf,
+                                      size_t len,
+                                      const search_set_t * set,
+                                      int negate );
+
+/*!
+ * @brief Search needle with SSSE3 first and last bytes filtering.
+ * @param buf           Buffer to search in.
+ * @param len           Length of buffer in bytes.
+ * @param needle        Substring to search.
+ * @param needle_len    Length of substring (2 <= needle_len <= len).
+ * @return Pointer on first occurrence on success otherwise NULL.
+ */
+static const char * search_substring_ssse3( const char * buf,
+                                            size_t len,
+                                            const char * needle,
+                                            size_t needle_len );
+
+/*!
+ * @brief Search first occurrence of c1, c2 or c3 with AVX2.
+ * @param buf   Buffer to search in.
+ * @param len   Length of buffer in bytes.
+ * @param c1    First byte to search.
+ * @param c2    Second byte to search.
+ * @param c3    Third byte to search.
+ * @return Pointer on first occurrence on success otherwise NULL.
+ */
+static const char * search_bytes_avx2( const char * buf,
+                                       size_t len,
+                                       uint8_t c1,
+                                       uint8_t c2,
+                                       uint8_t c3 );
+
+/*!
+ * @brief Search first byte in set or not in set with AVX2.
+ * @param buf       Buffer to search in.
+ * @param len       Length of buffer in bytes.
+ * @param set       Set of bytes.
+ * @param negate    0 to search a byte in set, 1 a byte not in set.
+ * @return Pointer on first byte found on success otherwise NULL.
+ */
+static const char * search_set_avx2( const char * buf,
+                                     size_t len,
+                                     const search_set_t * set,
+                                     int negate );
+
+/*!
+ * @brief Search needle with AVX2 first and last bytes filtering.
+ * @param buf           Buffer to search in.
+ * @param len           Length of buffer in bytes.
+ * @param needle        Substring to search.
+ * @param needle_len    Length of substring (2 <= needle_len <= len).
+ * @return Pointer on first occurrence on success otherwise NULL.
+ */
+static const char * search_substring_avx2( const char * buf,
+                                           size_t len,
+                                           const char * needle,
+                                           size_t needle_len );
+#endif
+
+/*!
+ * @brief Implementations indexed by instruction set.
+ */
+static const search_impl_t s_search_impls[] =
+{
+    [SEARCH_ISA_SCALAR] =
+    {
+        search_bytes_scalar, search_set_scalar, search_substring_scalar
+    },
+#ifdef HAVE_SEARCH_X86
+    [SEARCH_ISA_SSSE3] =
+    {
+        search_bytes_ssse3, search_set_ssse3, search_substring_ssse3
+    },
+    [SEARCH_ISA_AVX2] =
+    {
+        search_bytes_avx2, search_set_avx2, search_substring_avx2
+    },
+#endif
+};
+
+/*!
+ * @brief Implementation used by search functions (NULL until first use,
+ *        accessed atomically: first calls can run concurrently).
+ */
+static const search_impl_t * s_search_impl = NULL;
+
+/*!
+ * @brief Return implementation used by search functions (select it on first
+ *        call).
+ * @return The implementation.
+ */
+static inline const search_impl_t * get_search_impl( void );
+
+int search_set_isa( search_isa_t isa )
+{
+    int ret = -1;
+
+    switch ( isa )
+    {
+        case SEARCH_ISA_SCALAR:
+            ret = 0;
+        break;
+#ifdef HAVE_SEARCH_X86
+        case SEARCH_ISA_SSSE3:
+            ret = __builtin_cpu_supports( "ssse3" ) ? 0 : -1;
+        break;
+        case SEARCH_ISA_AVX2:
+            ret = __builtin_cpu_supports( "avx2" ) ? 0 : -1;
+        break;
+#endif
+        default:
+            ret = -1;
+        break;
+    }
+
+    if ( 0 == ret )
+    {
+        __atomic_store_n( &s_search_impl, &s_search_impls[isa], __ATOMIC_RELEASE );
+    }
+
+    return ret;
+}
+
+search_isa_t search_get_isa( void )
+{
+    return (search_isa_t)( get_search_impl() - s_search_impls );
+}
+
+const char * search_byte( const char * buf, size_t len, char c )
+{
+    ASSERT_PTR( buf, NULL );
+
+    return get_search_impl()->bytes( buf, len, (uint8_t)c, (uint8_t)c, (uint8_t)c );
+}
+
+const char * search_byte2( const char * buf, size_t len, char c1, char c2 )
+{
+    ASSERT_PTR( buf, NULL );
+
+    return get_search_impl()->bytes( buf, len, (uint8_t)c1, (uint8_t)c2, (uint8_t)c2 );
+}
+
+const char * search_byte3( const char * buf,
+                           size_t len,
+                           char c1,
+                           char c2,
+                           char c3 )
+{
+    ASSERT_PTR( buf, NULL );
+
+    return get_search_impl()->bytes( buf, len, (uint8_t)c1, (uint8_t)c2, (uint8_t)c3 );
+}
+
+int search_set_init( search_set_t * set, const char * chars, size_t nb_chars )
+{
+    uint8_t b;
+    size_t i;
+
+    ASSERT_PTR( set, -1 );
+    if ( nb_chars > 0 )
+    {
+        ASSERT_PTR( chars, -1 );
+    }
+
+    memset( set, 0, sizeof( *set ) );
+    for ( i = 0; i < nb_chars; i++ )
+    {
+        b = (uint8_t)chars[i];
+        set->table[b >> 7][b & 0x0F] |= (uint8_t)( 1u << ( ( b >> 4 ) & 7 ) );
+    }
+
+    return 0;
+}
+
+int search_set_add_range( search_set_t * set, char first, char last )
+{
+    unsigned int b;
+
+    ASSERT_PTR( set, -1 );
+
+    if ( (uint8_t)first > (uint8_t)last )
+    {
+        return -1;
+    }
+
+    for ( b = (uint8_t)first; b <= (uint8_t)last; b++ )
+    {
+        set->table[b >> 7][b & 0x0F] |= (uint8_t)( 1u << ( ( b >> 4 ) & 7 ) );
+    }
+
+    return 0;
+}
+
+const char * search_any_of( const char * buf,
+                            size_t len,
+                            const search_set_t * set )
+{
+    ASSERT_PTR( buf, NULL );
+    ASSERT_PTR( set, NULL );
+
+    return get_search_impl()->set( buf, len, set, 0 );
+}
+
+const char * search_none_of( const char * buf,
+                             size_t len,
+                             const search_set_t * set )
+{
+    ASSERT_PTR( buf, NULL );
+    ASSERT_PTR( set, NULL );
+
+    return get_search_impl()->set( buf, len, set, 1 );
+}
+
+const char * search_substring( const char * buf,
+                               size_t len,
+                               const char * needle,
+                               size_t needle_len )
+{
+    const search_impl_t * impl;
+
+    ASSERT_PTR( buf, NULL );
+    ASSERT_PTR( needle, NULL );
+
+    if ( 0 == needle_len )
+    {
+        return buf;
+    }
+    else if ( needle_len > len )
+    {
+        return NULL;
+    }
+
+    impl = get_search_impl();
+    if ( 1 == needle_len )
+    {
+        return impl->bytes( buf, len, (uint8_t)needle[0], (uint8_t)needle[0],
+                            (uint8_t)needle[0] );
+    }
+
+    return impl->substring( buf, len, needle, needle_len );
+}
+
+const search_impl_t * get_search_impl( void )
+{
+    const search_impl_t * impl = __atomic_load_n( &s_search_impl, __ATOMIC_ACQUIRE );
+
+    if ( ! impl )
+    {
+        /* Threads racing here select the same implementation */
+        if ( ( 0 != search_set_isa( SEARCH_ISA_AVX2 ) ) &&
+             ( 0 != search_set_isa( SEARCH_ISA_SSSE3 ) ) )
+        {
+            search_set_isa( SEARCH_ISA_SCALAR );
+        }
+        impl = __atomic_load_n( &s_search_impl, __ATOMIC_ACQUIRE );
+    }
+
+    return impl;
+}
+
+const char * search_bytes_scalar( const char * buf,
+                                  size_t len,
+                                  uint8_t c1,
+                                  uint8_t c2,
+                                  uint8_t c3 )
+{
+    const uint8_t * p = (const uint8_t *)buf;
+    size_t i;
+
+    if ( ( c1 == c2 ) && ( c1 == c3 ) )
+    {
+        return memchr( buf, c1, len );
+    }
+
+    for ( i = 0; i < len; i++ )
+    {
+        if ( ( p[i] == c1 ) || ( p[i] == c2 ) || ( p[i] == c3 ) )
+        {
+            return buf + i;
+        }
+    }
+
+    return NULL;
+}
+
+const char * search_set_scalar( const char * buf,
+                                size_t len,
+                                const search_set_t * set,
+                                int negate )
+{
+    size_t i;
+
+    for ( i = 0; i < len; i++ )
+    {
+        if ( search_set_contains( set, buf[i] ) != negate )
+        {
+            return buf + i;
+        }
+    }
+
+    return NULL;
+}
+
+const char * search_substring_scalar( const char * buf,
+                                      size_t len,
+                                      const char * needle,
+                                      size_t needle_len )
+{
+    const uint8_t * h = (const uint8_t *)buf;
+    const uint8_t * z = h + len;
+    const uint8_t * n = (const uint8_t *)needle;
+    size_t l = needle_len;
+    uint64_t byteset[4] = { 0, 0, 0, 0 };
+    size_t shift[256];
+    size_t ip;
+    size_t jp;
+    size_t k;
+    size_t p;
+    size_t ms;
+    size_t p0;
+    size_t mem;
+    size_t mem0;
+    size_t i;
+
+    /* Last position of each byte in needle (bad character shift) */
+    for ( i = 0; i < l; i++ )
+    {
+        byteset[n[i] >> 6] |= (uint64_t)1 << ( n[i] & 63 );
+        shift[n[i]] = i + 1;
+    }
+
+    /* Critical factorization: maximal suffix for both orders */
+    ip = (size_t)-1;
+    jp = 0;
+    k = 1;
+    p = 1;
+    while ( jp + k < l )
+    {
+        if ( n[ip + k] == n[jp + k] )
+        {
+            if ( k == p )
+            {
+                jp += p;
+                k = 1;
+            }
+            else
+            {
+                k++;
+            }
+        }
+        else if ( n[ip + k] > n[jp + k] )
+        {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        }
+        else
+        {
+            ip = jp++;
+            k = 1;
+            p = 1;
+        }
+    }
+    ms = ip;
+    p0 = p;
+
+    ip = (size_t)-1;
+    jp = 0;
+    k = 1;
+    p = 1;
+    while ( jp + k < l )
+    {
+        if ( n[ip + k] == n[jp + k] )
+        {
+            if ( k == p )
+            {
+                jp += p;
+                k = 1;
+            }
+            else
+            {
+                k++;
+            }
+        }
+        else if ( n[ip + k] < n[jp + k] )
+        {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        }
+        else
+        {
+            ip = jp++;
+            k = 1;
+            p = 1;
+        }
+    }
+    if ( ip + 1 > ms + 1 )
+    {
+        ms = ip;
+    }
+    else
+    {
+        p = p0;
+    }
+
+    /* Periodic needle: remember matched prefix between two shifts */
+    if ( 0 != memcmp( n, n + p, ms + 1 ) )
+    {
+        mem0 = 0;
+        p = ( ( ms > l - ms - 1 ) ? ms : l - ms - 1 ) + 1;
+    }
+    else
+    {
+        mem0 = l - p;
+    }
+    mem = 0;
+
+    while ( (size_t)( z - h ) >= l )
+    {
+        /* Check last byte first and shift on mismatch */
+        if ( byteset[h[l - 1] >> 6] & ( (uint64_t)1 << ( h[l - 1] & 63 ) ) )
+        {
+            k = l - shift[h[l - 1]];
+            if ( k )
+            {
+                h += ( k < mem ) ? mem : k;
+                mem = 0;
+                continue;
+            }
+        }
+        else
+        {
+            h += l;
+            mem = 0;
+            continue;
+        }
+
+        /* Compare right half */
+        for ( k = ( ms + 1 > mem ) ? ms + 1 : mem; ( k < l ) && ( n[k] == h[k] ); k++ )
+        {
+        }
+        if ( k < l )
+        {
+            h += k - ms;
+            mem = 0;
+            continue;
+        }
+
+        /* Compare left half */
+        for ( k = ms + 1; ( k > mem ) && ( n[k - 1] == h[k - 1] ); k-- )
+        {
+        }
+        if ( k <= mem )
+        {
+            return (const char *)h;
+        }
+        h += p;
+        mem = mem0;
+    }
+
+    return NULL;
+}
+
+#ifdef HAVE_SEARCH_X86
+/*!
+ * @brief Compare 16 bytes to three bytes.
+ * @param p     Bytes to compare (16 readable bytes).
+ * @param v1    First byte repeated.
+ * @param v2    Second byte repeated.
+ * @param v3    Third byte repeated.
+ * @return 0xFF in bytes equal to one of the three bytes otherwise 0.
+ */
+__attribute__(( target( "ssse3" ) ))
+static inline __m128i match_bytes_ssse3( const char * p,
+                                         __m128i v1,
+                                         __m128i v2,
+                                         __m128i v3 )
+{
+    __m128i x = _mm_loadu_si128( (const __m128i *)p );
+
+    return _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( x, v1 ),
+                                       _mm_cmpeq_epi8( x, v2 ) ),
+                         _mm_cmpeq_epi8( x, v3 ) );
+}
+
+/*!
+ * @brief Test if 16 bytes are in set.
+ * @param p     Bytes to test (16 readable bytes).
+ * @param t0    Bitmaps of bytes < 0x80.
+ * @param t1    Bitmaps of bytes >= 0x80.
+ * @param bits  1 << ( i & 7 ) in byte i.
+ * @return 0xFF in bytes in set otherwise 0.
+ */
+__attribute__(( target( "ssse3" ) ))
+static inline __m128i match_set_ssse3( const char * p,
+                                       __m128i t0,
+                                       __m128i t1,
+                                       __m128i bits )
+{
+    __m128i x = _mm_loadu_si128( (const __m128i *)p );
+    /* pshufb returns 0 if bit 7 of index is set: selects table of byte */
+    __m128i lo = _mm_and_si128( x, _mm_set1_epi8( (char)0x8F ) );
+    __m128i row = _mm_or_si128( _mm_shuffle_epi8( t0, lo ),
+                                _mm_shuffle_epi8( t1, _mm_xor_si128( lo, _mm_set1_epi8( (char)0x80 ) ) ) );
+    __m128i hi = _mm_and_si128( _mm_srli_epi16( x, 4 ), _mm_set1_epi8( 0x0F ) );
+    __m128i bit = _mm_shuffle_epi8( bits, hi );
+
+    return _mm_cmpeq_epi8( _mm_and_si128( row, bit ), bit );
+}
+
+__attribute__(( target( "ssse3" ) ))
+const char * search_bytes_ssse3( const char * buf,
+                                 size_t len,
+                                 uint8_t c1,
+                                 uint8_t c2,
+                                 uint8_t c3 )
+{
+    __m128i v1 = _mm_set1_epi8( (char)c1 );
+    __m128i v2 = _mm_set1_epi8( (char)c2 );
+    __m128i v3 = _mm_set1_epi8( (char)c3 );
+    __m128i m0;
+    __m128i m1;
+    __m128i m2;
+    __m128i m3;
+    uint64_t mask;
+    size_t i = 0;
+
+    /* Single byte: memchr of libc is already vectorized */
+    if ( ( len < 16 ) || ( ( c1 == c2 ) && ( c1 == c3 ) ) )
+    {
+        return search_bytes_scalar( buf, len, c1, c2, c3 );
+    }
+
+    /* 64 bytes per step, positions are computed only on a match */
+    for ( ; i + 64 <= len; i += 64 )
+    {
+        m0 = match_bytes_ssse3( buf + i, v1, v2, v3 );
+        m1 = match_bytes_ssse3( buf + i + 16, v1, v2, v3 );
+        m2 = match_bytes_ssse3( buf + i + 32, v1, v2, v3 );
+        m3 = match_bytes_ssse3( buf + i + 48, v1, v2, v3 );
+        if ( _mm_movemask_epi8( _mm_or_si128( _mm_or_si128( m0, m1 ),
+                                              _mm_or_si128( m2, m3 ) ) ) )
+        {
+            mask = (uint64_t)(uint16_t)_mm_movemask_epi8( m0 ) |
+                   ( (uint64_t)(uint16_t)_mm_movemask_epi8( m1 ) << 16 ) |
+                   ( (uint64_t)(uint16_t)_mm_movemask_epi8( m2 ) << 32 ) |
+                   ( (uint64_t)(uint16_t)_mm_movemask_epi8( m3 ) << 48 );
+            return buf + i + __builtin_ctzll( mask );
+        }
+    }
+
+    for ( ; i + 16 <= len; i += 16 )
+    {
+        mask = (uint16_t)_mm_movemask_epi8( match_bytes_ssse3( buf + i, v1, v2, v3 ) );
+        if ( mask )
+        {
+            return buf + i + __builtin_ctzll( mask );
+        }
+    }
+
+    /* Last bytes: overlap already checked bytes (none of them matched) */
+    if ( i < len )
+    {
+        i = len - 16;
+        mask = (uint16_t)_mm_movemask_epi8( match_bytes_ssse3( buf + i, v1, v2, v3 ) );
+        if ( mask )
+        {
+            return buf + i + __builtin_ctzll( mask );
+        }
+    }
+
+    return NULL;
+}
+
+__attribute__(( target( "ssse3" ) ))
+const char * search_set_ssse3( const char * buf,
+                               size_t len,
+                               const search_set_t * set,
+                               int negate )
+{
+    __m128i t0 = _mm_loadu_si128( (const __m128i *)set->table[0] );
+    __m128i t1 = _mm_loadu_si128( (const __m128i *)set->table[1] );
+    __m128i bits = _mm_setr_epi8( 1, 2, 4, 8, 16, 32, 64, (char)128,
+                                  1, 2, 4, 8, 16, 32, 64, (char)128 );
+    uint32_t flip = negate ? 0xFFFF : 0;
+    uint32_t mask;
+    size_t i = 0;
+
+    if ( len < 16 )
+    {
+        return search_set_scalar( buf, len, set, negate );
+    }
+
+    for ( ; i + 16 <= len; i += 16 )
+    {
+        mask = (uint32_t)_mm_movemask_epi8( match_set_ssse3( buf + i, t0, t1, bits ) ) ^ flip;
+        if ( mask )
+        {
+            return buf + i + __builtin_ctz( mask );
+        }
+    }
+
+    if ( i < len )
+    {
+        i = len - 16;
+        mask = (uint32_t)_mm_movemask_epi8( match_set_ssse3( buf + i, t0, t1, bits ) ) ^ flip;
+        if ( mask )
+        {
+            return buf + i + __builtin_ctz( mask );
+        }
+    }
+
+    return NULL;
+}
+
+__attribute__(( target( "ssse3" ) ))
+const char * search_substring_ssse3( const char * buf,
+                                     size_t len,
+                                     const char * needle,
+                                     size_t needle_len )
+{
+    __m128i first = _mm_set1_epi8( needle[0] );
+    __m128i last = _mm_set1_epi8( needle[needle_len - 1] );
+    size_t nb_pos = len - needle_len + 1;
+    size_t verified = 0;
+    size_t i = 0;
+    size_t j;
+    uint32_t mask;
+
+    /* Less than one block of candidates: compare each of them */
+    if ( nb_pos < 16 )
+    {
+        for ( ; i < nb_pos; i++ )
+        {
+            if ( ( buf[i] == needle[0] ) &&
+                 ( 0 == memcmp( buf + i + 1, needle + 1, needle_len - 1 ) ) )
+            {
+                return buf + i;
+            }
+        }
+        return NULL;
+    }
+
+    while ( i < nb_pos )
+    {
+        /* Last block overlaps candidates already rejected */
+        if ( i + 16 > nb_pos )
+        {
+            i = nb_pos - 16;
+        }
+
+        mask = (uint32_t)_mm_movemask_epi8( _mm_and_si128(
+                _mm_cmpeq_epi8( first, _mm_loadu_si128( (const __m128i *)( buf + i ) ) ),
+                _mm_cmpeq_epi8( last, _mm_loadu_si128( (const __m128i *)( buf + i + needle_len - 1 ) ) ) ) );
+        while ( mask )
+        {
+            j = i + __builtin_ctz( mask );
+            if ( 0 == memcmp( buf + j + 1, needle + 1, needle_len - 2 ) )
+            {
+                return buf + j;
+            }
+            verified += needle_len;
+            mask &= mask - 1;
+        }
+        i += 16;
+
+        /* Too many false candidates (e.g. repetitive text): linear search */
+        if ( ( verified > SUBSTRING_VERIFY_BUDGET + ( i >> 2 ) ) && ( i < nb_pos ) )
+        {
+            return search_substring_scalar( buf + i, len - i, needle, needle_len );
+        }
+    }
+
+    return NULL;
+}
+
+/*!
+ * @brief Compare 32 bytes to three bytes.
+ * @param p     Bytes to compare (32 readable bytes).
+ * @param v1    First byte repeated.
+ * @param v2    Second byte repeated.
+ * @param v3    Third byte repeated.
+ * @return 0xFF in bytes equal to one of the three bytes otherwise 0.
+ */
+__attribute__(( target( "avx2" ) ))
+static inline __m256i match_bytes_avx2( const char * p,
+                                        __m256i v1,
+                                        __m256i v2,
+                                        __m256i v3 )
+{
+    __m256i x = _mm256_loadu_si256( (const __m256i *)p );
+
+    return _mm256_or_si256( _mm256_or_si256( _mm256_cmpeq_epi8( x, v1 ),
+                                             _mm256_cmpeq_epi8( x, v2 ) ),
+                            _mm256_cmpeq_epi8( x, v3 ) );
+}
+
+/*!
+ * @brief Test if 32 bytes are in set.
+ * @param p     Bytes to test (32 readable bytes).
+ * @param t0    Bitmaps of bytes < 0x80 (in both lanes).
+ * @param t1    Bitmaps of bytes >= 0x80 (in both lanes).
+ * @param bits  1 << ( i & 7 ) in byte i.
+ * @return 0xFF in bytes in set otherwise 0.
+ */
+__attribute__(( target( "avx2" ) ))
+static inline __m256i match_set_avx2( const char * p,
+                                      __m256i t0,
+                                      __m256i t1,
+                                      __m256i bits )
+{
+    __m256i x = _mm256_loadu_si256( (const __m256i *)p );
+    __m256i lo = _mm256_and_si256( x, _mm256_set1_epi8( (char)0x8F ) );
+    __m256i row = _mm256_or_si256( _mm256_shuffle_epi8( t0, lo ),
+                                   _mm256_shuffle_epi8( t1, _mm256_xor_si256( lo, _mm256_set1_epi8( (char)0x80 ) ) ) );
+    __m256i hi = _mm256_and_si256( _mm256_srli_epi16( x, 4 ), _mm256_set1_epi8( 0x0F ) );
+    __m256i bit = _mm256_shuffle_epi8( bits, hi );
+
+    return _mm256_cmpeq_epi8( _mm256_and_si256( row, bit ), bit );
+}
+
+__attribute__(( target( "avx2" ) ))
+const char * search_bytes_avx2( const char * buf,
+                                size_t len,
+                                uint8_t c1,
+                                uint8_t c2,
+                                uint8_t c3 )
+{
+    __m256i v1 = _mm256_set1_epi8( (char)c1 );
+    __m256i v2 = _mm256_set1_epi8( (char)c2 );
+    __m256i v3 = _mm256_set1_epi8( (char)c3 );
+    __m256i m0;
+    __m256i m1;
+    uint64_t mask;
+    size_t i = 0;
+
+    if ( ( len < 32 ) || ( ( c1 == c2 ) && ( c1 == c3 ) ) )
+    {
+        return search_bytes_ssse3( buf, len, c1, c2, c3 );
+    }
+
+    for ( ; i + 64 <= len; i += 64 )
+    {
+        m0 = match_bytes_avx2( buf + i, v1, v2, v3 );
+        m1 = match_bytes_avx2( buf + i + 32, v1, v2, v3 );
+        if ( ! _mm256_testz_si256( _mm256_or_si256( m0, m1 ), _mm256_or_si256( m0, m1 ) ) )
+        {
+            mask = (uint64_t)(uint32_t)_mm256_movemask_epi8( m0 ) |
+                   ( (uint64_t)(uint32_t)_mm256_movemask_epi8( m1 ) << 32 );
+            return buf + i + __builtin_ctzll( mask );
+        }
+    }
+
+    for ( ; i + 32 <= len; i += 32 )
+    {
+        mask = (uint32_t)_mm256_movemask_epi8( match_bytes_avx2( buf + i, v1, v2, v3 ) );
+        if ( mask )
+        {
+            return buf + i + __builtin_ctzll( mask );
+        }
+    }
+
+    if ( i < len )
+    {
+        i = len - 32;
+        mask = (uint32_t)_mm256_movemask_epi8( match_bytes_avx2( buf + i, v1, v2, v3 ) );
+        if ( mask )
+        {
+            return buf + i + __builtin_ctzll( mask );
+        }
+    }
+
+    return NULL;
+}
+
+__attribute__(( target( "avx2" ) ))
+const char * search_set_avx2( const char * buf,
+                              size_t len,
+                              const search_set_t * set,
+                              int negate )
+{
+    __m256i t0 = _mm256_broadcastsi128_si256( _mm_loadu_si128( (const __m128i *)set->table[0] ) );
+    __m256i t1 = _mm256_broadcastsi128_si256( _mm_loadu_si128( (const __m128i *)set->table[1] ) );
+    __m256i bits = _mm256_setr_epi8( 1, 2, 4, 8, 16, 32, 64, (char)128,
+                                     1, 2, 4, 8, 16, 32, 64, (char)128,
+                                     1, 2, 4, 8, 16, 32, 64, (char)128,
+                                     1, 2, 4, 8, 16, 32, 64, (char)128 );
+    uint32_t flip = negate ? 0xFFFFFFFF : 0;
+    uint32_t mask;
+    size_t i = 0;
+
+    if ( len < 32 )
+    {
+        return search_set_ssse3( buf, len, set, negate );
+    }
+
+    for ( ; i + 32 <= len; i += 32 )
+    {
+        mask = (uint32_t)_mm256_movemask_epi8( match_set_avx2( buf + i, t0, t1, bits ) ) ^ flip;
+        if ( mask )
+        {
+            return buf + i + __builtin_ctz( mask );
+        }
+    }
+
+    if ( i < len )
+    {
+        i = len - 32;
+        mask = (uint32_t)_mm256_movemask_epi8( match_set_avx2( buf + i, t0, t1, bits ) ) ^ flip;
+        if ( mask )
+        {
+            return buf + i + __builtin_ctz( mask );
+        }
+    }
+
+    return NULL;
+}
+
+__attribute__(( target( "avx2" ) ))
+const char * search_substring_avx2( const char * buf,
+                                    size_t len,
+                                    const char * needle,
+                                    size_t needle_len )
+{
+    __m256i first = _mm256_set1_epi8( needle[0] );
+    __m256i last = _mm256_set1_epi8( needle[needle_len - 1] );
+    const char * tail = buf + needle_len - 1;
+    size_t nb_pos = len - needle_len + 1;
+    size_t verified = 0;
+    size_t i = 0;
+    size_t j;
+    __m256i m0;
+    __m256i m1;
+    uint64_t mask;
+
+    if ( nb_pos < 64 )
+    {
+        return search_substring_ssse3( buf, len, needle, needle_len );
+    }
+
+    /* 64 candidates per step */
+    while ( i < nb_pos )
+    {
+        /* Last step overlaps candidates already rejected */
+        if ( i + 64 > nb_pos )
+        {
+            i = nb_pos - 64;
+        }
+
+        m0 = _mm256_and_si256(
+                _mm256_cmpeq_epi8( first, _mm256_loadu_si256( (const __m256i *)( buf + i ) ) ),
+                _mm256_cmpeq_epi8( last, _mm256_loadu_si256( (const __m256i *)( tail + i ) ) ) );
+        m1 = _mm256_and_si256(
+                _mm256_cmpeq_epi8( first, _mm256_loadu_si256( (const __m256i *)( buf + i + 32 ) ) ),
+                _mm256_cmpeq_epi8( last, _mm256_loadu_si256( (const __m256i *)( tail + i + 32 ) ) ) );
+        if ( ! _mm256_testz_si256( _mm256_or_si256( m0, m1 ), _mm256_or_si256( m0, m1 ) ) )
+        {
+            mask = (uint64_t)(uint32_t)_mm256_movemask_epi8( m0 ) |
+                   ( (uint64_t)(uint32_t)_mm256_movemask_epi8( m1 ) << 32 );
+            while ( mask )
+            {
+                j = i + __builtin_ctzll( mask );
+                if ( 0 == memcmp( buf + j + 1, needle + 1, needle_len - 2 ) )
+                {
+                    return buf + j;
+                }
+                verified += needle_len;
+                mask &= mask - 1;
+            }
+        }
+        i += 64;
+
+        if ( ( verified > SUBSTRING_VERIFY_BUDGET + ( i >> 2 ) ) && ( i < nb_pos ) )
+        {
+            return search_substring_scalar( buf + i, len - i, needle, needle_len );
+        }
+    }
+
+    return NULL;
+}
+#endif
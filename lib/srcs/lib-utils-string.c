@@ -1,44 +1,787 @@
-/*!
- * @file: lib-utils-parse-string.c
- * @date: 2024-02-05
- * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
- * @brief: Implementation of function to manage string.
- */
-#include <stdlib.h>
-#include <string.h>
-
-#include "lib-utils-assert.h"
-
-char * allocate_and_copy_string( const char * str)
-{
-    char * ret = NULL;
-
-    ASSERT_STR_NOT_NULL(str, NULL);
-
-    ret = malloc( strlen( str ) + 1 );
-
-    if(ret)
-    {
-        strcpy(ret, str);
-    }
-
-    return ret;
-}
-
-char * allocate_and_concat_string( const char * str1, const char * str2 )
-{
-    char * ret = NULL;
-
-    ASSERT_STR_NOT_NULL(str1, NULL);
-    ASSERT_STR_NOT_NULL(str2, NULL);
-
-    ret = malloc( strlen( str1 ) + strlen( str2 ) + 1 );
-
-    if(ret)
-    {
-        strcpy( ret, str1 );
-        strcat( ret, str2 );
-    }
-
-    return ret;
-}
\ No newline at end of file
+/*!
+ * @file: lib-utils-parse-string.c
+ * @date: 2024-02-05
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of function to manage string.
+ */
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lib-utils-assert.h"
+#include "lib-utils-format-number.h"
+#include "lib-utils-string.h"
+
+/*!
+ * @brief Number of parts whose length (and pointer for variadic function) is
+ *        kept on stack when strings are concatenated.
+ */
+#define CONCAT_STRINGS_NB_CACHED    32
+
+/*!
+ * @brief Number of bytes of a token checked one by one before a vectorized
+ *        search of delimiter (most tokens are short).
+ */
+#define SPLIT_SHORT_TOKEN           16
+
+/*!
+ * @brief Update length of string builder after a number is formatted at its
+ *        end.
+ * @param builder   String builder.
+ * @param len       Length returned by format_<type> function.
+ * @return 0 on success otherwise -1.
+ */
+static int string_builder_commit( string_builder_t * builder, int len );
+
+/*!
+ * @brief Copy bytes of view (no NUL termination).
+ * @param dst   Destination (at least str.len bytes).
+ * @param str   View to copy (can be empty with a NULL pointer).
+ * @return Pointer after last byte copied.
+ */
+static inline char * string_copy_view( char * dst, lu_strview_t str );
+
+/*!
+ * @brief Search next delimiter of split iterator in a part of buffer.
+ * @param split Iterator.
+ * @param p     Start of search.
+ * @param limit End of search (delimiter ends before).
+ * @return Pointer on delimiter otherwise NULL.
+ */
+static inline const char * string_split_find_delim( const string_split_t * split,
+                                                    const char * p,
+                                                    const char * limit );
+
+/*!
+ * @brief Search next delimiter of split iterator outside of quotes (each byte
+ *        is scanned once for quotes).
+ * @param split Iterator.
+ * @param p     Start of search.
+ * @return Pointer on delimiter otherwise NULL.
+ */
+static const char * string_split_find( string_split_t * split, const char * p );
+
+char * allocate_and_copy_string( const char * str)
+{
+    ASSERT_STR_NOT_NULL(str, NULL);
+
+    return allocate_and_copy_strview( lu_strview_from_cstr( str ) );
+}
+
+char * allocate_and_concat_string( const char * str1, const char * str2 )
+{
+    ASSERT_STR_NOT_NULL(str1, NULL);
+    ASSERT_STR_NOT_NULL(str2, NULL);
+
+    return allocate_and_concat_strview( lu_strview_from_cstr( str1 ),
+                                        lu_strview_from_cstr( str2 ) );
+}
+
+char * allocate_and_copy_strview( lu_strview_t str )
+{
+    char * ret = NULL;
+
+    if ( ( ! str.ptr ) && ( str.len > 0 ) )
+    {
+        return NULL;
+    }
+
+    ret = malloc( str.len + 1 );
+
+    if ( ret )
+    {
+        string_copy_view( ret, str );
+        ret[str.len] = '\0';
+    }
+
+    return ret;
+}
+
+char * allocate_and_concat_strview( lu_strview_t str1, lu_strview_t str2 )
+{
+    char * ret = NULL;
+
+    if ( ( ! str1.ptr ) && ( str1.len > 0 ) )
+    {
+        return NULL;
+    }
+    if ( ( ! str2.ptr ) && ( str2.len > 0 ) )
+    {
+        return NULL;
+    }
+
+    ret = malloc( str1.len + str2.len + 1 );
+
+    if ( ret )
+    {
+        string_copy_view( string_copy_view( ret, str1 ), str2 );
+        ret[str1.len + str2.len] = '\0';
+    }
+
+    return ret;
+}
+
+char * allocate_and_concat_strings( size_t count, ... )
+{
+    const char *    local_parts[CONCAT_STRINGS_NB_CACHED];
+    const char **   parts = local_parts;
+    char *          ret;
+    va_list         args;
+    size_t          i;
+
+    if ( count > CONCAT_STRINGS_NB_CACHED )
+    {
+        parts = malloc( count * sizeof( *parts ) );
+        if ( ! parts )
+        {
+            return NULL;
+        }
+    }
+
+    va_start( args, count );
+    for ( i = 0; i < count; i++ )
+    {
+        parts[i] = va_arg( args, const char * );
+    }
+    va_end( args );
+
+    ret = allocate_and_concat_string_array( parts, count );
+
+    if ( parts != local_parts )
+    {
+        free( parts );
+    }
+
+    return ret;
+}
+
+char * allocate_and_concat_string_array( const char * const * parts, size_t count )
+{
+    size_t  lens[CONCAT_STRINGS_NB_CACHED];
+    size_t  total = 0;
+    size_t  len;
+    size_t  i;
+    char *  ret;
+    char *  p;
+
+    ASSERT_PTR( parts, NULL );
+
+    if ( 0 == count )
+    {
+        return NULL;
+    }
+
+    for ( i = 0; i < count; i++ )
+    {
+        if ( ! parts[i] )
+        {
+            return NULL;
+        }
+
+        len = strlen( parts[i] );
+        if ( i < CONCAT_STRINGS_NB_CACHED )
+        {
+            lens[i] = len;
+        }
+        /* Same string can be given many times */
+        if ( total + len + 1 <= total )
+        {
+            return NULL;
+        }
+        total += len;
+    }
+
+    ret = malloc( total + 1 );
+    if ( ! ret )
+    {
+        return NULL;
+    }
+
+    /* Lengths of first parts are known, only next ones are scanned again */
+    p = ret;
+    for ( i = 0; i < count; i++ )
+    {
+        len = ( i < CONCAT_STRINGS_NB_CACHED ) ? lens[i] : strlen( parts[i] );
+        memcpy( p, parts[i], len );
+        p += len;
+    }
+    *p = '\0';
+
+    return ret;
+}
+
+char * allocate_and_copy_string_arena( arena_t * arena, const char * str )
+{
+    ASSERT_STR_NOT_NULL( str, NULL );
+
+    return allocate_and_copy_strview_arena( arena, lu_strview_from_cstr( str ) );
+}
+
+char * allocate_and_concat_string_arena( arena_t * arena,
+                                         const char * str1,
+                                         const char * str2 )
+{
+    ASSERT_STR_NOT_NULL( str1, NULL );
+    ASSERT_STR_NOT_NULL( str2, NULL );
+
+    return allocate_and_concat_strview_arena( arena, lu_strview_from_cstr( str1 ),
+                                              lu_strview_from_cstr( str2 ) );
+}
+
+char * allocate_and_copy_strview_arena( arena_t * arena, lu_strview_t str )
+{
+    char * ret = NULL;
+
+    ASSERT_PTR( arena, NULL );
+    if ( ( ! str.ptr ) && ( str.len > 0 ) )
+    {
+        return NULL;
+    }
+
+    ret = arena_alloc_aligned( arena, str.len + 1, 1 );
+
+    if ( ret )
+    {
+        string_copy_view( ret, str );
+        ret[str.len] = '\0';
+    }
+
+    return ret;
+}
+
+char * allocate_and_concat_strview_arena( arena_t * arena,
+                                          lu_strview_t str1,
+                                          lu_strview_t str2 )
+{
+    char * ret = NULL;
+
+    ASSERT_PTR( arena, NULL );
+    if ( ( ! str1.ptr ) && ( str1.len > 0 ) )
+    {
+        return NULL;
+    }
+    if ( ( ! str2.ptr ) && ( str2.len > 0 ) )
+    {
+        return NULL;
+    }
+
+    ret = arena_alloc_aligned( arena, str1.len + str2.len + 1, 1 );
+
+    if ( ret )
+    {
+        string_copy_view( string_copy_view( ret, str1 ), str2 );
+        ret[str1.len + str2.len] = '\0';
+    }
+
+    return ret;
+}
+
+int string_builder_init( string_builder_t * builder, size_t capacity )
+{
+    ASSERT_PTR( builder, -1 );
+
+    builder->data = NULL;
+    builder->len = 0;
+    builder->capacity = 0;
+
+    return capacity ? string_builder_reserve( builder, capacity ) : 0;
+}
+
+void string_builder_free( string_builder_t * builder )
+{
+    if ( ! builder )
+    {
+        return;
+    }
+
+    free( builder->data );
+    builder->data = NULL;
+    builder->len = 0;
+    builder->capacity = 0;
+}
+
+int string_builder_reserve( string_builder_t * builder, size_t len )
+{
+    size_t  needed;
+    size_t  capacity;
+    char *  data;
+
+    ASSERT_PTR( builder, -1 );
+
+    needed = builder->len + len + 1;
+    if ( needed <= len )
+    {
+        return -1;
+    }
+
+    if ( needed <= builder->capacity )
+    {
+        return 0;
+    }
+
+    /* Geometric growth: appends are amortized constant time */
+    capacity = builder->capacity ? builder->capacity : STRING_BUILDER_MIN_CAPACITY;
+    while ( capacity < needed )
+    {
+        capacity = ( capacity * 2 > capacity ) ? capacity * 2 : needed;
+    }
+
+    data = realloc( builder->data, capacity );
+    if ( ! data )
+    {
+        return -1;
+    }
+
+    data[builder->len] = '\0';
+    builder->data = data;
+    builder->capacity = capacity;
+
+    return 0;
+}
+
+void string_builder_clear( string_builder_t * builder )
+{
+    ASSERT_PTR( builder, );
+
+    builder->len = 0;
+    if ( builder->data )
+    {
+        builder->data[0] = '\0';
+    }
+}
+
+int string_builder_append( string_builder_t * builder, const char * str )
+{
+    ASSERT_PTR( str, -1 );
+
+    return string_builder_append_n( builder, str, strlen( str ) );
+}
+
+int string_builder_append_n( string_builder_t * builder,
+                             const char * str,
+                             size_t len )
+{
+    uintptr_t   data;
+    uintptr_t   offset;
+
+    ASSERT_PTR( builder, -1 );
+    ASSERT_PTR( str, -1 );
+
+    data = (uintptr_t)builder->data;
+    offset = (uintptr_t)str - data;
+
+    if ( 0 != string_builder_reserve( builder, len ) )
+    {
+        return -1;
+    }
+
+    /* Append a part of builder itself: buffer may have moved */
+    if ( data && ( offset < builder->len ) )
+    {
+        str = builder->data + offset;
+    }
+
+    memmove( builder->data + builder->len, str, len );
+    builder->len += len;
+    builder->data[builder->len] = '\0';
+
+    return 0;
+}
+
+int string_builder_append_view( string_builder_t * builder, lu_strview_t str )
+{
+    if ( 0 == str.len )
+    {
+        /* Empty view can have a NULL pointer */
+        return string_builder_reserve( builder, 0 );
+    }
+
+    return string_builder_append_n( builder, str.ptr, str.len );
+}
+
+int string_builder_append_char( string_builder_t * builder, char c )
+{
+    ASSERT_PTR( builder, -1 );
+
+    if ( 0 != string_builder_reserve( builder, 1 ) )
+    {
+        return -1;
+    }
+
+    builder->data[builder->len++] = c;
+    builder->data[builder->len] = '\0';
+
+    return 0;
+}
+
+int string_builder_append_uint32( string_builder_t * builder, uint32_t number )
+{
+    ASSERT_PTR( builder, -1 );
+
+    if ( 0 != string_builder_reserve( builder, FORMAT_NUMBER_BUFFER_SIZE ) )
+    {
+        return -1;
+    }
+
+    return string_builder_commit( builder,
+            format_uint32( number, builder->data + builder->len,
+                           builder->capacity - builder->len ) );
+}
+
+int string_builder_append_int32( string_builder_t * builder, int32_t number )
+{
+    ASSERT_PTR( builder, -1 );
+
+    if ( 0 != string_builder_reserve( builder, FORMAT_NUMBER_BUFFER_SIZE ) )
+    {
+        return -1;
+    }
+
+    return string_builder_commit( builder,
+            format_int32( number, builder->data + builder->len,
+                          builder->capacity - builder->len ) );
+}
+
+int string_builder_append_hex32( string_builder_t * builder, uint32_t hex )
+{
+    ASSERT_PTR( builder, -1 );
+
+    if ( 0 != string_builder_reserve( builder, FORMAT_NUMBER_BUFFER_SIZE ) )
+    {
+        return -1;
+    }
+
+    return string_builder_commit( builder,
+            format_hex32( hex, builder->data + builder->len,
+                          builder->capacity - builder->len ) );
+}
+
+int string_builder_append_uint64( string_builder_t * builder, uint64_t number )
+{
+    ASSERT_PTR( builder, -1 );
+
+    if ( 0 != string_builder_reserve( builder, FORMAT_NUMBER_BUFFER_SIZE ) )
+    {
+        return -1;
+    }
+
+    return string_builder_commit( builder,
+            format_uint64( number, builder->data + builder->len,
+                           builder->capacity - builder->len ) );
+}
+
+int string_builder_append_int64( string_builder_t * builder, int64_t number )
+{
+    ASSERT_PTR( builder, -1 );
+
+    if ( 0 != string_builder_reserve( builder, FORMAT_NUMBER_BUFFER_SIZE ) )
+    {
+        return -1;
+    }
+
+    return string_builder_commit( builder,
+            format_int64( number, builder->data + builder->len,
+                          builder->capacity - builder->len ) );
+}
+
+int string_builder_append_hex64( string_builder_t * builder, uint64_t hex )
+{
+    ASSERT_PTR( builder, -1 );
+
+    if ( 0 != string_builder_reserve( builder, FORMAT_NUMBER_BUFFER_SIZE ) )
+    {
+        return -1;
+    }
+
+    return string_builder_commit( builder,
+            format_hex64( hex, builder->data + builder->len,
+                          builder->capacity - builder->len ) );
+}
+
+int string_builder_append_double( string_builder_t * builder, double number )
+{
+    ASSERT_PTR( builder, -1 );
+
+    if ( 0 != string_builder_reserve( builder, FORMAT_NUMBER_BUFFER_SIZE ) )
+    {
+        return -1;
+    }
+
+    return string_builder_commit( builder,
+            format_double( number, builder->data + builder->len,
+                           builder->capacity - builder->len ) );
+}
+
+const char * string_builder_get( const string_builder_t * builder )
+{
+    ASSERT_PTR( builder, NULL );
+
+    return builder->data ? builder->data : "";
+}
+
+lu_strview_t string_builder_view( const string_builder_t * builder )
+{
+    if ( ! builder )
+    {
+        return lu_strview( NULL, 0 );
+    }
+
+    return lu_strview( builder->data, builder->len );
+}
+
+size_t string_builder_get_length( const string_builder_t * builder )
+{
+    return builder ? builder->len : 0;
+}
+
+char * string_builder_detach( string_builder_t * builder )
+{
+    char * ret;
+
+    ASSERT_PTR( builder, NULL );
+
+    /* Nothing appended: detach an allocated empty string */
+    if ( ( ! builder->data ) && ( 0 != string_builder_reserve( builder, 0 ) ) )
+    {
+        return NULL;
+    }
+
+    ret = builder->data;
+    builder->data = NULL;
+    builder->len = 0;
+    builder->capacity = 0;
+
+    return ret;
+}
+
+int string_builder_commit( string_builder_t * builder, int len )
+{
+    if ( len < 0 )
+    {
+        return -1;
+    }
+
+    builder->len += len;
+
+    return 0;
+}
+
+int string_split_init( string_split_t * split,
+                       const char * buf,
+                       size_t len,
+                       char delim,
+                       unsigned int flags )
+{
+    ASSERT_PTR( split, -1 );
+    ASSERT_PTR( buf, -1 );
+
+    memset( split, 0, sizeof( *split ) );
+    split->pos = buf;
+    split->end = buf + len;
+    split->byte = delim;
+    split->delim_len = 1;
+    split->mode = STRING_SPLIT_BYTE;
+    split->flags = flags;
+
+    return 0;
+}
+
+int string_split_init_string( string_split_t * split,
+                              const char * buf,
+                              size_t len,
+                              const char * delim,
+                              size_t delim_len,
+                              unsigned int flags )
+{
+    ASSERT_PTR( split, -1 );
+    ASSERT_PTR( buf, -1 );
+    ASSERT_PTR( delim, -1 );
+
+    if ( 0 == delim_len )
+    {
+        return -1;
+    }
+
+    memset( split, 0, sizeof( *split ) );
+    split->pos = buf;
+    split->end = buf + len;
+    split->delim = delim;
+    split->delim_len = delim_len;
+    split->mode = STRING_SPLIT_STRING;
+    split->flags = flags;
+
+    return 0;
+}
+
+int string_split_init_any( string_split_t * split,
+                           const char * buf,
+                           size_t len,
+                           const char * delims,
+                           size_t nb_delims,
+                           unsigned int flags )
+{
+    ASSERT_PTR( split, -1 );
+    ASSERT_PTR( buf, -1 );
+    ASSERT_PTR( delims, -1 );
+
+    if ( 0 == nb_delims )
+    {
+        return -1;
+    }
+
+    memset( split, 0, sizeof( *split ) );
+    split->pos = buf;
+    split->end = buf + len;
+    split->delim_len = 1;
+    split->mode = STRING_SPLIT_ANY_OF;
+    split->flags = flags;
+
+    return search_set_init( &split->set, delims, nb_delims );
+}
+
+int string_split_next( string_split_t * split,
+                       const char ** token,
+                       size_t * token_len )
+{
+    const char * start;
+    const char * delim;
+    size_t len;
+
+    ASSERT_PTR( split, -1 );
+    ASSERT_PTR( token, -1 );
+    ASSERT_PTR( token_len, -1 );
+
+    while ( split->pos )
+    {
+        start = split->pos;
+
+        /* Skip a run of delimiters in one scan */
+        if ( ( STRING_SPLIT_ANY_OF == split->mode ) &&
+             ( split->flags & STRING_SPLIT_SKIP_EMPTY ) )
+        {
+            start = search_none_of( start, split->end - start, &split->set );
+            if ( ! start )
+            {
+                split->pos = NULL;
+                break;
+            }
+        }
+
+        delim = string_split_find( split, start );
+        if ( delim )
+        {
+            len = delim - start;
+            split->pos = delim + split->delim_len;
+        }
+        else
+        {
+            len = split->end - start;
+            split->pos = NULL;
+        }
+
+        if ( ( 0 == len ) && ( split->flags & STRING_SPLIT_SKIP_EMPTY ) )
+        {
+            continue;
+        }
+
+        if ( ( split->flags & STRING_SPLIT_QUOTES ) && ( len >= 2 ) &&
+             ( STRING_SPLIT_QUOTE_CHAR == start[0] ) &&
+             ( STRING_SPLIT_QUOTE_CHAR == start[len - 1] ) )
+        {
+            start++;
+            len -= 2;
+        }
+
+        *token = start;
+        *token_len = len;
+        return 0;
+    }
+
+    return -1;
+}
+
+int string_split_next_view( string_split_t * split, lu_strview_t * token )
+{
+    ASSERT_PTR( token, -1 );
+
+    return string_split_next( split, &token->ptr, &token->len );
+}
+
+const char * string_split_find_delim( const string_split_t * split,
+                                      const char * p,
+                                      const char * limit )
+{
+    const char * short_end = ( limit - p > SPLIT_SHORT_TOKEN ) ? p + SPLIT_SHORT_TOKEN : limit;
+
+    switch ( split->mode )
+    {
+        case STRING_SPLIT_STRING:
+            return search_substring( p, limit - p, split->delim, split->delim_len );
+        case STRING_SPLIT_ANY_OF:
+            for ( ; p < short_end; p++ )
+            {
+                if ( search_set_contains( &split->set, *p ) )
+                {
+                    return p;
+                }
+            }
+            return ( p < limit ) ? search_any_of( p, limit - p, &split->set ) : NULL;
+        default:
+            for ( ; p < short_end; p++ )
+            {
+                if ( *p == split->byte )
+                {
+                    return p;
+                }
+            }
+            return ( p < limit ) ? search_byte( p, limit - p, split->byte ) : NULL;
+    }
+}
+
+const char * string_split_find( string_split_t * split, const char * p )
+{
+    const char * delim;
+    const char * quote;
+
+    if ( ! ( split->flags & STRING_SPLIT_QUOTES ) )
+    {
+        return string_split_find_delim( split, p, split->end );
+    }
+
+    while ( 1 )
+    {
+        /* Next quote is kept until the iterator goes past it */
+        if ( ( ! split->quote ) || ( split->quote < p ) )
+        {
+            quote = search_byte( p, split->end - p, STRING_SPLIT_QUOTE_CHAR );
+            split->quote = quote ? quote : split->end;
+        }
+
+        /* Delimiter is valid if no quote is opened before it */
+        delim = string_split_find_delim( split, p, split->quote );
+        if ( delim || ( split->quote == split->end ) )
+        {
+            return delim;
+        }
+
+        /* Search again after closing quote */
+        p = search_byte( split->quote + 1, split->end - split->quote - 1,
+                         STRING_SPLIT_QUOTE_CHAR );
+        if ( ! p )
+        {
+            return NULL;
+        }
+        p++;
+    }
+}
+
+char * string_copy_view( char * dst, lu_strview_t str )
+{
+    if ( str.len > 0 )
+    {
+        memcpy( dst, str.ptr, str.len );
+    }
+
+    return dst + str.len;
+}
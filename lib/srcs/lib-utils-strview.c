@@ -0,0 +1,33 @@
+/*!
+ * @file: lib-utils-strview.c
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of immutable string view helpers.
+ */
+#include <string.h>
+
+#include "lib-utils-search.h"
+#include "lib-utils-strview.h"
+
+lu_strview_t lu_strview_from_cstr( const char * str )
+{
+    return lu_strview( str, str ? strlen( str ) : 0 );
+}
+
+size_t lu_strview_find( lu_strview_t view, lu_strview_t needle )
+{
+    const char * found;
+
+    if ( 0 == needle.len )
+    {
+        return 0;
+    }
+    if ( needle.len > view.len )
+    {
+        return LU_STRVIEW_NPOS;
+    }
+
+    found = search_substring( view.ptr, view.len, needle.ptr, needle.len );
+
+    return found ? (size_t)( found - view.ptr ) : LU_STRVIEW_NPOS;
+}
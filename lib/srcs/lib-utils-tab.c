@@ -0,0 +1,68 @@
+/*!
+ * @file: lib-utils-tab.c
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of memory management of growable arrays.
+ */
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "lib-utils-assert.h"
+#include "lib-utils-tab.h"
+
+int tab_grow( void ** data, size_t * capacity, size_t elem_size, size_t needed )
+{
+    size_t new_capacity;
+
+    ASSERT_PTR( data, -1 );
+    ASSERT_PTR( capacity, -1 );
+
+    if ( needed <= *capacity )
+    {
+        return 0;
+    }
+
+    /* Geometric growth: appends are amortized constant time */
+    new_capacity = ( *capacity > TAB_MIN_CAPACITY ) ? *capacity : TAB_MIN_CAPACITY;
+    while ( new_capacity < needed )
+    {
+        new_capacity = ( new_capacity * 2 > new_capacity ) ? new_capacity * 2 : needed;
+    }
+
+    return tab_set_capacity( data, capacity, elem_size, new_capacity );
+}
+
+int tab_set_capacity( void ** data,
+                      size_t * capacity,
+                      size_t elem_size,
+                      size_t new_capacity )
+{
+    void * new_data;
+
+    ASSERT_PTR( data, -1 );
+    ASSERT_PTR( capacity, -1 );
+
+    if ( ( 0 == elem_size ) || ( new_capacity > SIZE_MAX / elem_size ) )
+    {
+        return -1;
+    }
+
+    if ( 0 == new_capacity )
+    {
+        free( *data );
+        *data = NULL;
+        *capacity = 0;
+        return 0;
+    }
+
+    new_data = realloc( *data, new_capacity * elem_size );
+    if ( ! new_data )
+    {
+        return -1;
+    }
+
+    *data = new_data;
+    *capacity = new_capacity;
+
+    return 0;
+}
@@ -0,0 +1,1304 @@
+/*!
+ * @file: lib-utils-utf8.c
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of functions to validate and transcode UTF-8.
+ *
+ * Vectorized validation uses the lookup algorithm of simdjson/simdutf
+ * (Keiser, Lemire): three nibble lookups classify each byte with its previous
+ * one, an error is kept if any class bit survives, plus a check that bytes
+ * expected as third or fourth byte of a sequence are continuations. The
+ * validator only tells if a block is valid: the first invalid sequence is
+ * located by the scalar validator restarted at the start of the faulty block.
+ * UTF-8 input of transcoders is validated first then decoded without check,
+ * runs of ASCII characters are converted 16 bytes at a time.
+ */
+#include <stdint.h>
+#include <string.h>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <immintrin.h>
+
+/*!
+ * @brief SSSE3 and AVX2 implementations are available for this target.
+ */
+#define HAVE_UTF8_X86 1
+#endif
+
+#include "lib-utils-assert.h"
+#include "lib-utils-utf8.h"
+
+/*!
+ * @struct utf8_impl_t
+ * @brief Implementation of UTF-8 functions for an instruction set.
+ */
+typedef struct utf8_impl_t
+{
+    /*! Validate buffer (error_offset can be NULL). */
+    int ( *validate )( const char * buf, size_t len, size_t * error_offset );
+    /*! Count code points and bytes >= 0xF0 (lead of 4 bytes sequences). */
+    size_t ( *count )( const char * buf, size_t len, size_t * nb_4_bytes );
+    /*! Widen leading ASCII characters, return number converted. */
+    size_t ( *ascii_to_utf16 )( const char * buf, size_t len, uint16_t * out );
+    /*! Widen leading ASCII characters, return number converted. */
+    size_t ( *ascii_to_utf32 )( const char * buf, size_t len, uint32_t * out );
+    /*! Narrow leading ASCII code units, return number converted. */
+    size_t ( *utf16_to_ascii )( const uint16_t * buf, size_t len, char * out );
+    /*! Narrow leading ASCII code points, return number converted. */
+    size_t ( *utf32_to_ascii )( const uint32_t * buf, size_t len, char * out );
+} utf8_impl_t;
+
+/*!
+ * @brief Decode one UTF-8 sequence.
+ * @param p     Sequence.
+ * @param len   Number of readable bytes (not 0).
+ * @param cp    Pointer to store code point.
+ * @return Length of sequence on success otherwise 0 (invalid sequence).
+ */
+static inline size_t decode_utf8( const uint8_t * p, size_t len, uint32_t * cp );
+
+/*!
+ * @brief Decode one sequence of valid UTF-8 (no check).
+ * @param p     Valid sequence.
+ * @param cp    Pointer to store code point.
+ * @return Length of sequence.
+ */
+static inline size_t decode_valid_utf8( const uint8_t * p, uint32_t * cp );
+
+/*!
+ * @brief Encode one code point in UTF-8.
+ * @param cp    Code point (valid).
+ * @param out   Buffer to store bytes.
+ * @param avail Number of bytes available in out.
+ * @return Number of bytes stored on success otherwise 0 (out too small).
+ */
+static inline size_t encode_utf8( uint32_t cp, char * out, size_t avail );
+
+/*!
+ * @brief Validate UTF-8 buffer (portable C).
+ * @param buf           Buffer to validate.
+ * @param len           Length of buffer in bytes.
+ * @param error_offset  Pointer to store offset of first invalid sequence (can
+ *                      be NULL).
+ * @return 0 if buffer is valid otherwise -1.
+ */
+static int utf8_validate_scalar( const char * buf, size_t len, size_t * error_offset );
+
+/*!
+ * @brief Locate first invalid sequence after a block found invalid.
+ * @param buf           Buffer (valid before pos).
+ * @param len           Length of buffer in bytes.
+ * @param pos           Offset of faulty block.
+ * @param error_offset  Pointer to store offset of first invalid sequence (can
+ *                      be NULL).
+ * @return -1 (0 if no error is found).
+ */
+static int utf8_validate_from( const char * buf,
+                               size_t len,
+                               size_t pos,
+                               size_t * error_offset );
+
+/*!
+ * @brief Count code points and 4 bytes sequences (portable C).
+ * @param buf           Valid UTF-8 buffer.
+ * @param len           Length of buffer in bytes.
+ * @param nb_4_bytes    Pointer to store number of bytes >= 0xF0.
+ * @return The number of code points.
+ */
+static size_t utf8_count_scalar( const char * buf, size_t len, size_t * nb_4_bytes );
+
+/*!
+ * @brief No vectorized ASCII conversion (portable C).
+ * @return 0.
+ */
+static size_t ascii_to_utf16_scalar( const char * buf, size_t len, uint16_t * out );
+
+/*!
+ * @brief No vectorized ASCII conversion (portable C).
+ * @return 0.
+ */
+static size_t ascii_to_utf32_scalar( const char * buf, size_t len, uint32_t * out );
+
+/*!
+ * @brief No vectorized ASCII conversion (portable C).
+ * @return 0.
+ */
+static size_t utf16_to_ascii_scalar( const uint16_t * buf, size_t len, char * out );
+
+/*!
+ * @brief No vectorized ASCII conversion (portable C).
+ * @return 0.
+ */
+static size_t utf32_to_ascii_scalar( const uint32_t * buf, size_t len, char * out );
+
+#ifdef HAVE_UTF8_X86
+/*!
+ * @brief Validate UTF-8 buffer with SSSE3.
+ * @param buf           Buffer to validate.
+ * @param len           Length of buffer in bytes.
+ * @param error_offset  Pointer to store offset of first invalid sequence (can
+ *                      be NULL).
+ * @return 0 if buffer is valid otherwise -1.
+ */
+static int utf8_validate_ssse3( const char * buf, size_t len, size_t * error_offset );
+
+/*!
+ * @brief Count code points and 4 bytes sequences with SSSE3.
+ * @param buf           Valid UTF-8 buffer.
+ * @param len           Length of buffer in bytes.
+ * @param nb_4_bytes    Pointer to store number of bytes >= 0xF0.
+ * @return The number of code points.
+ */
+static size_t utf8_count_ssse3( const char * buf, size_t len, size_t * nb_4_bytes );
+
+/*!
+ * @brief Widen leading ASCII characters 16 at a time (SSSE3).
+ * @param buf   UTF-8 buffer.
+ * @param len   Maximum number of characters to convert.
+ * @param out   Array to store code units.
+ * @return The number of characters converted (multiple of 16).
+ */
+static size_t ascii_to_utf16_ssse3( const char * buf, size_t len, uint16_t * out );
+
+/*!
+ * @brief Widen leading ASCII characters 16 at a time (SSSE3).
+ * @param buf   UTF-8 buffer.
+ * @param len   Maximum number of characters to convert.
+ * @param out   Array to store code points.
+ * @return The number of characters converted (multiple of 16).
+ */
+static size_t ascii_to_utf32_ssse3( const char * buf, size_t len, uint32_t * out );
+
+/*!
+ * @brief Narrow leading ASCII code units 8 at a time (SSSE3).
+ * @param buf   UTF-16 buffer.
+ * @param len   Maximum number of code units to convert.
+ * @param out   Buffer to store characters.
+ * @return The number of code units converted (multiple of 8).
+ */
+static size_t utf16_to_ascii_ssse3( const uint16_t * buf, size_t len, char * out );
+
+/*!
+ * @brief Narrow leading ASCII code points 8 at a time (SSSE3).
+ * @param buf   UTF-32 buffer.
+ * @param len   Maximum number of code points to convert.
+ * @param out   Buffer to store characters.
+ * @return The number of code points converted (multiple of 8).
+ */
+static size_t utf32_to_ascii_ssse3( const uint32_t * buf, size_t len, char * out );
+
+/*!
+ * @brief Validate UTF-8 buffer with AVX2.
+ * @param buf           Buffer to validate.
+ * @param len           Length of buffer in bytes.
+ * @param error_offset  Pointer to store offset of first invalid sequence (can
+ *                      be NULL).
+ * @return 0 if buffer is valid otherwise -1.
+ */
+static int utf8_validate_avx2( const char * buf, size_t len, size_t * error_offset );
+
+/*!
+ * @brief Count code points and 4 bytes sequences with AVX2.
+ * @param buf           Valid UTF-8 buffer.
+ * @param len           Length of buffer in bytes.
+ * @param nb_4_bytes    Pointer to store number of bytes >= 0xF0.
+ * @return The number of code points.
+ */
+static size_t utf8_count_avx2( const char * buf, size_t len, size_t * nb_4_bytes );
+#endif
+
+/*!
+ * @brief Implementations indexed by instruction set.
+ */
+static const utf8_impl_t s_utf8_impls[] =
+{
+    [UTF8_ISA_SCALAR] =
+    {
+        utf8_validate_scalar, utf8_count_scalar,
+        ascii_to_utf16_scalar, ascii_to_utf32_scalar,
+        utf16_to_ascii_scalar, utf32_to_ascii_scalar
+    },
+#ifdef HAVE_UTF8_X86
+    [UTF8_ISA_SSSE3] =
+    {
+        utf8_validate_ssse3, utf8_count_ssse3,
+        ascii_to_utf16_ssse3, ascii_to_utf32_ssse3,
+        utf16_to_ascii_ssse3, utf32_to_ascii_ssse3
+    },
+    [UTF8_ISA_AVX2] =
+    {
+        utf8_validate_avx2, utf8_count_avx2,
+        ascii_to_utf16_ssse3, ascii_to_utf32_ssse3,
+        utf16_to_ascii_ssse3, utf32_to_ascii_ssse3
+    },
+#endif
+};
+
+/*!
+ * @brief Implementation used by UTF-8 functions (NULL until first use,
+ *        accessed atomically: first calls can run concurrently).
+ */
+static const utf8_impl_t * s_utf8_impl = NULL;
+
+/*!
+ * @brief Return implementation used by UTF-8 functions (select it on first
+ *        call).
+ * @return The implementation.
+ */
+static inline const utf8_impl_t * get_utf8_impl( void );
+
+int utf8_set_isa( utf8_isa_t isa )
+{
+    int ret = -1;
+
+    switch ( isa )
+    {
+        case UTF8_ISA_SCALAR:
+            ret = 0;
+        break;
+#ifdef HAVE_UTF8_X86
+        case UTF8_ISA_SSSE3:
+            ret = __builtin_cpu_supports( "ssse3" ) ? 0 : -1;
+        break;
+        case UTF8_ISA_AVX2:
+            ret = __builtin_cpu_supports( "avx2" ) ? 0 : -1;
+        break;
+#endif
+        default:
+            ret = -1;
+        break;
+    }
+
+    if ( 0 == ret )
+    {
+        __atomic_store_n( &s_utf8_impl, &s_utf8_impls[isa], __ATOMIC_RELEASE );
+    }
+
+    return ret;
+}
+
+utf8_isa_t utf8_get_isa( void )
+{
+    return (utf8_isa_t)( get_utf8_impl() - s_utf8_impls );
+}
+
+int utf8_validate( const char * buf, size_t len, size_t * error_offset )
+{
+    ASSERT_PTR( buf, -1 );
+
+    return get_utf8_impl()->validate( buf, len, error_offset );
+}
+
+size_t utf8_count_code_points( const char * buf, size_t len )
+{
+    size_t nb_4_bytes;
+
+    ASSERT_PTR( buf, 0 );
+
+    return get_utf8_impl()->count( buf, len, &nb_4_bytes );
+}
+
+size_t utf8_utf16_length( const char * buf, size_t len )
+{
+    size_t nb_4_bytes;
+    size_t ret;
+
+    ASSERT_PTR( buf, 0 );
+
+    /* Code points above U+FFFF are surrogate pairs */
+    ret = get_utf8_impl()->count( buf, len, &nb_4_bytes );
+
+    return ret + nb_4_bytes;
+}
+
+size_t utf16_utf8_length( const uint16_t * buf, size_t len )
+{
+    size_t ret = 0;
+    size_t i;
+
+    ASSERT_PTR( buf, 0 );
+
+    for ( i = 0; i < len; i++ )
+    {
+        if ( buf[i] < 0x80 )
+        {
+            ret += 1;
+        }
+        else if ( buf[i] < 0x800 )
+        {
+            ret += 2;
+        }
+        else if ( ( buf[i] >= 0xD800 ) && ( buf[i] <= 0xDBFF ) )
+        {
+            /* Surrogate pair: 4 bytes for 2 code units */
+            ret += 4;
+            i++;
+        }
+        else
+        {
+            ret += 3;
+        }
+    }
+
+    return ret;
+}
+
+size_t utf32_utf8_length( const uint32_t * buf, size_t len )
+{
+    size_t ret = 0;
+    size_t i;
+
+    ASSERT_PTR( buf, 0 );
+
+    for ( i = 0; i < len; i++ )
+    {
+        ret += 1 + ( buf[i] >= 0x80 ) + ( buf[i] >= 0x800 ) + ( buf[i] >= 0x10000 );
+    }
+
+    return ret;
+}
+
+int utf8_to_utf16( const char * buf,
+                   size_t len,
+                   uint16_t * out,
+                   size_t max_out,
+                   size_t * nb_out )
+{
+    const utf8_impl_t * impl;
+    const uint8_t * p = (const uint8_t *)buf;
+    size_t i = 0;
+    size_t j = 0;
+    size_t n;
+    uint32_t cp;
+
+    ASSERT_PTR( buf, -1 );
+    ASSERT_PTR( out, -1 );
+    ASSERT_PTR( nb_out, -1 );
+
+    /* Input is validated first by vectorized validator, sequences are then
+       decoded without check */
+    impl = get_utf8_impl();
+    if ( 0 != impl->validate( buf, len, NULL ) )
+    {
+        return -1;
+    }
+
+    while ( i < len )
+    {
+        if ( p[i] < 0x80 )
+        {
+            /* Run of ASCII characters */
+            n = impl->ascii_to_utf16( buf + i, ( len - i < max_out - j ) ? len - i : max_out - j,
+                                      out + j );
+            i += n;
+            j += n;
+            for ( ; ( i < len ) && ( p[i] < 0x80 ); i++, j++ )
+            {
+                if ( j >= max_out )
+                {
+                    return -1;
+                }
+                out[j] = p[i];
+            }
+            continue;
+        }
+
+        i += decode_valid_utf8( p + i, &cp );
+
+        if ( cp >= 0x10000 )
+        {
+            if ( max_out - j < 2 )
+            {
+                return -1;
+            }
+            cp -= 0x10000;
+            out[j++] = (uint16_t)( 0xD800 + ( cp >> 10 ) );
+            out[j++] = (uint16_t)( 0xDC00 + ( cp & 0x3FF ) );
+        }
+        else
+        {
+            if ( j >= max_out )
+            {
+                return -1;
+            }
+            out[j++] = (uint16_t)cp;
+        }
+    }
+
+    *nb_out = j;
+
+    return 0;
+}
+
+int utf8_to_utf32( const char * buf,
+                   size_t len,
+                   uint32_t * out,
+                   size_t max_out,
+                   size_t * nb_out )
+{
+    const utf8_impl_t * impl;
+    const uint8_t * p = (const uint8_t *)buf;
+    size_t i = 0;
+    size_t j = 0;
+    size_t n;
+    uint32_t cp;
+
+    ASSERT_PTR( buf, -1 );
+    ASSERT_PTR( out, -1 );
+    ASSERT_PTR( nb_out, -1 );
+
+    /* Input is validated first by vectorized validator, sequences are then
+       decoded without check */
+    impl = get_utf8_impl();
+    if ( 0 != impl->validate( buf, len, NULL ) )
+    {
+        return -1;
+    }
+
+    while ( i < len )
+    {
+        if ( p[i] < 0x80 )
+        {
+            n = impl->ascii_to_utf32( buf + i, ( len - i < max_out - j ) ? len - i : max_out - j,
+                                      out + j );
+            i += n;
+            j += n;
+            for ( ; ( i < len ) && ( p[i] < 0x80 ); i++, j++ )
+            {
+                if ( j >= max_out )
+                {
+                    return -1;
+                }
+                out[j] = p[i];
+            }
+            continue;
+        }
+
+        if ( j >= max_out )
+        {
+            return -1;
+        }
+        i += decode_valid_utf8( p + i, &cp );
+        out[j++] = cp;
+    }
+
+    *nb_out = j;
+
+    return 0;
+}
+
+int utf16_to_utf8( const uint16_t * buf,
+                   size_t len,
+                   char * out,
+                   size_t max_out,
+                   size_t * nb_out )
+{
+    const utf8_impl_t * impl;
+    size_t i = 0;
+    size_t j = 0;
+    size_t n;
+    uint32_t cp;
+
+    ASSERT_PTR( buf, -1 );
+    ASSERT_PTR( out, -1 );
+    ASSERT_PTR( nb_out, -1 );
+
+    impl = get_utf8_impl();
+    while ( i < len )
+    {
+        cp = buf[i];
+        if ( cp < 0x80 )
+        {
+            n = impl->utf16_to_ascii( buf + i, ( len - i < max_out - j ) ? len - i : max_out - j,
+                                      out + j );
+            i += n;
+            j += n;
+            for ( ; ( i < len ) && ( buf[i] < 0x80 ); i++, j++ )
+            {
+                if ( j >= max_out )
+                {
+                    return -1;
+                }
+                out[j] = (char)buf[i];
+            }
+            continue;
+        }
+
+        if ( ( cp >= 0xD800 ) && ( cp <= 0xDFFF ) )
+        {
+            /* High surrogate followed by low surrogate */
+            if ( ( cp > 0xDBFF ) || ( i + 1 >= len ) ||
+                 ( buf[i + 1] < 0xDC00 ) || ( buf[i + 1] > 0xDFFF ) )
+            {
+                return -1;
+            }
+            cp = 0x10000 + ( ( cp - 0xD800 ) << 10 ) + ( buf[i + 1] - 0xDC00 );
+            i++;
+        }
+        i++;
+
+        n = encode_utf8( cp, out + j, max_out - j );
+        if ( 0 == n )
+        {
+            return -1;
+        }
+        j += n;
+    }
+
+    *nb_out = j;
+
+    return 0;
+}
+
+int utf32_to_utf8( const uint32_t * buf,
+                   size_t len,
+                   char * out,
+                   size_t max_out,
+                   size_t * nb_out )
+{
+    const utf8_impl_t * impl;
+    size_t i = 0;
+    size_t j = 0;
+    size_t n;
+
+    ASSERT_PTR( buf, -1 );
+    ASSERT_PTR( out, -1 );
+    ASSERT_PTR( nb_out, -1 );
+
+    impl = get_utf8_impl();
+    while ( i < len )
+    {
+        if ( buf[i] < 0x80 )
+        {
+            n = impl->utf32_to_ascii( buf + i, ( len - i < max_out - j ) ? len - i : max_out - j,
+                                      out + j );
+            i += n;
+            j += n;
+            for ( ; ( i < len ) && ( buf[i] < 0x80 ); i++, j++ )
+            {
+                if ( j >= max_out )
+                {
+                    return -1;
+                }
+                out[j] = (char)buf[i];
+            }
+            continue;
+        }
+
+        if ( ( buf[i] > 0x10FFFF ) || ( ( buf[i] >= 0xD800 ) && ( buf[i] <= 0xDFFF ) ) )
+        {
+            return -1;
+        }
+
+        n = encode_utf8( buf[i], out + j, max_out - j );
+        if ( 0 == n )
+        {
+            return -1;
+        }
+        i++;
+        j += n;
+    }
+
+    *nb_out = j;
+
+    return 0;
+}
+
+const utf8_impl_t * get_utf8_impl( void )
+{
+    const utf8_impl_t * impl = __atomic_load_n( &s_utf8_impl, __ATOMIC_ACQUIRE );
+
+    if ( ! impl )
+    {
+        /* Threads racing here select the same implementation */
+        if ( ( 0 != utf8_set_isa( UTF8_ISA_AVX2 ) ) &&
+             ( 0 != utf8_set_isa( UTF8_ISA_SSSE3 ) ) )
+        {
+            utf8_set_isa( UTF8_ISA_SCALAR );
+        }
+        impl = __atomic_load_n( &s_utf8_impl, __ATOMIC_ACQUIRE );
+    }
+
+    return impl;
+}
+
+size_t decode_utf8( const uint8_t * p, size_t len, uint32_t * cp )
+{
+    uint8_t c = p[0];
+    uint8_t lo = 0x80;
+    uint8_t hi = 0xBF;
+
+    if ( c < 0x80 )
+    {
+        *cp = c;
+        return 1;
+    }
+    else if ( c < 0xC2 )
+    {
+        /* Continuation or overlong 2 bytes sequence */
+        return 0;
+    }
+    else if ( c < 0xE0 )
+    {
+        if ( ( len < 2 ) || ( ( p[1] & 0xC0 ) != 0x80 ) )
+        {
+            return 0;
+        }
+        *cp = ( (uint32_t)( c & 0x1F ) << 6 ) | ( p[1] & 0x3F );
+        return 2;
+    }
+    else if ( c < 0xF0 )
+    {
+        /* Second byte range excludes overlong forms and surrogates */
+        if ( 0xE0 == c )
+        {
+            lo = 0xA0;
+        }
+        else if ( 0xED == c )
+        {
+            hi = 0x9F;
+        }
+        if ( ( len < 3 ) || ( p[1] < lo ) || ( p[1] > hi ) || ( ( p[2] & 0xC0 ) != 0x80 ) )
+        {
+            return 0;
+        }
+        *cp = ( (uint32_t)( c & 0x0F ) << 12 ) | ( (uint32_t)( p[1] & 0x3F ) << 6 ) |
+              ( p[2] & 0x3F );
+        return 3;
+    }
+    else if ( c < 0xF5 )
+    {
+        /* Second byte range excludes overlong forms and values > U+10FFFF */
+        if ( 0xF0 == c )
+        {
+            lo = 0x90;
+        }
+        else if ( 0xF4 == c )
+        {
+            hi = 0x8F;
+        }
+        if ( ( len < 4 ) || ( p[1] < lo ) || ( p[1] > hi ) ||
+             ( ( p[2] & 0xC0 ) != 0x80 ) || ( ( p[3] & 0xC0 ) != 0x80 ) )
+        {
+            return 0;
+        }
+        *cp = ( (uint32_t)( c & 0x07 ) << 18 ) | ( (uint32_t)( p[1] & 0x3F ) << 12 ) |
+              ( (uint32_t)( p[2] & 0x3F ) << 6 ) | ( p[3] & 0x3F );
+        return 4;
+    }
+
+    return 0;
+}
+
+size_t decode_valid_utf8( const uint8_t * p, uint32_t * cp )
+{
+    if ( p[0] < 0xE0 )
+    {
+        *cp = ( (uint32_t)( p[0] & 0x1F ) << 6 ) | ( p[1] & 0x3F );
+        return 2;
+    }
+    else if ( p[0] < 0xF0 )
+    {
+        *cp = ( (uint32_t)( p[0] & 0x0F ) << 12 ) | ( (uint32_t)( p[1] & 0x3F ) << 6 ) |
+              ( p[2] & 0x3F );
+        return 3;
+    }
+
+    *cp = ( (uint32_t)( p[0] & 0x07 ) << 18 ) | ( (uint32_t)( p[1] & 0x3F ) << 12 ) |
+          ( (uint32_t)( p[2] & 0x3F ) << 6 ) | ( p[3] & 0x3F );
+    return 4;
+}
+
+size_t encode_utf8( uint32_t cp, char * out, size_t avail )
+{
+    if ( cp < 0x80 )
+    {
+        if ( avail < 1 )
+        {
+            return 0;
+        }
+        out[0] = (char)cp;
+        return 1;
+    }
+    else if ( cp < 0x800 )
+    {
+        if ( avail < 2 )
+        {
+            return 0;
+        }
+        out[0] = (char)( 0xC0 | ( cp >> 6 ) );
+        out[1] = (char)( 0x80 | ( cp & 0x3F ) );
+        return 2;
+    }
+    else if ( cp < 0x10000 )
+    {
+        if ( avail < 3 )
+        {
+            return 0;
+        }
+        out[0] = (char)( 0xE0 | ( cp >> 12 ) );
+        out[1] = (char)( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+        out[2] = (char)( 0x80 | ( cp & 0x3F ) );
+        return 3;
+    }
+
+    if ( avail < 4 )
+    {
+        return 0;
+    }
+    out[0] = (char)( 0xF0 | ( cp >> 18 ) );
+    out[1] = (char)( 0x80 | ( ( cp >> 12 ) & 0x3F ) );
+    out[2] = (char)( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+    out[3] = (char)( 0x80 | ( cp & 0x3F ) );
+    return 4;
+}
+
+int utf8_validate_scalar( const char * buf, size_t len, size_t * error_offset )
+{
+    const uint8_t * p = (const uint8_t *)buf;
+    uint64_t word;
+    uint32_t cp;
+    size_t i = 0;
+    size_t n;
+
+    while ( i < len )
+    {
+        /* 8 ASCII characters at a time */
+        if ( len - i >= 8 )
+        {
+            memcpy( &word, p + i, sizeof( word ) );
+            if ( 0 == ( word & 0x8080808080808080ULL ) )
+            {
+                i += 8;
+                continue;
+            }
+        }
+
+        n = decode_utf8( p + i, len - i, &cp );
+        if ( 0 == n )
+        {
+            if ( error_offset )
+            {
+                *error_offset = i;
+            }
+            return -1;
+        }
+        i += n;
+    }
+
+    return 0;
+}
+
+int utf8_validate_from( const char * buf,
+                        size_t len,
+                        size_t pos,
+                        size_t * error_offset )
+{
+    size_t start = pos;
+    size_t k;
+
+    /* Restart at the last sequence which starts before pos (it may be
+       incomplete), bytes before are valid */
+    for ( k = 0; ( k < 4 ) && ( start > 0 ); k++ )
+    {
+        start--;
+        if ( ( (uint8_t)buf[start] & 0xC0 ) != 0x80 )
+        {
+            break;
+        }
+    }
+
+    if ( 0 == utf8_validate_scalar( buf + start, len - start, error_offset ) )
+    {
+        return 0;
+    }
+    if ( error_offset )
+    {
+        *error_offset += start;
+    }
+
+    return -1;
+}
+
+size_t utf8_count_scalar( const char * buf, size_t len, size_t * nb_4_bytes )
+{
+    const uint8_t * p = (const uint8_t *)buf;
+    size_t ret = 0;
+    size_t nb = 0;
+    size_t i;
+
+    for ( i = 0; i < len; i++ )
+    {
+        ret += ( ( p[i] & 0xC0 ) != 0x80 );
+        nb += ( p[i] >= 0xF0 );
+    }
+    *nb_4_bytes = nb;
+
+    return ret;
+}
+
+size_t ascii_to_utf16_scalar( const char * buf, size_t len, uint16_t * out )
+{
+    (void)buf;
+    (void)len;
+    (void)out;
+
+    return 0;
+}
+
+size_t ascii_to_utf32_scalar( const char * buf, size_t len, uint32_t * out )
+{
+    (void)buf;
+    (void)len;
+    (void)out;
+
+    return 0;
+}
+
+size_t utf16_to_ascii_scalar( const uint16_t * buf, size_t len, char * out )
+{
+    (void)buf;
+    (void)len;
+    (void)out;
+
+    return 0;
+}
+
+size_t utf32_to_ascii_scalar( const uint32_t * buf, size_t len, char * out )
+{
+    (void)buf;
+    (void)len;
+    (void)out;
+
+    return 0;
+}
+
+#ifdef HAVE_UTF8_X86
+/*
+ * Error classes of two consecutive bytes (byte 1, byte 2) of lookup
+ * algorithm: an error is found if a class bit is set in the three lookups.
+ */
+#define TOO_SHORT       ( 1 << 0 )  /* 11______ 0_______, 11______ 11______ */
+#define TOO_LONG        ( 1 << 1 )  /* 0_______ 10______ */
+#define OVERLONG_3      ( 1 << 2 )  /* 11100000 100_____ */
+#define TOO_LARGE       ( 1 << 3 )  /* 11110100 1001____ ... 11111___ 101_____ */
+#define SURROGATE       ( 1 << 4 )  /* 11101101 101_____ */
+#define OVERLONG_2      ( 1 << 5 )  /* 1100000_ 10______ */
+#define TOO_LARGE_1000  ( 1 << 6 )  /* 11110101 1000____ ... 11111___ 1000____ */
+#define OVERLONG_4      ( 1 << 6 )  /* 11110000 1000____ */
+#define TWO_CONTS       ( 1 << 7 )  /* 10______ 10______ */
+#define CARRY           ( TOO_SHORT | TOO_LONG | TWO_CONTS )
+
+/*!
+ * @brief Classes of byte 1 indexed by its high nibble.
+ */
+#define BYTE_1_HIGH_TABLE \
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, \
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, \
+    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS, \
+    TOO_SHORT | OVERLONG_2, \
+    TOO_SHORT, \
+    TOO_SHORT | OVERLONG_3 | SURROGATE, \
+    (char)( TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4 )
+
+/*!
+ * @brief Classes of byte 1 indexed by its low nibble.
+ */
+#define BYTE_1_LOW_TABLE \
+    (char)( CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4 ), \
+    (char)( CARRY | OVERLONG_2 ), \
+    (char)CARRY, \
+    (char)CARRY, \
+    (char)( CARRY | TOO_LARGE ), \
+    (char)( CARRY | TOO_LARGE | TOO_LARGE_1000 ), \
+    (char)( CARRY | TOO_LARGE | TOO_LARGE_1000 ), \
+    (char)( CARRY | TOO_LARGE | TOO_LARGE_1000 ), \
+    (char)( CARRY | TOO_LARGE | TOO_LARGE_1000 ), \
+    (char)( CARRY | TOO_LARGE | TOO_LARGE_1000 ), \
+    (char)( CARRY | TOO_LARGE | TOO_LARGE_1000 ), \
+    (char)( CARRY | TOO_LARGE | TOO_LARGE_1000 ), \
+    (char)( CARRY | TOO_LARGE | TOO_LARGE_1000 ), \
+    (char)( CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE ), \
+    (char)( CARRY | TOO_LARGE | TOO_LARGE_1000 ), \
+    (char)( CARRY | TOO_LARGE | TOO_LARGE_1000 )
+
+/*!
+ * @brief Classes of byte 2 indexed by its high nibble.
+ */
+#define BYTE_2_HIGH_TABLE \
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, \
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, \
+    (char)( TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4 ), \
+    (char)( TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE ), \
+    (char)( TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE ), \
+    (char)( TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE ), \
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+
+/*!
+ * @brief Maximum value of the last 3 bytes of a block which does not start
+ *        a sequence continued in next block.
+ */
+#define INCOMPLETE_TABLE \
+    (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, \
+    (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, \
+    (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, \
+    (char)0xFF, (char)( 0xF0 - 1 ), (char)( 0xE0 - 1 ), (char)( 0xC0 - 1 )
+
+/*!
+ * @brief Validate 16 bytes given the previous 16 bytes.
+ * @param input             Bytes to validate.
+ * @param prev              Previous bytes.
+ * @param prev_incomplete   Incomplete sequences at end of previous bytes
+ *                          (updated).
+ * @param error             Errors (updated).
+ * @return None.
+ */
+__attribute__(( target( "ssse3" ) ))
+static inline void validate_block_ssse3( __m128i input,
+                                         __m128i prev,
+                                         __m128i * prev_incomplete,
+                                         __m128i * error )
+{
+    const __m128i b1h = _mm_setr_epi8( BYTE_1_HIGH_TABLE );
+    const __m128i b1l = _mm_setr_epi8( BYTE_1_LOW_TABLE );
+    const __m128i b2h = _mm_setr_epi8( BYTE_2_HIGH_TABLE );
+    const __m128i max_value = _mm_setr_epi8( INCOMPLETE_TABLE );
+    const __m128i nibble = _mm_set1_epi8( 0x0F );
+    __m128i prev1;
+    __m128i prev2;
+    __m128i prev3;
+    __m128i sc;
+    __m128i must23;
+
+    /* ASCII block: only a sequence of previous block can be incomplete */
+    if ( 0 == _mm_movemask_epi8( input ) )
+    {
+        *error = _mm_or_si128( *error, *prev_incomplete );
+        *prev_incomplete = _mm_setzero_si128();
+        return;
+    }
+
+    prev1 = _mm_alignr_epi8( input, prev, 15 );
+    sc = _mm_and_si128( _mm_and_si128(
+            _mm_shuffle_epi8( b1h, _mm_and_si128( _mm_srli_epi16( prev1, 4 ), nibble ) ),
+            _mm_shuffle_epi8( b1l, _mm_and_si128( prev1, nibble ) ) ),
+            _mm_shuffle_epi8( b2h, _mm_and_si128( _mm_srli_epi16( input, 4 ), nibble ) ) );
+
+    /* Third and fourth bytes of sequences must be continuations */
+    prev2 = _mm_alignr_epi8( input, prev, 14 );
+    prev3 = _mm_alignr_epi8( input, prev, 13 );
+    must23 = _mm_or_si128( _mm_subs_epu8( prev2, _mm_set1_epi8( (char)( 0xE0 - 0x80 ) ) ),
+                           _mm_subs_epu8( prev3, _mm_set1_epi8( (char)( 0xF0 - 0x80 ) ) ) );
+    must23 = _mm_and_si128( must23, _mm_set1_epi8( (char)0x80 ) );
+
+    *error = _mm_or_si128( *error, _mm_xor_si128( must23, sc ) );
+    *prev_incomplete = _mm_subs_epu8( input, max_value );
+}
+
+__attribute__(( target( "ssse3" ) ))
+int utf8_validate_ssse3( const char * buf, size_t len, size_t * error_offset )
+{
+    __m128i prev = _mm_setzero_si128();
+    __m128i prev_incomplete = _mm_setzero_si128();
+    __m128i error = _mm_setzero_si128();
+    __m128i input;
+    uint8_t tail[16];
+    size_t i = 0;
+
+    for ( ; i + 16 <= len; i += 16 )
+    {
+        input = _mm_loadu_si128( (const __m128i *)( buf + i ) );
+        validate_block_ssse3( input, prev, &prev_incomplete, &error );
+        if ( 0xFFFF != _mm_movemask_epi8( _mm_cmpeq_epi8( error, _mm_setzero_si128() ) ) )
+        {
+            return utf8_validate_from( buf, len, i, error_offset );
+        }
+        prev = input;
+    }
+
+    /* Last bytes padded with NUL (ASCII): incomplete sequences are errors */
+    if ( i < len )
+    {
+        memset( tail, 0, sizeof( tail ) );
+        memcpy( tail, buf + i, len - i );
+        validate_block_ssse3( _mm_loadu_si128( (const __m128i *)tail ), prev,
+                              &prev_incomplete, &error );
+    }
+    error = _mm_or_si128( error, prev_incomplete );
+    if ( 0xFFFF != _mm_movemask_epi8( _mm_cmpeq_epi8( error, _mm_setzero_si128() ) ) )
+    {
+        return utf8_validate_from( buf, len, i, error_offset );
+    }
+
+    return 0;
+}
+
+__attribute__(( target( "ssse3" ) ))
+size_t utf8_count_ssse3( const char * buf, size_t len, size_t * nb_4_bytes )
+{
+    const __m128i cont_max = _mm_set1_epi8( (char)0xBF );
+    const __m128i lead_4 = _mm_set1_epi8( (char)0xF0 );
+    __m128i total = _mm_setzero_si128();
+    __m128i total_4 = _mm_setzero_si128();
+    __m128i acc;
+    __m128i acc_4;
+    __m128i x;
+    uint64_t sums[2];
+    size_t nb = 0;
+    size_t ret = 0;
+    size_t i = 0;
+    size_t k;
+
+    while ( i + 16 <= len )
+    {
+        /* Byte counters are summed before they overflow (255 blocks) */
+        acc = _mm_setzero_si128();
+        acc_4 = _mm_setzero_si128();
+        for ( k = 0; ( k < 255 ) && ( i + 16 <= len ); k++, i += 16 )
+        {
+            x = _mm_loadu_si128( (const __m128i *)( buf + i ) );
+            /* Signed compare: bytes > 0xBF are ASCII or leads */
+            acc = _mm_sub_epi8( acc, _mm_cmpgt_epi8( x, cont_max ) );
+            acc_4 = _mm_sub_epi8( acc_4, _mm_cmpeq_epi8( _mm_max_epu8( x, lead_4 ), x ) );
+        }
+        total = _mm_add_epi64( total, _mm_sad_epu8( acc, _mm_setzero_si128() ) );
+        total_4 = _mm_add_epi64( total_4, _mm_sad_epu8( acc_4, _mm_setzero_si128() ) );
+    }
+
+    ret = utf8_count_scalar( buf + i, len - i, &nb );
+    _mm_storeu_si128( (__m128i *)sums, total );
+    ret += sums[0] + sums[1];
+    _mm_storeu_si128( (__m128i *)sums, total_4 );
+    *nb_4_bytes = nb + sums[0] + sums[1];
+
+    return ret;
+}
+
+__attribute__(( target( "ssse3" ) ))
+size_t ascii_to_utf16_ssse3( const char * buf, size_t len, uint16_t * out )
+{
+    __m128i x;
+    size_t i = 0;
+
+    for ( ; i + 16 <= len; i += 16 )
+    {
+        x = _mm_loadu_si128( (const __m128i *)( buf + i ) );
+        if ( 0 != _mm_movemask_epi8( x ) )
+        {
+            break;
+        }
+        _mm_storeu_si128( (__m128i *)( out + i ), _mm_unpacklo_epi8( x, _mm_setzero_si128() ) );
+        _mm_storeu_si128( (__m128i *)( out + i + 8 ), _mm_unpackhi_epi8( x, _mm_setzero_si128() ) );
+    }
+
+    return i;
+}
+
+__attribute__(( target( "ssse3" ) ))
+size_t ascii_to_utf32_ssse3( const char * buf, size_t len, uint32_t * out )
+{
+    __m128i x;
+    __m128i lo;
+    __m128i hi;
+    size_t i = 0;
+
+    for ( ; i + 16 <= len; i += 16 )
+    {
+        x = _mm_loadu_si128( (const __m128i *)( buf + i ) );
+        if ( 0 != _mm_movemask_epi8( x ) )
+        {
+            break;
+        }
+        lo = _mm_unpacklo_epi8( x, _mm_setzero_si128() );
+        hi = _mm_unpackhi_epi8( x, _mm_setzero_si128() );
+        _mm_storeu_si128( (__m128i *)( out + i ), _mm_unpacklo_epi16( lo, _mm_setzero_si128() ) );
+        _mm_storeu_si128( (__m128i *)( out + i + 4 ), _mm_unpackhi_epi16( lo, _mm_setzero_si128() ) );
+        _mm_storeu_si128( (__m128i *)( out + i + 8 ), _mm_unpacklo_epi16( hi, _mm_setzero_si128() ) );
+        _mm_storeu_si128( (__m128i *)( out + i + 12 ), _mm_unpackhi_epi16( hi, _mm_setzero_si128() ) );
+    }
+
+    return i;
+}
+
+__attribute__(( target( "ssse3" ) ))
+size_t utf16_to_ascii_ssse3( const uint16_t * buf, size_t len, char * out )
+{
+    const __m128i not_ascii = _mm_set1_epi16( (short)0xFF80 );
+    __m128i x;
+    size_t i = 0;
+
+    for ( ; i + 8 <= len; i += 8 )
+    {
+        x = _mm_loadu_si128( (const __m128i *)( buf + i ) );
+        if ( 0xFFFF != _mm_movemask_epi8( _mm_cmpeq_epi16( _mm_and_si128( x, not_ascii ),
+                                                           _mm_setzero_si128() ) ) )
+        {
+            break;
+        }
+        _mm_storel_epi64( (__m128i *)( out + i ), _mm_packus_epi16( x, x ) );
+    }
+
+    return i;
+}
+
+__attribute__(( target( "ssse3" ) ))
+size_t utf32_to_ascii_ssse3( const uint32_t * buf, size_t len, char * out )
+{
+    const __m128i not_ascii = _mm_set1_epi32( (int)0xFFFFFF80 );
+    __m128i lo;
+    __m128i hi;
+    __m128i x;
+    size_t i = 0;
+
+    for ( ; i + 8 <= len; i += 8 )
+    {
+        lo = _mm_loadu_si128( (const __m128i *)( buf + i ) );
+        hi = _mm_loadu_si128( (const __m128i *)( buf + i + 4 ) );
+        if ( 0xFFFF != _mm_movemask_epi8( _mm_cmpeq_epi32(
+                _mm_and_si128( _mm_or_si128( lo, hi ), not_ascii ), _mm_setzero_si128() ) ) )
+        {
+            break;
+        }
+        x = _mm_packs_epi32( lo, hi );
+        _mm_storel_epi64( (__m128i *)( out + i ), _mm_packus_epi16( x, x ) );
+    }
+
+    return i;
+}
+
+/*!
+ * @brief Shift 32 bytes by n bytes, inserting last bytes of previous block.
+ * @param input Current bytes.
+ * @param prev  Previous bytes.
+ * @param n     Number of bytes (1 to 3).
+ * @return Bytes input[-n..31-n].
+ */
+#define PREV_AVX2( input, prev, n ) \
+    _mm256_alignr_epi8( input, _mm256_permute2x128_si256( prev, input, 0x21 ), 16 - ( n ) )
+
+/*!
+ * @brief Validate 32 bytes given the previous 32 bytes.
+ * @param input             Bytes to validate.
+ * @param prev              Previous bytes.
+ * @param prev_incomplete   Incomplete sequences at end of previous bytes
+ *                          (updated).
+ * @param error             Errors (updated).
+ * @return None.
+ */
+__attribute__(( target( "avx2" ) ))
+static inline void validate_block_avx2( __m256i input,
+                                        __m256i prev,
+                                        __m256i * prev_incomplete,
+                                        __m256i * error )
+{
+    const __m256i b1h = _mm256_setr_epi8( BYTE_1_HIGH_TABLE, BYTE_1_HIGH_TABLE );
+    const __m256i b1l = _mm256_setr_epi8( BYTE_1_LOW_TABLE, BYTE_1_LOW_TABLE );
+    const __m256i b2h = _mm256_setr_epi8( BYTE_2_HIGH_TABLE, BYTE_2_HIGH_TABLE );
+    const __m256i max_value = _mm256_setr_epi8( (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF,
+                                                (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF,
+                                                (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF,
+                                                (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF,
+                                                INCOMPLETE_TABLE );
+    const __m256i nibble = _mm256_set1_epi8( 0x0F );
+    __m256i prev1;
+    __m256i sc;
+    __m256i must23;
+
+    if ( 0 == _mm256_movemask_epi8( input ) )
+    {
+        *error = _mm256_or_si256( *error, *prev_incomplete );
+        *prev_incomplete = _mm256_setzero_si256();
+        return;
+    }
+
+    prev1 = PREV_AVX2( input, prev, 1 );
+    sc = _mm256_and_si256( _mm256_and_si256(
+            _mm256_shuffle_epi8( b1h, _mm256_and_si256( _mm256_srli_epi16( prev1, 4 ), nibble ) ),
+            _mm256_shuffle_epi8( b1l, _mm256_and_si256( prev1, nibble ) ) ),
+            _mm256_shuffle_epi8( b2h, _mm256_and_si256( _mm256_srli_epi16( input, 4 ), nibble ) ) );
+
+    must23 = _mm256_or_si256(
+            _mm256_subs_epu8( PREV_AVX2( input, prev, 2 ), _mm256_set1_epi8( (char)( 0xE0 - 0x80 ) ) ),
+            _mm256_subs_epu8( PREV_AVX2( input, prev, 3 ), _mm256_set1_epi8( (char)( 0xF0 - 0x80 ) ) ) );
+    must23 = _mm256_and_si256( must23, _mm256_set1_epi8( (char)0x80 ) );
+
+    *error = _mm256_or_si256( *error, _mm256_xor_si256( must23, sc ) );
+    *prev_incomplete = _mm256_subs_epu8( input, max_value );
+}
+
+__attribute__(( target( "avx2" ) ))
+int utf8_validate_avx2( const char * buf, size_t len, size_t * error_offset )
+{
+    __m256i prev = _mm256_setzero_si256();
+    __m256i prev_incomplete = _mm256_setzero_si256();
+    __m256i error = _mm256_setzero_si256();
+    __m256i input;
+    uint8_t tail[32];
+    size_t i = 0;
+
+    for ( ; i + 32 <= len; i += 32 )
+    {
+        input = _mm256_loadu_si256( (const __m256i *)( buf + i ) );
+        validate_block_avx2( input, prev, &prev_incomplete, &error );
+        if ( ! _mm256_testz_si256( error, error ) )
+        {
+            return utf8_validate_from( buf, len, i, error_offset );
+        }
+        prev = input;
+    }
+
+    if ( i < len )
+    {
+        memset( tail, 0, sizeof( tail ) );
+        memcpy( tail, buf + i, len - i );
+        validate_block_avx2( _mm256_loadu_si256( (const __m256i *)tail ), prev,
+                             &prev_incomplete, &error );
+    }
+    error = _mm256_or_si256( error, prev_incomplete );
+    if ( ! _mm256_testz_si256( error, error ) )
+    {
+        return utf8_validate_from( buf, len, i, error_offset );
+    }
+
+    return 0;
+}
+
+__attribute__(( target( "avx2" ) ))
+size_t utf8_count_avx2( const char * buf, size_t len, size_t * nb_4_bytes )
+{
+    const __m256i cont_max = _mm256_set1_epi8( (char)0xBF );
+    const __m256i lead_4 = _mm256_set1_epi8( (char)0xF0 );
+    __m256i total = _mm256_setzero_si256();
+    __m256i total_4 = _mm256_setzero_si256();
+    __m256i acc;
+    __m256i acc_4;
+    __m256i x;
+    uint64_t sums[4];
+    size_t nb = 0;
+    size_t ret = 0;
+    size_t i = 0;
+    size_t k;
+
+    while ( i + 32 <= len )
+    {
+        acc = _mm256_setzero_si256();
+        acc_4 = _mm256_setzero_si256();
+        for ( k = 0; ( k < 255 ) && ( i + 32 <= len ); k++, i += 32 )
+        {
+            x = _mm256_loadu_si256( (const __m256i *)( buf + i ) );
+            acc = _mm256_sub_epi8( acc, _mm256_cmpgt_epi8( x, cont_max ) );
+            acc_4 = _mm256_sub_epi8( acc_4, _mm256_cmpeq_epi8( _mm256_max_epu8( x, lead_4 ), x ) );
+        }
+        total = _mm256_add_epi64( total, _mm256_sad_epu8( acc, _mm256_setzero_si256() ) );
+        total_4 = _mm256_add_epi64( total_4, _mm256_sad_epu8( acc_4, _mm256_setzero_si256() ) );
+    }
+
+    ret = utf8_count_scalar( buf + i, len - i, &nb );
+    _mm256_storeu_si256( (__m256i *)sums, total );
+    ret += sums[0] + sums[1] + sums[2] + sums[3];
+    _mm256_storeu_si256( (__m256i *)sums, total_4 );
+    *nb_4_bytes = nb + sums[0] + sums[1] + sums[2] + sums[3];
+
+    return ret;
+}
+#endif
@@ -1,6 +1,6 @@
-################################################################################
-# Author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)                       #
-# Date: 12/02/2023                                                             #
-################################################################################
-
-CROSS="/usr/bin/x86_64-pc-msys-"
+################################################################################
+# Author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)                       #
+# Date: 12/02/2023                                                             #
+################################################################################
+
+CROSS="/usr/bin/x86_64-pc-msys-"
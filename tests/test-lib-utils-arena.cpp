@@ -0,0 +1,126 @@
+/*!
+ * @file: test-lib-utils-arena.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for arena allocator.
+ */
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+extern "C"
+{
+    #include "lib-utils-arena.h"
+}
+
+namespace
+{
+    // Tests arena -> Valid case
+    TEST( arena, valid_cases )
+    {
+        arena_t * arena = arena_create( 256 );
+        std::vector<char *> ptrs;
+
+        ASSERT_NE( arena, nullptr );
+        ASSERT_EQ( arena_get_capacity( arena ), 0u );
+
+        // Allocations do not overlap and keep their content
+        for( int i = 0; i < 100; i++ )
+        {
+            char * ptr = (char *)arena_alloc( arena, 1 + i % 40 );
+
+            ASSERT_NE( ptr, nullptr );
+            ASSERT_EQ( (uintptr_t)ptr % alignof( max_align_t ), 0u );
+            memset( ptr, i, 1 + i % 40 );
+            ptrs.push_back( ptr );
+        }
+        for( int i = 0; i < 100; i++ )
+        {
+            for( int j = 0; j < 1 + i % 40; j++ )
+            {
+                ASSERT_EQ( ptrs[i][j], (char)i );
+            }
+        }
+
+        // Packed allocations
+        char * a = (char *)arena_alloc_aligned( arena, 3, 1 );
+        char * b = (char *)arena_alloc_aligned( arena, 3, 1 );
+        ASSERT_EQ( b, a + 3 );
+
+        // Large alignment and allocation larger than a block
+        void * aligned = arena_alloc_aligned( arena, 10, 4096 );
+        ASSERT_NE( aligned, nullptr );
+        ASSERT_EQ( (uintptr_t)aligned % 4096, 0u );
+        char * large = (char *)arena_alloc( arena, 100000 );
+        ASSERT_NE( large, nullptr );
+        memset( large, 0, 100000 );
+
+        // Zero size allocation is valid
+        ASSERT_NE( arena_alloc( arena, 0 ), nullptr );
+
+        arena_destroy( arena );
+        arena_destroy( NULL );
+    }
+
+    // Tests arena -> Reset reuses blocks
+    TEST( arena, reset )
+    {
+        arena_t * arena = arena_create( 0 );
+        void * first;
+        size_t capacity;
+
+        ASSERT_NE( arena, nullptr );
+
+        first = arena_alloc( arena, 16 );
+        for( int i = 0; i < 10000; i++ )
+        {
+            ASSERT_NE( arena_alloc( arena, 64 ), nullptr );
+        }
+        capacity = arena_get_capacity( arena );
+        ASSERT_GE( capacity, 10000u * 64 );
+
+        for( int round = 0; round < 5; round++ )
+        {
+            arena_reset( arena );
+            ASSERT_EQ( arena_alloc( arena, 16 ), first );
+            for( int i = 0; i < 10000; i++ )
+            {
+                ASSERT_NE( arena_alloc( arena, 64 ), nullptr );
+            }
+            ASSERT_EQ( arena_get_capacity( arena ), capacity );
+        }
+
+        // Reset of an empty arena
+        arena_t * empty = arena_create( 0 );
+        arena_reset( empty );
+        ASSERT_NE( arena_alloc( empty, 1 ), nullptr );
+        arena_destroy( empty );
+
+        arena_destroy( arena );
+    }
+
+    // Tests arena -> Invalid case
+    TEST( arena, invalid_cases )
+    {
+        arena_t * arena = arena_create( 0 );
+
+        ASSERT_NE( arena, nullptr );
+        ASSERT_EQ( arena_alloc( NULL, 1 ), nullptr );
+        ASSERT_EQ( arena_alloc_aligned( arena, 1, 0 ), nullptr );
+        ASSERT_EQ( arena_alloc_aligned( arena, 1, 3 ), nullptr );
+        ASSERT_EQ( arena_alloc( arena, SIZE_MAX ), nullptr );
+        ASSERT_EQ( arena_alloc( arena, SIZE_MAX - 64 ), nullptr );
+        ASSERT_EQ( arena_get_capacity( NULL ), 0u );
+        arena_reset( NULL );
+
+        arena_destroy( arena );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
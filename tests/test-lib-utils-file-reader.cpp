@@ -0,0 +1,246 @@
+/*!
+ * @file: test-lib-utils-file-reader.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for file reader functions.
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+extern "C"
+{
+    #include "lib-utils-file-reader.h"
+    #include "lib-utils-parse-number.h"
+}
+
+namespace
+{
+    // Temporary file removed at end of scope
+    class temp_file
+    {
+        public:
+            explicit temp_file( const std::string & content )
+            {
+                char tmp[] = "/tmp/test-lib-utils-file-reader-XXXXXX";
+                int fd = mkstemp( tmp );
+
+                path = tmp;
+                if( fd >= 0 )
+                {
+                    if( write( fd, content.data(), content.size() ) !=
+                        (ssize_t)content.size() )
+                    {
+                        path.clear();
+                    }
+                    close( fd );
+                }
+            }
+
+            ~temp_file()
+            {
+                unlink( path.c_str() );
+            }
+
+            std::string path;
+    };
+
+    // Read all records and fields of file ("|" between fields, "\n" after
+    // each record)
+    std::string read_all( const std::string & path,
+                          file_reader_mode_t mode,
+                          size_t chunk_size )
+    {
+        file_reader_t reader;
+        std::string out;
+        const char * record;
+        const char * field;
+        size_t len;
+        int ret;
+
+        if( 0 != file_reader_open( &reader, path.c_str(), ',', mode, chunk_size ) )
+        {
+            return "open error";
+        }
+
+        while( 1 == ( ret = file_reader_next_record( &reader, &record, &len ) ) )
+        {
+            std::string fields;
+
+            while( 1 == file_reader_next_field( &reader, &field, &len ) )
+            {
+                fields += std::string( field, len ) + "|";
+            }
+            out += fields + "\n";
+        }
+        file_reader_close( &reader );
+
+        return ( 0 == ret ) ? out : "read error";
+    }
+
+    // Reference split of content
+    std::string split_reference( const std::string & content )
+    {
+        std::string out;
+        size_t pos = 0;
+
+        while( pos < content.size() )
+        {
+            size_t eol = content.find( '\n', pos );
+            std::string record = content.substr( pos, ( std::string::npos == eol ) ?
+                                                 std::string::npos : eol - pos );
+            size_t field_pos = 0;
+
+            pos = ( std::string::npos == eol ) ? content.size() : eol + 1;
+            if( ! record.empty() && ( '\r' == record.back() ) )
+            {
+                record.pop_back();
+            }
+            while( ! record.empty() && ( field_pos <= record.size() ) )
+            {
+                size_t sep = record.find( ',', field_pos );
+
+                if( std::string::npos == sep )
+                {
+                    sep = record.size();
+                }
+                out += record.substr( field_pos, sep - field_pos ) + "|";
+                field_pos = sep + 1;
+            }
+            out += "\n";
+        }
+
+        return out;
+    }
+
+    // Tests file_reader -> Valid case
+    TEST( file_reader, valid_cases )
+    {
+        temp_file file( "1,2,3\r\n\n,a,\nlast" );
+        file_reader_t reader;
+        const char * record;
+        const char * field;
+        size_t len;
+
+        ASSERT_EQ( read_all( file.path, FILE_READER_MODE_MMAP, 0 ),
+                   "1|2|3|\n\n|a||\nlast|\n" );
+        ASSERT_EQ( read_all( file.path, FILE_READER_MODE_READ, 0 ),
+                   "1|2|3|\n\n|a||\nlast|\n" );
+        ASSERT_EQ( read_all( file.path, FILE_READER_MODE_READ, 1 ),
+                   "1|2|3|\n\n|a||\nlast|\n" );
+
+        ASSERT_EQ( file_reader_open( &reader, file.path.c_str(), ',',
+                                     FILE_READER_MODE_AUTO, 0 ), 0 );
+        ASSERT_EQ( file_reader_next_record( &reader, &record, &len ), 1 );
+        ASSERT_EQ( std::string( record, len ), "1,2,3" );
+        ASSERT_EQ( file_reader_next_field( &reader, &field, &len ), 1 );
+        ASSERT_EQ( std::string( field, len ), "1" );
+        // Next record without reading all fields
+        ASSERT_EQ( file_reader_next_record( &reader, NULL, NULL ), 1 );
+        ASSERT_EQ( file_reader_next_field( &reader, &field, &len ), 0 );
+        ASSERT_EQ( file_reader_next_record( &reader, NULL, NULL ), 1 );
+        ASSERT_EQ( file_reader_next_record( &reader, NULL, NULL ), 1 );
+        ASSERT_EQ( file_reader_next_record( &reader, NULL, NULL ), 0 );
+        ASSERT_EQ( file_reader_next_record( &reader, NULL, NULL ), 0 );
+        file_reader_close( &reader );
+    }
+
+    // Tests file_reader -> Empty file
+    TEST( file_reader, empty_file )
+    {
+        temp_file file( "" );
+
+        ASSERT_EQ( read_all( file.path, FILE_READER_MODE_MMAP, 0 ), "" );
+        ASSERT_EQ( read_all( file.path, FILE_READER_MODE_READ, 0 ), "" );
+    }
+
+    // Tests file_reader -> Invalid case
+    TEST( file_reader, invalid_cases )
+    {
+        file_reader_t reader;
+        const char * field;
+        size_t len;
+
+        ASSERT_EQ( file_reader_open( &reader, "/nonexistent/file", ',',
+                                     FILE_READER_MODE_AUTO, 0 ), -1 );
+        ASSERT_EQ( file_reader_open( NULL, "/tmp", ',', FILE_READER_MODE_AUTO, 0 ), -1 );
+        ASSERT_EQ( file_reader_open( &reader, NULL, ',', FILE_READER_MODE_AUTO, 0 ), -1 );
+        // Directory can not be mapped or read
+        ASSERT_EQ( file_reader_open( &reader, "/tmp", ',', FILE_READER_MODE_MMAP, 0 ), -1 );
+        ASSERT_EQ( file_reader_open( &reader, "/tmp", ',', FILE_READER_MODE_READ, 0 ), 0 );
+        ASSERT_EQ( file_reader_next_record( &reader, NULL, NULL ), -1 );
+        file_reader_close( &reader );
+        ASSERT_EQ( file_reader_next_record( &reader, NULL, NULL ), -1 );
+        ASSERT_EQ( file_reader_next_field( &reader, &field, &len ), 0 );
+        ASSERT_EQ( file_reader_next_record( NULL, NULL, NULL ), -1 );
+        file_reader_close( NULL );
+    }
+
+    // Tests file_reader -> Records spanning chunks give the same split in
+    // every mode and chunk size
+    TEST( file_reader, chunk_boundaries )
+    {
+        static const char alphabet[] = "0123456789,,,\n\r";
+        std::mt19937_64 gen( 4242 );
+
+        for( int i = 0; i < 200; i++ )
+        {
+            std::string content;
+            size_t len = gen() % 2000;
+
+            for( size_t j = 0; j < len; j++ )
+            {
+                content += alphabet[gen() % ( sizeof( alphabet ) - 1 )];
+            }
+
+            temp_file file( content );
+            std::string expected = split_reference( content );
+
+            ASSERT_EQ( read_all( file.path, FILE_READER_MODE_MMAP, 0 ), expected );
+            ASSERT_EQ( read_all( file.path, FILE_READER_MODE_READ, 0 ), expected );
+            ASSERT_EQ( read_all( file.path, FILE_READER_MODE_READ,
+                                 1 + gen() % 64 ), expected );
+        }
+    }
+
+    // Tests file_reader -> Fields given to number parsers
+    TEST( file_reader, parse_fields )
+    {
+        temp_file file( "1,-2,0.5\n3,-4,1e3\n" );
+        file_reader_t reader;
+        const char * field;
+        size_t len;
+        uint32_t u32;
+        int64_t i64;
+        double d;
+        double sum = 0;
+
+        ASSERT_EQ( file_reader_open( &reader, file.path.c_str(), ',',
+                                     FILE_READER_MODE_READ, 4 ), 0 );
+        while( 1 == file_reader_next_record( &reader, NULL, NULL ) )
+        {
+            ASSERT_EQ( file_reader_next_field( &reader, &field, &len ), 1 );
+            ASSERT_EQ( parse_uint32_n( field, len, &u32 ), 0 );
+            ASSERT_EQ( file_reader_next_field( &reader, &field, &len ), 1 );
+            ASSERT_EQ( parse_int64_n( field, len, &i64 ), 0 );
+            ASSERT_EQ( file_reader_next_field( &reader, &field, &len ), 1 );
+            ASSERT_EQ( parse_double_n( field, len, &d ), 0 );
+            sum += u32 + i64 + d;
+        }
+        file_reader_close( &reader );
+
+        ASSERT_EQ( sum, 1 - 2 + 0.5 + 3 - 4 + 1e3 );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
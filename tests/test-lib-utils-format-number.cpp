@@ -0,0 +1,273 @@
+/*!
+ * @file: test-lib-utils-format-number.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for number formatting functions.
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+
+extern "C"
+{
+    #include "lib-utils-format-number.h"
+    #include "lib-utils-parse-number.h"
+}
+
+namespace
+{
+    // Tests format_uint32 -> Valid case
+    TEST( format_uint32, valid_cases )
+    {
+        char buf[FORMAT_NUMBER_BUFFER_SIZE];
+
+        ASSERT_EQ( format_uint32( 0, buf, sizeof( buf ) ), 1 );
+        ASSERT_STREQ( buf, "0" );
+        ASSERT_EQ( format_uint32( 7, buf, sizeof( buf ) ), 1 );
+        ASSERT_STREQ( buf, "7" );
+        ASSERT_EQ( format_uint32( 10, buf, sizeof( buf ) ), 2 );
+        ASSERT_STREQ( buf, "10" );
+        ASSERT_EQ( format_uint32( 100, buf, sizeof( buf ) ), 3 );
+        ASSERT_STREQ( buf, "100" );
+        ASSERT_EQ( format_uint32( UINT32_MAX, buf, sizeof( buf ) ), 10 );
+        ASSERT_STREQ( buf, "4294967295" );
+        ASSERT_EQ( format_uint32( 12345, buf, 6 ), 5 );
+        ASSERT_STREQ( buf, "12345" );
+    }
+
+    // Tests format_uint32 -> Invalid case
+    TEST( format_uint32, invalid_cases )
+    {
+        char buf[FORMAT_NUMBER_BUFFER_SIZE] = "unchanged";
+
+        ASSERT_EQ( format_uint32( 12345, buf, 5 ), -1 );
+        ASSERT_STREQ( buf, "unchanged" );
+        ASSERT_EQ( format_uint32( 1, buf, 0 ), -1 );
+        ASSERT_EQ( format_uint32( 1, NULL, 10 ), -1 );
+    }
+
+    // Tests format_int64 -> Valid case
+    TEST( format_int64, valid_cases )
+    {
+        char buf[FORMAT_NUMBER_BUFFER_SIZE];
+
+        ASSERT_EQ( format_int64( 0, buf, sizeof( buf ) ), 1 );
+        ASSERT_STREQ( buf, "0" );
+        ASSERT_EQ( format_int64( -1, buf, sizeof( buf ) ), 2 );
+        ASSERT_STREQ( buf, "-1" );
+        ASSERT_EQ( format_int64( INT64_MAX, buf, sizeof( buf ) ), 19 );
+        ASSERT_STREQ( buf, "9223372036854775807" );
+        ASSERT_EQ( format_int64( INT64_MIN, buf, sizeof( buf ) ), 20 );
+        ASSERT_STREQ( buf, "-9223372036854775808" );
+        ASSERT_EQ( format_int32( INT32_MIN, buf, sizeof( buf ) ), 11 );
+        ASSERT_STREQ( buf, "-2147483648" );
+        ASSERT_EQ( format_uint64( UINT64_MAX, buf, sizeof( buf ) ), 20 );
+        ASSERT_STREQ( buf, "18446744073709551615" );
+    }
+
+    // Tests format_int64 -> Invalid case
+    TEST( format_int64, invalid_cases )
+    {
+        char buf[FORMAT_NUMBER_BUFFER_SIZE] = "unchanged";
+
+        ASSERT_EQ( format_int64( -10, buf, 3 ), -1 );
+        ASSERT_STREQ( buf, "unchanged" );
+        ASSERT_EQ( format_int64( -10, NULL, 4 ), -1 );
+    }
+
+    // Tests format_hex64 -> Valid case
+    TEST( format_hex64, valid_cases )
+    {
+        char buf[FORMAT_NUMBER_BUFFER_SIZE];
+
+        ASSERT_EQ( format_hex64( 0, buf, sizeof( buf ) ), 1 );
+        ASSERT_STREQ( buf, "0" );
+        ASSERT_EQ( format_hex64( 0xAB, buf, sizeof( buf ) ), 2 );
+        ASSERT_STREQ( buf, "ab" );
+        ASSERT_EQ( format_hex64( UINT64_MAX, buf, sizeof( buf ) ), 16 );
+        ASSERT_STREQ( buf, "ffffffffffffffff" );
+        ASSERT_EQ( format_hex32( 0x1000, buf, sizeof( buf ) ), 4 );
+        ASSERT_STREQ( buf, "1000" );
+    }
+
+    // Tests format_hex64 -> Invalid case
+    TEST( format_hex64, invalid_cases )
+    {
+        char buf[FORMAT_NUMBER_BUFFER_SIZE] = "unchanged";
+
+        ASSERT_EQ( format_hex64( 0x100, buf, 3 ), -1 );
+        ASSERT_STREQ( buf, "unchanged" );
+        ASSERT_EQ( format_hex64( 0x100, NULL, 4 ), -1 );
+    }
+
+    // Tests format_double -> Valid case
+    TEST( format_double, valid_cases )
+    {
+        char buf[FORMAT_NUMBER_BUFFER_SIZE];
+
+        ASSERT_EQ( format_double( 0.0, buf, sizeof( buf ) ), 1 );
+        ASSERT_STREQ( buf, "0" );
+        ASSERT_EQ( format_double( -0.0, buf, sizeof( buf ) ), 2 );
+        ASSERT_STREQ( buf, "-0" );
+        ASSERT_EQ( format_double( 0.1, buf, sizeof( buf ) ), 3 );
+        ASSERT_STREQ( buf, "0.1" );
+        ASSERT_EQ( format_double( -2.5, buf, sizeof( buf ) ), 4 );
+        ASSERT_STREQ( buf, "-2.5" );
+        ASSERT_EQ( format_double( 100.0, buf, sizeof( buf ) ), 3 );
+        ASSERT_STREQ( buf, "100" );
+        ASSERT_EQ( format_double( 0.00001, buf, sizeof( buf ) ), 7 );
+        ASSERT_STREQ( buf, "0.00001" );
+        ASSERT_EQ( format_double( 0.000001, buf, sizeof( buf ) ), 5 );
+        ASSERT_STREQ( buf, "1e-06" );
+        ASSERT_EQ( format_double( 1e16, buf, sizeof( buf ) ), 17 );
+        ASSERT_STREQ( buf, "10000000000000000" );
+        ASSERT_EQ( format_double( 1e17, buf, sizeof( buf ) ), 5 );
+        ASSERT_STREQ( buf, "1e+17" );
+        ASSERT_EQ( format_double( 1.5e300, buf, sizeof( buf ) ), 8 );
+        ASSERT_STREQ( buf, "1.5e+300" );
+        ASSERT_EQ( format_double( std::numeric_limits<double>::max(), buf, sizeof( buf ) ), 23 );
+        ASSERT_STREQ( buf, "1.7976931348623157e+308" );
+        ASSERT_EQ( format_double( std::numeric_limits<double>::denorm_min(), buf, sizeof( buf ) ), 6 );
+        ASSERT_STREQ( buf, "5e-324" );
+        // Lower boundary closer: shorter than correctly rounded 16 digits
+        ASSERT_EQ( format_double( std::ldexp( 1.0, -1007 ), buf, sizeof( buf ) ), 22 );
+        ASSERT_STREQ( buf, "7.291122019556398e-304" );
+        ASSERT_EQ( format_double( std::numeric_limits<double>::infinity(), buf, sizeof( buf ) ), 3 );
+        ASSERT_STREQ( buf, "inf" );
+        ASSERT_EQ( format_double( -std::numeric_limits<double>::infinity(), buf, sizeof( buf ) ), 4 );
+        ASSERT_STREQ( buf, "-inf" );
+        ASSERT_EQ( format_double( std::numeric_limits<double>::quiet_NaN(), buf, sizeof( buf ) ), 3 );
+        ASSERT_STREQ( buf, "nan" );
+    }
+
+    // Tests format_double -> Invalid case
+    TEST( format_double, invalid_cases )
+    {
+        char buf[FORMAT_NUMBER_BUFFER_SIZE] = "unchanged";
+
+        ASSERT_EQ( format_double( 0.125, buf, 5 ), -1 );
+        ASSERT_STREQ( buf, "unchanged" );
+        ASSERT_EQ( format_double( 0.125, NULL, 6 ), -1 );
+    }
+
+    // Tests format_<type> -> Parsed back to the same value by parse_<type>
+    TEST( format_number, round_trip )
+    {
+        std::mt19937_64 gen( 4242 );
+        char buf[FORMAT_NUMBER_BUFFER_SIZE];
+
+        for( int i = 0; i < 100000; i++ )
+        {
+            uint64_t bits = gen();
+            uint32_t u32 = (uint32_t)bits >> ( gen() % 32 );
+            int64_t i64 = (int64_t)bits >> ( gen() % 64 );
+            uint64_t u64 = bits >> ( gen() % 64 );
+            uint32_t u32_back;
+            int64_t i64_back;
+            uint64_t u64_back;
+
+            ASSERT_GT( format_uint32( u32, buf, sizeof( buf ) ), 0 );
+            ASSERT_EQ( parse_uint32( buf, &u32_back ), 0 ) << buf;
+            ASSERT_EQ( u32_back, u32 );
+            ASSERT_GT( format_int64( i64, buf, sizeof( buf ) ), 0 );
+            ASSERT_EQ( parse_int64( buf, &i64_back ), 0 ) << buf;
+            ASSERT_EQ( i64_back, i64 );
+            ASSERT_GT( format_hex64( u64, buf, sizeof( buf ) ), 0 );
+            ASSERT_EQ( parse_hex64( buf, &u64_back ), 0 ) << buf;
+            ASSERT_EQ( u64_back, u64 );
+        }
+    }
+
+    // Return number of significant digits of a formatted double
+    int count_significant_digits( const char * str )
+    {
+        int nb_digits = 0;
+        int nb_zeros = 0;
+
+        for( ; *str && ( 'e' != *str ); str++ )
+        {
+            if( ( '0' == *str ) && ( 0 == nb_digits ) )
+            {
+                continue;
+            }
+            if( '0' == *str )
+            {
+                nb_zeros++;
+            }
+            else if( ( *str >= '1' ) && ( *str <= '9' ) )
+            {
+                nb_digits += nb_zeros + 1;
+                nb_zeros = 0;
+            }
+        }
+
+        return nb_digits;
+    }
+
+    // Check double is formatted in the shortest string parsed back to the
+    // same value (compared with the smallest printf precision round tripping)
+    void check_double_shortest( double value )
+    {
+        char buf[FORMAT_NUMBER_BUFFER_SIZE];
+        char ref[FORMAT_NUMBER_BUFFER_SIZE];
+        double back;
+        int precision;
+        int len;
+
+        len = format_double( value, buf, sizeof( buf ) );
+        ASSERT_EQ( len, (int)strlen( buf ) );
+        ASSERT_EQ( parse_double( buf, &back ), 0 ) << buf;
+        ASSERT_EQ( memcmp( &back, &value, sizeof( value ) ), 0 ) << buf;
+
+        for( precision = 1; precision < 17; precision++ )
+        {
+            snprintf( ref, sizeof( ref ), "%.*e", precision - 1, value );
+            if( strtod( ref, NULL ) == value )
+            {
+                break;
+            }
+        }
+        ASSERT_LE( count_significant_digits( buf ), precision ) << buf;
+    }
+
+    // Tests format_double -> Shortest round trip on random and special values
+    TEST( format_double, round_trip )
+    {
+        std::mt19937_64 gen( 4242 );
+
+        for( int i = 0; i < 30000; i++ )
+        {
+            uint64_t bits = gen();
+            double value;
+
+            memcpy( &value, &bits, sizeof( value ) );
+            if( std::isfinite( value ) )
+            {
+                check_double_shortest( value );
+            }
+
+            // Subnormals and powers of two (lower boundary closer)
+            bits &= ( UINT64_C( 1 ) << 52 ) - 1;
+            memcpy( &value, &bits, sizeof( value ) );
+            check_double_shortest( value );
+            check_double_shortest( std::ldexp( 1.0, (int)( gen() % 2098 ) - 1074 ) );
+        }
+
+        for( int i = 1; i < 20000; i++ )
+        {
+            check_double_shortest( i );
+            check_double_shortest( i / 1000.0 );
+        }
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
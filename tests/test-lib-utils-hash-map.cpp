@@ -0,0 +1,229 @@
+/*!
+ * @file: test-lib-utils-hash-map.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for open addressing hash map.
+ */
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+extern "C"
+{
+    #include "lib-utils-hash-map.h"
+}
+
+namespace
+{
+    // Tests hash_map -> Valid case with integer keys
+    TEST( hash_map, valid_cases_uint64 )
+    {
+        hash_map_t * map = hash_map_create( HASH_MAP_KEY_UINT64, 0 );
+        hash_map_entry_t entry;
+        void * value;
+        size_t pos = 0;
+        uint64_t sum = 0;
+
+        ASSERT_NE( map, nullptr );
+        ASSERT_EQ( hash_map_get_count( map ), 0u );
+        ASSERT_EQ( hash_map_get_uint64( map, 1, &value ), -1 );
+        ASSERT_EQ( hash_map_next( map, &pos, &entry ), -1 );
+
+        // Growth from default capacity
+        for( uint64_t key = 0; key < 100000; key++ )
+        {
+            ASSERT_EQ( hash_map_set_uint64( map, key * 7919, (void *)( key + 1 ) ), 0 );
+        }
+        ASSERT_EQ( hash_map_get_count( map ), 100000u );
+        for( uint64_t key = 0; key < 100000; key++ )
+        {
+            ASSERT_EQ( hash_map_get_uint64( map, key * 7919, &value ), 0 );
+            ASSERT_EQ( value, (void *)( key + 1 ) );
+        }
+        ASSERT_EQ( hash_map_get_uint64( map, 1, &value ), -1 );
+        ASSERT_EQ( hash_map_get_uint64( map, 0, NULL ), 0 );
+
+        // Replace value and NULL value
+        ASSERT_EQ( hash_map_set_uint64( map, 0, NULL ), 0 );
+        ASSERT_EQ( hash_map_get_count( map ), 100000u );
+        ASSERT_EQ( hash_map_get_uint64( map, 0, &value ), 0 );
+        ASSERT_EQ( value, nullptr );
+
+        // Remove half of keys
+        for( uint64_t key = 0; key < 100000; key += 2 )
+        {
+            ASSERT_EQ( hash_map_remove_uint64( map, key * 7919 ), 0 );
+        }
+        ASSERT_EQ( hash_map_remove_uint64( map, 0 ), -1 );
+        ASSERT_EQ( hash_map_get_count( map ), 50000u );
+        for( uint64_t key = 0; key < 100000; key++ )
+        {
+            ASSERT_EQ( hash_map_get_uint64( map, key * 7919, NULL ), ( key % 2 ) ? 0 : -1 );
+        }
+
+        // Iteration returns each entry once
+        pos = 0;
+        while( 0 == hash_map_next( map, &pos, &entry ) )
+        {
+            ASSERT_EQ( entry.key_string, nullptr );
+            ASSERT_EQ( (uint64_t)entry.value, entry.key_uint64 / 7919 + 1 );
+            sum += entry.key_uint64 / 7919;
+        }
+        ASSERT_EQ( sum, 2500000000u );
+
+        // Clear keeps map usable
+        hash_map_clear( map );
+        ASSERT_EQ( hash_map_get_count( map ), 0u );
+        ASSERT_EQ( hash_map_get_uint64( map, 7919, NULL ), -1 );
+        ASSERT_EQ( hash_map_set_uint64( map, UINT64_MAX, (void *)1 ), 0 );
+        ASSERT_EQ( hash_map_get_uint64( map, UINT64_MAX, &value ), 0 );
+        ASSERT_EQ( value, (void *)1 );
+
+        ASSERT_EQ( hash_map_reserve( map, 1000000 ), 0 );
+        ASSERT_EQ( hash_map_get_uint64( map, UINT64_MAX, NULL ), 0 );
+
+        hash_map_destroy( map );
+    }
+
+    // Tests hash_map -> Valid case with string keys
+    TEST( hash_map, valid_cases_string )
+    {
+        hash_map_t * map = hash_map_create( HASH_MAP_KEY_STRING, 1000 );
+        hash_map_entry_t entry;
+        std::string key = "key";
+        void * value;
+        size_t pos = 0;
+        size_t nb = 0;
+
+        ASSERT_NE( map, nullptr );
+
+        // Keys are copied
+        ASSERT_EQ( hash_map_set_string( map, key.c_str(), (void *)1 ), 0 );
+        key[0] = 'K';
+        ASSERT_EQ( hash_map_get_string( map, "key", &value ), 0 );
+        ASSERT_EQ( value, (void *)1 );
+        ASSERT_EQ( hash_map_get_string( map, "Key", &value ), -1 );
+
+        // Empty key and keys given by a buffer
+        ASSERT_EQ( hash_map_set_string( map, "", (void *)2 ), 0 );
+        ASSERT_EQ( hash_map_get_string( map, "", &value ), 0 );
+        ASSERT_EQ( value, (void *)2 );
+        ASSERT_EQ( hash_map_get_string_n( map, "key=value", 3, &value ), 0 );
+        ASSERT_EQ( value, (void *)1 );
+        ASSERT_EQ( hash_map_get_string_n( map, "key=value", 2, &value ), -1 );
+        ASSERT_EQ( hash_map_get_string_n( map, "key=value", 0, &value ), 0 );
+        ASSERT_EQ( value, (void *)2 );
+        ASSERT_EQ( hash_map_get_string_n( map, "key\0", 4, &value ), -1 );
+
+        for( int i = 0; i < 5000; i++ )
+        {
+            ASSERT_EQ( hash_map_set_string( map, std::to_string( i ).c_str(), NULL ), 0 );
+        }
+        ASSERT_EQ( hash_map_get_count( map ), 5002u );
+        ASSERT_EQ( hash_map_remove_string( map, "key" ), 0 );
+        ASSERT_EQ( hash_map_remove_string( map, "key" ), -1 );
+        ASSERT_EQ( hash_map_get_string( map, "4999", NULL ), 0 );
+
+        while( 0 == hash_map_next( map, &pos, &entry ) )
+        {
+            ASSERT_NE( entry.key_string, nullptr );
+            ASSERT_EQ( hash_map_get_string( map, entry.key_string, &value ), 0 );
+            ASSERT_EQ( value, entry.value );
+            nb++;
+        }
+        ASSERT_EQ( nb, 5001u );
+
+        hash_map_destroy( map );
+    }
+
+    // Tests hash_map -> Same content as std::unordered_map after random
+    // insertions and removals (removed slots are reused or dropped)
+    TEST( hash_map, same_as_unordered_map )
+    {
+        hash_map_t * map = hash_map_create( HASH_MAP_KEY_UINT64, 0 );
+        std::unordered_map<uint64_t, uintptr_t> expected;
+        std::mt19937_64 gen( 42 );
+        void * value;
+
+        ASSERT_NE( map, nullptr );
+
+        for( int i = 0; i < 500000; i++ )
+        {
+            uint64_t key = gen() % 3000;
+
+            if( gen() % 2 )
+            {
+                ASSERT_EQ( hash_map_set_uint64( map, key, (void *)(uintptr_t)i ), 0 );
+                expected[key] = i;
+            }
+            else
+            {
+                ASSERT_EQ( hash_map_remove_uint64( map, key ), expected.erase( key ) ? 0 : -1 );
+            }
+            ASSERT_EQ( hash_map_get_count( map ), expected.size() );
+        }
+
+        for( uint64_t key = 0; key < 3000; key++ )
+        {
+            auto it = expected.find( key );
+
+            ASSERT_EQ( hash_map_get_uint64( map, key, &value ), ( it == expected.end() ) ? -1 : 0 );
+            if( it != expected.end() )
+            {
+                ASSERT_EQ( (uintptr_t)value, it->second );
+            }
+        }
+
+        hash_map_destroy( map );
+    }
+
+    // Tests hash_map -> Invalid case
+    TEST( hash_map, invalid_cases )
+    {
+        hash_map_t * map_int = hash_map_create( HASH_MAP_KEY_UINT64, 0 );
+        hash_map_t * map_str = hash_map_create( HASH_MAP_KEY_STRING, 0 );
+        hash_map_entry_t entry;
+        size_t pos = 0;
+
+        ASSERT_EQ( hash_map_create( (hash_map_key_t)42, 0 ), nullptr );
+        ASSERT_EQ( hash_map_create( HASH_MAP_KEY_UINT64, SIZE_MAX ), nullptr );
+        hash_map_destroy( NULL );
+        hash_map_clear( NULL );
+        ASSERT_EQ( hash_map_get_count( NULL ), 0u );
+        ASSERT_EQ( hash_map_reserve( NULL, 10 ), -1 );
+        ASSERT_EQ( hash_map_reserve( map_int, SIZE_MAX ), -1 );
+
+        // Functions of other key type
+        ASSERT_EQ( hash_map_set_string( map_int, "a", NULL ), -1 );
+        ASSERT_EQ( hash_map_get_string( map_int, "a", NULL ), -1 );
+        ASSERT_EQ( hash_map_get_string_n( map_int, "a", 1, NULL ), -1 );
+        ASSERT_EQ( hash_map_remove_string( map_int, "a" ), -1 );
+        ASSERT_EQ( hash_map_set_uint64( map_str, 1, NULL ), -1 );
+        ASSERT_EQ( hash_map_get_uint64( map_str, 1, NULL ), -1 );
+        ASSERT_EQ( hash_map_remove_uint64( map_str, 1 ), -1 );
+
+        ASSERT_EQ( hash_map_set_uint64( NULL, 1, NULL ), -1 );
+        ASSERT_EQ( hash_map_get_uint64( NULL, 1, NULL ), -1 );
+        ASSERT_EQ( hash_map_remove_uint64( NULL, 1 ), -1 );
+        ASSERT_EQ( hash_map_set_string( map_str, NULL, NULL ), -1 );
+        ASSERT_EQ( hash_map_get_string( map_str, NULL, NULL ), -1 );
+        ASSERT_EQ( hash_map_get_string_n( NULL, "a", 1, NULL ), -1 );
+        ASSERT_EQ( hash_map_remove_string( map_str, NULL ), -1 );
+
+        ASSERT_EQ( hash_map_next( NULL, &pos, &entry ), -1 );
+        ASSERT_EQ( hash_map_next( map_int, NULL, &entry ), -1 );
+        ASSERT_EQ( hash_map_next( map_int, &pos, NULL ), -1 );
+
+        hash_map_destroy( map_int );
+        hash_map_destroy( map_str );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,153 @@
+/*!
+ * @file: test-lib-utils-hash.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for hash functions.
+ */
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+extern "C"
+{
+    #include "lib-utils-hash.h"
+}
+
+namespace
+{
+    // Tests hash_buffer -> Valid case (wyhash final 4 published test vectors:
+    // seed is the index of the vector)
+    TEST( hash_buffer, valid_cases )
+    {
+        static const struct
+        {
+            const char *    str;
+            uint64_t        hash;
+        } vectors[] =
+        {
+            { "", 0x93228A4DE0EEC5A2ULL },
+            { "a", 0xC5BAC3DB178713C4ULL },
+            { "abc", 0xA97F2F7B1D9B3314ULL },
+            { "message digest", 0x786D1F1DF3801DF4ULL },
+            { "abcdefghijklmnopqrstuvwxyz", 0xDCA5A8138AD37C87ULL },
+            { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+              0xB9E734F117CFAF70ULL },
+            { "1234567890123456789012345678901234567890"
+              "1234567890123456789012345678901234567890", 0x6CC5EAB49A92D617ULL },
+        };
+
+        for( size_t i = 0; i < sizeof( vectors ) / sizeof( vectors[0] ); i++ )
+        {
+            ASSERT_EQ( hash_buffer_seed( vectors[i].str, strlen( vectors[i].str ), i ),
+                       vectors[i].hash );
+            ASSERT_EQ( hash_string_seed( vectors[i].str, i ), vectors[i].hash );
+        }
+
+        ASSERT_EQ( hash_buffer( "abc", 3 ), hash_buffer_seed( "abc", 3, HASH_DEFAULT_SEED ) );
+        ASSERT_EQ( hash_string( "abc" ), hash_buffer( "abc", 3 ) );
+        ASSERT_NE( hash_buffer_seed( "abc", 3, 1 ), hash_buffer_seed( "abc", 3, 2 ) );
+
+        // All lengths and one byte changes give distinct hashes
+        std::string buf( 300, 'x' );
+        std::set<uint64_t> hashes;
+        for( size_t len = 0; len <= buf.size(); len++ )
+        {
+            ASSERT_TRUE( hashes.insert( hash_buffer( buf.data(), len ) ).second );
+        }
+        for( size_t i = 0; i < buf.size(); i++ )
+        {
+            std::string changed = buf;
+            changed[i] = 'y';
+            ASSERT_TRUE( hashes.insert( hash_buffer( changed.data(), changed.size() ) ).second );
+        }
+    }
+
+    // Tests hash_buffer -> Invalid case
+    TEST( hash_buffer, invalid_cases )
+    {
+        ASSERT_EQ( hash_buffer( NULL, 10 ), 0u );
+        ASSERT_EQ( hash_buffer_seed( NULL, 0, 1 ), 0u );
+        ASSERT_EQ( hash_string( NULL ), 0u );
+        ASSERT_EQ( hash_string_seed( NULL, 1 ), 0u );
+    }
+
+    // Tests hash_state -> Valid case (same hash as hash_buffer_seed for any
+    // split of buffer)
+    TEST( hash_state, valid_cases )
+    {
+        std::mt19937_64 gen( 42 );
+        std::vector<uint8_t> buf( 1000 );
+        hash_state_t state;
+
+        for( uint8_t & byte : buf )
+        {
+            byte = (uint8_t)gen();
+        }
+
+        for( size_t len = 0; len <= buf.size(); len += 1 + len / 16 )
+        {
+            uint64_t seed = gen();
+            uint64_t expected = hash_buffer_seed( buf.data(), len, seed );
+
+            // One update
+            hash_state_init( &state, seed );
+            ASSERT_EQ( hash_state_update( &state, buf.data(), len ), 0 );
+            ASSERT_EQ( hash_state_final( &state ), expected );
+
+            // Byte by byte
+            hash_state_init( &state, seed );
+            for( size_t i = 0; i < len; i++ )
+            {
+                ASSERT_EQ( hash_state_update( &state, &buf[i], 1 ), 0 );
+            }
+            ASSERT_EQ( hash_state_final( &state ), expected );
+
+            // Random parts (empty parts included)
+            for( int run = 0; run < 20; run++ )
+            {
+                size_t pos = 0;
+
+                hash_state_init( &state, seed );
+                while( pos < len )
+                {
+                    size_t part = std::min<size_t>( gen() % 120, len - pos );
+
+                    ASSERT_EQ( hash_state_update( &state, &buf[pos], part ), 0 );
+                    pos += part;
+                }
+                ASSERT_EQ( hash_state_final( &state ), expected );
+            }
+        }
+
+        // Final does not end hash
+        hash_state_init( &state, 7 );
+        ASSERT_EQ( hash_state_update( &state, "abc", 3 ), 0 );
+        ASSERT_EQ( hash_state_final( &state ), hash_buffer_seed( "abc", 3, 7 ) );
+        ASSERT_EQ( hash_state_update( &state, "def", 3 ), 0 );
+        ASSERT_EQ( hash_state_final( &state ), hash_buffer_seed( "abcdef", 6, 7 ) );
+        ASSERT_EQ( hash_state_update( &state, NULL, 0 ), 0 );
+    }
+
+    // Tests hash_state -> Invalid case
+    TEST( hash_state, invalid_cases )
+    {
+        hash_state_t state;
+
+        hash_state_init( NULL, 0 );
+        hash_state_init( &state, 0 );
+        ASSERT_EQ( hash_state_update( NULL, "abc", 3 ), -1 );
+        ASSERT_EQ( hash_state_update( &state, NULL, 3 ), -1 );
+        ASSERT_EQ( hash_state_final( NULL ), 0u );
+        ASSERT_EQ( hash_state_final( &state ), hash_buffer( "", 0 ) );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
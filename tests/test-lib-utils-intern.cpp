@@ -0,0 +1,134 @@
+/*!
+ * @file: test-lib-utils-intern.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for string interning table.
+ */
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+    #include "lib-utils-intern.h"
+}
+
+namespace
+{
+    // Tests intern_table -> Valid case
+    TEST( intern_table, valid_cases )
+    {
+        intern_table_t * table = intern_table_create( 0 );
+        std::vector<const char *> interned;
+        std::string key = "key";
+        const char * str;
+
+        ASSERT_NE( table, nullptr );
+
+        str = intern_string( table, "key" );
+        ASSERT_STREQ( str, "key" );
+        // Same pointer for equal strings, not the pointer given
+        ASSERT_EQ( intern_string( table, key.c_str() ), str );
+        ASSERT_NE( str, key.c_str() );
+        ASSERT_EQ( intern_string_n( table, "keys", 3 ), str );
+        ASSERT_EQ( intern_lookup( table, "key" ), str );
+        ASSERT_NE( intern_string( table, "Key" ), str );
+        ASSERT_STREQ( intern_string( table, "" ), "" );
+        ASSERT_EQ( intern_string( table, "" ), intern_string_n( table, "x", 0 ) );
+        ASSERT_EQ( intern_table_get_count( table ), 3u );
+
+        // Buffer with NUL character
+        ASSERT_NE( intern_string_n( table, "a\0b", 3 ), intern_string( table, "a" ) );
+
+        // Strings stay valid and unique when table grows
+        for( int i = 0; i < 100000; i++ )
+        {
+            interned.push_back( intern_string( table, std::to_string( i ).c_str() ) );
+        }
+        for( int i = 0; i < 100000; i++ )
+        {
+            ASSERT_STREQ( interned[i], std::to_string( i ).c_str() );
+            ASSERT_EQ( intern_string( table, std::to_string( i ).c_str() ), interned[i] );
+        }
+        ASSERT_EQ( intern_lookup( table, "key" ), str );
+        ASSERT_EQ( intern_table_get_count( table ), 100000u + 5 );
+        ASSERT_GT( intern_table_get_memory( table ), 100000u );
+
+        intern_table_destroy( table );
+        intern_table_destroy( NULL );
+    }
+
+    // Tests intern_table -> Invalid case
+    TEST( intern_table, invalid_cases )
+    {
+        intern_table_t * table = intern_table_create( 1000 );
+
+        ASSERT_NE( table, nullptr );
+        ASSERT_EQ( intern_lookup( table, "absent" ), nullptr );
+        ASSERT_EQ( intern_string( table, NULL ), nullptr );
+        ASSERT_EQ( intern_string_n( table, NULL, 1 ), nullptr );
+        ASSERT_EQ( intern_lookup( table, NULL ), nullptr );
+        ASSERT_EQ( intern_string( NULL, "a" ), nullptr );
+        ASSERT_EQ( intern_lookup( NULL, "a" ), nullptr );
+        ASSERT_EQ( intern_table_get_count( NULL ), 0u );
+        ASSERT_EQ( intern_table_get_memory( NULL ), 0u );
+        ASSERT_EQ( intern_table_create( SIZE_MAX ), nullptr );
+
+        intern_table_destroy( table );
+    }
+
+    // Tests intern_table -> Threads interning the same strings get the same
+    // pointers
+    TEST( intern_table, concurrent_cases )
+    {
+        intern_table_t * table = intern_table_create( 0 );
+        const int nb_threads = 4;
+        const int nb_strings = 20000;
+        std::vector<std::vector<const char *>> results( nb_threads );
+        std::vector<std::thread> threads;
+
+        ASSERT_NE( table, nullptr );
+
+        for( int t = 0; t < nb_threads; t++ )
+        {
+            threads.emplace_back( [&, t]() {
+                for( int i = 0; i < nb_strings; i++ )
+                {
+                    // Each thread starts at a different string
+                    int value = ( i + t * nb_strings / nb_threads ) % nb_strings;
+
+                    results[t].push_back( intern_string( table,
+                                          std::to_string( value ).c_str() ) );
+                }
+            } );
+        }
+        for( std::thread & thread : threads )
+        {
+            thread.join();
+        }
+
+        ASSERT_EQ( intern_table_get_count( table ), (size_t)nb_strings );
+        for( int i = 0; i < nb_strings; i++ )
+        {
+            const char * expected = intern_lookup( table, std::to_string( i ).c_str() );
+
+            ASSERT_NE( expected, nullptr );
+            for( int t = 0; t < nb_threads; t++ )
+            {
+                ASSERT_EQ( results[t][( i - t * nb_strings / nb_threads + nb_strings ) % nb_strings],
+                           expected );
+            }
+        }
+
+        intern_table_destroy( table );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
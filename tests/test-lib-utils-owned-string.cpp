@@ -0,0 +1,201 @@
+/*!
+ * @file: test-lib-utils-owned-string.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for owned string functions.
+ */
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+extern "C"
+{
+    #include "lib-utils-owned-string.h"
+}
+
+namespace
+{
+    // Tests lu_string_init, lu_string_assign -> Small and spilled strings
+    TEST( lu_string, assign )
+    {
+        lu_string_t str = LU_STRING_INIT;
+        std::string small( LU_STRING_SMALL_CAPACITY, 's' );
+        std::string large( LU_STRING_SMALL_CAPACITY + 8, 'l' );
+
+        ASSERT_STREQ( lu_string_cstr( &str ), "" );
+        ASSERT_EQ( lu_string_length( &str ), 0u );
+
+        ASSERT_EQ( lu_string_assign( &str, lu_strview( small.data(), small.size() ) ), 0 );
+        ASSERT_TRUE( lu_string_is_small( &str ) );
+        ASSERT_EQ( lu_string_cstr( &str ), (const char *)&str );
+        ASSERT_EQ( lu_string_cstr( &str ), small );
+
+        ASSERT_EQ( lu_string_assign( &str, lu_strview( large.data(), large.size() ) ), 0 );
+        ASSERT_FALSE( lu_string_is_small( &str ) );
+        ASSERT_EQ( lu_string_cstr( &str ), large );
+
+        // Spilled buffer is reused for a shorter long string
+        const char * data = lu_string_cstr( &str );
+        ASSERT_EQ( lu_string_assign( &str, lu_strview( large.data(), large.size() - 1 ) ), 0 );
+        ASSERT_EQ( lu_string_cstr( &str ), data );
+        ASSERT_EQ( lu_string_length( &str ), large.size() - 1 );
+
+        // Assign a part of string itself (spilled then small)
+        ASSERT_EQ( lu_string_assign( &str, lu_strview_slice( lu_string_view( &str ), 1, 20 ) ), 0 );
+        ASSERT_EQ( lu_string_cstr( &str ), std::string( 20, 'l' ) );
+        ASSERT_TRUE( lu_string_is_small( &str ) );
+        ASSERT_EQ( lu_string_assign( &str, lu_strview_slice( lu_string_view( &str ), 2, 3 ) ), 0 );
+        ASSERT_STREQ( lu_string_cstr( &str ), "lll" );
+
+        ASSERT_EQ( lu_string_assign( &str, lu_strview( NULL, 0 ) ), 0 );
+        ASSERT_STREQ( lu_string_cstr( &str ), "" );
+
+        lu_string_free( &str );
+    }
+
+    // Tests lu_string_concat -> Growth from inline to spilled storage
+    TEST( lu_string, concat )
+    {
+        lu_string_t str;
+        std::string expected;
+
+        ASSERT_EQ( lu_string_init( &str, NULL ), 0 );
+        for( int i = 0; i < 200; i++ )
+        {
+            std::string part = std::to_string( i ) + ",";
+
+            ASSERT_EQ( lu_string_concat( &str, lu_strview( part.data(), part.size() ) ), 0 );
+            expected += part;
+            ASSERT_EQ( lu_string_cstr( &str ), expected );
+            ASSERT_EQ( lu_string_length( &str ), expected.size() );
+            ASSERT_EQ( lu_string_is_small( &str ) != 0, expected.size() <= LU_STRING_SMALL_CAPACITY );
+        }
+
+        // Append string to itself (spilled)
+        ASSERT_EQ( lu_string_concat( &str, lu_string_view( &str ) ), 0 );
+        ASSERT_EQ( lu_string_cstr( &str ), expected + expected );
+        lu_string_free( &str );
+
+        // Append string to itself (small then spilled)
+        ASSERT_EQ( lu_string_assign( &str, lu_strview_from_cstr( "abcdefghij" ) ), 0 );
+        ASSERT_EQ( lu_string_concat( &str, lu_string_view( &str ) ), 0 );
+        ASSERT_STREQ( lu_string_cstr( &str ), "abcdefghijabcdefghij" );
+        ASSERT_EQ( lu_string_concat( &str, lu_string_view( &str ) ), 0 );
+        ASSERT_STREQ( lu_string_cstr( &str ), "abcdefghijabcdefghijabcdefghijabcdefghij" );
+        // Empty view without pointer (spilled, small and empty strings)
+        ASSERT_FALSE( lu_string_is_small( &str ) );
+        ASSERT_EQ( lu_string_concat( &str, lu_strview( NULL, 0 ) ), 0 );
+        ASSERT_EQ( lu_string_length( &str ), 40u );
+        ASSERT_STREQ( lu_string_cstr( &str ), "abcdefghijabcdefghijabcdefghijabcdefghij" );
+        ASSERT_EQ( lu_string_assign( &str, lu_strview_from_cstr( "abc" ) ), 0 );
+        ASSERT_EQ( lu_string_concat( &str, lu_strview( NULL, 0 ) ), 0 );
+        ASSERT_STREQ( lu_string_cstr( &str ), "abc" );
+        lu_string_free( &str );
+        ASSERT_EQ( lu_string_concat( &str, lu_strview( NULL, 0 ) ), 0 );
+        ASSERT_STREQ( lu_string_cstr( &str ), "" );
+
+        lu_string_free( &str );
+        ASSERT_EQ( lu_string_length( &str ), 0u );
+    }
+
+    // Tests lu_string_copy, lu_string_move, lu_string_compare
+    TEST( lu_string, copy_move_compare )
+    {
+        lu_string_t str1 = LU_STRING_INIT;
+        lu_string_t str2 = LU_STRING_INIT;
+        lu_string_t str3 = LU_STRING_INIT;
+        const char * long_str = "a string which is too long to be stored inline";
+        const char * data;
+
+        ASSERT_EQ( lu_string_assign( &str1, lu_strview_from_cstr( long_str ) ), 0 );
+        ASSERT_EQ( lu_string_copy( &str2, &str1 ), 0 );
+        ASSERT_STREQ( lu_string_cstr( &str2 ), long_str );
+        ASSERT_NE( lu_string_cstr( &str2 ), lu_string_cstr( &str1 ) );
+        ASSERT_EQ( lu_string_compare( &str1, &str2 ), 0 );
+        ASSERT_EQ( lu_string_copy( &str1, &str1 ), 0 );
+        ASSERT_STREQ( lu_string_cstr( &str1 ), long_str );
+
+        // Spilled buffer is moved without copy
+        data = lu_string_cstr( &str1 );
+        ASSERT_EQ( lu_string_move( &str3, &str1 ), 0 );
+        ASSERT_EQ( lu_string_cstr( &str3 ), data );
+        ASSERT_EQ( lu_string_length( &str1 ), 0u );
+        ASSERT_STREQ( lu_string_cstr( &str1 ), "" );
+
+        // Small string is moved by value
+        ASSERT_EQ( lu_string_assign( &str1, lu_strview_from_cstr( "small" ) ), 0 );
+        ASSERT_EQ( lu_string_move( &str3, &str1 ), 0 );
+        ASSERT_STREQ( lu_string_cstr( &str3 ), "small" );
+        ASSERT_EQ( lu_string_move( &str3, &str3 ), 0 );
+        ASSERT_STREQ( lu_string_cstr( &str3 ), "small" );
+
+        ASSERT_GT( lu_string_compare( &str3, &str2 ), 0 );
+        ASSERT_LT( lu_string_compare( &str2, &str3 ), 0 );
+        ASSERT_LT( lu_string_compare( &str1, &str3 ), 0 );
+
+        lu_string_free( &str1 );
+        lu_string_free( &str2 );
+        lu_string_free( &str3 );
+    }
+
+    // Tests lu_string with arena -> Spilled buffers are allocated from arena
+    TEST( lu_string, arena )
+    {
+        arena_t * arena = arena_create( 0 );
+        lu_string_t str;
+        std::string expected;
+        std::mt19937 gen( 42 );
+
+        ASSERT_NE( arena, nullptr );
+        ASSERT_EQ( lu_string_init( &str, arena ), 0 );
+
+        for( int i = 0; i < 1000; i++ )
+        {
+            std::string part( gen() % 40, (char)( 'a' + gen() % 26 ) );
+
+            if( gen() % 4 )
+            {
+                ASSERT_EQ( lu_string_concat( &str, lu_strview( part.data(), part.size() ) ), 0 );
+                expected += part;
+            }
+            else
+            {
+                ASSERT_EQ( lu_string_assign( &str, lu_strview( part.data(), part.size() ) ), 0 );
+                expected = part;
+            }
+            ASSERT_EQ( lu_string_cstr( &str ), expected );
+        }
+
+        // Buffers are released by arena (nothing to free)
+        lu_string_free( &str );
+        arena_destroy( arena );
+    }
+
+    // Tests lu_string functions -> Invalid cases
+    TEST( lu_string, invalid_cases )
+    {
+        lu_string_t str = LU_STRING_INIT;
+
+        ASSERT_EQ( lu_string_init( NULL, NULL ), -1 );
+        ASSERT_EQ( lu_string_assign( NULL, lu_strview_from_cstr( "a" ) ), -1 );
+        ASSERT_EQ( lu_string_assign( &str, lu_strview( NULL, 1 ) ), -1 );
+        ASSERT_EQ( lu_string_concat( NULL, lu_strview_from_cstr( "a" ) ), -1 );
+        ASSERT_EQ( lu_string_concat( &str, lu_strview( NULL, 1 ) ), -1 );
+        ASSERT_EQ( lu_string_copy( NULL, &str ), -1 );
+        ASSERT_EQ( lu_string_copy( &str, NULL ), -1 );
+        ASSERT_EQ( lu_string_move( NULL, &str ), -1 );
+        ASSERT_EQ( lu_string_move( &str, NULL ), -1 );
+        lu_string_free( NULL );
+
+        ASSERT_EQ( lu_string_assign( &str, lu_strview_from_cstr( "abc" ) ), 0 );
+        ASSERT_EQ( lu_string_concat( &str, lu_strview( "d", (size_t)-2 ) ), -1 );
+        ASSERT_STREQ( lu_string_cstr( &str ), "abc" );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
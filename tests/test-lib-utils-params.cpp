@@ -0,0 +1,533 @@
+/*!
+ * @file: test-lib-utils-params.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for parameters parser functions.
+ */
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+    #include "lib-utils-params.h"
+}
+
+namespace
+{
+    // Parameters of a test application
+    struct test_params_t
+    {
+        bool            verbose;
+        bool            force;
+        uint32_t        count;
+        int16_t         offset;
+        uint8_t         mask;
+        double          ratio;
+        const char *    name;
+        char            mode;
+    };
+
+    const parameter_description_t descriptions[] =
+    {
+        { BOOL_TYPE, offsetof( test_params_t, verbose ), sizeof( bool ), 'v', "verbose", "Verbose." },
+        { BOOL_TYPE, offsetof( test_params_t, force ), sizeof( bool ), 'f', "force", "Force." },
+        { U32_TYPE, offsetof( test_params_t, count ), sizeof( uint32_t ), 'c', "count", "Count." },
+        { I16_TYPE, offsetof( test_params_t, offset ), sizeof( int16_t ), 0, "offset", "Offset." },
+        { HEX8_TYPE, offsetof( test_params_t, mask ), sizeof( uint8_t ), 'm', NULL, "Mask." },
+        { DFLOAT_TYPE, offsetof( test_params_t, ratio ), sizeof( double ), 'r', "ratio", "Ratio." },
+        { STR_TYPE, offsetof( test_params_t, name ), sizeof( char * ), 'n', "name", "Name." },
+        { CHAR_TYPE, offsetof( test_params_t, mode ), sizeof( char ), 'M', "mode", "Mode." },
+        { SENTINEL_TYPE, 0, 0, 0, NULL, NULL },
+    };
+
+    // Parse tokens with defaults
+    int parse( const params_index_t * index,
+               std::vector<const char *> tokens,
+               test_params_t * params )
+    {
+        *params = test_params_t();
+
+        return parse_params_tokens( index, tokens.size(), tokens.data(), params );
+    }
+
+    // Write a temporary file and load it
+    int open_file( params_file_t * file, const std::string & content )
+    {
+        const char * path = "test-lib-utils-params.tmp";
+        FILE * fp = fopen( path, "wb" );
+        int ret;
+
+        if( ! fp )
+        {
+            return -1;
+        }
+        fwrite( content.data(), 1, content.size(), fp );
+        fclose( fp );
+        ret = params_file_open( file, path );
+        remove( path );
+
+        return ret;
+    }
+
+    // Parse a response file with defaults
+    int parse_response( const params_index_t * index,
+                        const std::string & content,
+                        test_params_t * params,
+                        params_file_t * file )
+    {
+        *params = test_params_t();
+        if( 0 != open_file( file, content ) )
+        {
+            return -2;
+        }
+
+        return parse_params_response_file( index, file, params );
+    }
+
+    // Parse a config file with defaults
+    int parse_config( const params_index_t * index,
+                      const std::string & content,
+                      test_params_t * params,
+                      params_file_t * file )
+    {
+        *params = test_params_t();
+        if( 0 != open_file( file, content ) )
+        {
+            return -2;
+        }
+
+        return parse_params_config_file( index, file, params );
+    }
+
+    // Tests params_index_init, params_index_find_shortname, params_index_find_longname
+    TEST( params, index )
+    {
+        params_index_t index;
+        const parameter_description_t duplicated[] =
+        {
+            { BOOL_TYPE, 0, 1, 'a', "all", "" },
+            { BOOL_TYPE, 1, 1, 'a', "any", "" },
+            { SENTINEL_TYPE, 0, 0, 0, NULL, NULL },
+        };
+
+        ASSERT_EQ( params_index_init( &index, descriptions ), 0 );
+        ASSERT_EQ( params_index_find_shortname( &index, 'c' ), &descriptions[2] );
+        ASSERT_EQ( params_index_find_shortname( &index, 'M' ), &descriptions[7] );
+        ASSERT_EQ( params_index_find_shortname( &index, 'x' ), nullptr );
+        ASSERT_EQ( params_index_find_shortname( &index, 0 ), nullptr );
+        ASSERT_EQ( params_index_find_longname( &index, "offset", 6 ), &descriptions[3] );
+        ASSERT_EQ( params_index_find_longname( &index, "count=3", 5 ), &descriptions[2] );
+        ASSERT_EQ( params_index_find_longname( &index, "coun", 4 ), nullptr );
+        params_index_release( &index );
+
+        ASSERT_EQ( params_index_init( &index, duplicated ), -1 );
+        ASSERT_EQ( params_index_init( NULL, descriptions ), -1 );
+        ASSERT_EQ( params_index_init( &index, NULL ), -1 );
+        params_index_release( NULL );
+    }
+
+    // Tests set_param_value
+    TEST( params, set_param_value )
+    {
+        test_params_t params = test_params_t();
+        const char * name = "file.txt";
+
+        ASSERT_EQ( set_param_value( &descriptions[0], NULL, &params ), 0 );
+        ASSERT_TRUE( params.verbose );
+        ASSERT_EQ( set_param_value( &descriptions[2], "42", &params ), 0 );
+        ASSERT_EQ( params.count, 42u );
+        ASSERT_EQ( set_param_value( &descriptions[3], "-12", &params ), 0 );
+        ASSERT_EQ( params.offset, -12 );
+        ASSERT_EQ( set_param_value( &descriptions[4], "0xF0", &params ), 0 );
+        ASSERT_EQ( params.mask, 0xF0 );
+        ASSERT_EQ( set_param_value( &descriptions[5], "0.25", &params ), 0 );
+        ASSERT_EQ( params.ratio, 0.25 );
+        ASSERT_EQ( set_param_value( &descriptions[6], name, &params ), 0 );
+        ASSERT_EQ( params.name, name );
+        ASSERT_EQ( set_param_value( &descriptions[7], "w", &params ), 0 );
+        ASSERT_EQ( params.mode, 'w' );
+        ASSERT_EQ( set_param_value( &descriptions[0], "false", &params ), 0 );
+        ASSERT_FALSE( params.verbose );
+        ASSERT_EQ( set_param_value( &descriptions[0], "1", &params ), 0 );
+        ASSERT_TRUE( params.verbose );
+        ASSERT_EQ( set_param_value( &descriptions[0], "0", &params ), 0 );
+        ASSERT_FALSE( params.verbose );
+        ASSERT_EQ( set_param_value( &descriptions[0], "true", &params ), 0 );
+        ASSERT_TRUE( params.verbose );
+        ASSERT_EQ( set_param_value( &descriptions[0], "yes", &params ), -1 );
+
+        ASSERT_EQ( set_param_value( &descriptions[2], "-1", &params ), -1 );
+        ASSERT_EQ( set_param_value( &descriptions[2], NULL, &params ), -1 );
+        ASSERT_EQ( set_param_value( &descriptions[7], NULL, &params ), -1 );
+        ASSERT_EQ( set_param_value( &descriptions[8], "1", &params ), -1 );
+        ASSERT_EQ( set_param_value( NULL, "1", &params ), -1 );
+        ASSERT_EQ( set_param_value( &descriptions[2], "1", NULL ), -1 );
+    }
+
+    // Tests parse_params_tokens -> Accepted forms
+    TEST( params, parse_tokens )
+    {
+        params_index_t index;
+        test_params_t params;
+        std::vector<const char *> tokens =
+        {
+            "-vf", "-c", "10", "--offset=-3", "input", "-m0x1F", "--ratio", "1.5",
+            "--name=", "-", "-Mr", "--", "--force"
+        };
+        std::vector<const char *> copy = tokens;
+
+        ASSERT_EQ( params_index_init( &index, descriptions ), 0 );
+
+        ASSERT_EQ( parse( &index, tokens, &params ), 0 );
+        ASSERT_TRUE( params.verbose );
+        ASSERT_TRUE( params.force );
+        ASSERT_EQ( params.count, 10u );
+        ASSERT_EQ( params.offset, -3 );
+        ASSERT_EQ( params.mask, 0x1F );
+        ASSERT_EQ( params.ratio, 1.5 );
+        ASSERT_STREQ( params.name, "" );
+        ASSERT_EQ( params.mode, 'r' );
+        // Tokens are not modified
+        ASSERT_EQ( tokens, copy );
+
+        // Flags after "--" are operands
+        ASSERT_EQ( parse( &index, { "--", "-v" }, &params ), 0 );
+        ASSERT_FALSE( params.verbose );
+
+        // Value of option can start with '-'
+        ASSERT_EQ( parse( &index, { "-n", "-v", "--name", "--force" }, &params ), 0 );
+        ASSERT_STREQ( params.name, "--force" );
+        ASSERT_FALSE( params.verbose );
+        ASSERT_FALSE( params.force );
+
+        ASSERT_EQ( parse( &index, {}, &params ), 0 );
+        ASSERT_EQ( parse_params_tokens( &index, 0, NULL, &params ), 0 );
+
+        params_index_release( &index );
+    }
+
+    // Tests parse_params_tokens -> Invalid command lines
+    TEST( params, parse_tokens_invalid )
+    {
+        params_index_t index;
+        test_params_t params;
+
+        ASSERT_EQ( params_index_init( &index, descriptions ), 0 );
+
+        ASSERT_EQ( parse( &index, { "-x" }, &params ), -1 );
+        ASSERT_EQ( parse( &index, { "-vx" }, &params ), -1 );
+        ASSERT_EQ( parse( &index, { "--unknown" }, &params ), -1 );
+        ASSERT_EQ( parse( &index, { "--verb" }, &params ), -1 );
+        ASSERT_EQ( parse( &index, { "--verbose=1" }, &params ), -1 );
+        ASSERT_EQ( parse( &index, { "-c" }, &params ), -1 );
+        ASSERT_EQ( parse( &index, { "--count" }, &params ), -1 );
+        ASSERT_EQ( parse( &index, { "--count=abc" }, &params ), -1 );
+        ASSERT_EQ( parse( &index, { "-c", "99999999999" }, &params ), -1 );
+        ASSERT_EQ( parse( &index, { "--=1" }, &params ), -1 );
+        ASSERT_EQ( parse( &index, { "-v", NULL }, &params ), -1 );
+
+        ASSERT_EQ( parse_params_tokens( &index, 1, NULL, &params ), -1 );
+        ASSERT_EQ( parse_params_tokens( NULL, 0, NULL, &params ), -1 );
+        ASSERT_EQ( parse_params_tokens( &index, 0, NULL, NULL ), -1 );
+
+        params_index_release( &index );
+    }
+
+    // Tests params_file_open, params_file_close
+    TEST( params, file_open )
+    {
+        params_file_t file;
+
+        ASSERT_EQ( open_file( &file, "-v" ), 0 );
+        ASSERT_EQ( file.size, 2u );
+        ASSERT_EQ( std::string( file.data, file.size ), "-v" );
+        ASSERT_EQ( file.data[file.size], '\0' );
+        params_file_close( &file );
+        ASSERT_EQ( file.data, nullptr );
+
+        // Empty file and file of a multiple of page size are NUL terminated
+        ASSERT_EQ( open_file( &file, "" ), 0 );
+        ASSERT_EQ( file.size, 0u );
+        ASSERT_EQ( file.data[0], '\0' );
+        params_file_close( &file );
+        ASSERT_EQ( open_file( &file, std::string( 4096, ' ' ) ), 0 );
+        ASSERT_EQ( file.data[4096], '\0' );
+        params_file_close( &file );
+
+        ASSERT_EQ( params_file_open( &file, "test-lib-utils-params.missing" ), -1 );
+        ASSERT_EQ( params_file_open( &file, "." ), -1 );
+        ASSERT_EQ( params_file_open( &file, NULL ), -1 );
+        ASSERT_EQ( params_file_open( NULL, "." ), -1 );
+        params_file_close( NULL );
+    }
+
+    // Tests parse_params_response_file
+    TEST( params, response_file )
+    {
+        params_index_t index;
+        test_params_t params;
+        params_file_t file;
+
+        ASSERT_EQ( params_index_init( &index, descriptions ), 0 );
+
+        ASSERT_EQ( parse_response( &index,
+                                   "-vf\n"
+                                   "  --count 10\t--offset=-3\r\n"
+                                   "input -m0x1F --ratio \"1.5\" -M r",
+                                   &params, &file ), 0 );
+        ASSERT_TRUE( params.verbose );
+        ASSERT_TRUE( params.force );
+        ASSERT_EQ( params.count, 10u );
+        ASSERT_EQ( params.offset, -3 );
+        ASSERT_EQ( params.mask, 0x1F );
+        ASSERT_EQ( params.ratio, 1.5 );
+        ASSERT_EQ( params.mode, 'r' );
+        params_file_close( &file );
+
+        // Quotes and escapes are removed in place, values point into file
+        ASSERT_EQ( parse_response( &index, "--name 'a \\b'", &params, &file ), 0 );
+        ASSERT_STREQ( params.name, "a \\b" );
+        ASSERT_GE( params.name, file.data );
+        ASSERT_LT( params.name, file.data + file.size );
+        params_file_close( &file );
+        ASSERT_EQ( parse_response( &index, "--name=\"a \\\"b\\\\\"c\\ d", &params, &file ), 0 );
+        ASSERT_STREQ( params.name, "a \"b\\c d" );
+        params_file_close( &file );
+        ASSERT_EQ( parse_response( &index, "-n ''", &params, &file ), 0 );
+        ASSERT_STREQ( params.name, "" );
+        params_file_close( &file );
+
+        // Last token, "--" and empty file
+        ASSERT_EQ( parse_response( &index, "-v -n", &params, &file ), -1 );
+        params_file_close( &file );
+        ASSERT_EQ( parse_response( &index, "-- -v", &params, &file ), 0 );
+        ASSERT_FALSE( params.verbose );
+        params_file_close( &file );
+        ASSERT_EQ( parse_response( &index, " \n ", &params, &file ), 0 );
+        params_file_close( &file );
+
+        // Unterminated quote, nested file and unknown option
+        ASSERT_EQ( parse_response( &index, "-n \"abc", &params, &file ), -1 );
+        params_file_close( &file );
+        ASSERT_EQ( parse_response( &index, "-v @other", &params, &file ), -1 );
+        params_file_close( &file );
+        ASSERT_EQ( parse_response( &index, "-n @other", &params, &file ), 0 );
+        ASSERT_STREQ( params.name, "@other" );
+        params_file_close( &file );
+        ASSERT_EQ( parse_response( &index, "--unknown", &params, &file ), -1 );
+        params_file_close( &file );
+
+        ASSERT_EQ( parse_params_response_file( &index, NULL, &params ), -1 );
+        params_index_release( &index );
+    }
+
+    // Tests parse_params_config_file
+    TEST( params, config_file )
+    {
+        params_index_t index;
+        test_params_t params;
+        params_file_t file;
+
+        ASSERT_EQ( params_index_init( &index, descriptions ), 0 );
+
+        ASSERT_EQ( parse_config( &index,
+                                 "# Comment\n"
+                                 "verbose\n"
+                                 "\n"
+                                 "force = false\r\n"
+                                 "  count=10\n"
+                                 "; Other comment\n"
+                                 "offset =\t-3  \n"
+                                 "name = \" a b \"\n"
+                                 "mode = r",
+                                 &params, &file ), 0 );
+        ASSERT_TRUE( params.verbose );
+        ASSERT_FALSE( params.force );
+        ASSERT_EQ( params.count, 10u );
+        ASSERT_EQ( params.offset, -3 );
+        ASSERT_STREQ( params.name, " a b " );
+        ASSERT_EQ( params.mode, 'r' );
+        params_file_close( &file );
+
+        ASSERT_EQ( parse_config( &index, "name =\n", &params, &file ), 0 );
+        ASSERT_STREQ( params.name, "" );
+        params_file_close( &file );
+        ASSERT_EQ( parse_config( &index, "name = last", &params, &file ), 0 );
+        ASSERT_STREQ( params.name, "last" );
+        params_file_close( &file );
+        ASSERT_EQ( parse_config( &index, "", &params, &file ), 0 );
+        params_file_close( &file );
+
+        // Unknown name, short name, missing value and invalid value
+        ASSERT_EQ( parse_config( &index, "unknown = 1", &params, &file ), -1 );
+        params_file_close( &file );
+        ASSERT_EQ( parse_config( &index, "c = 1", &params, &file ), -1 );
+        params_file_close( &file );
+        ASSERT_EQ( parse_config( &index, "count", &params, &file ), -1 );
+        params_file_close( &file );
+        ASSERT_EQ( parse_config( &index, "verbose = yes", &params, &file ), -1 );
+        params_file_close( &file );
+        ASSERT_EQ( parse_config( &index, "= 1", &params, &file ), -1 );
+        params_file_close( &file );
+
+        ASSERT_EQ( parse_params_config_file( &index, NULL, &params ), -1 );
+        params_index_release( &index );
+    }
+
+    // Tests set_param_value -> Array parameters
+    TEST( params, set_param_array )
+    {
+        struct array_params_t
+        {
+            param_array_t   ids;
+            param_array_t   ratios;
+            param_array_t   masks;
+        };
+        const parameter_description_t array_descriptions[] =
+        {
+            { U32_ARRAY_TYPE, offsetof( array_params_t, ids ), sizeof( param_array_t ), 'i', "ids", "Ids." },
+            { DFLOAT_ARRAY_TYPE, offsetof( array_params_t, ratios ), sizeof( param_array_t ), 'r', "ratios", "Ratios." },
+            { HEX8_ARRAY_TYPE, offsetof( array_params_t, masks ), sizeof( param_array_t ), 0, "masks", "Masks." },
+            { I8_ARRAY_TYPE, 0, sizeof( uint8_t ), 0, "bad-size", "Bad size." },
+            { SENTINEL_TYPE, 0, 0, 0, NULL, NULL },
+        };
+        uint32_t ids[4];
+        double ratios[3];
+        uint8_t masks[2];
+        array_params_t params = { { ids, 4, 0 }, { ratios, 3, 0 }, { masks, 2, 0 } };
+        params_index_t index;
+
+        ASSERT_EQ( set_param_value( &array_descriptions[0], "1,2,3", &params ), 0 );
+        ASSERT_EQ( params.ids.count, 3u );
+        ASSERT_EQ( ids[0], 1u );
+        ASSERT_EQ( ids[2], 3u );
+        ASSERT_EQ( set_param_value( &array_descriptions[0], "4,3,2,1", &params ), 0 );
+        ASSERT_EQ( params.ids.count, 4u );
+        ASSERT_EQ( ids[0], 4u );
+        ASSERT_EQ( ids[3], 1u );
+        ASSERT_EQ( set_param_value( &array_descriptions[0], "", &params ), 0 );
+        ASSERT_EQ( params.ids.count, 0u );
+        ASSERT_EQ( set_param_value( &array_descriptions[1], "0.5,-1e3", &params ), 0 );
+        ASSERT_EQ( params.ratios.count, 2u );
+        ASSERT_EQ( ratios[1], -1e3 );
+        ASSERT_EQ( set_param_value( &array_descriptions[2], "0xF0,0F", &params ), 0 );
+        ASSERT_EQ( params.masks.count, 2u );
+        ASSERT_EQ( masks[1], 0x0F );
+
+        // Count is index of invalid element (capacity if too many elements)
+        ASSERT_EQ( set_param_value( &array_descriptions[0], "1,2,x,4", &params ), -1 );
+        ASSERT_EQ( params.ids.count, 2u );
+        ASSERT_EQ( set_param_value( &array_descriptions[0], "-1", &params ), -1 );
+        ASSERT_EQ( params.ids.count, 0u );
+        ASSERT_EQ( set_param_value( &array_descriptions[0], "1,2,3,4,5", &params ), -1 );
+        ASSERT_EQ( params.ids.count, 4u );
+        ASSERT_EQ( set_param_value( &array_descriptions[0], "1,,2", &params ), -1 );
+        ASSERT_EQ( params.ids.count, 1u );
+        ASSERT_EQ( set_param_value( &array_descriptions[2], "1FF", &params ), -1 );
+        ASSERT_EQ( params.masks.count, 0u );
+        ASSERT_EQ( set_param_value( &array_descriptions[0], NULL, &params ), -1 );
+        ASSERT_EQ( set_param_value( &array_descriptions[3], "1", &params ), -1 );
+
+        // Command line and buffer without capacity
+        ASSERT_EQ( params_index_init( &index, array_descriptions ), 0 );
+        std::vector<const char *> tokens = { "--ids", "7,8", "-r", "2.5", "--masks=A" };
+        ASSERT_EQ( parse_params_tokens( &index, tokens.size(), tokens.data(), &params ), 0 );
+        ASSERT_EQ( params.ids.count, 2u );
+        ASSERT_EQ( ids[1], 8u );
+        ASSERT_EQ( params.ratios.count, 1u );
+        ASSERT_EQ( ratios[0], 2.5 );
+        ASSERT_EQ( params.masks.count, 1u );
+        ASSERT_EQ( masks[0], 0x0A );
+        params.ids = param_array_t{ NULL, 0, 0 };
+        ASSERT_EQ( parse_params_tokens( &index, 2, tokens.data(), &params ), -1 );
+        ASSERT_EQ( params.ids.count, 0u );
+        params.ids = param_array_t{ NULL, 2, 0 };
+        ASSERT_EQ( parse_params_tokens( &index, 2, tokens.data(), &params ), -1 );
+        params_index_release( &index );
+    }
+
+    // Tests params_index_set_command_line_only -> Option naming a config file
+    // is rejected in files
+    TEST( params, command_line_only )
+    {
+        params_index_t index;
+        test_params_t params;
+        params_file_t file;
+
+        ASSERT_EQ( params_index_init( &index, descriptions ), 0 );
+        ASSERT_EQ( params_index_set_command_line_only( &index, &descriptions[6] ), 0 );
+
+        // Accepted on command line
+        ASSERT_EQ( parse( &index, { "-n", "v.cfg" }, &params ), 0 );
+        ASSERT_STREQ( params.name, "v.cfg" );
+
+        // Rejected in response files (short and long names) and config files
+        ASSERT_EQ( parse_response( &index, "-n v.cfg", &params, &file ), -1 );
+        params_file_close( &file );
+        ASSERT_EQ( parse_response( &index, "-vnv.cfg", &params, &file ), -1 );
+        params_file_close( &file );
+        ASSERT_EQ( parse_response( &index, "--name=v.cfg", &params, &file ), -1 );
+        params_file_close( &file );
+        ASSERT_EQ( parse_config( &index, "name = v.cfg", &params, &file ), -1 );
+        params_file_close( &file );
+
+        // Other parameters are still accepted in files
+        ASSERT_EQ( parse_response( &index, "-v --count 3", &params, &file ), 0 );
+        ASSERT_EQ( params.count, 3u );
+        params_file_close( &file );
+        ASSERT_EQ( parse_config( &index, "count = 4", &params, &file ), 0 );
+        ASSERT_EQ( params.count, 4u );
+        params_file_close( &file );
+
+        ASSERT_EQ( params_index_set_command_line_only( &index, &descriptions[8] ), -1 );
+        ASSERT_EQ( params_index_set_command_line_only( &index, NULL ), -1 );
+        ASSERT_EQ( params_index_set_command_line_only( NULL, &descriptions[6] ), -1 );
+        params_index_release( &index );
+    }
+
+    // Tests parse_params_tokens -> Same index used by several threads
+    TEST( params, parse_tokens_threads )
+    {
+        params_index_t index;
+        std::vector<std::thread> threads;
+        std::vector<int> errors( 4, 0 );
+
+        ASSERT_EQ( params_index_init( &index, descriptions ), 0 );
+        for( size_t t = 0; t < errors.size(); t++ )
+        {
+            threads.emplace_back( [&, t]() {
+                for( uint32_t i = 0; i < 10000; i++ )
+                {
+                    std::string count = std::to_string( i * t );
+                    test_params_t params;
+
+                    if( ( parse( &index, { "-v", "--count", count.c_str() }, &params ) != 0 ) ||
+                        ( params.count != i * t ) || ! params.verbose )
+                    {
+                        errors[t]++;
+                    }
+                }
+            } );
+        }
+        for( std::thread & thread : threads )
+        {
+            thread.join();
+        }
+        for( int error : errors )
+        {
+            ASSERT_EQ( error, 0 );
+        }
+        params_index_release( &index );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
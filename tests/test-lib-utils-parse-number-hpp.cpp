@@ -0,0 +1,165 @@
+/*!
+ * @file: test-lib-utils-parse-number-hpp.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for C++ inline number parsers.
+ */
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "lib-utils-parse-number.hpp"
+
+namespace
+{
+    // Parsers are evaluated at compile time
+    static_assert( lib_utils::parse<uint8_t>( "255" ) == 255 );
+    static_assert( ! lib_utils::parse<uint8_t>( "256" ) );
+    static_assert( lib_utils::parse<int8_t>( " -128" ) == -128 );
+    static_assert( ! lib_utils::parse<int8_t>( "-129" ) );
+    static_assert( lib_utils::parse<uint64_t>( "18446744073709551615" ) == UINT64_MAX );
+    static_assert( ! lib_utils::parse<uint64_t>( "18446744073709551616" ) );
+    static_assert( lib_utils::parse<int64_t>( "-9223372036854775808" ) == INT64_MIN );
+    static_assert( lib_utils::parse_hex<uint16_t>( "0xFFFF" ) == 0xFFFF );
+    static_assert( ! lib_utils::parse_hex<uint16_t>( "0x10000" ) );
+    static_assert( ! lib_utils::parse<uint32_t>( "" ) );
+
+    // Tests parse<T> -> Valid case
+    TEST( parse_number_hpp, valid_cases )
+    {
+        const char buf[] = "25599 -12899 0xFFFF1";
+        uint32_t u32 = 0;
+
+        ASSERT_EQ( lib_utils::parse<uint32_t>( "12" ), 12u );
+        ASSERT_EQ( lib_utils::parse<int16_t>( "+00012" ), 12 );
+        ASSERT_EQ( lib_utils::parse<uint8_t>( "-0" ), 0 );
+        ASSERT_EQ( lib_utils::parse<int32_t>( std::string_view( &buf[6], 6 ) ), -12899 );
+        ASSERT_EQ( lib_utils::parse_hex<uint32_t>( std::string_view( &buf[13], 7 ) ), 0xFFFF1u );
+        ASSERT_EQ( lib_utils::parse_hex<uint8_t>( "ff" ), 0xFF );
+        ASSERT_EQ( lib_utils::parse<double>( "1.5e3" ), 1500.0 );
+        ASSERT_EQ( lib_utils::parse<float>( "0.25" ), 0.25f );
+        ASSERT_EQ( lib_utils::parse( std::string_view( buf, 5 ), u32 ), 0 );
+        ASSERT_EQ( u32, 25599u );
+    }
+
+    // Tests parse<T> -> Invalid case
+    TEST( parse_number_hpp, invalid_cases )
+    {
+        uint32_t u32 = 42;
+
+        ASSERT_FALSE( lib_utils::parse<uint32_t>( "" ) );
+        ASSERT_FALSE( lib_utils::parse<uint32_t>( "12 " ) );
+        ASSERT_FALSE( lib_utils::parse<uint32_t>( "-1" ) );
+        ASSERT_FALSE( lib_utils::parse<uint32_t>( "4294967296" ) );
+        ASSERT_FALSE( lib_utils::parse<int16_t>( "32768" ) );
+        ASSERT_FALSE( lib_utils::parse_hex<uint64_t>( "0x" ) );
+        ASSERT_FALSE( lib_utils::parse_hex<uint64_t>( "10000000000000000" ) );
+        ASSERT_FALSE( lib_utils::parse<double>( "1.5f" ) );
+        ASSERT_FALSE( lib_utils::parse<double>( std::string_view() ) );
+        ASSERT_EQ( lib_utils::parse( "abc", u32 ), -1 );
+        ASSERT_EQ( u32, 42u );
+    }
+
+    // Build a random string looking like a decimal or hexadecimal number
+    std::string random_number_string( std::mt19937_64 & gen )
+    {
+        static const char alphabet[] = " \t+-0123456789abcdefxX";
+        std::string str;
+        unsigned int len;
+
+        switch( gen() % 4 )
+        {
+            case 0:
+                // Random characters
+                len = gen() % 25;
+                for( unsigned int i = 0; i < len; i++ )
+                {
+                    str += alphabet[gen() % ( sizeof( alphabet ) - 1 )];
+                }
+            break;
+            case 1:
+                // Random hexadecimal value
+                str = ( gen() & 1 ) ? "0x" : "";
+                str += std::string( gen() % 3, '0' );
+                for( uint64_t value = gen() >> ( gen() % 64 ); value; value >>= 4 )
+                {
+                    str += ( gen() & 1 ) ? "0123456789abcdef"[value & 0xF] :
+                                           "0123456789ABCDEF"[value & 0xF];
+                }
+            break;
+            default:
+                // Random value with optional sign, spaces and leading zeros
+                if( 0 == gen() % 4 )
+                {
+                    str += ' ';
+                }
+                if( 0 == gen() % 3 )
+                {
+                    str += ( gen() & 1 ) ? '-' : '+';
+                }
+                str += std::string( gen() % 4, '0' );
+                str += std::to_string( gen() >> ( gen() % 64 ) );
+                str += std::string( ( 0 == gen() % 8 ) ? 1 : 0, '0' );
+            break;
+        }
+
+        return str;
+    }
+
+    // Check C++ parser gives the same result as C parser (buffer is allocated
+    // without terminator)
+    template <typename T>
+    void check_same_as_c( const std::string & value,
+            int (*parse_n)( const char *, size_t, T * ),
+            std::optional<T> (*parse)( std::string_view ) )
+    {
+        std::unique_ptr<char[]> buf( new char[value.size() + 1] );
+        std::string_view str( buf.get(), value.size() );
+        std::optional<T> number;
+        T expected = 0;
+        int ret;
+
+        memcpy( buf.get(), value.data(), value.size() );
+        ret = parse_n( buf.get(), value.size(), &expected );
+        number = parse( str );
+
+        ASSERT_EQ( number.has_value(), 0 == ret ) << value;
+        if( number )
+        {
+            ASSERT_EQ( *number, expected ) << value;
+        }
+    }
+
+    // Tests parse<T> -> Same result as C API on random inputs
+    TEST( parse_number_hpp, same_as_c_api )
+    {
+        std::mt19937_64 gen( 4242 );
+
+        for( int i = 0; i < 100000; i++ )
+        {
+            std::string value = random_number_string( gen );
+
+            check_same_as_c( value, parse_uint8_n, lib_utils::parse<uint8_t> );
+            check_same_as_c( value, parse_int8_n, lib_utils::parse<int8_t> );
+            check_same_as_c( value, parse_hex8_n, lib_utils::parse_hex<uint8_t> );
+            check_same_as_c( value, parse_uint16_n, lib_utils::parse<uint16_t> );
+            check_same_as_c( value, parse_int16_n, lib_utils::parse<int16_t> );
+            check_same_as_c( value, parse_hex16_n, lib_utils::parse_hex<uint16_t> );
+            check_same_as_c( value, parse_uint32_n, lib_utils::parse<uint32_t> );
+            check_same_as_c( value, parse_int32_n, lib_utils::parse<int32_t> );
+            check_same_as_c( value, parse_hex32_n, lib_utils::parse_hex<uint32_t> );
+            check_same_as_c( value, parse_uint64_n, lib_utils::parse<uint64_t> );
+            check_same_as_c( value, parse_int64_n, lib_utils::parse<int64_t> );
+            check_same_as_c( value, parse_hex64_n, lib_utils::parse_hex<uint64_t> );
+        }
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
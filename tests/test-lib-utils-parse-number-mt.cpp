@@ -0,0 +1,240 @@
+/*!
+ * @file: test-lib-utils-parse-number-mt.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for multithreaded number parsers.
+ */
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C"
+{
+    #include "lib-utils-parse-number.h"
+    #include "lib-utils-parse-number-mt.h"
+}
+
+namespace
+{
+    // Random buffer of nb values separated by delim, bad values are inserted
+    // with probability 1 / bad_ratio (0: only valid values)
+    std::string generate_buffer( std::mt19937_64 & gen,
+                                 size_t nb,
+                                 char delim,
+                                 unsigned int bad_ratio,
+                                 bool is_float )
+    {
+        static const char * bad_values[] = { "", "x", "-", "1e", "0x", "99999999999999999999999" };
+        std::string buf;
+        char value[64];
+
+        for( size_t i = 0; i < nb; i++ )
+        {
+            if( ( bad_ratio > 0 ) && ( 0 == gen() % bad_ratio ) )
+            {
+                buf += bad_values[gen() % ( sizeof( bad_values ) / sizeof( bad_values[0] ) )];
+            }
+            else if( is_float )
+            {
+                snprintf( value, sizeof( value ), "%.*g", (int)( 1 + gen() % 17 ),
+                          (double)(int64_t)gen() / (double)( 1 + gen() % 1000000 ) );
+                buf += value;
+            }
+            else
+            {
+                snprintf( value, sizeof( value ), "%d", (int16_t)gen() );
+                buf += value;
+            }
+            buf += delim;
+        }
+        // Trailing delimiter is optional
+        if( gen() % 2 )
+        {
+            buf.pop_back();
+        }
+
+        return buf;
+    }
+
+    // Check multithreaded parser gives the same result as single threaded one
+    template <typename T>
+    void check_same_as_single_thread( parse_pool_t * pool,
+            const std::string & buf,
+            char delim,
+            size_t max_out,
+            size_t (*parse_array)( const char *, size_t, char, T *, size_t, size_t * ),
+            size_t (*parse_array_mt)( parse_pool_t *, const char *, size_t, char, T *,
+                                      size_t, size_t * ) )
+    {
+        std::vector<T> expected( max_out + 1 );
+        std::vector<T> numbers( max_out + 1 );
+        size_t expected_consumed;
+        size_t consumed;
+        size_t expected_nb;
+        size_t nb;
+
+        expected_nb = parse_array( buf.data(), buf.size(), delim, expected.data(),
+                                   max_out, &expected_consumed );
+        nb = parse_array_mt( pool, buf.data(), buf.size(), delim, numbers.data(),
+                             max_out, &consumed );
+
+        ASSERT_EQ( nb, expected_nb );
+        ASSERT_EQ( consumed, expected_consumed );
+        ASSERT_EQ( 0, memcmp( numbers.data(), expected.data(), nb * sizeof( T ) ) );
+    }
+
+    // Tests parse_pool -> Create and destroy
+    TEST( parse_pool, create_destroy )
+    {
+        parse_pool_t * pool;
+
+        ASSERT_EQ( parse_pool_create( 0 ), nullptr );
+        ASSERT_EQ( parse_pool_get_nb_threads( NULL ), 0u );
+        parse_pool_destroy( NULL );
+
+        for( unsigned int nb_threads = 1; nb_threads <= 8; nb_threads++ )
+        {
+            pool = parse_pool_create( nb_threads );
+            ASSERT_NE( pool, nullptr );
+            ASSERT_EQ( parse_pool_get_nb_threads( pool ), nb_threads );
+            parse_pool_destroy( pool );
+        }
+    }
+
+    // Tests parse_array_mt -> Valid case
+    TEST( parse_array_mt, valid_cases )
+    {
+        parse_pool_t * pool = parse_pool_create( 4 );
+        std::string buf;
+        std::vector<uint32_t> numbers( 1000000 );
+        size_t consumed;
+        size_t nb;
+
+        ASSERT_NE( pool, nullptr );
+
+        for( uint32_t i = 0; i < numbers.size(); i++ )
+        {
+            buf += std::to_string( i ) + "\n";
+        }
+
+        nb = parse_uint32_array_mt( pool, buf.data(), buf.size(), '\n', numbers.data(),
+                                    numbers.size(), &consumed );
+        ASSERT_EQ( nb, numbers.size() );
+        ASSERT_EQ( consumed, buf.size() );
+        for( uint32_t i = 0; i < numbers.size(); i++ )
+        {
+            ASSERT_EQ( numbers[i], i );
+        }
+
+        // Output array full: parsing restarts after consumed bytes
+        nb = parse_uint32_array_mt( pool, buf.data(), buf.size(), '\n', numbers.data(),
+                                    1000, &consumed );
+        ASSERT_EQ( nb, 1000u );
+        ASSERT_EQ( consumed, buf.find( "1000\n" ) );
+
+        // Small buffer: parsed by calling thread
+        nb = parse_uint32_array_mt( pool, "1,2,3", 5, ',', numbers.data(),
+                                    numbers.size(), &consumed );
+        ASSERT_EQ( nb, 3u );
+        ASSERT_EQ( consumed, 5u );
+        ASSERT_EQ( numbers[2], 3u );
+
+        nb = parse_uint32_array_mt( pool, buf.data(), 0, '\n', numbers.data(),
+                                    numbers.size(), &consumed );
+        ASSERT_EQ( nb, 0u );
+        ASSERT_EQ( consumed, 0u );
+
+        parse_pool_destroy( pool );
+    }
+
+    // Tests parse_array_mt -> Invalid case
+    TEST( parse_array_mt, invalid_cases )
+    {
+        parse_pool_t * pool = parse_pool_create( 3 );
+        std::string buf;
+        std::vector<int64_t> numbers( 1000000 );
+        size_t consumed;
+        size_t nb;
+
+        ASSERT_NE( pool, nullptr );
+
+        for( int64_t i = 0; i < 1000000; i++ )
+        {
+            buf += ( 777777 == i ) ? std::string( "7a" ) : std::to_string( -i );
+            buf += ",";
+        }
+
+        nb = parse_int64_array_mt( pool, buf.data(), buf.size(), ',', numbers.data(),
+                                   numbers.size(), &consumed );
+        ASSERT_EQ( nb, 777777u );
+        ASSERT_EQ( consumed, buf.find( "7a" ) );
+        ASSERT_EQ( numbers[777776], -777776 );
+
+        nb = parse_int64_array_mt( NULL, buf.data(), buf.size(), ',', numbers.data(),
+                                   numbers.size(), &consumed );
+        ASSERT_EQ( nb, 0u );
+        ASSERT_EQ( consumed, 0u );
+
+        nb = parse_int64_array_mt( pool, NULL, buf.size(), ',', numbers.data(),
+                                   numbers.size(), &consumed );
+        ASSERT_EQ( nb, 0u );
+
+        nb = parse_int64_array_mt( pool, buf.data(), buf.size(), ',', NULL,
+                                   numbers.size(), &consumed );
+        ASSERT_EQ( nb, 0u );
+
+        nb = parse_int64_array_mt( pool, buf.data(), buf.size(), ',', numbers.data(),
+                                   numbers.size(), NULL );
+        ASSERT_EQ( nb, 0u );
+
+        parse_pool_destroy( pool );
+    }
+
+    // Tests parse_array_mt -> Same result as single threaded parsers for any
+    // number of threads, bad values and output array size
+    TEST( parse_array_mt, same_as_single_thread )
+    {
+        std::mt19937_64 gen( 4242 );
+
+        for( unsigned int nb_threads = 1; nb_threads <= 6; nb_threads++ )
+        {
+            parse_pool_t * pool = parse_pool_create( nb_threads );
+
+            ASSERT_NE( pool, nullptr );
+
+            for( int i = 0; i < 12; i++ )
+            {
+                size_t nb = 1 + gen() % 150000;
+                unsigned int bad_ratio = ( i % 3 ) ? 0 : 1 + gen() % 200000;
+                char delim = ( i % 2 ) ? ',' : '\n';
+                std::string ints = generate_buffer( gen, nb, delim, bad_ratio, false );
+                std::string floats = generate_buffer( gen, nb / 4, delim, bad_ratio, true );
+                size_t max_out = ( i % 4 ) ? nb + 1 : gen() % nb;
+
+                check_same_as_single_thread( pool, ints, delim, max_out,
+                                             parse_int16_array, parse_int16_array_mt );
+                check_same_as_single_thread( pool, ints, delim, max_out,
+                                             parse_int32_array, parse_int32_array_mt );
+                check_same_as_single_thread( pool, ints, delim, max_out,
+                                             parse_uint64_array, parse_uint64_array_mt );
+                check_same_as_single_thread( pool, ints, delim, max_out,
+                                             parse_hex32_array, parse_hex32_array_mt );
+                check_same_as_single_thread( pool, floats, delim, max_out,
+                                             parse_double_array, parse_double_array_mt );
+                check_same_as_single_thread( pool, floats, delim, max_out,
+                                             parse_float_array, parse_float_array_mt );
+            }
+
+            parse_pool_destroy( pool );
+        }
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
@@ -1,666 +1,1395 @@
-/*!
- * @file: test-lib-utils-parse-number.cpp
- * @date: 2024-01-06
- * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
- * @brief: Implementation of unit test for library version management functions.
- */
-#include <gtest/gtest.h>
-
-extern "C"
-{
-    #include "lib-utils-parse-number.h"
-}
-
-namespace
-{
-    // Tests parse_uint8 -> Valid case
-    TEST( parse_uint8, valid_cases )
-    {
-        int ret;
-        uint8_t number = -1;
-
-        ret = parse_uint8("12", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 12);
-
-        ret = parse_uint8("0", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0);
-        
-        ret = parse_uint8("255", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ( number, 255 );
-    }
-
-    // Tests parse_uint8 -> Invalid case
-    TEST( parse_uint8, invalid_cases )
-    {
-        int ret;
-        uint8_t number = -1;
-
-        ret = parse_uint8(NULL, &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint8("42", NULL);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint8("-1", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_uint8("256", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_uint8("ab", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint8("", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint8("helloworld", &number);
-        ASSERT_EQ( ret, -1 );
-    }
-
-    // Tests parse_int8 -> Valid case
-    TEST( parse_int8, valid_cases )
-    {
-        int ret;
-        int8_t number = -1;
-
-        ret = parse_int8("12", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 12);
-
-        ret = parse_int8("0", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0);
-
-        ret = parse_int8("-1", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, -1);
-        
-        ret = parse_int8("-128", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, -128);
-
-        ret = parse_int8("127", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 127);
-    }
-
-    // Tests parse_int8 -> Invalid case
-    TEST( parse_int8, invalid_cases )
-    {
-        int ret;
-        int8_t number = -1;
-
-        ret = parse_int8(NULL, &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int8("42", NULL);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int8("-129", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_int8("128", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_int8("ab", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int8("", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int8("helloworld", &number);
-        ASSERT_EQ( ret, -1 );
-    }
-
-    // Tests parse_hex8 -> Valid case
-    TEST( parse_hex8, valid_cases )
-    {
-        int ret;
-        uint8_t number = -1;
-
-        ret = parse_hex8("0", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x00);
-
-        ret = parse_hex8("0x00", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x00);
-
-        ret = parse_hex8("0xFF", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0xFF);
-
-        ret = parse_hex8("0x42", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x42);
-
-        ret = parse_hex8("0xA5", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0xA5 );
-
-        ret = parse_hex8("5A", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x5A);
-    }
-
-    // Tests parse_hex8 -> Invalid case
-    TEST( parse_hex8, invalid_cases )
-    {
-        int ret;
-        uint8_t number = -1;
-
-        ret = parse_hex8(NULL, &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex8("42", NULL);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex8("0x100", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_hex8("100", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_hex8("Oxab", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex8("", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex8("helloworld", &number);
-        ASSERT_EQ( ret, -1 );
-    }
-
-        // Tests parse_uint16 -> Valid case
-    TEST( parse_uint16, valid_cases )
-    {
-        int ret;
-        uint16_t number = -1;
-
-        ret = parse_uint16("42", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 42);
-
-        ret = parse_uint16("0", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0);
-        
-        ret = parse_uint16("65535", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 65535);
-    }
-
-    // Tests parse_uint16 -> Invalid case
-    TEST( parse_uint16, invalid_cases )
-    {
-        int ret;
-        uint16_t number = -1;
-
-        ret = parse_uint16(NULL, &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint16("42", NULL);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint16("-1", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_uint16("65536", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_uint16("abcd", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint16("", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint16("helloworld", &number);
-        ASSERT_EQ( ret, -1 );
-    }
-
-    // Tests parse_int16 -> Valid case
-    TEST( parse_int16, valid_cases )
-    {
-        int ret;
-        int16_t number = -1;
-
-        ret = parse_int16("12", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 12);
-
-        ret = parse_int16("0", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0);
-
-        ret = parse_int16("-1", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, -1);
-        
-        ret = parse_int16("-32768", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, -32768);
-
-        ret = parse_int16("32767", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 32767);
-    }
-
-    // Tests parse_int16 -> Invalid case
-    TEST( parse_int16, invalid_cases )
-    {
-        int ret;
-        int16_t number = -1;
-
-        ret = parse_int16(NULL, &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int16("42", NULL);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int16("-32769", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_int16("32768", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_int16("abcd", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int16("", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int16("helloworld", &number);
-        ASSERT_EQ( ret, -1 );
-    }
-
-    // Tests parse_hex16 -> Valid case
-    TEST( parse_hex16, valid_cases )
-    {
-        int ret;
-        uint16_t number = -1;
-
-        ret = parse_hex16("0", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x00);
-
-        ret = parse_hex16("0x0000", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x0000);
-
-        ret = parse_hex16("0xFFFF", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0xFFFF);
-
-        ret = parse_hex16("0x4242", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x4242);
-
-        ret = parse_hex16("0x55AA", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x55AA );
-
-        ret = parse_hex16("55AA", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x55AA);
-    }
-
-    // Tests parse_hex16 -> Invalid case
-    TEST( parse_hex16, invalid_cases )
-    {
-        int ret;
-        uint16_t number = -1;
-
-        ret = parse_hex16(NULL, &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex16("42", NULL);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex16("0x10000", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_hex16("10000", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_hex16("Oxabcd", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex16("", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex16("helloworld", &number);
-        ASSERT_EQ( ret, -1 );
-    }
-
-        // Tests parse_uint32 -> Valid case
-    TEST( parse_uint32, valid_cases )
-    {
-        int ret;
-        uint32_t number = -1;
-
-        ret = parse_uint32("42", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 42);
-
-        ret = parse_uint32("0", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0);
-        
-        ret = parse_uint32("4294967295", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 4294967295);
-    }
-
-    // Tests parse_uint32 -> Invalid case
-    TEST( parse_uint32, invalid_cases )
-    {
-        int ret;
-        uint32_t number = -1;
-
-        ret = parse_uint32(NULL, &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint32("42", NULL);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint32("-1", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_uint32("4294967296", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_uint32("abcdef01", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint32("", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint32("helloworld", &number);
-        ASSERT_EQ( ret, -1 );
-    }
-
-    // Tests parse_int32 -> Valid case
-    TEST( parse_int32, valid_cases )
-    {
-        int ret;
-        int32_t number = -1;
-
-        ret = parse_int32("12", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 12);
-
-        ret = parse_int32("0", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0);
-
-        ret = parse_int32("-1", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, -1);
-        
-        ret = parse_int32("-2147483648", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, -2147483648);
-
-        ret = parse_int32("2147483647", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 2147483647);
-    }
-
-    // Tests parse_int32 -> Invalid case
-    TEST( parse_int32, invalid_cases )
-    {
-        int ret;
-        int32_t number = -1;
-
-        ret = parse_int32(NULL, &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int32("42", NULL);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int32("-2147483649", &number);
-        printf("NUmber : %d\r\n", number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_int32("2147483648", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_int32("abcdef01", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int32("", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int32("helloworld", &number);
-        ASSERT_EQ( ret, -1 );
-    }
-
-    // Tests parse_hex32 -> Valid case
-    TEST( parse_hex32, valid_cases )
-    {
-        int ret;
-        uint32_t number = -1;
-
-        ret = parse_hex32("0", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x00);
-
-        ret = parse_hex32("0x00000000", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x0000);
-
-        ret = parse_hex32("0xFFFFFFFF", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0xFFFFFFFF);
-
-        ret = parse_hex32("0x42424242", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x42424242);
-
-        ret = parse_hex32("0x5555AAAA", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x5555AAAA );
-
-        ret = parse_hex32("5555AAAA", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x5555AAAA);
-    }
-
-    // Tests parse_hex32 -> Invalid case
-    TEST( parse_hex32, invalid_cases )
-    {
-        int ret;
-        uint32_t number = -1;
-
-        ret = parse_hex32(NULL, &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex32("42", NULL);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex32("0x100000000", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex32("100000000", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_hex32("Oxabcdef01", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex32("", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex32("helloworld", &number);
-        ASSERT_EQ( ret, -1 );
-    }
-
-        // Tests parse_uint64 -> Valid case
-    TEST( parse_uint64, valid_cases )
-    {
-        int ret;
-        uint64_t number = -1;
-
-        ret = parse_uint64("42", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 42);
-
-        ret = parse_uint64("0", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0);
-        
-        ret = parse_uint64("18446744073709551615", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, UINT64_C(18446744073709551615));
-    }
-
-    // Tests parse_uint64 -> Invalid case
-    TEST( parse_uint64, invalid_cases )
-    {
-        int ret;
-        uint64_t number = -1;
-
-        ret = parse_uint64(NULL, &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint64("42", NULL);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint64("-1", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_uint64("18446744073709551616", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_uint64("abcdef01abcdef01", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint64("", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_uint64("helloworld", &number);
-        ASSERT_EQ( ret, -1 );
-    }
-
-    // Tests parse_int64 -> Valid case
-    TEST( parse_int64, valid_cases )
-    {
-        int ret;
-        int64_t number = -1;
-
-        ret = parse_int64("12", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 12);
-
-        ret = parse_int64("0", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0);
-
-        ret = parse_int64("-1", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, -1);
-        
-        ret = parse_int64("-9223372036854775808", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, INT64_MIN);
-
-        ret = parse_int64("9223372036854775807", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 9223372036854775807);
-    }
-
-    // Tests parse_int64 -> Invalid case
-    TEST( parse_int64, invalid_cases )
-    {
-        int ret;
-        int64_t number = -1;
-
-        ret = parse_int64(NULL, &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int64("42", NULL);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int64("-9223372036854775809", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_int64("9223372036854775808", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_int64("abcdef01abcdef01", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int64("", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_int64("helloworld", &number);
-        ASSERT_EQ( ret, -1 );
-    }
-
-    // Tests parse_hex64 -> Valid case
-    TEST( parse_hex64, valid_cases )
-    {
-        int ret;
-        uint64_t number = -1;
-
-        ret = parse_hex64("0", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x00);
-
-        ret = parse_hex64("0x0000000000000000", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x0000);
-
-        ret = parse_hex64("0xFFFFFFFFFFFFFFFF", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0xFFFFFFFFFFFFFFFF);
-
-        ret = parse_hex64("0x4242424242424242", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x4242424242424242);
-
-        ret = parse_hex64("0x55555555AAAAAAAA", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x55555555AAAAAAAA );
-
-        ret = parse_hex64("55555555AAAAAAAA", &number);
-        ASSERT_EQ( ret, 0 );
-        ASSERT_EQ(number, 0x55555555AAAAAAAA);
-    }
-
-    // Tests parse_hex64 -> Invalid case
-    TEST( parse_hex64, invalid_cases )
-    {
-        int ret;
-        uint64_t number = -1;
-
-        ret = parse_hex64(NULL, &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex64("42", NULL);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex64("0x10000000000000000", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_hex64("10000000000000000", &number);
-        ASSERT_EQ( ret, -1 );
-        
-        ret = parse_hex64("Oxabcdef01abcdef01", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex64("", &number);
-        ASSERT_EQ( ret, -1 );
-
-        ret = parse_hex64("helloworld", &number);
-        ASSERT_EQ( ret, -1 );
-    }
-}
-
-int main( int argc, char** argv )
-{
-    testing::InitGoogleTest( &argc, argv );
-    return RUN_ALL_TESTS();
+/*!
+ * @file: test-lib-utils-parse-number.cpp
+ * @date: 2024-01-06
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for library version management functions.
+ */
+#include <gtest/gtest.h>
+
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+
+extern "C"
+{
+    #include "lib-utils-parse-number.h"
+}
+
+namespace
+{
+    // Tests parse_uint8 -> Valid case
+    TEST( parse_uint8, valid_cases )
+    {
+        int ret;
+        uint8_t number = -1;
+
+        ret = parse_uint8("12", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 12);
+
+        ret = parse_uint8("0", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0);
+        
+        ret = parse_uint8("255", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ( number, 255 );
+    }
+
+    // Tests parse_uint8 -> Invalid case
+    TEST( parse_uint8, invalid_cases )
+    {
+        int ret;
+        uint8_t number = -1;
+
+        ret = parse_uint8(NULL, &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint8("42", NULL);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint8("-1", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_uint8("256", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_uint8("ab", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint8("", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint8("helloworld", &number);
+        ASSERT_EQ( ret, -1 );
+    }
+
+    // Tests parse_int8 -> Valid case
+    TEST( parse_int8, valid_cases )
+    {
+        int ret;
+        int8_t number = -1;
+
+        ret = parse_int8("12", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 12);
+
+        ret = parse_int8("0", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0);
+
+        ret = parse_int8("-1", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, -1);
+        
+        ret = parse_int8("-128", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, -128);
+
+        ret = parse_int8("127", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 127);
+    }
+
+    // Tests parse_int8 -> Invalid case
+    TEST( parse_int8, invalid_cases )
+    {
+        int ret;
+        int8_t number = -1;
+
+        ret = parse_int8(NULL, &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int8("42", NULL);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int8("-129", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_int8("128", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_int8("ab", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int8("", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int8("helloworld", &number);
+        ASSERT_EQ( ret, -1 );
+    }
+
+    // Tests parse_hex8 -> Valid case
+    TEST( parse_hex8, valid_cases )
+    {
+        int ret;
+        uint8_t number = -1;
+
+        ret = parse_hex8("0", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x00);
+
+        ret = parse_hex8("0x00", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x00);
+
+        ret = parse_hex8("0xFF", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0xFF);
+
+        ret = parse_hex8("0x42", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x42);
+
+        ret = parse_hex8("0xA5", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0xA5 );
+
+        ret = parse_hex8("5A", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x5A);
+    }
+
+    // Tests parse_hex8 -> Invalid case
+    TEST( parse_hex8, invalid_cases )
+    {
+        int ret;
+        uint8_t number = -1;
+
+        ret = parse_hex8(NULL, &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex8("42", NULL);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex8("0x100", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_hex8("100", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_hex8("Oxab", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex8("", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex8("helloworld", &number);
+        ASSERT_EQ( ret, -1 );
+    }
+
+        // Tests parse_uint16 -> Valid case
+    TEST( parse_uint16, valid_cases )
+    {
+        int ret;
+        uint16_t number = -1;
+
+        ret = parse_uint16("42", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 42);
+
+        ret = parse_uint16("0", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0);
+        
+        ret = parse_uint16("65535", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 65535);
+    }
+
+    // Tests parse_uint16 -> Invalid case
+    TEST( parse_uint16, invalid_cases )
+    {
+        int ret;
+        uint16_t number = -1;
+
+        ret = parse_uint16(NULL, &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint16("42", NULL);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint16("-1", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_uint16("65536", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_uint16("abcd", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint16("", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint16("helloworld", &number);
+        ASSERT_EQ( ret, -1 );
+    }
+
+    // Tests parse_int16 -> Valid case
+    TEST( parse_int16, valid_cases )
+    {
+        int ret;
+        int16_t number = -1;
+
+        ret = parse_int16("12", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 12);
+
+        ret = parse_int16("0", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0);
+
+        ret = parse_int16("-1", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, -1);
+        
+        ret = parse_int16("-32768", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, -32768);
+
+        ret = parse_int16("32767", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 32767);
+    }
+
+    // Tests parse_int16 -> Invalid case
+    TEST( parse_int16, invalid_cases )
+    {
+        int ret;
+        int16_t number = -1;
+
+        ret = parse_int16(NULL, &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int16("42", NULL);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int16("-32769", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_int16("32768", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_int16("abcd", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int16("", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int16("helloworld", &number);
+        ASSERT_EQ( ret, -1 );
+    }
+
+    // Tests parse_hex16 -> Valid case
+    TEST( parse_hex16, valid_cases )
+    {
+        int ret;
+        uint16_t number = -1;
+
+        ret = parse_hex16("0", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x00);
+
+        ret = parse_hex16("0x0000", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x0000);
+
+        ret = parse_hex16("0xFFFF", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0xFFFF);
+
+        ret = parse_hex16("0x4242", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x4242);
+
+        ret = parse_hex16("0x55AA", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x55AA );
+
+        ret = parse_hex16("55AA", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x55AA);
+    }
+
+    // Tests parse_hex16 -> Invalid case
+    TEST( parse_hex16, invalid_cases )
+    {
+        int ret;
+        uint16_t number = -1;
+
+        ret = parse_hex16(NULL, &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex16("42", NULL);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex16("0x10000", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_hex16("10000", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_hex16("Oxabcd", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex16("", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex16("helloworld", &number);
+        ASSERT_EQ( ret, -1 );
+    }
+
+        // Tests parse_uint32 -> Valid case
+    TEST( parse_uint32, valid_cases )
+    {
+        int ret;
+        uint32_t number = -1;
+
+        ret = parse_uint32("42", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 42);
+
+        ret = parse_uint32("0", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0);
+        
+        ret = parse_uint32("4294967295", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 4294967295);
+    }
+
+    // Tests parse_uint32 -> Invalid case
+    TEST( parse_uint32, invalid_cases )
+    {
+        int ret;
+        uint32_t number = -1;
+
+        ret = parse_uint32(NULL, &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint32("42", NULL);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint32("-1", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_uint32("4294967296", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_uint32("abcdef01", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint32("", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint32("helloworld", &number);
+        ASSERT_EQ( ret, -1 );
+    }
+
+    // Tests parse_int32 -> Valid case
+    TEST( parse_int32, valid_cases )
+    {
+        int ret;
+        int32_t number = -1;
+
+        ret = parse_int32("12", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 12);
+
+        ret = parse_int32("0", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0);
+
+        ret = parse_int32("-1", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, -1);
+        
+        ret = parse_int32("-2147483648", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, -2147483648);
+
+        ret = parse_int32("2147483647", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 2147483647);
+    }
+
+    // Tests parse_int32 -> Invalid case
+    TEST( parse_int32, invalid_cases )
+    {
+        int ret;
+        int32_t number = -1;
+
+        ret = parse_int32(NULL, &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int32("42", NULL);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int32("-2147483649", &number);
+        printf("NUmber : %d\r\n", number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_int32("2147483648", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_int32("abcdef01", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int32("", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int32("helloworld", &number);
+        ASSERT_EQ( ret, -1 );
+    }
+
+    // Tests parse_hex32 -> Valid case
+    TEST( parse_hex32, valid_cases )
+    {
+        int ret;
+        uint32_t number = -1;
+
+        ret = parse_hex32("0", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x00);
+
+        ret = parse_hex32("0x00000000", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x0000);
+
+        ret = parse_hex32("0xFFFFFFFF", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0xFFFFFFFF);
+
+        ret = parse_hex32("0x42424242", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x42424242);
+
+        ret = parse_hex32("0x5555AAAA", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x5555AAAA );
+
+        ret = parse_hex32("5555AAAA", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x5555AAAA);
+    }
+
+    // Tests parse_hex32 -> Invalid case
+    TEST( parse_hex32, invalid_cases )
+    {
+        int ret;
+        uint32_t number = -1;
+
+        ret = parse_hex32(NULL, &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex32("42", NULL);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex32("0x100000000", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex32("100000000", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_hex32("Oxabcdef01", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex32("", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex32("helloworld", &number);
+        ASSERT_EQ( ret, -1 );
+    }
+
+        // Tests parse_uint64 -> Valid case
+    TEST( parse_uint64, valid_cases )
+    {
+        int ret;
+        uint64_t number = -1;
+
+        ret = parse_uint64("42", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 42);
+
+        ret = parse_uint64("0", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0);
+        
+        ret = parse_uint64("18446744073709551615", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, UINT64_C(18446744073709551615));
+    }
+
+    // Tests parse_uint64 -> Invalid case
+    TEST( parse_uint64, invalid_cases )
+    {
+        int ret;
+        uint64_t number = -1;
+
+        ret = parse_uint64(NULL, &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint64("42", NULL);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint64("-1", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_uint64("18446744073709551616", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_uint64("abcdef01abcdef01", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint64("", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_uint64("helloworld", &number);
+        ASSERT_EQ( ret, -1 );
+    }
+
+    // Tests parse_int64 -> Valid case
+    TEST( parse_int64, valid_cases )
+    {
+        int ret;
+        int64_t number = -1;
+
+        ret = parse_int64("12", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 12);
+
+        ret = parse_int64("0", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0);
+
+        ret = parse_int64("-1", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, -1);
+        
+        ret = parse_int64("-9223372036854775808", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, INT64_MIN);
+
+        ret = parse_int64("9223372036854775807", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 9223372036854775807);
+    }
+
+    // Tests parse_int64 -> Invalid case
+    TEST( parse_int64, invalid_cases )
+    {
+        int ret;
+        int64_t number = -1;
+
+        ret = parse_int64(NULL, &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int64("42", NULL);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int64("-9223372036854775809", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_int64("9223372036854775808", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_int64("abcdef01abcdef01", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int64("", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_int64("helloworld", &number);
+        ASSERT_EQ( ret, -1 );
+    }
+
+    // Tests parse_hex64 -> Valid case
+    TEST( parse_hex64, valid_cases )
+    {
+        int ret;
+        uint64_t number = -1;
+
+        ret = parse_hex64("0", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x00);
+
+        ret = parse_hex64("0x0000000000000000", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x0000);
+
+        ret = parse_hex64("0xFFFFFFFFFFFFFFFF", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0xFFFFFFFFFFFFFFFF);
+
+        ret = parse_hex64("0x4242424242424242", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x4242424242424242);
+
+        ret = parse_hex64("0x55555555AAAAAAAA", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x55555555AAAAAAAA );
+
+        ret = parse_hex64("55555555AAAAAAAA", &number);
+        ASSERT_EQ( ret, 0 );
+        ASSERT_EQ(number, 0x55555555AAAAAAAA);
+    }
+
+    // Tests parse_hex64 -> Invalid case
+    TEST( parse_hex64, invalid_cases )
+    {
+        int ret;
+        uint64_t number = -1;
+
+        ret = parse_hex64(NULL, &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex64("42", NULL);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex64("0x10000000000000000", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_hex64("10000000000000000", &number);
+        ASSERT_EQ( ret, -1 );
+        
+        ret = parse_hex64("Oxabcdef01abcdef01", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex64("", &number);
+        ASSERT_EQ( ret, -1 );
+
+        ret = parse_hex64("helloworld", &number);
+        ASSERT_EQ( ret, -1 );
+    }
+
+    // Tests parse_uint32_array -> Valid case
+    TEST( parse_uint32_array, valid_cases )
+    {
+        size_t ret;
+        size_t consumed;
+        uint32_t numbers[4];
+        const char buf[] = "12,0,4294967295,42";
+        const char trailing[] = "1\n2\n";
+        // Not NUL terminated: "7" must not be parsed with previous digit
+        const char unterminated[] = { '1', ',', '2', '7' };
+
+        ret = parse_uint32_array( buf, strlen( buf ), ',', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 4u );
+        ASSERT_EQ( consumed, strlen( buf ) );
+        ASSERT_EQ( numbers[0], 12u );
+        ASSERT_EQ( numbers[1], 0u );
+        ASSERT_EQ( numbers[2], 4294967295u );
+        ASSERT_EQ( numbers[3], 42u );
+
+        ret = parse_uint32_array( trailing, strlen( trailing ), '\n', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 2u );
+        ASSERT_EQ( consumed, strlen( trailing ) );
+        ASSERT_EQ( numbers[0], 1u );
+        ASSERT_EQ( numbers[1], 2u );
+
+        ret = parse_uint32_array( unterminated, 3, ',', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 2u );
+        ASSERT_EQ( consumed, 3u );
+        ASSERT_EQ( numbers[1], 2u );
+
+        ret = parse_uint32_array( buf, 0, ',', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 0u );
+        ASSERT_EQ( consumed, 0u );
+
+        // Output array full: parsing restarts after consumed bytes
+        ret = parse_uint32_array( buf, strlen( buf ), ',', numbers, 2, &consumed );
+        ASSERT_EQ( ret, 2u );
+        ASSERT_EQ( consumed, 5u );
+        ret = parse_uint32_array( &buf[consumed], strlen( buf ) - consumed, ',', numbers, 2, &consumed );
+        ASSERT_EQ( ret, 2u );
+        ASSERT_EQ( numbers[0], 4294967295u );
+        ASSERT_EQ( numbers[1], 42u );
+    }
+
+    // Tests parse_uint32_array -> Invalid case
+    TEST( parse_uint32_array, invalid_cases )
+    {
+        size_t ret;
+        size_t consumed;
+        uint32_t numbers[4];
+        const char overflow[] = "1,4294967296,3";
+        const char empty[] = "1,,3";
+        const char garbage[] = "1,2,3a";
+
+        ret = parse_uint32_array( overflow, strlen( overflow ), ',', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 1u );
+        ASSERT_EQ( consumed, 2u );
+        ASSERT_EQ( numbers[0], 1u );
+
+        ret = parse_uint32_array( empty, strlen( empty ), ',', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 1u );
+        ASSERT_EQ( consumed, 2u );
+
+        ret = parse_uint32_array( garbage, strlen( garbage ), ',', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 2u );
+        ASSERT_EQ( consumed, 4u );
+
+        ret = parse_uint32_array( NULL, 4, ',', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 0u );
+        ASSERT_EQ( consumed, 0u );
+
+        ret = parse_uint32_array( overflow, strlen( overflow ), ',', NULL, 4, &consumed );
+        ASSERT_EQ( ret, 0u );
+        ASSERT_EQ( consumed, 0u );
+
+        ret = parse_uint32_array( overflow, strlen( overflow ), ',', numbers, 4, NULL );
+        ASSERT_EQ( ret, 0u );
+    }
+
+    // Tests parse_int8_array -> Valid and invalid cases
+    TEST( parse_int8_array, valid_invalid_cases )
+    {
+        size_t ret;
+        size_t consumed;
+        int8_t numbers[4];
+        const char buf[] = "-128; 127;+0;-1";
+        const char invalid[] = "-128;-129";
+
+        ret = parse_int8_array( buf, strlen( buf ), ';', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 4u );
+        ASSERT_EQ( numbers[0], -128 );
+        ASSERT_EQ( numbers[1], 127 );
+        ASSERT_EQ( numbers[2], 0 );
+        ASSERT_EQ( numbers[3], -1 );
+
+        ret = parse_int8_array( invalid, strlen( invalid ), ';', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 1u );
+        ASSERT_EQ( consumed, 5u );
+    }
+
+    // Tests parse_int64_array -> Valid and invalid cases
+    TEST( parse_int64_array, valid_invalid_cases )
+    {
+        size_t ret;
+        size_t consumed;
+        int64_t numbers[4];
+        const char buf[] = "-9223372036854775808 9223372036854775807 0";
+        const char invalid[] = "-9223372036854775809";
+
+        ret = parse_int64_array( buf, strlen( buf ), ' ', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 3u );
+        ASSERT_EQ( numbers[0], INT64_MIN );
+        ASSERT_EQ( numbers[1], INT64_MAX );
+        ASSERT_EQ( numbers[2], 0 );
+
+        ret = parse_int64_array( invalid, strlen( invalid ), ' ', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 0u );
+        ASSERT_EQ( consumed, 0u );
+    }
+
+    // Tests parse_hex16_array -> Valid and invalid cases
+    TEST( parse_hex16_array, valid_invalid_cases )
+    {
+        size_t ret;
+        size_t consumed;
+        uint16_t numbers[4];
+        const char buf[] = "0xFFFF,a5,0X0,0";
+        const char invalid[] = "0x10000";
+        const char no_digit[] = "0x";
+
+        ret = parse_hex16_array( buf, strlen( buf ), ',', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 4u );
+        ASSERT_EQ( numbers[0], 0xFFFF );
+        ASSERT_EQ( numbers[1], 0xA5 );
+        ASSERT_EQ( numbers[2], 0 );
+        ASSERT_EQ( numbers[3], 0 );
+
+        ret = parse_hex16_array( invalid, strlen( invalid ), ',', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 0u );
+
+        ret = parse_hex16_array( no_digit, strlen( no_digit ), ',', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 0u );
+    }
+
+    // Tests parse_double_array and parse_float_array -> Valid and invalid cases
+    TEST( parse_double_array, valid_invalid_cases )
+    {
+        size_t ret;
+        size_t consumed;
+        double numbers[4];
+        float fnumbers[4];
+        const char buf[] = "1.5\n-0\n1e308\ninf\n";
+        const char invalid[] = "0.1,1e,3";
+
+        ret = parse_double_array( buf, strlen( buf ), '\n', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 4u );
+        ASSERT_EQ( consumed, strlen( buf ) );
+        ASSERT_EQ( numbers[0], 1.5 );
+        ASSERT_TRUE( std::signbit( numbers[1] ) );
+        ASSERT_EQ( numbers[2], 1e308 );
+        ASSERT_EQ( numbers[3], std::numeric_limits<double>::infinity() );
+
+        ret = parse_float_array( buf, strlen( buf ), '\n', fnumbers, 4, &consumed );
+        ASSERT_EQ( ret, 4u );
+        ASSERT_EQ( fnumbers[0], 1.5f );
+        ASSERT_EQ( fnumbers[2], std::numeric_limits<float>::infinity() );
+
+        ret = parse_double_array( invalid, strlen( invalid ), ',', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 1u );
+        ASSERT_EQ( consumed, 4u );
+        ASSERT_EQ( numbers[0], 0.1 );
+
+        ret = parse_float_array( invalid, strlen( invalid ), ',', fnumbers, 1, &consumed );
+        ASSERT_EQ( ret, 1u );
+        ASSERT_EQ( consumed, 4u );
+        ASSERT_EQ( fnumbers[0], 0.1f );
+
+        ret = parse_double_array( NULL, 4, ',', numbers, 4, &consumed );
+        ASSERT_EQ( ret, 0u );
+        ASSERT_EQ( consumed, 0u );
+    }
+
+    // Check array parser returns the same result as single value parser
+    template <typename T>
+    void check_array_same_as_single_value( const char * value,
+            int (*parse)( const char *, T * ),
+            size_t (*parse_array)( const char *, size_t, char, T *, size_t, size_t * ) )
+    {
+        T expected = 0;
+        T number = 0;
+        size_t consumed;
+        int ret;
+
+        ret = parse( value, &expected );
+        ASSERT_EQ( parse_array( value, strlen( value ), ',', &number, 1, &consumed ),
+                   ( 0 == ret ) ? 1u : 0u ) << value;
+        ASSERT_EQ( number, expected ) << value;
+    }
+
+    // Tests array parsers -> Same result as single value parsers
+    TEST( parse_array, same_as_single_value )
+    {
+        const char * values[] = { "0", "1", " 2", "+3", "-0", "-1", "255", "256",
+                                  "65535", "65536", "4294967295", "4294967296",
+                                  "18446744073709551615", "18446744073709551616",
+                                  "0x1F", "1F", "x", "", " ", "+", "-", "0x",
+                                  "007", "1 ", "-128", "-129", "-2147483648",
+                                  "-9223372036854775808", "9223372036854775808" };
+
+        for( const char * value : values )
+        {
+            check_array_same_as_single_value( value, parse_uint8, parse_uint8_array );
+            check_array_same_as_single_value( value, parse_int16, parse_int16_array );
+            check_array_same_as_single_value( value, parse_hex32, parse_hex32_array );
+            check_array_same_as_single_value( value, parse_uint64, parse_uint64_array );
+            check_array_same_as_single_value( value, parse_int64, parse_int64_array );
+        }
+    }
+
+    // Reference unsigned parser: behaviour of strtoull based implementation
+    template <typename T>
+    int reference_parse_unsigned( const char * str, int base, T * number )
+    {
+        const char * p = str;
+        char * end;
+        unsigned long long tmp;
+
+        if( ( ! str ) || ( 0 == str[0] ) )
+        {
+            return -1;
+        }
+
+        errno = 0;
+        tmp = strtoull( str, &end, base );
+        while( isspace( (unsigned char)*p ) )
+        {
+            p++;
+        }
+
+        if( ( *end ) || ( ERANGE == errno ) ||
+            ( tmp > std::numeric_limits<T>::max() ) ||
+            ( ( '-' == *p ) && ( 0 != tmp ) ) )
+        {
+            return -1;
+        }
+
+        *number = (T)tmp;
+        return 0;
+    }
+
+    // Reference signed parser: behaviour of strtoll based implementation
+    template <typename T>
+    int reference_parse_signed( const char * str, T * number )
+    {
+        char * end;
+        long long tmp;
+
+        if( ( ! str ) || ( 0 == str[0] ) )
+        {
+            return -1;
+        }
+
+        errno = 0;
+        tmp = strtoll( str, &end, 10 );
+
+        if( ( *end ) || ( ERANGE == errno ) ||
+            ( tmp > std::numeric_limits<T>::max() ) ||
+            ( tmp < std::numeric_limits<T>::min() ) )
+        {
+            return -1;
+        }
+
+        *number = (T)tmp;
+        return 0;
+    }
+
+    // Build a random string looking like a number
+    std::string random_number_string( std::mt19937_64 & gen )
+    {
+        static const char alphabet[] = " \t+-0123456789abcdefxX";
+        std::string str;
+        unsigned int len;
+
+        switch( gen() % 4 )
+        {
+            case 0:
+                // Random characters
+                len = gen() % 25;
+                for( unsigned int i = 0; i < len; i++ )
+                {
+                    str += alphabet[gen() % ( sizeof( alphabet ) - 1 )];
+                }
+            break;
+            case 1:
+                // Random digits
+                len = 1 + gen() % 24;
+                for( unsigned int i = 0; i < len; i++ )
+                {
+                    str += (char)( '0' + gen() % 10 );
+                }
+            break;
+            default:
+                // Random value with optional sign, spaces and leading zeros
+                if( 0 == gen() % 4 )
+                {
+                    str += ' ';
+                }
+                if( 0 == gen() % 3 )
+                {
+                    str += ( gen() & 1 ) ? '-' : '+';
+                }
+                str += std::string( gen() % 4, '0' );
+                str += std::to_string( gen() >> ( gen() % 64 ) );
+            break;
+        }
+
+        return str;
+    }
+
+    // Tests parsers -> Same result as strtoul/strtoll on random inputs for each
+    // instruction set
+    TEST( parse_number_isa, differential_cases )
+    {
+        const parse_number_isa_t isas[] = { PARSE_NUMBER_ISA_SCALAR,
+                                            PARSE_NUMBER_ISA_SSE42 };
+        parse_number_isa_t default_isa = parse_number_get_isa();
+        std::mt19937_64 gen( 42 );
+
+        for( parse_number_isa_t isa : isas )
+        {
+            if( 0 != parse_number_set_isa( isa ) )
+            {
+                continue;
+            }
+            ASSERT_EQ( parse_number_get_isa(), isa );
+
+            for( int i = 0; i < 200000; i++ )
+            {
+                std::string str = random_number_string( gen );
+                const char * value = str.c_str();
+                uint8_t u8[2] = { 0, 0 };
+                int8_t i8[2] = { 0, 0 };
+                uint16_t h16[2] = { 0, 0 };
+                uint32_t u32[2] = { 0, 0 };
+                int32_t i32[2] = { 0, 0 };
+                uint64_t u64[2] = { 0, 0 };
+                int64_t i64[2] = { 0, 0 };
+                uint64_t h64[2] = { 0, 0 };
+
+                ASSERT_EQ( parse_uint8( value, &u8[0] ), reference_parse_unsigned( value, 10, &u8[1] ) ) << value;
+                ASSERT_EQ( u8[0], u8[1] ) << value;
+                ASSERT_EQ( parse_int8( value, &i8[0] ), reference_parse_signed( value, &i8[1] ) ) << value;
+                ASSERT_EQ( i8[0], i8[1] ) << value;
+                ASSERT_EQ( parse_hex16( value, &h16[0] ), reference_parse_unsigned( value, 16, &h16[1] ) ) << value;
+                ASSERT_EQ( h16[0], h16[1] ) << value;
+                ASSERT_EQ( parse_uint32( value, &u32[0] ), reference_parse_unsigned( value, 10, &u32[1] ) ) << value;
+                ASSERT_EQ( u32[0], u32[1] ) << value;
+                ASSERT_EQ( parse_int32( value, &i32[0] ), reference_parse_signed( value, &i32[1] ) ) << value;
+                ASSERT_EQ( i32[0], i32[1] ) << value;
+                ASSERT_EQ( parse_uint64( value, &u64[0] ), reference_parse_unsigned( value, 10, &u64[1] ) ) << value;
+                ASSERT_EQ( u64[0], u64[1] ) << value;
+                ASSERT_EQ( parse_int64( value, &i64[0] ), reference_parse_signed( value, &i64[1] ) ) << value;
+                ASSERT_EQ( i64[0], i64[1] ) << value;
+                ASSERT_EQ( parse_hex64( value, &h64[0] ), reference_parse_unsigned( value, 16, &h64[1] ) ) << value;
+                ASSERT_EQ( h64[0], h64[1] ) << value;
+
+                check_array_same_as_single_value( value, parse_uint64, parse_uint64_array );
+            }
+        }
+
+        ASSERT_EQ( parse_number_set_isa( default_isa ), 0 );
+    }
+
+    // Tests parse_<type>_n -> Valid case
+    TEST( parse_number_n, valid_cases )
+    {
+        // Characters after length must be ignored
+        const char buf[] = "25599 -12899 0xFFFF1";
+        uint8_t u8;
+        int8_t i8;
+        uint16_t h16;
+        int16_t i16;
+        uint32_t u32;
+        int32_t i32;
+        uint64_t h64;
+        int64_t i64;
+        double d;
+
+        ASSERT_EQ( parse_uint8_n( buf, 3, &u8 ), 0 );
+        ASSERT_EQ( u8, 255 );
+        ASSERT_EQ( parse_int8_n( &buf[6], 4, &i8 ), 0 );
+        ASSERT_EQ( i8, -128 );
+        ASSERT_EQ( parse_hex8_n( &buf[13], 4, &u8 ), 0 );
+        ASSERT_EQ( u8, 0xFF );
+        ASSERT_EQ( parse_hex16_n( &buf[13], 6, &h16 ), 0 );
+        ASSERT_EQ( h16, 0xFFFF );
+        ASSERT_EQ( parse_uint16_n( buf, 5, &h16 ), 0 );
+        ASSERT_EQ( h16, 25599 );
+        ASSERT_EQ( parse_int16_n( &buf[5], 6, &i16 ), 0 );
+        ASSERT_EQ( i16, -1289 );
+        ASSERT_EQ( parse_uint32_n( buf, 1, &u32 ), 0 );
+        ASSERT_EQ( u32, 2u );
+        ASSERT_EQ( parse_int32_n( &buf[6], 6, &i32 ), 0 );
+        ASSERT_EQ( i32, -12899 );
+        ASSERT_EQ( parse_hex32_n( &buf[13], 7, &u32 ), 0 );
+        ASSERT_EQ( u32, 0xFFFF1u );
+        ASSERT_EQ( parse_uint64_n( buf, 2, &h64 ), 0 );
+        ASSERT_EQ( h64, 25u );
+        ASSERT_EQ( parse_int64_n( &buf[5], 4, &i64 ), 0 );
+        ASSERT_EQ( i64, -12 );
+        ASSERT_EQ( parse_hex64_n( &buf[13], 3, &h64 ), 0 );
+        ASSERT_EQ( h64, 0xFu );
+        ASSERT_EQ( parse_double_n( &buf[6], 3, &d ), 0 );
+        ASSERT_EQ( d, -12.0 );
+    }
+
+    // Tests parse_<type>_n -> Invalid case
+    TEST( parse_number_n, invalid_cases )
+    {
+        const char buf[] = "256 -129 0x";
+        uint8_t u8;
+        int8_t i8;
+        uint32_t u32;
+        double d;
+
+        ASSERT_EQ( parse_uint8_n( buf, 3, &u8 ), -1 );
+        ASSERT_EQ( parse_uint8_n( buf, 4, &u8 ), -1 );
+        ASSERT_EQ( parse_uint8_n( buf, 0, &u8 ), -1 );
+        ASSERT_EQ( parse_uint8_n( NULL, 3, &u8 ), -1 );
+        ASSERT_EQ( parse_uint8_n( buf, 3, NULL ), -1 );
+        ASSERT_EQ( parse_int8_n( &buf[4], 4, &i8 ), -1 );
+        ASSERT_EQ( parse_hex32_n( &buf[9], 2, &u32 ), -1 );
+        ASSERT_EQ( parse_uint32_n( "1\0", 2, &u32 ), -1 );
+        ASSERT_EQ( parse_double_n( buf, 0, &d ), -1 );
+        ASSERT_EQ( parse_double_n( "1\0", 2, &d ), -1 );
+        ASSERT_EQ( parse_double_n( NULL, 3, &d ), -1 );
+    }
+
+    // Tests parse_<type>_view -> Valid and invalid cases
+    TEST( parse_number_view, valid_invalid_cases )
+    {
+        lu_strview_t line = LU_STRVIEW_LITERAL( "255,-128,0xFF,65536,1.5e3" );
+        uint8_t u8;
+        int8_t i8;
+        uint16_t u16;
+        uint32_t u32;
+        uint64_t h64;
+        double d;
+        float f;
+
+        // Slices are parsed without reading after their end
+        ASSERT_EQ( parse_uint8_view( lu_strview_slice( line, 0, 3 ), &u8 ), 0 );
+        ASSERT_EQ( u8, 255 );
+        ASSERT_EQ( parse_int8_view( lu_strview_slice( line, 4, 4 ), &i8 ), 0 );
+        ASSERT_EQ( i8, -128 );
+        ASSERT_EQ( parse_hex8_view( lu_strview_slice( line, 9, 4 ), &u8 ), 0 );
+        ASSERT_EQ( u8, 0xFF );
+        ASSERT_EQ( parse_hex64_view( lu_strview_slice( line, 9, 4 ), &h64 ), 0 );
+        ASSERT_EQ( h64, 0xFFu );
+        ASSERT_EQ( parse_uint32_view( lu_strview_slice( line, 14, 5 ), &u32 ), 0 );
+        ASSERT_EQ( u32, 65536u );
+        ASSERT_EQ( parse_double_view( lu_strview_slice( line, 20, LU_STRVIEW_NPOS ), &d ), 0 );
+        ASSERT_EQ( d, 1500.0 );
+        ASSERT_EQ( parse_float_view( lu_strview_slice( line, 20, 3 ), &f ), 0 );
+        ASSERT_EQ( f, 1.5f );
+
+        ASSERT_EQ( parse_uint16_view( lu_strview_slice( line, 14, 5 ), &u16 ), -1 );
+        ASSERT_EQ( parse_uint8_view( lu_strview_slice( line, 0, 4 ), &u8 ), -1 );
+        ASSERT_EQ( parse_uint8_view( lu_strview( NULL, 0 ), &u8 ), -1 );
+        ASSERT_EQ( parse_uint8_view( lu_strview_slice( line, 0, 3 ), NULL ), -1 );
+    }
+
+    // Check bounded parser on each prefix of value returns the same result as
+    // NUL terminated parser (buffer is allocated without terminator)
+    template <typename T>
+    void check_n_same_as_string( const std::string & value,
+            int (*parse)( const char *, T * ),
+            int (*parse_n)( const char *, size_t, T * ) )
+    {
+        for( size_t len = 0; len <= value.size(); len++ )
+        {
+            std::string prefix = value.substr( 0, len );
+            std::unique_ptr<char[]> buf( new char[len + 1] );
+            T expected = 0;
+            T number = 0;
+
+            memcpy( buf.get(), prefix.data(), len );
+            ASSERT_EQ( parse_n( buf.get(), len, &number ),
+                       parse( prefix.c_str(), &expected ) ) << prefix;
+            ASSERT_EQ( number, expected ) << prefix;
+        }
+    }
+
+    // Tests parse_<type>_n -> Same result as NUL terminated parsers
+    TEST( parse_number_n, same_as_string )
+    {
+        std::mt19937_64 gen( 4242 );
+
+        for( int i = 0; i < 20000; i++ )
+        {
+            std::string value = random_number_string( gen );
+
+            check_n_same_as_string( value, parse_uint8, parse_uint8_n );
+            check_n_same_as_string( value, parse_int8, parse_int8_n );
+            check_n_same_as_string( value, parse_hex8, parse_hex8_n );
+            check_n_same_as_string( value, parse_uint16, parse_uint16_n );
+            check_n_same_as_string( value, parse_int16, parse_int16_n );
+            check_n_same_as_string( value, parse_hex16, parse_hex16_n );
+            check_n_same_as_string( value, parse_uint32, parse_uint32_n );
+            check_n_same_as_string( value, parse_int32, parse_int32_n );
+            check_n_same_as_string( value, parse_hex32, parse_hex32_n );
+            check_n_same_as_string( value, parse_uint64, parse_uint64_n );
+            check_n_same_as_string( value, parse_int64, parse_int64_n );
+            check_n_same_as_string( value, parse_hex64, parse_hex64_n );
+            check_n_same_as_string( value, parse_double, parse_double_n );
+            check_n_same_as_string( value, parse_float, parse_float_n );
+        }
+    }
+
+    // Tests parse_double -> Valid case
+    TEST( parse_double, valid_cases )
+    {
+        double number = -1;
+
+        ASSERT_EQ( parse_double( "12.5", &number ), 0 );
+        ASSERT_EQ( number, 12.5 );
+        ASSERT_EQ( parse_double( " -1e-3", &number ), 0 );
+        ASSERT_EQ( number, -0.001 );
+        ASSERT_EQ( parse_double( ".5", &number ), 0 );
+        ASSERT_EQ( number, 0.5 );
+        ASSERT_EQ( parse_double( "1.", &number ), 0 );
+        ASSERT_EQ( number, 1.0 );
+        ASSERT_EQ( parse_double( "-0", &number ), 0 );
+        ASSERT_TRUE( std::signbit( number ) );
+        ASSERT_EQ( parse_double( "1.7976931348623157e308", &number ), 0 );
+        ASSERT_EQ( number, std::numeric_limits<double>::max() );
+        ASSERT_EQ( parse_double( "4.9406564584124654e-324", &number ), 0 );
+        ASSERT_EQ( number, std::numeric_limits<double>::denorm_min() );
+        ASSERT_EQ( parse_double( "1e400", &number ), 0 );
+        ASSERT_EQ( number, std::numeric_limits<double>::infinity() );
+        ASSERT_EQ( parse_double( "1e-400", &number ), 0 );
+        ASSERT_EQ( number, 0.0 );
+        ASSERT_EQ( parse_double( "-Infinity", &number ), 0 );
+        ASSERT_EQ( number, -std::numeric_limits<double>::infinity() );
+        ASSERT_EQ( parse_double( "nan(0x1)", &number ), 0 );
+        ASSERT_TRUE( std::isnan( number ) );
+        ASSERT_EQ( parse_double( "0x1.8p1", &number ), 0 );
+        ASSERT_EQ( number, 3.0 );
+        // Exactly halfway between 1 and next double: round to even
+        ASSERT_EQ( parse_double( "1.00000000000000011102230246251565404236316680908203125", &number ), 0 );
+        ASSERT_EQ( number, 1.0 );
+        ASSERT_EQ( parse_double( "1.00000000000000011102230246251565404236316680908203125001", &number ), 0 );
+        ASSERT_EQ( number, std::nextafter( 1.0, 2.0 ) );
+    }
+
+    // Tests parse_double -> Invalid case
+    TEST( parse_double, invalid_cases )
+    {
+        double number = -1;
+
+        ASSERT_EQ( parse_double( "", &number ), -1 );
+        ASSERT_EQ( parse_double( ".", &number ), -1 );
+        ASSERT_EQ( parse_double( "1e", &number ), -1 );
+        ASSERT_EQ( parse_double( "1e+", &number ), -1 );
+        ASSERT_EQ( parse_double( "12 ", &number ), -1 );
+        ASSERT_EQ( parse_double( "+-1", &number ), -1 );
+        ASSERT_EQ( parse_double( "0x", &number ), -1 );
+        ASSERT_EQ( parse_double( "0x.p1", &number ), -1 );
+        ASSERT_EQ( parse_double( "infinit", &number ), -1 );
+        ASSERT_EQ( parse_double( "nan(", &number ), -1 );
+        ASSERT_EQ( parse_double( NULL, &number ), -1 );
+        ASSERT_EQ( parse_double( "1", NULL ), -1 );
+        ASSERT_EQ( number, -1 );
+    }
+
+    // Tests parse_float -> Valid case
+    TEST( parse_float, valid_cases )
+    {
+        float number = -1;
+
+        ASSERT_EQ( parse_float( "12.5", &number ), 0 );
+        ASSERT_EQ( number, 12.5f );
+        ASSERT_EQ( parse_float( "3.40282347e38", &number ), 0 );
+        ASSERT_EQ( number, std::numeric_limits<float>::max() );
+        ASSERT_EQ( parse_float( "3.5e38", &number ), 0 );
+        ASSERT_EQ( number, std::numeric_limits<float>::infinity() );
+        ASSERT_EQ( parse_float( "1.40129846e-45", &number ), 0 );
+        ASSERT_EQ( number, std::numeric_limits<float>::denorm_min() );
+        ASSERT_EQ( parse_float( "0x1.000001p0", &number ), 0 );
+        ASSERT_EQ( number, 1.0f );
+        ASSERT_EQ( parse_float( "-inf", &number ), 0 );
+        ASSERT_EQ( number, -std::numeric_limits<float>::infinity() );
+    }
+
+    // Tests parse_float -> Invalid case
+    TEST( parse_float, invalid_cases )
+    {
+        float number = -1;
+
+        ASSERT_EQ( parse_float( "", &number ), -1 );
+        ASSERT_EQ( parse_float( "1.5f", &number ), -1 );
+        ASSERT_EQ( parse_float( "e5", &number ), -1 );
+        ASSERT_EQ( parse_float_n( "1\0", 2, &number ), -1 );
+        ASSERT_EQ( number, -1 );
+    }
+
+    // Check parse_double and parse_float give the same result (bit exact) as
+    // strtod and strtof on whole string
+    void check_same_as_strtod( const char * str )
+    {
+        char * end;
+        double expected = strtod( str, &end );
+        float expected_float = strtof( str, &end );
+        bool valid = ( end != str ) && ( '\0' == *end );
+        double number;
+        float number_float;
+
+        ASSERT_EQ( parse_double( str, &number ), valid ? 0 : -1 ) << str;
+        ASSERT_EQ( parse_float( str, &number_float ), valid ? 0 : -1 ) << str;
+        if ( valid && ! std::isnan( expected ) )
+        {
+            ASSERT_EQ( memcmp( &number, &expected, sizeof( number ) ), 0 ) << str;
+            ASSERT_EQ( memcmp( &number_float, &expected_float,
+                               sizeof( number_float ) ), 0 ) << str;
+        }
+    }
+
+    // Tests parse_double -> Same result as strtod on every mantissa and power
+    // of ten of a grid covering the whole range (subnormals, overflow)
+    TEST( parse_double, differential_grid )
+    {
+        char str[64];
+
+        for( int mantissa = 1; mantissa < 1000; mantissa += 7 )
+        {
+            for( int exponent = -330; exponent <= 310; exponent++ )
+            {
+                snprintf( str, sizeof( str ), "%de%d", mantissa, exponent );
+                check_same_as_strtod( str );
+            }
+        }
+    }
+
+    // Tests parse_double -> Same result as strtod on random inputs
+    TEST( parse_double, differential_random )
+    {
+        std::mt19937_64 gen( 4242 );
+        char str[1024];
+
+        for( int i = 0; i < 100000; i++ )
+        {
+            uint64_t bits = gen();
+            uint32_t bits_float = (uint32_t)bits;
+            double value;
+            float value_float;
+
+            memcpy( &value, &bits, sizeof( value ) );
+            memcpy( &value_float, &bits_float, sizeof( value_float ) );
+
+            // Shortest and non shortest representations of random doubles
+            snprintf( str, sizeof( str ), "%.17g", value );
+            check_same_as_strtod( str );
+            snprintf( str, sizeof( str ), "%.15g", value );
+            check_same_as_strtod( str );
+            snprintf( str, sizeof( str ), "%a", value );
+            check_same_as_strtod( str );
+            snprintf( str, sizeof( str ), "%.9g", value_float );
+            check_same_as_strtod( str );
+
+            // Exact halfway point between two doubles (needs exact conversion)
+            if ( std::isfinite( value ) && ( value > 0 ) &&
+                 ( value < std::numeric_limits<double>::max() ) )
+            {
+                long double halfway = ( (long double)value +
+                    std::nextafter( value, std::numeric_limits<double>::infinity() ) ) / 2;
+
+                snprintf( str, sizeof( str ), "%.800Le", halfway );
+                check_same_as_strtod( str );
+            }
+
+            // Random digits, dot and exponent
+            std::string digits;
+            int nb_digits = 1 + gen() % 30;
+            for( int j = 0; j < nb_digits; j++ )
+            {
+                digits += (char)( '0' + gen() % 10 );
+            }
+            if ( gen() % 2 )
+            {
+                digits.insert( gen() % ( digits.size() + 1 ), "." );
+            }
+            if ( gen() % 2 )
+            {
+                digits += "e" + std::to_string( (int)( gen() % 700 ) - 350 );
+            }
+            check_same_as_strtod( digits.c_str() );
+        }
+    }
+
+    // Tests parse_double -> Same accepted syntax as strtod
+    TEST( parse_double, differential_syntax )
+    {
+        const char alphabet[] = "0123456789.eExXpP+- aAfFiInNtTyY()_";
+        std::mt19937_64 gen( 4242 );
+        char str[16];
+
+        for( int i = 0; i < 200000; i++ )
+        {
+            size_t len = 1 + gen() % ( sizeof( str ) - 1 );
+
+            for( size_t j = 0; j < len; j++ )
+            {
+                str[j] = alphabet[gen() % ( sizeof( alphabet ) - 1 )];
+            }
+            str[len] = '\0';
+            check_same_as_strtod( str );
+        }
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
 }
\ No newline at end of file
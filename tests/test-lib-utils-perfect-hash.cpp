@@ -0,0 +1,192 @@
+/*!
+ * @file: test-lib-utils-perfect-hash.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for perfect hash functions.
+ */
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+extern "C"
+{
+    #include "lib-utils-perfect-hash.h"
+}
+
+namespace
+{
+    // Record with a key which is not the first field
+    struct record_t
+    {
+        int             value;
+        const char *    name;
+    };
+
+    // Tests perfect_hash_create, perfect_hash_lookup -> Array of strings
+    TEST( perfect_hash, strings )
+    {
+        const char * keys[] = { "help", "version", "verbose", "output", "o", "" };
+        const size_t nb_keys = sizeof( keys ) / sizeof( keys[0] );
+        perfect_hash_t * hash = perfect_hash_create( keys, nb_keys, sizeof( keys[0] ) );
+
+        ASSERT_NE( hash, nullptr );
+        ASSERT_EQ( perfect_hash_get_count( hash ), nb_keys );
+        for( size_t i = 0; i < nb_keys; i++ )
+        {
+            ASSERT_EQ( perfect_hash_lookup( hash, keys[i] ), i );
+        }
+
+        ASSERT_EQ( perfect_hash_lookup( hash, "hel" ), PERFECT_HASH_NOT_FOUND );
+        ASSERT_EQ( perfect_hash_lookup( hash, "helpp" ), PERFECT_HASH_NOT_FOUND );
+        ASSERT_EQ( perfect_hash_lookup( hash, "HELP" ), PERFECT_HASH_NOT_FOUND );
+        ASSERT_EQ( perfect_hash_lookup( hash, "versio" ), PERFECT_HASH_NOT_FOUND );
+
+        // Key is not NUL terminated
+        ASSERT_EQ( perfect_hash_lookup_n( hash, "output=file", 6 ), 3u );
+        ASSERT_EQ( perfect_hash_lookup_n( hash, "o=file", 1 ), 4u );
+        ASSERT_EQ( perfect_hash_lookup_n( hash, "x", 0 ), 5u );
+
+        perfect_hash_destroy( hash );
+    }
+
+    // Tests perfect_hash_create -> Records with stride and NULL keys
+    TEST( perfect_hash, records )
+    {
+        const record_t records[] =
+        {
+            { 1, "alpha" },
+            { 2, NULL },
+            { 3, "beta" },
+            { 4, "gamma" },
+            { 5, NULL },
+        };
+        perfect_hash_t * hash = perfect_hash_create( &records[0].name, 5, sizeof( records[0] ) );
+
+        ASSERT_NE( hash, nullptr );
+        ASSERT_EQ( perfect_hash_get_count( hash ), 3u );
+        ASSERT_EQ( perfect_hash_lookup( hash, "alpha" ), 0u );
+        ASSERT_EQ( perfect_hash_lookup( hash, "beta" ), 2u );
+        ASSERT_EQ( perfect_hash_lookup( hash, "gamma" ), 3u );
+        ASSERT_EQ( perfect_hash_lookup( hash, "delta" ), PERFECT_HASH_NOT_FOUND );
+        ASSERT_EQ( perfect_hash_lookup( hash, "" ), PERFECT_HASH_NOT_FOUND );
+        perfect_hash_destroy( hash );
+
+        // Empty set
+        hash = perfect_hash_create( &records[1].name, 1, sizeof( records[0] ) );
+        ASSERT_NE( hash, nullptr );
+        ASSERT_EQ( perfect_hash_get_count( hash ), 0u );
+        ASSERT_EQ( perfect_hash_lookup( hash, "" ), PERFECT_HASH_NOT_FOUND );
+        ASSERT_EQ( perfect_hash_lookup( hash, "alpha" ), PERFECT_HASH_NOT_FOUND );
+        perfect_hash_destroy( hash );
+    }
+
+    // Tests perfect_hash_create -> Large sets of similar keys
+    TEST( perfect_hash, large )
+    {
+        for( size_t nb_keys : { 1, 2, 3, 10, 100, 1000, 20000 } )
+        {
+            std::vector<std::string> names( nb_keys );
+            std::vector<const char *> keys( nb_keys );
+            perfect_hash_t * hash;
+
+            for( size_t i = 0; i < nb_keys; i++ )
+            {
+                names[i] = "option-" + std::to_string( i );
+                keys[i] = names[i].c_str();
+            }
+
+            hash = perfect_hash_create( keys.data(), nb_keys, sizeof( keys[0] ) );
+            ASSERT_NE( hash, nullptr ) << nb_keys;
+            for( size_t i = 0; i < nb_keys; i++ )
+            {
+                ASSERT_EQ( perfect_hash_lookup( hash, keys[i] ), i );
+                ASSERT_EQ( perfect_hash_lookup( hash, ( names[i] + "x" ).c_str() ), PERFECT_HASH_NOT_FOUND );
+            }
+            ASSERT_EQ( perfect_hash_lookup( hash, "option-" ), PERFECT_HASH_NOT_FOUND );
+            perfect_hash_destroy( hash );
+        }
+    }
+
+    // Tests perfect_hash_create -> Random sets of option like names (dense
+    // tables of a few keys)
+    TEST( perfect_hash, random_sets )
+    {
+        const char * words[] = { "seed", "host", "min", "max", "retry", "threads",
+                                 "name", "color", "size", "output", "input", "mode" };
+        const char * failing[] = { "seed-host", "min", "min-retry", "threads-name",
+                                   "seed", "name-seed", "color" };
+        std::mt19937 rng( 42 );
+        perfect_hash_t * hash;
+
+        hash = perfect_hash_create( failing, 7, sizeof( failing[0] ) );
+        ASSERT_NE( hash, nullptr );
+        for( size_t i = 0; i < 7; i++ )
+        {
+            ASSERT_EQ( perfect_hash_lookup( hash, failing[i] ), i );
+        }
+        perfect_hash_destroy( hash );
+
+        for( size_t nb_keys = 1; nb_keys <= 64; nb_keys++ )
+        {
+            for( size_t run = 0; run < 200; run++ )
+            {
+                std::set<std::string> names;
+                std::vector<const char *> keys;
+
+                while( names.size() < nb_keys )
+                {
+                    std::string name = words[rng() % 12];
+
+                    for( size_t parts = rng() % 3; parts > 0; parts-- )
+                    {
+                        name += std::string( "-" ) + words[rng() % 12];
+                    }
+                    names.insert( name );
+                }
+                for( const std::string & name : names )
+                {
+                    keys.push_back( name.c_str() );
+                }
+
+                hash = perfect_hash_create( keys.data(), nb_keys, sizeof( keys[0] ) );
+                ASSERT_NE( hash, nullptr ) << nb_keys << " keys, run " << run;
+                for( size_t i = 0; i < nb_keys; i++ )
+                {
+                    ASSERT_EQ( perfect_hash_lookup( hash, keys[i] ), i );
+                }
+                perfect_hash_destroy( hash );
+            }
+        }
+    }
+
+    // Tests perfect_hash functions -> Invalid cases
+    TEST( perfect_hash, invalid_cases )
+    {
+        const char * keys[] = { "a", "b", "c", "b" };
+        perfect_hash_t * hash;
+
+        // Duplicated keys
+        ASSERT_EQ( perfect_hash_create( keys, 4, sizeof( keys[0] ) ), nullptr );
+
+        ASSERT_EQ( perfect_hash_create( NULL, 4, sizeof( keys[0] ) ), nullptr );
+        ASSERT_EQ( perfect_hash_create( keys, 3, 1 ), nullptr );
+
+        hash = perfect_hash_create( keys, 3, sizeof( keys[0] ) );
+        ASSERT_NE( hash, nullptr );
+        ASSERT_EQ( perfect_hash_lookup( hash, NULL ), PERFECT_HASH_NOT_FOUND );
+        ASSERT_EQ( perfect_hash_lookup_n( hash, NULL, 1 ), PERFECT_HASH_NOT_FOUND );
+        ASSERT_EQ( perfect_hash_lookup( NULL, "a" ), PERFECT_HASH_NOT_FOUND );
+        ASSERT_EQ( perfect_hash_get_count( NULL ), 0u );
+        perfect_hash_destroy( hash );
+        perfect_hash_destroy( NULL );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
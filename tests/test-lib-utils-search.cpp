@@ -0,0 +1,288 @@
+/*!
+ * @file: test-lib-utils-search.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for search functions (fuzzed against
+ *         libc with every instruction set supported by CPU).
+ */
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C"
+{
+    #include "lib-utils-search.h"
+}
+
+namespace
+{
+    const search_isa_t ISAS[] = { SEARCH_ISA_SCALAR, SEARCH_ISA_SSSE3, SEARCH_ISA_AVX2 };
+
+    // Copy string at the end of an exact size allocation so any read after
+    // the end is reported by address sanitizer
+    class exact_buffer
+    {
+    public:
+        explicit exact_buffer( const std::string & str )
+            : m_data( new char[str.size() + 1] ), m_len( str.size() )
+        {
+            memcpy( m_data, str.data(), m_len );
+        }
+
+        ~exact_buffer()
+        {
+            delete[] m_data;
+        }
+
+        const char * data() const { return m_data; }
+        size_t size() const { return m_len; }
+
+    private:
+        char *  m_data;
+        size_t  m_len;
+    };
+
+    // Random string of len bytes taken in alphabet
+    std::string random_string( std::mt19937 & gen, size_t len, const std::string & alphabet )
+    {
+        std::string str( len, '\0' );
+
+        for( char & c : str )
+        {
+            c = alphabet[gen() % alphabet.size()];
+        }
+
+        return str;
+    }
+
+    // Reference search of first byte equal to one of chars
+    const char * ref_any_of( const char * buf, size_t len, const std::string & chars, bool negate )
+    {
+        for( size_t i = 0; i < len; i++ )
+        {
+            if( ( chars.find( buf[i] ) != std::string::npos ) != negate )
+            {
+                return buf + i;
+            }
+        }
+
+        return NULL;
+    }
+
+    // Tests search_set_isa -> Valid case
+    TEST( search, isa )
+    {
+        search_isa_t isa = search_get_isa();
+
+        ASSERT_EQ( search_set_isa( SEARCH_ISA_SCALAR ), 0 );
+        ASSERT_EQ( search_get_isa(), SEARCH_ISA_SCALAR );
+        ASSERT_EQ( search_set_isa( (search_isa_t)42 ), -1 );
+        ASSERT_EQ( search_get_isa(), SEARCH_ISA_SCALAR );
+        ASSERT_EQ( search_set_isa( isa ), 0 );
+    }
+
+    // Tests search_byte, search_byte2, search_byte3 -> Same result as memchr
+    TEST( search, bytes_fuzz )
+    {
+        search_isa_t default_isa = search_get_isa();
+        std::mt19937 gen( 42 );
+
+        for( search_isa_t isa : ISAS )
+        {
+            if( 0 != search_set_isa( isa ) )
+            {
+                continue;
+            }
+
+            for( size_t iter = 0; iter < 3000; iter++ )
+            {
+                size_t len = ( iter < 300 ) ? iter : gen() % 4096;
+                std::string alphabet = ( iter % 2 ) ? "abcdefghijklmnopqrstuvwxyz" :
+                                                      std::string( "ab\0\xff", 4 );
+                exact_buffer buf( random_string( gen, len, alphabet + std::string( len / 16 + 1, 'z' ) ) );
+                char c1 = ( iter % 3 ) ? alphabet[gen() % alphabet.size()] : '#';
+                char c2 = ( iter % 5 ) ? alphabet[gen() % alphabet.size()] : '$';
+                char c3 = ( iter % 7 ) ? alphabet[gen() % alphabet.size()] : '%';
+                const char * r1 = (const char *)memchr( buf.data(), c1, len );
+                const char * r2 = (const char *)memchr( buf.data(), c2, len );
+                const char * r3 = (const char *)memchr( buf.data(), c3, len );
+                const char * r12 = ( r1 && ( ! r2 || r1 < r2 ) ) ? r1 : r2;
+                const char * r123 = ( r12 && ( ! r3 || r12 < r3 ) ) ? r12 : r3;
+
+                ASSERT_EQ( search_byte( buf.data(), len, c1 ), r1 ) << isa;
+                ASSERT_EQ( search_byte2( buf.data(), len, c1, c2 ), r12 ) << isa;
+                ASSERT_EQ( search_byte3( buf.data(), len, c1, c2, c3 ), r123 ) << isa;
+            }
+        }
+        ASSERT_EQ( search_set_isa( default_isa ), 0 );
+    }
+
+    // Tests search_any_of, search_none_of -> Same result as strpbrk, strspn
+    TEST( search, set_fuzz )
+    {
+        search_isa_t default_isa = search_get_isa();
+        std::mt19937 gen( 43 );
+        search_set_t set;
+
+        for( search_isa_t isa : ISAS )
+        {
+            if( 0 != search_set_isa( isa ) )
+            {
+                continue;
+            }
+
+            for( size_t iter = 0; iter < 3000; iter++ )
+            {
+                size_t len = ( iter < 300 ) ? iter : gen() % 4096;
+                std::string chars = random_string( gen, 1 + gen() % 12, "abcdefgh\t \n,;\x80\xfe" );
+                exact_buffer buf( random_string( gen, len, "abcdefghijklmnopqrstuvwxyz \x80\xff" ) );
+
+                ASSERT_EQ( search_set_init( &set, chars.data(), chars.size() ), 0 );
+                ASSERT_EQ( search_any_of( buf.data(), len, &set ),
+                           ref_any_of( buf.data(), len, chars, false ) ) << isa;
+                ASSERT_EQ( search_none_of( buf.data(), len, &set ),
+                           ref_any_of( buf.data(), len, chars, true ) ) << isa;
+            }
+
+            // All 256 bytes, one at a time and with libc
+            std::string all( 256, '\0' );
+            for( int c = 0; c < 256; c++ )
+            {
+                all[c] = (char)c;
+            }
+            exact_buffer buf( all + all );
+            for( int c = 1; c < 255; c++ )
+            {
+                char chars[3] = { (char)c, (char)( 255 - c ), '\0' };
+
+                ASSERT_EQ( search_set_init( &set, chars, 2 ), 0 );
+                ASSERT_EQ( search_any_of( buf.data() + 1, buf.size() - 1, &set ),
+                           strpbrk( buf.data() + 1, chars ) ) << isa;
+                ASSERT_EQ( search_none_of( buf.data() + c, buf.size() - c, &set ),
+                           buf.data() + c + strspn( buf.data() + c, chars ) ) << isa;
+            }
+        }
+        ASSERT_EQ( search_set_isa( default_isa ), 0 );
+    }
+
+    // Tests search_set_add_range -> Valid case
+    TEST( search, set_range )
+    {
+        search_set_t set;
+        const char * str = "  x=0x1F;";
+
+        ASSERT_EQ( search_set_init( &set, NULL, 0 ), 0 );
+        ASSERT_EQ( search_set_add_range( &set, '0', '9' ), 0 );
+        ASSERT_EQ( search_set_add_range( &set, 'A', 'F' ), 0 );
+        ASSERT_EQ( search_set_add_range( &set, (char)0x80, (char)0xFF ), 0 );
+        ASSERT_TRUE( search_set_contains( &set, '5' ) );
+        ASSERT_TRUE( search_set_contains( &set, (char)0xC3 ) );
+        ASSERT_FALSE( search_set_contains( &set, 'a' ) );
+        ASSERT_FALSE( search_set_contains( &set, '\0' ) );
+        ASSERT_EQ( search_any_of( str, strlen( str ), &set ), str + 4 );
+        ASSERT_EQ( search_none_of( str + 6, strlen( str ) - 6, &set ), str + 8 );
+    }
+
+    // Tests search_substring -> Same result as memmem
+    TEST( search, substring_fuzz )
+    {
+        search_isa_t default_isa = search_get_isa();
+        std::mt19937 gen( 44 );
+
+        for( search_isa_t isa : ISAS )
+        {
+            if( 0 != search_set_isa( isa ) )
+            {
+                continue;
+            }
+
+            for( size_t iter = 0; iter < 20000; iter++ )
+            {
+                const char * alphabet = ( iter % 3 ) ? "ab" : "abcdefghij";
+                size_t len = gen() % ( ( iter % 10 ) ? 100 : 5000 );
+                std::string hay = random_string( gen, len, alphabet );
+                size_t needle_len = gen() % 12;
+                std::string needle;
+
+                // Half of needles are taken in haystack
+                if( ( iter % 2 ) && ( needle_len <= len ) )
+                {
+                    needle = hay.substr( gen() % ( len - needle_len + 1 ), needle_len );
+                }
+                else
+                {
+                    needle = random_string( gen, needle_len, alphabet );
+                }
+
+                exact_buffer buf( hay );
+                exact_buffer sub( needle );
+                ASSERT_EQ( search_substring( buf.data(), len, sub.data(), needle_len ),
+                           memmem( buf.data(), len, sub.data(), needle_len ) )
+                        << isa << " " << hay << " " << needle;
+            }
+
+            // Periodic text: candidates filter fails, Two-Way takes over
+            for( size_t n : { 2, 3, 16, 31, 33, 100, 1000, 5000 } )
+            {
+                std::string hay = std::string( 100000, 'a' );
+                std::string needle = std::string( n - 1, 'a' ) + "b";
+
+                exact_buffer buf( hay );
+                ASSERT_EQ( search_substring( buf.data(), hay.size(), needle.data(), n ), nullptr );
+                hay[70000] = 'b';
+                exact_buffer buf2( hay );
+                ASSERT_EQ( search_substring( buf2.data(), hay.size(), needle.data(), n ),
+                           buf2.data() + 70000 - ( n - 1 ) ) << isa << " " << n;
+                needle = "b" + std::string( n - 1, 'a' );
+                ASSERT_EQ( search_substring( buf2.data(), hay.size(), needle.data(), n ),
+                           buf2.data() + 70000 ) << isa << " " << n;
+
+                // First and last bytes match everywhere
+                needle = std::string( n / 2, 'a' ) + "b" + std::string( n / 2, 'a' );
+                ASSERT_EQ( search_substring( buf2.data(), hay.size(), needle.data(), needle.size() ),
+                           memmem( buf2.data(), hay.size(), needle.data(), needle.size() ) )
+                        << isa << " " << n;
+                needle[n / 2] = 'c';
+                ASSERT_EQ( search_substring( buf2.data(), hay.size(), needle.data(), needle.size() ),
+                           nullptr ) << isa << " " << n;
+            }
+        }
+        ASSERT_EQ( search_set_isa( default_isa ), 0 );
+    }
+
+    // Tests search functions -> Invalid case
+    TEST( search, invalid_cases )
+    {
+        search_set_t set;
+        const char * str = "abc";
+
+        ASSERT_EQ( search_byte( NULL, 3, 'a' ), nullptr );
+        ASSERT_EQ( search_byte2( NULL, 3, 'a', 'b' ), nullptr );
+        ASSERT_EQ( search_byte3( NULL, 3, 'a', 'b', 'c' ), nullptr );
+        ASSERT_EQ( search_set_init( NULL, "a", 1 ), -1 );
+        ASSERT_EQ( search_set_init( &set, NULL, 1 ), -1 );
+        ASSERT_EQ( search_set_add_range( NULL, 'a', 'z' ), -1 );
+        ASSERT_EQ( search_set_add_range( &set, 'z', 'a' ), -1 );
+        ASSERT_EQ( search_any_of( NULL, 3, &set ), nullptr );
+        ASSERT_EQ( search_any_of( str, 3, NULL ), nullptr );
+        ASSERT_EQ( search_none_of( NULL, 3, &set ), nullptr );
+        ASSERT_EQ( search_substring( NULL, 3, "a", 1 ), nullptr );
+        ASSERT_EQ( search_substring( str, 3, NULL, 1 ), nullptr );
+
+        // Not found and empty cases
+        ASSERT_EQ( search_byte( str, 0, 'a' ), nullptr );
+        ASSERT_EQ( search_byte( str, 3, 'd' ), nullptr );
+        ASSERT_EQ( search_substring( str, 3, "abcd", 4 ), nullptr );
+        ASSERT_EQ( search_substring( str, 3, "", 0 ), str );
+        ASSERT_EQ( search_substring( str, 0, "", 0 ), str );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
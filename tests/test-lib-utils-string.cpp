@@ -0,0 +1,534 @@
+/*!
+ * @file: test-lib-utils-string.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for string functions.
+ */
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C"
+{
+    #include "lib-utils-string.h"
+}
+
+namespace
+{
+    // Tests allocate_and_copy_string -> Valid and invalid cases
+    TEST( allocate_and_copy_string, valid_invalid_cases )
+    {
+        char * str;
+
+        str = allocate_and_copy_string( "hello" );
+        ASSERT_STREQ( str, "hello" );
+        free( str );
+
+        ASSERT_EQ( allocate_and_copy_string( "" ), nullptr );
+        ASSERT_EQ( allocate_and_copy_string( NULL ), nullptr );
+    }
+
+    // Tests allocate_and_concat_string -> Valid and invalid cases
+    TEST( allocate_and_concat_string, valid_invalid_cases )
+    {
+        char * str;
+
+        str = allocate_and_concat_string( "hello ", "world" );
+        ASSERT_STREQ( str, "hello world" );
+        free( str );
+
+        ASSERT_EQ( allocate_and_concat_string( "", "a" ), nullptr );
+        ASSERT_EQ( allocate_and_concat_string( NULL, "a" ), nullptr );
+        ASSERT_EQ( allocate_and_concat_string( "a", NULL ), nullptr );
+    }
+
+    // Tests allocate_and_concat_strings -> Valid and invalid cases
+    TEST( allocate_and_concat_strings, valid_invalid_cases )
+    {
+        char * str;
+
+        str = allocate_and_concat_strings( 3, "hello", " ", "world" );
+        ASSERT_STREQ( str, "hello world" );
+        free( str );
+
+        // Empty parts are allowed
+        str = allocate_and_concat_strings( 4, "", "a", "", "b" );
+        ASSERT_STREQ( str, "ab" );
+        free( str );
+
+        str = allocate_and_concat_strings( 1, "" );
+        ASSERT_STREQ( str, "" );
+        free( str );
+
+        // More parts than pointers kept on stack
+        str = allocate_and_concat_strings( 34, "0", "1", "2", "3", "4", "5", "6",
+                                           "7", "8", "9", "0", "1", "2", "3", "4",
+                                           "5", "6", "7", "8", "9", "0", "1", "2",
+                                           "3", "4", "5", "6", "7", "8", "9", "0",
+                                           "1", "2", "3" );
+        ASSERT_STREQ( str, "0123456789012345678901234567890123" );
+        free( str );
+
+        ASSERT_EQ( allocate_and_concat_strings( 0 ), nullptr );
+        ASSERT_EQ( allocate_and_concat_strings( 2, "a", NULL ), nullptr );
+    }
+
+    // Tests allocate_and_concat_string_array -> Valid and invalid cases
+    TEST( allocate_and_concat_string_array, valid_invalid_cases )
+    {
+        std::vector<std::string> values;
+        std::vector<const char *> parts;
+        std::string expected;
+        char * str;
+
+        // More parts than lengths kept on stack
+        for( int i = 0; i < 1000; i++ )
+        {
+            values.push_back( std::to_string( i ) + "," );
+        }
+        for( const std::string & value : values )
+        {
+            parts.push_back( value.c_str() );
+            expected += value;
+        }
+
+        str = allocate_and_concat_string_array( parts.data(), parts.size() );
+        ASSERT_EQ( str, expected );
+        free( str );
+
+        str = allocate_and_concat_string_array( parts.data(), 1 );
+        ASSERT_STREQ( str, "0," );
+        free( str );
+
+        ASSERT_EQ( allocate_and_concat_string_array( parts.data(), 0 ), nullptr );
+        ASSERT_EQ( allocate_and_concat_string_array( NULL, 1 ), nullptr );
+        parts[500] = NULL;
+        ASSERT_EQ( allocate_and_concat_string_array( parts.data(), parts.size() ), nullptr );
+    }
+
+    // Tests allocate_and_copy_string_arena -> Valid and invalid cases
+    TEST( allocate_and_copy_string_arena, valid_invalid_cases )
+    {
+        arena_t * arena = arena_create( 16 );
+        char * strs[100];
+
+        ASSERT_NE( arena, nullptr );
+
+        for( int i = 0; i < 100; i++ )
+        {
+            strs[i] = allocate_and_copy_string_arena( arena, std::to_string( i ).c_str() );
+            ASSERT_NE( strs[i], nullptr );
+        }
+        for( int i = 0; i < 100; i++ )
+        {
+            ASSERT_STREQ( strs[i], std::to_string( i ).c_str() );
+        }
+
+        ASSERT_EQ( allocate_and_copy_string_arena( arena, "" ), nullptr );
+        ASSERT_EQ( allocate_and_copy_string_arena( arena, NULL ), nullptr );
+        ASSERT_EQ( allocate_and_copy_string_arena( NULL, "a" ), nullptr );
+
+        arena_destroy( arena );
+    }
+
+    // Tests allocate_and_concat_string_arena -> Valid and invalid cases
+    TEST( allocate_and_concat_string_arena, valid_invalid_cases )
+    {
+        arena_t * arena = arena_create( 0 );
+        char * str;
+
+        ASSERT_NE( arena, nullptr );
+
+        str = allocate_and_concat_string_arena( arena, "hello ", "world" );
+        ASSERT_STREQ( str, "hello world" );
+        ASSERT_STREQ( allocate_and_concat_string_arena( arena, str, "!" ), "hello world!" );
+
+        ASSERT_EQ( allocate_and_concat_string_arena( arena, NULL, "a" ), nullptr );
+        ASSERT_EQ( allocate_and_concat_string_arena( arena, "a", NULL ), nullptr );
+        ASSERT_EQ( allocate_and_concat_string_arena( arena, "a", "" ), nullptr );
+        ASSERT_EQ( allocate_and_concat_string_arena( NULL, "a", "b" ), nullptr );
+
+        arena_destroy( arena );
+    }
+
+    // Tests allocate_and_copy_strview, allocate_and_concat_strview -> Valid and
+    // invalid cases
+    TEST( allocate_and_copy_strview, valid_invalid_cases )
+    {
+        const char * buf = "hello world";
+        char * str;
+
+        // Slices are copied without reading after their end
+        str = allocate_and_copy_strview( lu_strview( buf + 6, 3 ) );
+        ASSERT_STREQ( str, "wor" );
+        free( str );
+        str = allocate_and_copy_strview( lu_strview( NULL, 0 ) );
+        ASSERT_STREQ( str, "" );
+        free( str );
+        str = allocate_and_concat_strview( lu_strview( buf, 6 ), lu_strview( buf + 6, 5 ) );
+        ASSERT_STREQ( str, "hello world" );
+        free( str );
+        str = allocate_and_concat_strview( lu_strview( buf, 5 ), lu_strview( NULL, 0 ) );
+        ASSERT_STREQ( str, "hello" );
+        free( str );
+
+        ASSERT_EQ( allocate_and_copy_strview( lu_strview( NULL, 1 ) ), nullptr );
+        ASSERT_EQ( allocate_and_concat_strview( lu_strview( NULL, 1 ), lu_strview( buf, 1 ) ), nullptr );
+        ASSERT_EQ( allocate_and_concat_strview( lu_strview( buf, 1 ), lu_strview( NULL, 1 ) ), nullptr );
+    }
+
+    // Tests allocate_and_copy_strview_arena, allocate_and_concat_strview_arena
+    // -> Valid and invalid cases
+    TEST( allocate_and_copy_strview_arena, valid_invalid_cases )
+    {
+        arena_t * arena = arena_create( 0 );
+        const char * buf = "key=value";
+
+        ASSERT_NE( arena, nullptr );
+
+        ASSERT_STREQ( allocate_and_copy_strview_arena( arena, lu_strview( buf, 3 ) ), "key" );
+        ASSERT_STREQ( allocate_and_copy_strview_arena( arena, lu_strview( NULL, 0 ) ), "" );
+        ASSERT_STREQ( allocate_and_concat_strview_arena( arena, lu_strview( buf + 4, 5 ),
+                                                         lu_strview( buf + 3, 1 ) ), "value=" );
+
+        ASSERT_EQ( allocate_and_copy_strview_arena( NULL, lu_strview( buf, 3 ) ), nullptr );
+        ASSERT_EQ( allocate_and_copy_strview_arena( arena, lu_strview( NULL, 3 ) ), nullptr );
+        ASSERT_EQ( allocate_and_concat_strview_arena( NULL, lu_strview( buf, 1 ),
+                                                      lu_strview( buf, 1 ) ), nullptr );
+        ASSERT_EQ( allocate_and_concat_strview_arena( arena, lu_strview( buf, 1 ),
+                                                      lu_strview( NULL, 1 ) ), nullptr );
+
+        arena_destroy( arena );
+    }
+
+    // Tests string_builder_append_view, string_builder_view -> Valid and
+    // invalid cases
+    TEST( string_builder, views )
+    {
+        string_builder_t builder = STRING_BUILDER_INIT;
+        const char * buf = "abcdef";
+        lu_strview_t view;
+
+        view = string_builder_view( &builder );
+        ASSERT_EQ( view.len, 0u );
+
+        ASSERT_EQ( string_builder_append_view( &builder, lu_strview( NULL, 0 ) ), 0 );
+        ASSERT_STREQ( string_builder_get( &builder ), "" );
+        ASSERT_EQ( string_builder_append_view( &builder, lu_strview( buf + 1, 2 ) ), 0 );
+        ASSERT_EQ( string_builder_append_view( &builder, lu_strview( buf + 4, 2 ) ), 0 );
+        ASSERT_STREQ( string_builder_get( &builder ), "bcef" );
+
+        // Append a slice of builder itself
+        view = string_builder_view( &builder );
+        ASSERT_EQ( view.ptr, string_builder_get( &builder ) );
+        ASSERT_EQ( view.len, 4u );
+        ASSERT_EQ( string_builder_append_view( &builder, lu_strview_slice( view, 1, 2 ) ), 0 );
+        ASSERT_STREQ( string_builder_get( &builder ), "bcefce" );
+
+        ASSERT_EQ( string_builder_append_view( &builder, lu_strview( NULL, 1 ) ), -1 );
+        ASSERT_EQ( string_builder_append_view( NULL, lu_strview( buf, 1 ) ), -1 );
+        ASSERT_EQ( string_builder_view( NULL ).len, 0u );
+
+        string_builder_free( &builder );
+    }
+
+    // Tests string_builder -> Valid case
+    TEST( string_builder, valid_cases )
+    {
+        string_builder_t builder = STRING_BUILDER_INIT;
+        std::string expected;
+        char * str;
+
+        ASSERT_STREQ( string_builder_get( &builder ), "" );
+        ASSERT_EQ( string_builder_get_length( &builder ), 0u );
+
+        ASSERT_EQ( string_builder_append( &builder, "id=" ), 0 );
+        ASSERT_EQ( string_builder_append_uint32( &builder, 4294967295u ), 0 );
+        ASSERT_EQ( string_builder_append_char( &builder, ' ' ), 0 );
+        ASSERT_EQ( string_builder_append_int32( &builder, INT32_MIN ), 0 );
+        ASSERT_EQ( string_builder_append_char( &builder, ' ' ), 0 );
+        ASSERT_EQ( string_builder_append_hex32( &builder, 0xABCDu ), 0 );
+        ASSERT_EQ( string_builder_append_char( &builder, ' ' ), 0 );
+        ASSERT_EQ( string_builder_append_uint64( &builder, UINT64_MAX ), 0 );
+        ASSERT_EQ( string_builder_append_char( &builder, ' ' ), 0 );
+        ASSERT_EQ( string_builder_append_int64( &builder, INT64_MIN ), 0 );
+        ASSERT_EQ( string_builder_append_char( &builder, ' ' ), 0 );
+        ASSERT_EQ( string_builder_append_hex64( &builder, UINT64_MAX ), 0 );
+        ASSERT_EQ( string_builder_append_char( &builder, ' ' ), 0 );
+        ASSERT_EQ( string_builder_append_double( &builder, 0.1 ), 0 );
+        ASSERT_EQ( string_builder_append_n( &builder, " abc", 2 ), 0 );
+        ASSERT_EQ( string_builder_append( &builder, "" ), 0 );
+        expected = "id=4294967295 -2147483648 abcd 18446744073709551615 "
+                   "-9223372036854775808 ffffffffffffffff 0.1 a";
+        ASSERT_STREQ( string_builder_get( &builder ), expected.c_str() );
+        ASSERT_EQ( string_builder_get_length( &builder ), expected.size() );
+
+        // Append a part of builder itself
+        ASSERT_EQ( string_builder_append( &builder, string_builder_get( &builder ) ), 0 );
+        ASSERT_EQ( string_builder_get( &builder ), expected + expected );
+
+        string_builder_clear( &builder );
+        ASSERT_STREQ( string_builder_get( &builder ), "" );
+
+        // Large string with geometric growth
+        expected.clear();
+        for( int i = 0; i < 100000; i++ )
+        {
+            ASSERT_EQ( string_builder_append_int32( &builder, i ), 0 );
+            ASSERT_EQ( string_builder_append_char( &builder, ',' ), 0 );
+            expected += std::to_string( i ) + ",";
+        }
+        ASSERT_EQ( string_builder_get( &builder ), expected );
+
+        str = string_builder_detach( &builder );
+        ASSERT_EQ( str, expected );
+        ASSERT_STREQ( string_builder_get( &builder ), "" );
+        free( str );
+
+        // Detach without append
+        str = string_builder_detach( &builder );
+        ASSERT_STREQ( str, "" );
+        free( str );
+
+        string_builder_free( &builder );
+    }
+
+    // Tests string_builder -> Reserve
+    TEST( string_builder, reserve )
+    {
+        string_builder_t builder;
+        const char * data;
+
+        ASSERT_EQ( string_builder_init( &builder, 1000 ), 0 );
+        ASSERT_STREQ( string_builder_get( &builder ), "" );
+        data = string_builder_get( &builder );
+        for( int i = 0; i < 1000; i++ )
+        {
+            ASSERT_EQ( string_builder_append_char( &builder, 'a' ), 0 );
+        }
+        // No reallocation
+        ASSERT_EQ( string_builder_get( &builder ), data );
+
+        ASSERT_EQ( string_builder_reserve( &builder, 10 ), 0 );
+        data = string_builder_get( &builder );
+        ASSERT_EQ( string_builder_append( &builder, "0123456789" ), 0 );
+        ASSERT_EQ( string_builder_get( &builder ), data );
+        ASSERT_EQ( string_builder_get_length( &builder ), 1010u );
+
+        string_builder_free( &builder );
+        string_builder_free( NULL );
+    }
+
+    // Tests string_builder -> Invalid case
+    TEST( string_builder, invalid_cases )
+    {
+        string_builder_t builder = STRING_BUILDER_INIT;
+
+        ASSERT_EQ( string_builder_append( &builder, "abc" ), 0 );
+        ASSERT_EQ( string_builder_reserve( &builder, SIZE_MAX ), -1 );
+        ASSERT_EQ( string_builder_reserve( &builder, SIZE_MAX - 3 ), -1 );
+        ASSERT_EQ( string_builder_append( &builder, NULL ), -1 );
+        ASSERT_EQ( string_builder_append_n( &builder, NULL, 1 ), -1 );
+        ASSERT_STREQ( string_builder_get( &builder ), "abc" );
+
+        ASSERT_EQ( string_builder_init( NULL, 0 ), -1 );
+        ASSERT_EQ( string_builder_append( NULL, "a" ), -1 );
+        ASSERT_EQ( string_builder_append_char( NULL, 'a' ), -1 );
+        ASSERT_EQ( string_builder_append_uint32( NULL, 1 ), -1 );
+        ASSERT_EQ( string_builder_append_double( NULL, 1 ), -1 );
+        ASSERT_EQ( string_builder_get( NULL ), nullptr );
+        ASSERT_EQ( string_builder_get_length( NULL ), 0u );
+        ASSERT_EQ( string_builder_detach( NULL ), nullptr );
+
+        string_builder_free( &builder );
+    }
+
+    // Collect all tokens of split iterator
+    std::vector<std::string> split_all( string_split_t * split )
+    {
+        std::vector<std::string> tokens;
+        const char * token;
+        size_t len;
+
+        while( 0 == string_split_next( split, &token, &len ) )
+        {
+            tokens.push_back( std::string( token, len ) );
+        }
+
+        return tokens;
+    }
+
+    // Reference split on any of delims (no quotes)
+    std::vector<std::string> ref_split( const std::string & str,
+                                        const std::string & delims,
+                                        bool skip_empty )
+    {
+        std::vector<std::string> tokens;
+        size_t start = 0;
+        size_t pos;
+
+        while( true )
+        {
+            pos = str.find_first_of( delims, start );
+            std::string token = str.substr( start, ( std::string::npos == pos ) ? std::string::npos :
+                                                                                  pos - start );
+            if( ! skip_empty || ! token.empty() )
+            {
+                tokens.push_back( token );
+            }
+            if( std::string::npos == pos )
+            {
+                return tokens;
+            }
+            start = pos + 1;
+        }
+    }
+
+    // Tests string_split -> Valid case
+    TEST( string_split, valid_cases )
+    {
+        string_split_t split;
+        const char * csv = "10,,20,30,";
+        const char * lines = "a\r\nbb\r\n\r\nccc";
+        const char * words = "  hello \t world\n";
+        std::vector<std::string> expected;
+
+        // Single byte delimiter
+        ASSERT_EQ( string_split_init( &split, csv, strlen( csv ), ',', 0 ), 0 );
+        expected = { "10", "", "20", "30", "" };
+        ASSERT_EQ( split_all( &split ), expected );
+        ASSERT_EQ( string_split_init( &split, csv, strlen( csv ), ',', STRING_SPLIT_SKIP_EMPTY ), 0 );
+        expected = { "10", "20", "30" };
+        ASSERT_EQ( split_all( &split ), expected );
+
+        // Buffer is not NUL terminated
+        ASSERT_EQ( string_split_init( &split, csv, 5, ',', 0 ), 0 );
+        expected = { "10", "", "2" };
+        ASSERT_EQ( split_all( &split ), expected );
+
+        // Empty buffer
+        ASSERT_EQ( string_split_init( &split, csv, 0, ',', 0 ), 0 );
+        expected = { "" };
+        ASSERT_EQ( split_all( &split ), expected );
+        ASSERT_EQ( string_split_init( &split, csv, 0, ',', STRING_SPLIT_SKIP_EMPTY ), 0 );
+        ASSERT_TRUE( split_all( &split ).empty() );
+
+        // Multi byte delimiter
+        ASSERT_EQ( string_split_init_string( &split, lines, strlen( lines ), "\r\n", 2, 0 ), 0 );
+        expected = { "a", "bb", "", "ccc" };
+        ASSERT_EQ( split_all( &split ), expected );
+
+        // Any of delimiters
+        ASSERT_EQ( string_split_init_any( &split, words, strlen( words ), " \t\n", 3,
+                                          STRING_SPLIT_SKIP_EMPTY ), 0 );
+        expected = { "hello", "world" };
+        ASSERT_EQ( split_all( &split ), expected );
+        ASSERT_EQ( string_split_init_any( &split, words, strlen( words ), " \t\n", 3, 0 ), 0 );
+        ASSERT_EQ( split_all( &split ).size(), 7u );
+
+        // Iterator stays at end
+        const char * token;
+        size_t len;
+        ASSERT_EQ( string_split_next( &split, &token, &len ), -1 );
+    }
+
+    // Tests string_split_next_view -> Valid and invalid cases
+    TEST( string_split, views )
+    {
+        string_split_t split;
+        lu_strview_t line = LU_STRVIEW_LITERAL( " key = value " );
+        lu_strview_t token;
+
+        ASSERT_EQ( string_split_init( &split, line.ptr, line.len, '=', 0 ), 0 );
+        ASSERT_EQ( string_split_next_view( &split, &token ), 0 );
+        ASSERT_TRUE( lu_strview_equals( lu_strview_trim( token ), lu_strview_from_cstr( "key" ) ) );
+        ASSERT_EQ( string_split_next_view( &split, &token ), 0 );
+        ASSERT_EQ( token.ptr, line.ptr + 6 );
+        ASSERT_TRUE( lu_strview_equals( lu_strview_trim( token ), lu_strview_from_cstr( "value" ) ) );
+        ASSERT_EQ( string_split_next_view( &split, &token ), -1 );
+
+        ASSERT_EQ( string_split_next_view( &split, NULL ), -1 );
+        ASSERT_EQ( string_split_next_view( NULL, &token ), -1 );
+    }
+
+    // Tests string_split -> Quotes
+    TEST( string_split, quotes )
+    {
+        string_split_t split;
+        const char * csv = "a,\"b,c\",\"\",x\"y,z\"w,\"unclosed,end";
+        const char * args = "--name \"John Smith\"  -v";
+        std::vector<std::string> expected;
+
+        ASSERT_EQ( string_split_init( &split, csv, strlen( csv ), ',', STRING_SPLIT_QUOTES ), 0 );
+        expected = { "a", "b,c", "", "x\"y,z\"w", "\"unclosed,end" };
+        ASSERT_EQ( split_all( &split ), expected );
+
+        ASSERT_EQ( string_split_init( &split, csv, strlen( csv ), ',', 0 ), 0 );
+        ASSERT_EQ( split_all( &split ).size(), 8u );
+
+        ASSERT_EQ( string_split_init_any( &split, args, strlen( args ), " \t", 2,
+                                          STRING_SPLIT_QUOTES | STRING_SPLIT_SKIP_EMPTY ), 0 );
+        expected = { "--name", "John Smith", "-v" };
+        ASSERT_EQ( split_all( &split ), expected );
+
+        ASSERT_EQ( string_split_init_string( &split, "a::\"b::c\"::d", 12, "::", 2,
+                                             STRING_SPLIT_QUOTES ), 0 );
+        expected = { "a", "b::c", "d" };
+        ASSERT_EQ( split_all( &split ), expected );
+    }
+
+    // Tests string_split -> Same tokens as reference implementation
+    TEST( string_split, fuzz )
+    {
+        std::mt19937 gen( 42 );
+        string_split_t split;
+
+        for( size_t iter = 0; iter < 5000; iter++ )
+        {
+            size_t len = gen() % ( ( iter % 10 ) ? 64 : 2000 );
+            std::string str( len, 'a' );
+            bool skip_empty = gen() % 2;
+            unsigned int flags = skip_empty ? STRING_SPLIT_SKIP_EMPTY : 0;
+
+            for( char & c : str )
+            {
+                c = ",; ab"[gen() % 5];
+            }
+
+            ASSERT_EQ( string_split_init( &split, str.data(), len, ',', flags ), 0 );
+            ASSERT_EQ( split_all( &split ), ref_split( str, ",", skip_empty ) ) << str;
+            ASSERT_EQ( string_split_init_any( &split, str.data(), len, ",; ", 3, flags ), 0 );
+            ASSERT_EQ( split_all( &split ), ref_split( str, ",; ", skip_empty ) ) << str;
+        }
+    }
+
+    // Tests string_split -> Invalid case
+    TEST( string_split, invalid_cases )
+    {
+        string_split_t split;
+        const char * token;
+        size_t len;
+
+        ASSERT_EQ( string_split_init( NULL, "a", 1, ',', 0 ), -1 );
+        ASSERT_EQ( string_split_init( &split, NULL, 1, ',', 0 ), -1 );
+        ASSERT_EQ( string_split_init_string( &split, "a", 1, NULL, 1, 0 ), -1 );
+        ASSERT_EQ( string_split_init_string( &split, "a", 1, "", 0, 0 ), -1 );
+        ASSERT_EQ( string_split_init_any( &split, "a", 1, NULL, 1, 0 ), -1 );
+        ASSERT_EQ( string_split_init_any( &split, "a", 1, ",", 0, 0 ), -1 );
+
+        ASSERT_EQ( string_split_init( &split, "a", 1, ',', 0 ), 0 );
+        ASSERT_EQ( string_split_next( NULL, &token, &len ), -1 );
+        ASSERT_EQ( string_split_next( &split, NULL, &len ), -1 );
+        ASSERT_EQ( string_split_next( &split, &token, NULL ), -1 );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
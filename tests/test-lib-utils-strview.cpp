@@ -0,0 +1,149 @@
+/*!
+ * @file: test-lib-utils-strview.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for string view helpers.
+ */
+#include <gtest/gtest.h>
+
+#include <string>
+
+extern "C"
+{
+    #include "lib-utils-strview.h"
+}
+
+namespace
+{
+    // Convert view to std::string for comparisons
+    std::string to_string( lu_strview_t view )
+    {
+        return std::string( view.ptr ? view.ptr : "", view.len );
+    }
+
+    // Tests lu_strview, lu_strview_from_cstr, LU_STRVIEW_LITERAL
+    TEST( strview, build )
+    {
+        const char * str = "hello world";
+        lu_strview_t literal = LU_STRVIEW_LITERAL( "a\0b" );
+        lu_strview_t view = lu_strview_from_cstr( str );
+        char buf[32];
+
+        ASSERT_EQ( view.ptr, str );
+        ASSERT_EQ( view.len, 11u );
+        ASSERT_EQ( literal.len, 3u );
+
+        view = lu_strview( str + 6, 5 );
+        ASSERT_EQ( to_string( view ), "world" );
+        snprintf( buf, sizeof( buf ), "[" LU_STRVIEW_FMT "]", LU_STRVIEW_ARG( view ) );
+        ASSERT_STREQ( buf, "[world]" );
+
+        view = lu_strview_from_cstr( NULL );
+        ASSERT_EQ( view.ptr, nullptr );
+        ASSERT_EQ( view.len, 0u );
+    }
+
+    // Tests lu_strview_compare, lu_strview_equals
+    TEST( strview, compare )
+    {
+        lu_strview_t empty = lu_strview( NULL, 0 );
+        lu_strview_t abc = LU_STRVIEW_LITERAL( "abc" );
+        lu_strview_t ab = LU_STRVIEW_LITERAL( "ab" );
+        lu_strview_t abd = LU_STRVIEW_LITERAL( "abd" );
+        lu_strview_t high = LU_STRVIEW_LITERAL( "\xff" );
+
+        ASSERT_EQ( lu_strview_compare( abc, abc ), 0 );
+        ASSERT_LT( lu_strview_compare( ab, abc ), 0 );
+        ASSERT_GT( lu_strview_compare( abc, ab ), 0 );
+        ASSERT_LT( lu_strview_compare( abc, abd ), 0 );
+        ASSERT_LT( lu_strview_compare( abc, high ), 0 );
+        ASSERT_EQ( lu_strview_compare( empty, lu_strview( "", 0 ) ), 0 );
+        ASSERT_LT( lu_strview_compare( empty, ab ), 0 );
+
+        ASSERT_EQ( lu_strview_equals( abc, lu_strview( "abcdef", 3 ) ), 1 );
+        ASSERT_EQ( lu_strview_equals( abc, ab ), 0 );
+        ASSERT_EQ( lu_strview_equals( abc, abd ), 0 );
+        ASSERT_EQ( lu_strview_equals( empty, empty ), 1 );
+    }
+
+    // Tests lu_strview_starts_with, lu_strview_ends_with
+    TEST( strview, prefix_suffix )
+    {
+        lu_strview_t empty = lu_strview( NULL, 0 );
+        lu_strview_t view = LU_STRVIEW_LITERAL( "--option=value" );
+
+        ASSERT_EQ( lu_strview_starts_with( view, lu_strview_from_cstr( "--" ) ), 1 );
+        ASSERT_EQ( lu_strview_starts_with( view, lu_strview_from_cstr( "-o" ) ), 0 );
+        ASSERT_EQ( lu_strview_starts_with( view, empty ), 1 );
+        ASSERT_EQ( lu_strview_starts_with( empty, view ), 0 );
+        ASSERT_EQ( lu_strview_ends_with( view, lu_strview_from_cstr( "value" ) ), 1 );
+        ASSERT_EQ( lu_strview_ends_with( view, lu_strview_from_cstr( "valu" ) ), 0 );
+        ASSERT_EQ( lu_strview_ends_with( view, empty ), 1 );
+        ASSERT_EQ( lu_strview_ends_with( lu_strview( "e", 1 ), view ), 0 );
+    }
+
+    // Tests lu_strview_find, lu_strview_find_char
+    TEST( strview, find )
+    {
+        lu_strview_t empty = lu_strview( NULL, 0 );
+        lu_strview_t view = LU_STRVIEW_LITERAL( "key=value=other" );
+
+        ASSERT_EQ( lu_strview_find_char( view, '=' ), 3u );
+        ASSERT_EQ( lu_strview_find_char( view, '#' ), LU_STRVIEW_NPOS );
+        ASSERT_EQ( lu_strview_find_char( empty, '=' ), LU_STRVIEW_NPOS );
+        ASSERT_EQ( lu_strview_find( view, lu_strview_from_cstr( "value" ) ), 4u );
+        ASSERT_EQ( lu_strview_find( view, lu_strview_from_cstr( "other" ) ), 10u );
+        ASSERT_EQ( lu_strview_find( view, lu_strview_from_cstr( "others" ) ), LU_STRVIEW_NPOS );
+        ASSERT_EQ( lu_strview_find( view, lu_strview_from_cstr( "x" ) ), LU_STRVIEW_NPOS );
+        ASSERT_EQ( lu_strview_find( view, empty ), 0u );
+        ASSERT_EQ( lu_strview_find( empty, empty ), 0u );
+        ASSERT_EQ( lu_strview_find( empty, view ), LU_STRVIEW_NPOS );
+
+        // Bytes after end of view are not searched
+        ASSERT_EQ( lu_strview_find_char( lu_strview_slice( view, 0, 3 ), '=' ), LU_STRVIEW_NPOS );
+        ASSERT_EQ( lu_strview_find( lu_strview_slice( view, 0, 8 ), lu_strview_from_cstr( "value" ) ),
+                   LU_STRVIEW_NPOS );
+    }
+
+    // Tests lu_strview_slice
+    TEST( strview, slice )
+    {
+        lu_strview_t view = LU_STRVIEW_LITERAL( "0123456789" );
+        lu_strview_t slice;
+
+        slice = lu_strview_slice( view, 2, 3 );
+        ASSERT_EQ( slice.ptr, view.ptr + 2 );
+        ASSERT_EQ( to_string( slice ), "234" );
+        ASSERT_EQ( to_string( lu_strview_slice( view, 7, LU_STRVIEW_NPOS ) ), "789" );
+        ASSERT_EQ( to_string( lu_strview_slice( view, 8, 100 ) ), "89" );
+        ASSERT_EQ( to_string( lu_strview_slice( view, 0, 0 ) ), "" );
+
+        slice = lu_strview_slice( view, 42, 3 );
+        ASSERT_EQ( slice.ptr, view.ptr + 10 );
+        ASSERT_EQ( slice.len, 0u );
+
+        slice = lu_strview_slice( lu_strview( NULL, 0 ), 1, 1 );
+        ASSERT_EQ( slice.ptr, nullptr );
+        ASSERT_EQ( slice.len, 0u );
+    }
+
+    // Tests lu_strview_trim, lu_strview_trim_left, lu_strview_trim_right
+    TEST( strview, trim )
+    {
+        lu_strview_t view = LU_STRVIEW_LITERAL( " \t\r\n a b \v\f " );
+
+        ASSERT_EQ( to_string( lu_strview_trim( view ) ), "a b" );
+        ASSERT_EQ( to_string( lu_strview_trim_left( view ) ), "a b \v\f " );
+        ASSERT_EQ( to_string( lu_strview_trim_right( view ) ), " \t\r\n a b" );
+        ASSERT_EQ( lu_strview_trim( view ).ptr, view.ptr + 5 );
+        ASSERT_EQ( lu_strview_trim( lu_strview_from_cstr( "   " ) ).len, 0u );
+        ASSERT_EQ( lu_strview_trim( lu_strview( NULL, 0 ) ).len, 0u );
+        ASSERT_EQ( to_string( lu_strview_trim( lu_strview_from_cstr( "x" ) ) ), "x" );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
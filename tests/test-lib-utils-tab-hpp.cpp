@@ -0,0 +1,90 @@
+/*!
+ * @file: test-lib-utils-tab-hpp.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for C++ growable array template.
+ */
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <utility>
+
+#include "lib-utils-tab.hpp"
+
+namespace
+{
+    // Tests lib_utils::tab -> Valid case
+    TEST( tab_hpp, valid_cases )
+    {
+        lib_utils::tab<uint64_t> tab;
+        uint64_t values[] = { 5, 3, 4 };
+
+        ASSERT_TRUE( tab.empty() );
+        for( uint64_t i = 0; i < 10000; i++ )
+        {
+            ASSERT_TRUE( tab.push_back( i ) );
+        }
+        ASSERT_EQ( tab.size(), 10000u );
+        ASSERT_EQ( std::accumulate( tab.begin(), tab.end(), uint64_t( 0 ) ), 49995000u );
+
+        ASSERT_TRUE( tab.shrink_to_fit() );
+        ASSERT_EQ( tab.capacity(), 10000u );
+        ASSERT_TRUE( tab.append( values, 3 ) );
+        ASSERT_TRUE( tab.append( nullptr, 0 ) );
+        ASSERT_EQ( tab[10001], 3u );
+
+        // Sort with default and custom comparison
+        tab.sort( std::greater<uint64_t>() );
+        ASSERT_EQ( tab[0], 9999u );
+        ASSERT_EQ( tab[tab.size() - 1], 0u );
+        tab.sort();
+        ASSERT_EQ( tab[0], 0u );
+        ASSERT_EQ( tab[4], 3u );
+
+        ASSERT_TRUE( tab.resize( 2 ) );
+        ASSERT_TRUE( tab.resize( 4 ) );
+        ASSERT_EQ( tab[1], 1u );
+        ASSERT_EQ( tab[3], 0u );
+
+        uint64_t * slots = tab.extend( 2 );
+        ASSERT_NE( slots, nullptr );
+        slots[1] = 42;
+        ASSERT_EQ( tab.size(), 6u );
+        ASSERT_EQ( tab[5], 42u );
+
+        // Move keeps elements
+        lib_utils::tab<uint64_t> moved( std::move( tab ) );
+        ASSERT_EQ( moved.size(), 6u );
+        ASSERT_EQ( tab.size(), 0u );
+        ASSERT_EQ( tab.data(), nullptr );
+        tab = std::move( moved );
+        ASSERT_EQ( tab[5], 42u );
+
+        tab.clear();
+        ASSERT_TRUE( tab.empty() );
+        ASSERT_TRUE( tab.reserve( 100 ) );
+        ASSERT_GE( tab.capacity(), 100u );
+    }
+
+    // Tests lib_utils::tab -> Invalid case
+    TEST( tab_hpp, invalid_cases )
+    {
+        lib_utils::tab<uint32_t> tab;
+
+        ASSERT_TRUE( tab.push_back( 1 ) );
+        ASSERT_FALSE( tab.append( nullptr, 3 ) );
+        ASSERT_FALSE( tab.reserve( SIZE_MAX / 2 ) );
+        ASSERT_EQ( tab.extend( SIZE_MAX ), nullptr );
+        ASSERT_FALSE( tab.resize( SIZE_MAX / 4 + 1 ) );
+        ASSERT_EQ( tab.size(), 1u );
+        ASSERT_EQ( tab[0], 1u );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,200 @@
+/*!
+ * @file: test-lib-utils-tab.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for growable array macros.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+extern "C"
+{
+    #include "lib-utils-parse-number.h"
+    #include "lib-utils-tab.h"
+}
+
+namespace
+{
+    struct point_t
+    {
+        int32_t x;
+        int32_t y;
+    };
+
+    #define LESS( a, b )        ( ( a ) < ( b ) )
+    #define POINT_LESS( a, b )  ( ( ( a ).x < ( b ).x ) || \
+                                  ( ( ( a ).x == ( b ).x ) && ( ( a ).y < ( b ).y ) ) )
+
+    TAB_DEFINE( uint32_tab, uint32_t )
+    TAB_DEFINE_SORT( uint32_tab, uint32_t, LESS )
+    TAB_DEFINE( double_tab, double )
+    TAB_DEFINE( point_tab, point_t )
+    TAB_DEFINE_SORT( point_tab, point_t, POINT_LESS )
+
+    // Tests GET_NB_ELEMENTS -> Valid case
+    TEST( tab, get_nb_elements )
+    {
+        int tab[7];
+        point_t points[3];
+
+        ASSERT_EQ( GET_NB_ELEMENTS( tab ), 7u );
+        ASSERT_EQ( GET_NB_ELEMENTS( points ), 3u );
+    }
+
+    // Tests TAB_DEFINE -> Valid case
+    TEST( tab, valid_cases )
+    {
+        uint32_tab_t tab = TAB_INIT;
+        uint32_t values[] = { 7, 8, 9 };
+        uint32_t * slots;
+
+        // Amortized push
+        for( uint32_t i = 0; i < 100000; i++ )
+        {
+            ASSERT_EQ( uint32_tab_push( &tab, i ), 0 );
+        }
+        ASSERT_EQ( tab.size, 100000u );
+        ASSERT_GE( tab.capacity, tab.size );
+        ASSERT_LT( tab.capacity, 2 * tab.size );
+        for( uint32_t i = 0; i < 100000; i++ )
+        {
+            ASSERT_EQ( tab.data[i], i );
+        }
+
+        // Shrink to fit, bulk append and resize
+        ASSERT_EQ( uint32_tab_shrink_to_fit( &tab ), 0 );
+        ASSERT_EQ( tab.capacity, 100000u );
+        ASSERT_EQ( uint32_tab_append( &tab, values, 3 ), 0 );
+        ASSERT_EQ( uint32_tab_append( &tab, NULL, 0 ), 0 );
+        ASSERT_EQ( tab.size, 100003u );
+        ASSERT_EQ( tab.data[100002], 9u );
+        ASSERT_EQ( uint32_tab_resize( &tab, 2 ), 0 );
+        ASSERT_EQ( tab.size, 2u );
+        ASSERT_EQ( uint32_tab_resize( &tab, 5 ), 0 );
+        ASSERT_EQ( tab.data[1], 1u );
+        ASSERT_EQ( tab.data[4], 0u );
+
+        // Reserve is exact and never shrinks
+        uint32_tab_clear( &tab );
+        ASSERT_EQ( tab.size, 0u );
+        ASSERT_EQ( uint32_tab_shrink_to_fit( &tab ), 0 );
+        ASSERT_EQ( tab.data, nullptr );
+        ASSERT_EQ( uint32_tab_reserve( &tab, 1000 ), 0 );
+        ASSERT_EQ( tab.capacity, 1000u );
+        ASSERT_EQ( uint32_tab_reserve( &tab, 10 ), 0 );
+        ASSERT_EQ( tab.capacity, 1000u );
+
+        // Bulk parser writes in extended memory
+        const char * buf = "10,20,30,40";
+        size_t consumed;
+        slots = uint32_tab_extend( &tab, 16 );
+        ASSERT_NE( slots, nullptr );
+        size_t nb = parse_uint32_array( buf, strlen( buf ), ',', slots, 16, &consumed );
+        ASSERT_EQ( uint32_tab_resize( &tab, tab.size - 16 + nb ), 0 );
+        ASSERT_EQ( tab.size, 4u );
+        ASSERT_EQ( tab.data[3], 40u );
+        ASSERT_EQ( tab.capacity, 1000u );
+
+        uint32_tab_free( &tab );
+        ASSERT_EQ( tab.data, nullptr );
+        ASSERT_EQ( tab.capacity, 0u );
+
+        double_tab_t doubles;
+        double_tab_init( &doubles );
+        ASSERT_EQ( double_tab_push( &doubles, 1.5 ), 0 );
+        ASSERT_EQ( double_tab_resize( &doubles, 3 ), 0 );
+        ASSERT_EQ( doubles.data[0], 1.5 );
+        ASSERT_EQ( doubles.data[2], 0.0 );
+        double_tab_free( &doubles );
+    }
+
+    // Tests TAB_DEFINE_SORT -> Same order as std::sort
+    TEST( tab, sort )
+    {
+        std::mt19937 gen( 42 );
+        uint32_tab_t tab = TAB_INIT;
+        point_tab_t points = TAB_INIT;
+
+        for( size_t n : { 0, 1, 2, 3, 16, 17, 100, 1000, 100000 } )
+        {
+            for( int kind = 0; kind < 5; kind++ )
+            {
+                std::vector<uint32_t> expected( n );
+
+                for( size_t i = 0; i < n; i++ )
+                {
+                    switch( kind )
+                    {
+                        case 0: expected[i] = gen(); break;             // random
+                        case 1: expected[i] = gen() % 4; break;         // duplicates
+                        case 2: expected[i] = (uint32_t)i; break;       // sorted
+                        case 3: expected[i] = (uint32_t)( n - i ); break; // reversed
+                        default: expected[i] = ( i % 2 ) ? (uint32_t)i : (uint32_t)( n - i ); break;
+                    }
+                }
+
+                uint32_tab_clear( &tab );
+                ASSERT_EQ( uint32_tab_append( &tab, expected.data(), n ), 0 );
+                uint32_tab_sort( &tab );
+                std::sort( expected.begin(), expected.end() );
+                ASSERT_TRUE( std::equal( expected.begin(), expected.end(), tab.data ) );
+            }
+        }
+
+        for( int i = 0; i < 1000; i++ )
+        {
+            ASSERT_EQ( point_tab_push( &points, point_t{ (int32_t)( gen() % 10 ), (int32_t)gen() } ), 0 );
+        }
+        point_tab_sort( &points );
+        for( size_t i = 1; i < points.size; i++ )
+        {
+            ASSERT_FALSE( POINT_LESS( points.data[i], points.data[i - 1] ) );
+        }
+
+        uint32_tab_free( &tab );
+        point_tab_free( &points );
+    }
+
+    // Tests TAB_DEFINE -> Invalid case
+    TEST( tab, invalid_cases )
+    {
+        uint32_tab_t tab = TAB_INIT;
+        uint32_t value = 1;
+
+        uint32_tab_init( NULL );
+        uint32_tab_free( NULL );
+        uint32_tab_clear( NULL );
+        uint32_tab_sort( NULL );
+        ASSERT_EQ( uint32_tab_push( NULL, 1 ), -1 );
+        ASSERT_EQ( uint32_tab_append( NULL, &value, 1 ), -1 );
+        ASSERT_EQ( uint32_tab_append( &tab, NULL, 3 ), -1 );
+        ASSERT_EQ( uint32_tab_reserve( NULL, 3 ), -1 );
+        ASSERT_EQ( uint32_tab_resize( NULL, 3 ), -1 );
+        ASSERT_EQ( uint32_tab_shrink_to_fit( NULL ), -1 );
+        ASSERT_EQ( uint32_tab_extend( NULL, 3 ), nullptr );
+
+        // Too large: array is unchanged
+        ASSERT_EQ( uint32_tab_push( &tab, 1 ), 0 );
+        ASSERT_EQ( uint32_tab_reserve( &tab, SIZE_MAX / 2 ), -1 );
+        ASSERT_EQ( uint32_tab_extend( &tab, SIZE_MAX ), nullptr );
+        ASSERT_EQ( uint32_tab_resize( &tab, SIZE_MAX / 4 + 1 ), -1 );
+        ASSERT_EQ( tab.size, 1u );
+        ASSERT_EQ( tab.data[0], 1u );
+
+        ASSERT_EQ( tab_grow( NULL, &tab.capacity, 4, 10 ), -1 );
+        ASSERT_EQ( tab_set_capacity( (void **)&tab.data, NULL, 4, 10 ), -1 );
+        ASSERT_EQ( tab_set_capacity( (void **)&tab.data, &tab.capacity, 0, 10 ), -1 );
+
+        uint32_tab_free( &tab );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,445 @@
+/*!
+ * @file: test-lib-utils-utf8.cpp
+ * @date: 2026-10-17
+ * @author: Sebastien CORBEAU (corbeau.sebastien@yahoo.fr)
+ * @brief: Implementation of unit test for UTF-8 functions (checked against a
+ *         reference decoder with every instruction set supported by CPU).
+ */
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C"
+{
+    #include "lib-utils-utf8.h"
+}
+
+namespace
+{
+    const utf8_isa_t ISAS[] = { UTF8_ISA_SCALAR, UTF8_ISA_SSSE3, UTF8_ISA_AVX2 };
+
+    // Reference decoder: decode sequence by its lead byte then reject
+    // overlong forms, surrogates and values above U+10FFFF. Return length of
+    // sequence or 0 if invalid.
+    size_t ref_decode( const std::string & str, size_t pos, uint32_t & cp )
+    {
+        static const uint32_t MIN_VALUE[] = { 0, 0, 0x80, 0x800, 0x10000 };
+        uint8_t c = (uint8_t)str[pos];
+        size_t n = ( c < 0x80 ) ? 1 : ( c >> 5 ) == 6 ? 2 : ( c >> 4 ) == 14 ? 3 :
+                   ( c >> 3 ) == 30 ? 4 : 0;
+
+        if( ( 0 == n ) || ( pos + n > str.size() ) )
+        {
+            return 0;
+        }
+
+        cp = ( n == 1 ) ? c : c & ( 0x7F >> n );
+        for( size_t k = 1; k < n; k++ )
+        {
+            if( ( (uint8_t)str[pos + k] & 0xC0 ) != 0x80 )
+            {
+                return 0;
+            }
+            cp = ( cp << 6 ) | ( (uint8_t)str[pos + k] & 0x3F );
+        }
+
+        if( ( cp < MIN_VALUE[n] ) || ( cp > 0x10FFFF ) || ( ( cp >= 0xD800 ) && ( cp <= 0xDFFF ) ) )
+        {
+            return 0;
+        }
+
+        return n;
+    }
+
+    // Reference validation: offset of first invalid sequence or npos
+    size_t ref_validate( const std::string & str )
+    {
+        uint32_t cp;
+        size_t pos = 0;
+
+        while( pos < str.size() )
+        {
+            size_t n = ref_decode( str, pos, cp );
+
+            if( 0 == n )
+            {
+                return pos;
+            }
+            pos += n;
+        }
+
+        return std::string::npos;
+    }
+
+    // Encode code point in UTF-8 (no check)
+    std::string encode( uint32_t cp )
+    {
+        std::string str;
+
+        if( cp < 0x80 )
+        {
+            str += (char)cp;
+        }
+        else if( cp < 0x800 )
+        {
+            str += (char)( 0xC0 | ( cp >> 6 ) );
+            str += (char)( 0x80 | ( cp & 0x3F ) );
+        }
+        else if( cp < 0x10000 )
+        {
+            str += (char)( 0xE0 | ( cp >> 12 ) );
+            str += (char)( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+            str += (char)( 0x80 | ( cp & 0x3F ) );
+        }
+        else
+        {
+            str += (char)( 0xF0 | ( cp >> 18 ) );
+            str += (char)( 0x80 | ( ( cp >> 12 ) & 0x3F ) );
+            str += (char)( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+            str += (char)( 0x80 | ( cp & 0x3F ) );
+        }
+
+        return str;
+    }
+
+    // Random valid UTF-8 text: ASCII runs mixed with 2, 3 and 4 bytes code
+    // points
+    std::string random_text( std::mt19937 & gen, size_t nb_code_points )
+    {
+        std::string str;
+
+        for( size_t i = 0; i < nb_code_points; i++ )
+        {
+            uint32_t r = gen() % 8;
+            uint32_t cp;
+
+            if( r < 4 )
+            {
+                cp = gen() % 0x80;
+            }
+            else if( r < 5 )
+            {
+                cp = 0x80 + gen() % ( 0x800 - 0x80 );
+            }
+            else if( r < 7 )
+            {
+                cp = 0x800 + gen() % ( 0x10000 - 0x800 - 0x800 );
+                cp += ( cp >= 0xD800 ) ? 0x800 : 0;
+            }
+            else
+            {
+                cp = 0x10000 + gen() % ( 0x110000 - 0x10000 );
+            }
+            str += encode( cp );
+        }
+
+        return str;
+    }
+
+    // Check utf8_validate result and error offset against reference
+    void check_validate( const std::string & str, utf8_isa_t isa )
+    {
+        size_t expected = ref_validate( str );
+        size_t offset = 12345;
+        int ret = utf8_validate( str.data(), str.size(), &offset );
+
+        if( std::string::npos == expected )
+        {
+            ASSERT_EQ( ret, 0 ) << isa;
+            ASSERT_EQ( offset, 12345u ) << isa;
+        }
+        else
+        {
+            ASSERT_EQ( ret, -1 ) << isa;
+            ASSERT_EQ( offset, expected ) << isa;
+        }
+    }
+
+    // Tests utf8_set_isa -> Valid case
+    TEST( utf8, isa )
+    {
+        utf8_isa_t isa = utf8_get_isa();
+
+        ASSERT_EQ( utf8_set_isa( UTF8_ISA_SCALAR ), 0 );
+        ASSERT_EQ( utf8_get_isa(), UTF8_ISA_SCALAR );
+        ASSERT_EQ( utf8_set_isa( (utf8_isa_t)42 ), -1 );
+        ASSERT_EQ( utf8_get_isa(), UTF8_ISA_SCALAR );
+        ASSERT_EQ( utf8_set_isa( isa ), 0 );
+    }
+
+    // Tests utf8_validate -> Every 1 and 2 bytes sequence, every 3 bytes
+    // sequence with a multi byte lead, at every position of a block
+    TEST( utf8, validate_exhaustive )
+    {
+        utf8_isa_t default_isa = utf8_get_isa();
+
+        for( utf8_isa_t isa : ISAS )
+        {
+            if( 0 != utf8_set_isa( isa ) )
+            {
+                continue;
+            }
+
+            for( unsigned int b1 = 0; b1 < 256; b1++ )
+            {
+                for( unsigned int b2 = 0; b2 < 256; b2++ )
+                {
+                    std::string str( 64, 'a' );
+
+                    str[30] = (char)b1;
+                    str[31] = (char)b2;
+                    check_validate( str, isa );
+                    check_validate( str.substr( 30, 2 ), isa );
+
+                    if( b1 >= 0xE0 && b1 <= 0xF4 )
+                    {
+                        for( unsigned int b3 = 0x70; b3 < 0xD0; b3++ )
+                        {
+                            str[32] = (char)b3;
+                            str[33] = ( b1 >= 0xF0 ) ? (char)0x80 : 'a';
+                            check_validate( str, isa );
+                        }
+                    }
+                }
+            }
+
+            // 4 bytes sequence crossing block boundaries
+            for( size_t pos = 0; pos < 70; pos++ )
+            {
+                std::string str( 70, 'a' );
+
+                str.replace( pos, 4, "\xf0\x9f\x98\x80" );
+                str.resize( 70 );
+                check_validate( str, isa );
+            }
+        }
+        ASSERT_EQ( utf8_set_isa( default_isa ), 0 );
+    }
+
+    // Tests utf8_validate -> Random texts with random corruptions
+    TEST( utf8, validate_fuzz )
+    {
+        utf8_isa_t default_isa = utf8_get_isa();
+        std::mt19937 gen( 42 );
+
+        for( utf8_isa_t isa : ISAS )
+        {
+            if( 0 != utf8_set_isa( isa ) )
+            {
+                continue;
+            }
+
+            for( size_t iter = 0; iter < 5000; iter++ )
+            {
+                std::string str = random_text( gen, ( iter < 200 ) ? iter : gen() % 1000 );
+                size_t nb_errors = ( iter % 3 ) ? gen() % 3 : 0;
+
+                for( size_t k = 0; ( k < nb_errors ) && ! str.empty(); k++ )
+                {
+                    size_t pos = gen() % str.size();
+
+                    switch( gen() % 3 )
+                    {
+                        case 0:
+                            str[pos] = (char)( gen() % 256 );
+                        break;
+                        case 1:
+                            str.erase( pos, 1 );
+                        break;
+                        default:
+                            str.insert( pos, 1, (char)( 0x80 + gen() % 0x80 ) );
+                        break;
+                    }
+                }
+
+                // Exact size copy so sanitizer reports reads after the end
+                std::unique_ptr<char[]> copy( new char[str.size() + 1] );
+                size_t expected = ref_validate( str );
+                size_t offset = 0;
+
+                memcpy( copy.get(), str.data(), str.size() );
+                ASSERT_EQ( utf8_validate( copy.get(), str.size(), &offset ),
+                           ( std::string::npos == expected ) ? 0 : -1 ) << isa;
+                if( std::string::npos != expected )
+                {
+                    ASSERT_EQ( offset, expected ) << isa;
+                }
+            }
+        }
+        ASSERT_EQ( utf8_set_isa( default_isa ), 0 );
+    }
+
+    // Tests utf8_count_code_points, length functions and round trips
+    TEST( utf8, transcode_fuzz )
+    {
+        utf8_isa_t default_isa = utf8_get_isa();
+        std::mt19937 gen( 43 );
+
+        for( utf8_isa_t isa : ISAS )
+        {
+            if( 0 != utf8_set_isa( isa ) )
+            {
+                continue;
+            }
+
+            for( size_t iter = 0; iter < 2000; iter++ )
+            {
+                std::string str = ( iter % 4 ) ? random_text( gen, gen() % ( 20 * 1000 / ( iter % 64 + 1 ) ) ) :
+                                                 std::string( gen() % 10000, 'x' );
+                std::vector<uint32_t> ref32;
+                std::vector<uint16_t> ref16;
+                uint32_t cp;
+                size_t nb;
+
+                for( size_t pos = 0; pos < str.size(); )
+                {
+                    pos += ref_decode( str, pos, cp );
+                    ref32.push_back( cp );
+                    if( cp >= 0x10000 )
+                    {
+                        ref16.push_back( (uint16_t)( 0xD800 + ( ( cp - 0x10000 ) >> 10 ) ) );
+                        ref16.push_back( (uint16_t)( 0xDC00 + ( ( cp - 0x10000 ) & 0x3FF ) ) );
+                    }
+                    else
+                    {
+                        ref16.push_back( (uint16_t)cp );
+                    }
+                }
+
+                ASSERT_EQ( utf8_count_code_points( str.data(), str.size() ), ref32.size() ) << isa;
+                ASSERT_EQ( utf8_utf16_length( str.data(), str.size() ), ref16.size() ) << isa;
+                ASSERT_EQ( utf16_utf8_length( ref16.data(), ref16.size() ), str.size() ) << isa;
+                ASSERT_EQ( utf32_utf8_length( ref32.data(), ref32.size() ), str.size() ) << isa;
+
+                // UTF-8 -> UTF-16 -> UTF-8
+                std::vector<uint16_t> out16( ref16.size() + 1 );
+                std::string back( str.size(), '\0' );
+
+                ASSERT_EQ( utf8_to_utf16( str.data(), str.size(), out16.data(), ref16.size(), &nb ), 0 ) << isa;
+                ASSERT_EQ( nb, ref16.size() );
+                out16.resize( nb );
+                ASSERT_EQ( out16, ref16 ) << isa;
+                ASSERT_EQ( utf16_to_utf8( out16.data(), out16.size(), &back[0], back.size(), &nb ), 0 ) << isa;
+                ASSERT_EQ( nb, str.size() );
+                ASSERT_EQ( back, str ) << isa;
+
+                // UTF-8 -> UTF-32 -> UTF-8
+                std::vector<uint32_t> out32( ref32.size() + 1 );
+
+                ASSERT_EQ( utf8_to_utf32( str.data(), str.size(), out32.data(), ref32.size(), &nb ), 0 ) << isa;
+                ASSERT_EQ( nb, ref32.size() );
+                out32.resize( nb );
+                ASSERT_EQ( out32, ref32 ) << isa;
+                back.assign( str.size(), '\0' );
+                ASSERT_EQ( utf32_to_utf8( out32.data(), out32.size(), &back[0], back.size(), &nb ), 0 ) << isa;
+                ASSERT_EQ( nb, str.size() );
+                ASSERT_EQ( back, str ) << isa;
+
+                // Output one element too small
+                if( ! str.empty() )
+                {
+                    ASSERT_EQ( utf8_to_utf16( str.data(), str.size(), out16.data(), out16.size() - 1, &nb ), -1 ) << isa;
+                    ASSERT_EQ( utf8_to_utf32( str.data(), str.size(), out32.data(), out32.size() - 1, &nb ), -1 ) << isa;
+                    ASSERT_EQ( utf16_to_utf8( out16.data(), out16.size(), &back[0], back.size() - 1, &nb ), -1 ) << isa;
+                    ASSERT_EQ( utf32_to_utf8( out32.data(), out32.size(), &back[0], back.size() - 1, &nb ), -1 ) << isa;
+                }
+            }
+        }
+        ASSERT_EQ( utf8_set_isa( default_isa ), 0 );
+    }
+
+    // Tests UTF-8 functions -> Valid cases
+    TEST( utf8, valid_cases )
+    {
+        const char * str = "a\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80";
+        uint16_t out16[8];
+        uint32_t out32[8];
+        char out8[16];
+        size_t nb = 42;
+
+        ASSERT_EQ( utf8_validate( str, strlen( str ), NULL ), 0 );
+        ASSERT_EQ( utf8_validate( "", 0, NULL ), 0 );
+        ASSERT_EQ( utf8_validate( "a\0b", 3, NULL ), 0 );
+        ASSERT_EQ( utf8_count_code_points( str, strlen( str ) ), 4u );
+        ASSERT_EQ( utf8_utf16_length( str, strlen( str ) ), 5u );
+
+        ASSERT_EQ( utf8_to_utf32( str, strlen( str ), out32, 8, &nb ), 0 );
+        ASSERT_EQ( nb, 4u );
+        ASSERT_EQ( out32[0], 0x61u );
+        ASSERT_EQ( out32[1], 0xE9u );
+        ASSERT_EQ( out32[2], 0x20ACu );
+        ASSERT_EQ( out32[3], 0x1F600u );
+
+        ASSERT_EQ( utf8_to_utf16( str, strlen( str ), out16, 8, &nb ), 0 );
+        ASSERT_EQ( nb, 5u );
+        ASSERT_EQ( out16[3], 0xD83D );
+        ASSERT_EQ( out16[4], 0xDE00 );
+
+        ASSERT_EQ( utf32_to_utf8( out32, 4, out8, sizeof( out8 ), &nb ), 0 );
+        ASSERT_EQ( std::string( out8, nb ), str );
+
+        ASSERT_EQ( utf8_to_utf16( "", 0, out16, 0, &nb ), 0 );
+        ASSERT_EQ( nb, 0u );
+    }
+
+    // Tests UTF-8 functions -> Invalid cases
+    TEST( utf8, invalid_cases )
+    {
+        const uint16_t lone_high[] = { 'a', 0xD800, 'b' };
+        const uint16_t lone_low[] = { 0xDC00 };
+        const uint16_t truncated[] = { 'a', 0xDBFF };
+        const uint32_t surrogate[] = { 0xDFFF };
+        const uint32_t too_large[] = { 0x110000 };
+        uint16_t out16[8];
+        uint32_t out32[8];
+        char out8[16];
+        size_t offset = 0;
+        size_t nb = 42;
+
+        // Overlong, surrogate, too large, truncated and continuation only
+        ASSERT_EQ( utf8_validate( "ab\xc0\x80", 4, &offset ), -1 );
+        ASSERT_EQ( offset, 2u );
+        ASSERT_EQ( utf8_validate( "\xe0\x80\x80", 3, &offset ), -1 );
+        ASSERT_EQ( offset, 0u );
+        ASSERT_EQ( utf8_validate( "a\xed\xa0\x80", 4, &offset ), -1 );
+        ASSERT_EQ( offset, 1u );
+        ASSERT_EQ( utf8_validate( "\xf4\x90\x80\x80", 4, &offset ), -1 );
+        ASSERT_EQ( utf8_validate( "abc\xe2\x82", 5, &offset ), -1 );
+        ASSERT_EQ( offset, 3u );
+        ASSERT_EQ( utf8_validate( "\x80", 1, &offset ), -1 );
+        ASSERT_EQ( utf8_validate( "\xff", 1, &offset ), -1 );
+
+        // Transcoders reject invalid input and do not update nb_out
+        ASSERT_EQ( utf8_to_utf16( "\xc3", 1, out16, 8, &nb ), -1 );
+        ASSERT_EQ( utf8_to_utf32( "a\xed\xa0\x80", 4, out32, 8, &nb ), -1 );
+        ASSERT_EQ( utf16_to_utf8( lone_high, 3, out8, 16, &nb ), -1 );
+        ASSERT_EQ( utf16_to_utf8( lone_low, 1, out8, 16, &nb ), -1 );
+        ASSERT_EQ( utf16_to_utf8( truncated, 2, out8, 16, &nb ), -1 );
+        ASSERT_EQ( utf32_to_utf8( surrogate, 1, out8, 16, &nb ), -1 );
+        ASSERT_EQ( utf32_to_utf8( too_large, 1, out8, 16, &nb ), -1 );
+        ASSERT_EQ( nb, 42u );
+
+        // NULL pointers
+        ASSERT_EQ( utf8_validate( NULL, 1, &offset ), -1 );
+        ASSERT_EQ( utf8_count_code_points( NULL, 1 ), 0u );
+        ASSERT_EQ( utf8_utf16_length( NULL, 1 ), 0u );
+        ASSERT_EQ( utf16_utf8_length( NULL, 1 ), 0u );
+        ASSERT_EQ( utf32_utf8_length( NULL, 1 ), 0u );
+        ASSERT_EQ( utf8_to_utf16( NULL, 1, out16, 8, &nb ), -1 );
+        ASSERT_EQ( utf8_to_utf16( "a", 1, NULL, 8, &nb ), -1 );
+        ASSERT_EQ( utf8_to_utf16( "a", 1, out16, 8, NULL ), -1 );
+        ASSERT_EQ( utf8_to_utf32( NULL, 1, out32, 8, &nb ), -1 );
+        ASSERT_EQ( utf16_to_utf8( NULL, 1, out8, 16, &nb ), -1 );
+        ASSERT_EQ( utf32_to_utf8( NULL, 1, out8, 16, &nb ), -1 );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}